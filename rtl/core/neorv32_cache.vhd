@@ -38,7 +38,9 @@ entity neorv32_cache is
     host_req_i : in  bus_req_t;  -- host request
     host_rsp_o : out bus_rsp_t;  -- host response
     bus_req_o  : out bus_req_t;  -- bus request
-    bus_rsp_i  : in  bus_rsp_t   -- bus response
+    bus_rsp_i  : in  bus_rsp_t;  -- bus response
+    hit_o      : out std_ulogic; -- cache hit (performance monitor event)
+    miss_o     : out std_ulogic  -- cache miss (performance monitor event)
   );
 end neorv32_cache;
 
@@ -118,6 +120,9 @@ architecture neorv32_cache_rtl of neorv32_cache is
   signal tag_reg : std_ulogic_vector(tag_width_c-1 downto 0);
   signal tag_rd : std_ulogic_vector(31 downto 0);
 
+  -- performance monitor events --
+  signal retry : std_ulogic;
+
 begin
 
   -- Control Engine FSM Sync ----------------------------------------------------------------
@@ -317,6 +322,26 @@ begin
   end process ctrl_engine_comb;
 
 
+  -- Performance Monitor Events -------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- the re-check after a block download is neither a hit nor a new miss --
+  retry_flag: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      retry <= '0';
+    elsif rising_edge(clk_i) then
+      if (ctrl.state = S_DELAY) then
+        retry <= '1';
+      elsif (ctrl.state = S_CHECK) then
+        retry <= '0';
+      end if;
+    end if;
+  end process retry_flag;
+
+  hit_o  <= '1' when (ctrl.state = S_CHECK) and (ctrl.buf_dir = '0') and (cache_i.hit = '1') and (retry = '0') else '0';
+  miss_o <= '1' when (ctrl.state = S_CHECK) and (ctrl.buf_dir = '0') and (cache_i.hit = '0') else '0';
+
+
   -- Cache Bypass (Direct Access) Response Buffer -------------------------------------------
   -- -------------------------------------------------------------------------------------------
   response_buf: process(rstn_i, clk_i)
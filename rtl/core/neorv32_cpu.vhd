@@ -87,6 +87,8 @@ entity neorv32_cpu is
     mti_i      : in  std_ulogic;                     -- RISC-V machine timer interrupt
     firq_i     : in  std_ulogic_vector(15 downto 0); -- custom fast interrupts
     dbi_i      : in  std_ulogic;                     -- RISC-V debug halt request interrupt
+    -- SoC performance monitor events --
+    hpm_i      : in  std_ulogic_vector(19 downto 14) := (others => '0'); -- cache/bus/DMA events for the HPM counters
     -- instruction bus interface --
     ibus_req_o : out bus_req_t;                      -- request bus
     ibus_rsp_i : in  bus_rsp_t;                      -- response bus
@@ -134,6 +136,7 @@ architecture neorv32_cpu_rtl of neorv32_cpu is
   signal lsu_wait    : std_ulogic;                     -- wait for current data bus access
   signal csr_rdata   : std_ulogic_vector(31 downto 0); -- CSR read data
   signal irq_machine : std_ulogic_vector(2 downto 0);  -- RISC-V standard machine-level interrupts
+  signal irq_lcof    : std_ulogic;                     -- local counter overflow interrupt
 
   -- external CSR interface read-back --
   signal xcsr_tm, xcsr_cnt, xcsr_pmp, xcsr_alu, xcsr_res : std_ulogic_vector(31 downto 0);
@@ -300,6 +303,7 @@ begin
     irq_dbg_i     => dbi_i,       -- debug mode (halt) request
     irq_machine_i => irq_machine, -- RISC-V interrupts
     irq_fast_i    => firq_i,      -- fast interrupts
+    irq_lcof_i    => irq_lcof,    -- local counter overflow interrupt
     -- load/store unit interface --
     lsu_wait_i    => lsu_wait,    -- wait for data bus
     lsu_mar_i     => lsu_mar,     -- memory address register
@@ -363,14 +367,18 @@ begin
       clk_i   => clk_i,   -- global clock, rising edge
       rstn_i  => rstn_i,  -- global reset, low-active, async
       ctrl_i  => ctrl,    -- main control bus
+      hpm_i   => hpm_i,   -- SoC counter events
       -- read back --
-      rdata_o => xcsr_cnt -- read data
+      rdata_o => xcsr_cnt, -- read data
+      -- interrupt --
+      irq_o   => irq_lcof  -- local counter overflow interrupt
     );
   end generate;
 
   cnts_disabled:
   if not (RISCV_ISA_Zicntr or RISCV_ISA_Zihpm) generate
     xcsr_cnt <= (others => '0');
+    irq_lcof <= '0';
   end generate;
 
 
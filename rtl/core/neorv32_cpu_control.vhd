@@ -81,6 +81,7 @@ entity neorv32_cpu_control is
     irq_dbg_i     : in  std_ulogic;                     -- debug mode (halt) request
     irq_machine_i : in  std_ulogic_vector(2 downto 0);  -- RISC-V interrupt
     irq_fast_i    : in  std_ulogic_vector(15 downto 0); -- fast interrupts
+    irq_lcof_i    : in  std_ulogic;                     -- local counter overflow interrupt
     -- load/store unit interface --
     lsu_wait_i    : in  std_ulogic;                     -- wait for data bus
     lsu_mar_i     : in  std_ulogic_vector(31 downto 0); -- memory address register
@@ -135,6 +136,7 @@ architecture neorv32_cpu_control_rtl of neorv32_cpu_control is
     mie_mei      : std_ulogic; -- machine external interrupt enable
     mie_mti      : std_ulogic; -- machine timer interrupt enable
     mie_firq     : std_ulogic_vector(15 downto 0); -- fast interrupt enable
+    mie_lcof     : std_ulogic; -- local counter overflow interrupt enable
     mepc         : std_ulogic_vector(31 downto 0); -- machine exception PC
     mcause       : std_ulogic_vector(5 downto 0);  -- machine trap cause
     mtvec        : std_ulogic_vector(31 downto 0); -- machine trap-handler base address
@@ -164,7 +166,8 @@ architecture neorv32_cpu_control_rtl of neorv32_cpu_control is
   signal monitor_cnt  : std_ulogic_vector(alu_cp_tmo_c downto 0); -- execution monitor cycle counter
   signal csr_valid    : std_ulogic_vector(2 downto 0); -- CSR access: [2] implemented, [1] r/w access, [0] privilege
   signal illegal_cmd  : std_ulogic; -- illegal instruction check
-  signal cnt_event    : std_ulogic_vector(10 downto 0); -- counter events
+  signal cnt_event    : std_ulogic_vector(13 downto 0); -- counter events
+  signal cnt_restart  : std_ulogic; -- fetch restart pending (dispatch wait after control flow transfer)
   signal ebreak_trig  : std_ulogic; -- environment break exception trigger
   signal trap_env     : std_ulogic_vector(6 downto 0); -- environment call cause-value helper
 
@@ -541,6 +544,23 @@ begin
   cnt_event(cnt_event_load_c)     <= '1' when (ctrl.lsu_req = '1') and (ctrl.lsu_rd = '1')               else '0'; -- executed load operation
   cnt_event(cnt_event_store_c)    <= '1' when (ctrl.lsu_req = '1') and (ctrl.lsu_wr = '1')               else '0'; -- executed store operation
   cnt_event(cnt_event_wait_lsu_c) <= '1' when (ctrl.lsu_req = '0') and (exec.state = S_MEM_RSP)          else '0'; -- load/store memory wait
+  cnt_event(cnt_event_trap_c)     <= '1' when (trap.env_enter = '1') and (trap.cause(5) = '0')            else '0'; -- trap entry (no debug-mode)
+  cnt_event(cnt_event_irq_c)      <= '1' when (trap.env_enter = '1') and (trap.cause(6 downto 5) = "10")  else '0'; -- interrupt entry
+  cnt_event(cnt_event_restart_c)  <= '1' when (cnt_restart = '1') and (exec.state = S_DISPATCH) and (frontend_i.valid = '0') else '0'; -- restart wait
+
+  -- dispatch wait cycles after a fetch restart (subset of the dispatch wait cycles) --
+  cnt_restart_flag: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      cnt_restart <= '0';
+    elsif rising_edge(clk_i) then
+      if (ctrl.if_reset = '1') then
+        cnt_restart <= '1';
+      elsif (frontend_i.valid = '1') then
+        cnt_restart <= '0';
+      end if;
+    end if;
+  end process cnt_restart_flag;
 
 
   -- ****************************************************************************************************************************
@@ -588,7 +608,10 @@ begin
            csr_mhpmcounter13h_c | csr_mhpmcounter14h_c | csr_mhpmcounter15h_c | -- machine counters HIGH
            csr_mhpmevent3_c     | csr_mhpmevent4_c     | csr_mhpmevent5_c     | csr_mhpmevent6_c     | csr_mhpmevent7_c     |
            csr_mhpmevent8_c     | csr_mhpmevent9_c     | csr_mhpmevent10_c    | csr_mhpmevent11_c    | csr_mhpmevent12_c    |
-           csr_mhpmevent13_c    | csr_mhpmevent14_c    | csr_mhpmevent15_c => -- machine event configuration
+           csr_mhpmevent13_c    | csr_mhpmevent14_c    | csr_mhpmevent15_c    | -- machine event configuration LOW
+           csr_mhpmevent3h_c    | csr_mhpmevent4h_c    | csr_mhpmevent5h_c    | csr_mhpmevent6h_c    | csr_mhpmevent7h_c    |
+           csr_mhpmevent8h_c    | csr_mhpmevent9h_c    | csr_mhpmevent10h_c   | csr_mhpmevent11h_c   | csr_mhpmevent12h_c   |
+           csr_mhpmevent13h_c   | csr_mhpmevent14h_c   | csr_mhpmevent15h_c => -- machine event configuration HIGH (overflow and filter)
         csr_valid(2) <= bool_to_ulogic_f(RISCV_ISA_Zihpm);
 
       -- counter and timer CSRs --
@@ -764,7 +787,7 @@ begin
       trap.exc_buf <= (others => '0');
     elsif rising_edge(clk_i) then
       -- interrupt pending: synchronize requests --
-      trap.irq_pnd <= '0' & irq_fast_i & irq_machine_i;
+      trap.irq_pnd <= '0' & irq_lcof_i & irq_fast_i & irq_machine_i;
       -- interrupt buffer: local feedback to ensure requests stay active until trap environment has started --
       trap.irq_buf(irq_db_halt_c) <= debug_ctrl.trig_halt                          or (trap.env_pend and trap.irq_buf(irq_db_halt_c));
       trap.irq_buf(irq_msi_irq_c) <= (trap.irq_pnd(irq_msi_irq_c) and csr.mie_msi) or (trap.env_pend and trap.irq_buf(irq_msi_irq_c));
@@ -773,6 +796,7 @@ begin
       for i in 0 to 15 loop
         trap.irq_buf(irq_firq_0_c+i) <= (trap.irq_pnd(irq_firq_0_c+i) and csr.mie_firq(i)) or (trap.env_pend and trap.irq_buf(irq_firq_0_c+i));
       end loop;
+      trap.irq_buf(irq_lcof_c) <= (trap.irq_pnd(irq_lcof_c) and csr.mie_lcof) or (trap.env_pend and trap.irq_buf(irq_lcof_c));
       -- exception buffer: accumulate exception requests; clear all requests at once when trap environment starts --
       trap.exc_buf(exc_iaccess_c) <= (trap.exc_buf(exc_iaccess_c) or trap.instr_be)         and (not trap.env_enter);
       trap.exc_buf(exc_illegal_c) <= (trap.exc_buf(exc_illegal_c) or trap.instr_il)         and (not trap.env_enter);
@@ -815,7 +839,7 @@ begin
   -- any system interrupt? --
   trap.irq_fire(0) <= '1' when
     ((exec.state = S_EXECUTE) or (exec.state = S_SLEEP)) and -- trigger system IRQ only in S_EXECUTE state or in sleep mode
-    (or_reduce_f(trap.irq_buf(irq_firq_15_c downto irq_msi_irq_c)) = '1') and -- pending system IRQ
+    (or_reduce_f(trap.irq_buf(irq_lcof_c downto irq_msi_irq_c)) = '1') and -- pending system IRQ
     ((csr.mstatus_mie = '1') or (csr.prv_level = priv_mode_u_c)) and -- IRQ only when in M-mode and MIE=1 OR when in U-mode
     (debug_ctrl.run = '0') and (csr.dcsr_step = '0') else '0'; -- no system IRQs when in debug-mode / during single-stepping
 
@@ -861,7 +885,8 @@ begin
     -- standard RISC-V interrupts --
     trap_mei_c     when (trap.irq_buf(irq_mei_irq_c) = '1') else -- machine external interrupt (MEI)
     trap_msi_c     when (trap.irq_buf(irq_msi_irq_c) = '1') else -- machine software interrupt (MSI)
-    trap_mti_c;  --when (trap.irq_buf(irq_mti_irq_c) = '1') else -- machine timer interrupt (MTI)
+    trap_mti_c     when (trap.irq_buf(irq_mti_irq_c) = '1') else -- machine timer interrupt (MTI)
+    trap_lcof_c;   --when (trap.irq_buf(irq_lcof_c) = '1') else -- local counter overflow interrupt (LCOFI)
 
   -- environment call helper --
   trap_env <= trap_env_c(6 downto 2) & csr.prv_level & csr.prv_level;
@@ -965,6 +990,7 @@ begin
       csr.mie_mei      <= '0';
       csr.mie_mti      <= '0';
       csr.mie_firq     <= (others => '0');
+      csr.mie_lcof     <= '0';
       csr.mtvec        <= (others => '0');
       csr.mscratch     <= (others => '0');
       csr.mepc         <= (others => '0');
@@ -999,6 +1025,7 @@ begin
             csr.mie_mti  <= csr_wdata(7);
             csr.mie_mei  <= csr_wdata(11);
             csr.mie_firq <= csr_wdata(31 downto 16);
+            csr.mie_lcof <= csr_wdata(13) and bool_to_ulogic_f(RISCV_ISA_Zihpm);
 
           when csr_mtvec_c => -- machine trap-handler base address
             csr.mtvec <= csr_wdata(31 downto 2) & '0' & csr_wdata(0); -- base + mode (vectored/direct)
@@ -1154,6 +1181,7 @@ begin
             csr_rdata(3)  <= csr.mie_msi;
             csr_rdata(7)  <= csr.mie_mti;
             csr_rdata(11) <= csr.mie_mei;
+            csr_rdata(13) <= csr.mie_lcof;
             csr_rdata(31 downto 16) <= csr.mie_firq;
 
           when csr_mtvec_c => -- machine trap-handler base address
@@ -1184,6 +1212,7 @@ begin
             csr_rdata(3)  <= trap.irq_pnd(irq_msi_irq_c);
             csr_rdata(7)  <= trap.irq_pnd(irq_mti_irq_c);
             csr_rdata(11) <= trap.irq_pnd(irq_mei_irq_c);
+            csr_rdata(13) <= trap.irq_pnd(irq_lcof_c);
             csr_rdata(31 downto 16) <= trap.irq_pnd(irq_firq_15_c downto irq_firq_0_c);
 
           when csr_mtinst_c => -- machine trap instruction
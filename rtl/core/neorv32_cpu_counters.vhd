@@ -5,6 +5,7 @@
 -- + Zicntr:    Base Counters           -> [m]cycle[h]         + [m]instret[h]      --
 -- + Zihpm:     Hardware Perf. Monitors -> [m]hpmcnt[3..15][h] + mhpmevent[3..15]   --
 -- + Smcntrpmf: Counter Priv. Filtering -> mcyclecfg[h]        + minstretcfg[h]     --
+-- + Sscofpmf:  Count Overflow Filter   -> mhpmevent[3..15]h   + LCOFI (M-mode)     --
 -- -------------------------------------------------------------------------------- --
 -- The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              --
 -- Copyright (c) NEORV32 contributors.                                              --
@@ -34,8 +35,11 @@ entity neorv32_cpu_counters is
     clk_i   : in  std_ulogic; -- global clock, rising edge
     rstn_i  : in  std_ulogic; -- global reset, low-active, async
     ctrl_i  : in  ctrl_bus_t; -- main control bus
+    hpm_i   : in  std_ulogic_vector(19 downto 14); -- SoC counter events
     -- read back --
-    rdata_o : out std_ulogic_vector(31 downto 0) -- read data
+    rdata_o : out std_ulogic_vector(31 downto 0); -- read data
+    -- interrupt --
+    irq_o   : out std_ulogic -- local counter overflow interrupt
   );
 end neorv32_cpu_counters;
 
@@ -44,15 +48,19 @@ architecture neorv32_cpu_counters_rtl of neorv32_cpu_counters is
   -- global access decoder --
   type cnt_we_t is array (0 to 15) of std_ulogic_vector(1 downto 0);
   signal cnt_we : cnt_we_t;
-  signal cnt_acc, cfg_acc, inh_acc, pmf_acc : std_ulogic;
-  signal sel, cnt_re, cfg_we, cfg_re : std_ulogic_vector(15 downto 0);
+  signal cnt_acc, cfg_acc, cfgh_acc, inh_acc, pmf_acc : std_ulogic;
+  signal sel, cnt_re, cfg_we, cfg_re, cfgh_we, cfgh_re : std_ulogic_vector(15 downto 0);
 
   -- counter increment control --
   signal inhibit, cnt_inc : std_ulogic_vector(15 downto 0);
   signal pmf_cy, pmf_ir, pmf_inh : std_ulogic_vector(1 downto 0);
+  signal hpm_event : std_ulogic_vector(19 downto 0);
+
+  -- HPM overflow and privilege-mode filtering (mhpmevent*h) --
+  signal hpm_of, hpm_minh, hpm_uinh, hpm_inh, hpm_ovf : std_ulogic_vector(15 downto 3);
 
   -- HPM read-backs --
-  type hpmevent_t is array (3 to 15) of std_ulogic_vector(10 downto 0);
+  type hpmevent_t is array (3 to 15) of std_ulogic_vector(19 downto 0);
   type hpmcnt_t   is array (3 to 15) of std_ulogic_vector(63 downto 0);
   signal hpmevent, hpmevent_rd : hpmevent_t;
   signal hpmcnt_rd : hpmcnt_t;
@@ -72,6 +80,8 @@ begin
     cnt_re(i)    <= cnt_acc and sel(i) and ctrl_i.csr_re;
     cfg_we(i)    <= cfg_acc and sel(i) and ctrl_i.csr_we;
     cfg_re(i)    <= cfg_acc and sel(i) and ctrl_i.csr_re;
+    cfgh_we(i)   <= cfgh_acc and sel(i) and ctrl_i.csr_we;
+    cfgh_re(i)   <= cfgh_acc and sel(i) and ctrl_i.csr_re;
   end generate;
 
   -- CSR access --
@@ -79,9 +89,10 @@ begin
                                      (ctrl_i.csr_addr(11 downto 5) = csr_mcycle_c(11 downto 5)) or
                                      (ctrl_i.csr_addr(11 downto 5) = csr_cycleh_c(11 downto 5)) or
                                      (ctrl_i.csr_addr(11 downto 5) = csr_mcycleh_c(11 downto 5))) else '0';
-  cfg_acc <= '1' when ZIHPM_EN and (ctrl_i.csr_addr(11 downto 5) = csr_mhpmevent3_c(11 downto 5)) else '0';
-  inh_acc <= '1' when (ctrl_i.csr_addr = csr_mcountinhibit_c) else '0';
-  pmf_acc <= '1' when SMCNTRPMF_EN and (ctrl_i.csr_addr(11 downto 2) = csr_minstretcfgh_c(11 downto 2)) else '0';
+  cfg_acc  <= '1' when ZIHPM_EN and (ctrl_i.csr_addr(11 downto 5) = csr_mhpmevent3_c(11 downto 5)) else '0';
+  cfgh_acc <= '1' when ZIHPM_EN and (ctrl_i.csr_addr(11 downto 5) = csr_mhpmevent3h_c(11 downto 5)) else '0';
+  inh_acc  <= '1' when (ctrl_i.csr_addr = csr_mcountinhibit_c) else '0';
+  pmf_acc  <= '1' when SMCNTRPMF_EN and ((ctrl_i.csr_addr = csr_mcyclecfgh_c) or (ctrl_i.csr_addr = csr_minstretcfgh_c)) else '0';
 
   -- global CSR read-back and subword select --
   rdata64 <= cycle_rd or time_rd or instret_rd or hpm_rd or inhibit_rd or pmf_rd;
@@ -181,10 +192,11 @@ begin
   cnt_inc(0) <= ctrl_i.cnt_event(cnt_event_cy_c) and (not ctrl_i.cpu_debug) and (not inhibit(0)) and (not pmf_inh(0));
   cnt_inc(1) <= '0'; -- undefined
   cnt_inc(2) <= ctrl_i.cnt_event(cnt_event_ir_c) and (not ctrl_i.cpu_debug) and (not inhibit(2)) and (not pmf_inh(1));
-  -- NEORV32-specific HPM events --
+  -- NEORV32-specific HPM events (CPU-internal and SoC events) --
+  hpm_event <= hpm_i & ctrl_i.cnt_event;
   event_gen:
   for i in 3 to 15 generate
-    cnt_inc(i) <= or_reduce_f(ctrl_i.cnt_event and hpmevent(i)) and (not ctrl_i.cpu_debug) and (not inhibit(i));
+    cnt_inc(i) <= or_reduce_f(hpm_event and hpmevent(i)) and (not ctrl_i.cpu_debug) and (not inhibit(i)) and (not hpm_inh(i));
   end generate;
 
 
@@ -257,7 +269,8 @@ begin
         we_i   => cnt_we(i),
         data_i => ctrl_i.csr_wdata,
         oe_i   => cnt_re(i),
-        cnt_o  => hpmcnt_rd(i)
+        cnt_o  => hpmcnt_rd(i),
+        ovf_o  => hpm_ovf(i)
       );
 
       -- mhpmevent[3..15] --
@@ -267,13 +280,34 @@ begin
           hpmevent(i) <= (others => '0');
         elsif rising_edge(clk_i) then
           if (cfg_we(i) = '1') then
-            hpmevent(i) <= ctrl_i.csr_wdata(10 downto 0);
+            hpmevent(i) <= ctrl_i.csr_wdata(19 downto 0);
           end if;
           hpmevent(i)(cnt_event_tm_c) <= '0'; -- time: not available
         end if;
       end process hpmevent_reg;
       hpmevent_rd(i) <= hpmevent(i) when (cfg_re(i) = '1') else (others => '0');
 
+      -- mhpmevent[3..15]h: overflow flag and privilege-mode filtering --
+      hpmeventh_reg: process(rstn_i, clk_i)
+      begin
+        if (rstn_i = '0') then
+          hpm_of(i)   <= '0';
+          hpm_minh(i) <= '0';
+          hpm_uinh(i) <= '0';
+        elsif rising_edge(clk_i) then
+          if (cfgh_we(i) = '1') then
+            hpm_of(i)   <= ctrl_i.csr_wdata(31);
+            hpm_minh(i) <= ctrl_i.csr_wdata(30);
+            hpm_uinh(i) <= ctrl_i.csr_wdata(28) and bool_to_ulogic_f(UMODE_EN);
+          elsif (hpm_ovf(i) = '1') then -- sticky until cleared by software
+            hpm_of(i) <= '1';
+          end if;
+        end if;
+      end process hpmeventh_reg;
+
+      -- counter-inhibit according to current privilege-mode --
+      hpm_inh(i) <= hpm_minh(i) when (ctrl_i.cpu_priv = priv_mode_m_c) or (UMODE_EN = false) else hpm_uinh(i);
+
     end generate;
 
     -- terminate unused HPM slices --
@@ -282,19 +316,32 @@ begin
       hpmcnt_rd(i)   <= (others => '0');
       hpmevent(i)    <= (others => '0');
       hpmevent_rd(i) <= (others => '0');
+      hpm_ovf(i)     <= '0';
+      hpm_of(i)      <= '0';
+      hpm_minh(i)    <= '0';
+      hpm_uinh(i)    <= '0';
+      hpm_inh(i)     <= '0';
     end generate;
 
     -- read-back --
-    hpm_read_back: process(hpmcnt_rd, hpmevent_rd)
+    hpm_read_back: process(hpmcnt_rd, hpmevent_rd, cfgh_re, hpm_of, hpm_minh, hpm_uinh)
       variable tmp_v : std_ulogic_vector(63 downto 0);
     begin
       tmp_v := (others => '0');
       for i in 3 to 15 loop
         tmp_v := tmp_v or hpmcnt_rd(i) or std_ulogic_vector(resize(unsigned(hpmevent_rd(i)), 64));
+        if (cfgh_re(i) = '1') then -- mhpmevent*h
+          tmp_v(31) := hpm_of(i);
+          tmp_v(30) := hpm_minh(i);
+          tmp_v(28) := hpm_uinh(i);
+        end if;
       end loop;
       hpm_rd <= tmp_v;
     end process hpm_read_back;
 
+    -- local counter overflow interrupt: pending as long as any overflow flag is set --
+    irq_o <= or_reduce_f(hpm_of);
+
   end generate;
 
   -- HPMs disabled --
@@ -304,6 +351,12 @@ begin
     hpmevent    <= (others => (others => '0'));
     hpmevent_rd <= (others => (others => '0'));
     hpm_rd      <= (others => '0');
+    hpm_ovf     <= (others => '0');
+    hpm_of      <= (others => '0');
+    hpm_minh    <= (others => '0');
+    hpm_uinh    <= (others => '0');
+    hpm_inh     <= (others => '0');
+    irq_o       <= '0';
   end generate;
 
 end neorv32_cpu_counters_rtl;
@@ -3,7 +3,7 @@
 -- -------------------------------------------------------------------------------- --
 -- The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              --
 -- Copyright (c) NEORV32 contributors.                                              --
--- Copyright (c) 2020 - 2025 Stephan Nolting. All rights reserved.                  --
+-- Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  --
 -- Licensed under the BSD-3-Clause license, see LICENSE for details.                --
 -- SPDX-License-Identifier: BSD-3-Clause                                            --
 -- ================================================================================ --
@@ -26,6 +26,7 @@ entity neorv32_dma is
     bus_rsp_o : out bus_rsp_t;  -- bus response
     dma_req_o : out bus_req_t;  -- DMA request
     dma_rsp_i : in  bus_rsp_t;  -- DMA response
+    dreq_i    : in  std_ulogic_vector(3 downto 0); -- peripheral DMA requests (flow control)
     irq_o     : out std_ulogic  -- transfer done interrupt
   );
 end neorv32_dma;
@@ -36,13 +37,16 @@ architecture neorv32_dma_rtl of neorv32_dma is
   constant log2_fifo_size_c : natural := index_size_f(DSC_FIFO); -- extend to next power of two
 
   -- transfer configuration (part of the descriptor) --
-  constant conf_num_lo_c : natural :=  0; -- r/w: number of elements to transfer, LSB
-  constant conf_num_hi_c : natural := 23; -- r/w: number of elements to transfer, MSB
-  constant conf_bswap_c  : natural := 27; -- r/w: swap byte order
-  constant conf_src_lo_c : natural := 28; -- r/w: source addressing (0=byte, 1=word)
-  constant conf_src_hi_c : natural := 29; -- r/w: source addressing (0=const, 1=inc)
-  constant conf_dst_lo_c : natural := 30; -- r/w: destination addressing (0=byte, 1=word)
-  constant conf_dst_hi_c : natural := 31; -- r/w: destination addressing (0=const, 1=inc)
+  constant conf_num_lo_c  : natural :=  0; -- r/w: number of elements to transfer, LSB
+  constant conf_num_hi_c  : natural := 23; -- r/w: number of elements to transfer, MSB
+  constant conf_dsel_lo_c : natural := 24; -- r/w: peripheral DMA request select, LSB
+  constant conf_dsel_hi_c : natural := 25; -- r/w: peripheral DMA request select, MSB
+  constant conf_dreq_c    : natural := 26; -- r/w: wait for peripheral DMA request before each element
+  constant conf_bswap_c   : natural := 27; -- r/w: swap byte order
+  constant conf_src_lo_c  : natural := 28; -- r/w: source addressing (0=byte, 1=word)
+  constant conf_src_hi_c  : natural := 29; -- r/w: source addressing (0=const, 1=inc)
+  constant conf_dst_lo_c  : natural := 30; -- r/w: destination addressing (0=byte, 1=word)
+  constant conf_dst_hi_c  : natural := 31; -- r/w: destination addressing (0=const, 1=inc)
 
   -- control and status register bits --
   constant ctrl_en_c     : natural :=  0; -- r/w: DMA enable
@@ -93,7 +97,7 @@ architecture neorv32_dma_rtl of neorv32_dma is
   signal fifo : fifo_t;
 
   -- bus access engine --
-  type state_t is (S_CHECK, S_GET_0, S_GET_1, S_GET_2, S_GET_3, S_READ_REQ, S_READ_RSP, S_WRITE_REQ, S_WRITE_RSP);
+  type state_t is (S_CHECK, S_GET_0, S_GET_1, S_GET_2, S_GET_3, S_DREQ, S_READ_REQ, S_READ_RSP, S_WRITE_REQ, S_WRITE_RSP);
   type engine_t is record
     state    : state_t;
     run      : std_ulogic;
@@ -104,6 +108,8 @@ architecture neorv32_dma_rtl of neorv32_dma is
     num      : std_ulogic_vector(23 downto 0);
     num_or   : std_ulogic;
     bswap    : std_ulogic; -- swap byte order
+    dreq     : std_ulogic; -- wait for peripheral request
+    dsel     : std_ulogic_vector(1 downto 0); -- peripheral request select
     src_type : std_ulogic_vector(1 downto 0);
     dst_type : std_ulogic_vector(1 downto 0);
   end record;
@@ -205,6 +211,8 @@ begin
       engine.num      <= (others => '0');
       engine.num_or   <= '0';
       engine.bswap    <= '0';
+      engine.dreq     <= '0';
+      engine.dsel     <= (others => '0');
       engine.src_type <= (others => '0');
       engine.dst_type <= (others => '0');
     elsif rising_edge(clk_i) then
@@ -252,9 +260,23 @@ begin
         -- ------------------------------------------------------------
           engine.num      <= fifo.rdata(conf_num_hi_c downto conf_num_lo_c);
           engine.bswap    <= fifo.rdata(conf_bswap_c);
+          engine.dreq     <= fifo.rdata(conf_dreq_c);
+          engine.dsel     <= fifo.rdata(conf_dsel_hi_c downto conf_dsel_lo_c);
           engine.src_type <= fifo.rdata(conf_src_hi_c downto conf_src_lo_c);
           engine.dst_type <= fifo.rdata(conf_dst_hi_c downto conf_dst_lo_c);
-          engine.state    <= S_READ_REQ;
+          if (fifo.rdata(conf_dreq_c) = '1') then
+            engine.state <= S_DREQ;
+          else
+            engine.state <= S_READ_REQ;
+          end if;
+
+        when S_DREQ => -- wait for peripheral request
+        -- ------------------------------------------------------------
+          if (ctrl.enable = '0') then -- abort
+            engine.state <= S_CHECK;
+          elsif (dreq_i(to_integer(unsigned(engine.dsel))) = '1') then
+            engine.state <= S_READ_REQ;
+          end if;
 
         when S_READ_REQ => -- read request
         -- ------------------------------------------------------------
@@ -287,6 +309,8 @@ begin
             engine.err <= dma_rsp_i.err;
             if (engine.num_or = '0') or (ctrl.enable = '0') or (dma_rsp_i.err = '1') then -- done/abort/error?
               engine.state <= S_CHECK;
+            elsif (engine.dreq = '1') then
+              engine.state <= S_DREQ;
             else
               engine.state <= S_READ_REQ;
             end if;
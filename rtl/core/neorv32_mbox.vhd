@@ -0,0 +1,192 @@
+-- ================================================================================ --
+-- NEORV32 SoC - Inter-Core Mailbox (MBOX)                                          --
+-- -------------------------------------------------------------------------------- --
+-- Provides one inbox FIFO per hart. Any hart can push a message into any inbox;    --
+-- the sender's hart ID is stored together with the message. Each inbox provides a  --
+-- dedicated "inbox not empty" interrupt for its hart.                              --
+-- -------------------------------------------------------------------------------- --
+-- The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              --
+-- Copyright (c) NEORV32 contributors.                                              --
+-- Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  --
+-- Licensed under the BSD-3-Clause license, see LICENSE for details.                --
+-- SPDX-License-Identifier: BSD-3-Clause                                            --
+-- ================================================================================ --
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library neorv32;
+use neorv32.neorv32_package.all;
+
+entity neorv32_mbox is
+  generic (
+    NUM_HARTS  : natural range 1 to 4;     -- number of harts (= number of inboxes)
+    FIFO_DEPTH : natural range 1 to 2**15  -- inbox FIFO depth, has to be a power of two, min 1
+  );
+  port (
+    clk_i     : in  std_ulogic;                              -- global clock line
+    rstn_i    : in  std_ulogic;                              -- global reset line, low-active, async
+    bus_req_i : in  bus_req_t;                               -- bus request
+    bus_rsp_o : out bus_rsp_t;                               -- bus response
+    irq_o     : out std_ulogic_vector(NUM_HARTS-1 downto 0)  -- per-hart interrupt
+  );
+end neorv32_mbox;
+
+architecture neorv32_mbox_rtl of neorv32_mbox is
+
+  -- control register --
+  constant ctrl_en_c      : natural :=  0; -- r/w: inbox enable (FIFO is cleared when disabled)
+  constant ctrl_irq_en_c  : natural :=  1; -- r/w: interrupt if inbox not empty
+  --
+  constant ctrl_avail_c   : natural :=  8; -- r/-: inbox not empty
+  constant ctrl_full_c    : natural :=  9; -- r/-: inbox full
+  constant ctrl_ovf_c     : natural := 10; -- r/c: message lost (write to full inbox), cleared by writing CTRL
+  --
+  constant ctrl_fifo0_c   : natural := 24; -- r/-: log2(FIFO_DEPTH), bit 0 (LSB)
+  constant ctrl_fifo3_c   : natural := 27; -- r/-: log2(FIFO_DEPTH), bit 3 (MSB)
+  constant ctrl_harts0_c  : natural := 28; -- r/-: number of harts - 1, bit 0 (LSB)
+  constant ctrl_harts1_c  : natural := 29; -- r/-: number of harts - 1, bit 1 (MSB)
+
+  -- helpers --
+  constant log2_fifo_c : natural := index_size_f(FIFO_DEPTH);
+
+  -- per-inbox control and status --
+  type inbox_t is record
+    enable, irq_en, ovf : std_ulogic;
+    src                 : std_ulogic_vector(1 downto 0); -- sender of last read message
+  end record;
+  type inbox_arr_t is array (0 to NUM_HARTS-1) of inbox_t;
+  signal inbox : inbox_arr_t;
+
+  -- FIFO interface --
+  type fifo_data_t is array (0 to NUM_HARTS-1) of std_ulogic_vector((2+32)-1 downto 0);
+  type fifo_t is record
+    we, re, clr, avail, free : std_ulogic_vector(NUM_HARTS-1 downto 0);
+    wdata                    : std_ulogic_vector((2+32)-1 downto 0);
+    rdata                    : fifo_data_t;
+  end record;
+  signal fifo : fifo_t;
+
+  -- access decoding --
+  signal sel : natural range 0 to 3;
+
+begin
+
+  -- inbox select --
+  sel <= to_integer(unsigned(bus_req_i.addr(5 downto 4)));
+
+
+  -- Bus Access -----------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  bus_access: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      bus_rsp_o <= rsp_terminate_c;
+      for i in 0 to NUM_HARTS-1 loop
+        inbox(i).enable <= '0';
+        inbox(i).irq_en <= '0';
+        inbox(i).ovf    <= '0';
+        inbox(i).src    <= (others => '0');
+      end loop;
+    elsif rising_edge(clk_i) then
+      -- bus handshake --
+      bus_rsp_o.ack  <= bus_req_i.stb;
+      bus_rsp_o.err  <= '0';
+      bus_rsp_o.data <= (others => '0');
+      -- message lost --
+      for i in 0 to NUM_HARTS-1 loop
+        if (fifo.we(i) = '1') and (fifo.free(i) = '0') then
+          inbox(i).ovf <= '1';
+        end if;
+      end loop;
+      -- bus access --
+      if (bus_req_i.stb = '1') and (sel < NUM_HARTS) then
+        if (bus_req_i.rw = '1') then -- write access
+          if (bus_req_i.addr(3 downto 2) = "00") then -- control register
+            inbox(sel).enable <= bus_req_i.data(ctrl_en_c);
+            inbox(sel).irq_en <= bus_req_i.data(ctrl_irq_en_c);
+            inbox(sel).ovf    <= '0';
+          end if;
+        else -- read access
+          case bus_req_i.addr(3 downto 2) is
+            when "00" => -- control register
+              bus_rsp_o.data(ctrl_en_c)                           <= inbox(sel).enable;
+              bus_rsp_o.data(ctrl_irq_en_c)                       <= inbox(sel).irq_en;
+              bus_rsp_o.data(ctrl_avail_c)                        <= fifo.avail(sel);
+              bus_rsp_o.data(ctrl_full_c)                         <= not fifo.free(sel);
+              bus_rsp_o.data(ctrl_ovf_c)                          <= inbox(sel).ovf;
+              bus_rsp_o.data(ctrl_fifo3_c downto ctrl_fifo0_c)    <= std_ulogic_vector(to_unsigned(log2_fifo_c, 4));
+              bus_rsp_o.data(ctrl_harts1_c downto ctrl_harts0_c)  <= std_ulogic_vector(to_unsigned(NUM_HARTS-1, 2));
+            when "01" => -- sender of last read message
+              bus_rsp_o.data(1 downto 0) <= inbox(sel).src;
+            when "10" => -- message data
+              bus_rsp_o.data <= fifo.rdata(sel)(31 downto 0);
+            when others => -- reserved
+              bus_rsp_o.data <= (others => '0');
+          end case;
+        end if;
+      end if;
+      -- backup sender of current read access --
+      for i in 0 to NUM_HARTS-1 loop
+        if (fifo.re(i) = '1') then
+          inbox(i).src <= fifo.rdata(i)(33 downto 32);
+        end if;
+      end loop;
+    end if;
+  end process bus_access;
+
+
+  -- Inbox FIFOs ----------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  inbox_gen:
+  for i in 0 to NUM_HARTS-1 generate
+
+    inbox_fifo_inst: entity neorv32.neorv32_prim_fifo
+    generic map (
+      AWIDTH  => log2_fifo_c,
+      DWIDTH  => 2+32, -- sender hart ID + data
+      OUTGATE => false -- no output gate required
+    )
+    port map (
+      -- global control --
+      clk_i   => clk_i,
+      rstn_i  => rstn_i,
+      clear_i => fifo.clr(i),
+      -- write port --
+      wdata_i => fifo.wdata,
+      we_i    => fifo.we(i),
+      free_o  => fifo.free(i),
+      -- read port --
+      re_i    => fifo.re(i),
+      rdata_o => fifo.rdata(i),
+      avail_o => fifo.avail(i)
+    );
+
+    fifo.clr(i) <= not inbox(i).enable;
+    fifo.we(i)  <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '1') and (bus_req_i.addr(3 downto 2) = "10") and
+                            (sel = i) and (inbox(i).enable = '1') else '0';
+    fifo.re(i)  <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '0') and (bus_req_i.addr(3 downto 2) = "10") and
+                            (sel = i) else '0';
+
+  end generate;
+
+  -- the sender's hart ID is part of the bus request meta data --
+  fifo.wdata <= bus_req_i.meta(4 downto 3) & bus_req_i.data;
+
+
+  -- Interrupt Generator --------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  irq_gen: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      irq_o <= (others => '0');
+    elsif rising_edge(clk_i) then
+      for i in 0 to NUM_HARTS-1 loop
+        irq_o(i) <= inbox(i).enable and inbox(i).irq_en and fifo.avail(i); -- inbox not empty
+      end loop;
+    end if;
+  end process irq_gen;
+
+
+end neorv32_mbox_rtl;
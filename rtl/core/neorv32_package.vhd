@@ -20,7 +20,7 @@ package neorv32_package is
 
   -- Architecture Constants -----------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  constant hw_version_c  : std_ulogic_vector(31 downto 0) := x"01120705"; -- hardware version
+  constant hw_version_c  : std_ulogic_vector(31 downto 0) := x"01120730"; -- hardware version
   constant int_bus_tmo_c : natural := 16; -- internal bus timeout window; has to be a power of two
   constant alu_cp_tmo_c  : natural := 9;  -- log2 of max ALU co-processor execution cycles
 
@@ -41,6 +41,8 @@ package neorv32_package is
   -- Main Address Regions (base address must be aligned to the region's size) ---
   constant mem_imem_base_c : std_ulogic_vector(31 downto 0) := x"00000000"; -- IMEM size via top generic
   constant mem_dmem_base_c : std_ulogic_vector(31 downto 0) := x"80000000"; -- DMEM size via top generic
+  constant mem_xip_base_c  : std_ulogic_vector(31 downto 0) := x"e0000000";
+  constant mem_xip_size_c  : natural := 256*1024*1024; -- XIP flash window
   constant mem_io_base_c   : std_ulogic_vector(31 downto 0) := x"ffe00000";
   constant mem_io_size_c   : natural := 32*64*1024; -- 32 * iodev_size_c
 
@@ -63,8 +65,8 @@ package neorv32_package is
   constant base_io_cfs_c     : std_ulogic_vector(31 downto 0) := x"ffeb0000";
   constant base_io_slink_c   : std_ulogic_vector(31 downto 0) := x"ffec0000";
   constant base_io_dma_c     : std_ulogic_vector(31 downto 0) := x"ffed0000";
---constant base_io_???_c     : std_ulogic_vector(31 downto 0) := x"ffee0000"; -- reserved
---constant base_io_???_c     : std_ulogic_vector(31 downto 0) := x"ffef0000"; -- reserved
+  constant base_io_mbox_c    : std_ulogic_vector(31 downto 0) := x"ffee0000";
+  constant base_io_xip_c     : std_ulogic_vector(31 downto 0) := x"ffef0000";
   constant base_io_pwm_c     : std_ulogic_vector(31 downto 0) := x"fff00000";
   constant base_io_gptmr_c   : std_ulogic_vector(31 downto 0) := x"fff10000";
   constant base_io_onewire_c : std_ulogic_vector(31 downto 0) := x"fff20000";
@@ -487,6 +489,19 @@ package neorv32_package is
   -- machine counter setup - continued --
   constant csr_mcyclecfgh_c     : std_ulogic_vector(11 downto 0) := x"721";
   constant csr_minstretcfgh_c   : std_ulogic_vector(11 downto 0) := x"722";
+  constant csr_mhpmevent3h_c    : std_ulogic_vector(11 downto 0) := x"723";
+  constant csr_mhpmevent4h_c    : std_ulogic_vector(11 downto 0) := x"724";
+  constant csr_mhpmevent5h_c    : std_ulogic_vector(11 downto 0) := x"725";
+  constant csr_mhpmevent6h_c    : std_ulogic_vector(11 downto 0) := x"726";
+  constant csr_mhpmevent7h_c    : std_ulogic_vector(11 downto 0) := x"727";
+  constant csr_mhpmevent8h_c    : std_ulogic_vector(11 downto 0) := x"728";
+  constant csr_mhpmevent9h_c    : std_ulogic_vector(11 downto 0) := x"729";
+  constant csr_mhpmevent10h_c   : std_ulogic_vector(11 downto 0) := x"72a";
+  constant csr_mhpmevent11h_c   : std_ulogic_vector(11 downto 0) := x"72b";
+  constant csr_mhpmevent12h_c   : std_ulogic_vector(11 downto 0) := x"72c";
+  constant csr_mhpmevent13h_c   : std_ulogic_vector(11 downto 0) := x"72d";
+  constant csr_mhpmevent14h_c   : std_ulogic_vector(11 downto 0) := x"72e";
+  constant csr_mhpmevent15h_c   : std_ulogic_vector(11 downto 0) := x"72f";
   -- trigger module registers --
   constant csr_tselect_c        : std_ulogic_vector(11 downto 0) := x"7a0";
   constant csr_tdata1_c         : std_ulogic_vector(11 downto 0) := x"7a1";
@@ -617,7 +632,7 @@ package neorv32_package is
     csr_addr     : std_ulogic_vector(11 downto 0); -- address
     csr_wdata    : std_ulogic_vector(31 downto 0); -- write data
     -- counter events --
-    cnt_event    : std_ulogic_vector(10 downto 0); -- counter increment events
+    cnt_event    : std_ulogic_vector(13 downto 0); -- counter increment events
     -- instruction word --
     ir_funct3    : std_ulogic_vector(2 downto 0);  -- funct3 bit field
     ir_funct12   : std_ulogic_vector(11 downto 0); -- funct12 bit field
@@ -716,6 +731,7 @@ package neorv32_package is
   constant trap_msi_c     : std_ulogic_vector(6 downto 0) := "1" & "0" & "00011"; -- 3:  machine software interrupt
   constant trap_mti_c     : std_ulogic_vector(6 downto 0) := "1" & "0" & "00111"; -- 7:  machine timer interrupt
   constant trap_mei_c     : std_ulogic_vector(6 downto 0) := "1" & "0" & "01011"; -- 11: machine external interrupt
+  constant trap_lcof_c    : std_ulogic_vector(6 downto 0) := "1" & "0" & "01101"; -- 13: local counter overflow interrupt
   -- NEORV32-specific asynchronous exceptions (interrupts) --
   constant trap_firq0_c   : std_ulogic_vector(6 downto 0) := "1" & "0" & "10000"; -- 16: fast interrupt 0
   constant trap_firq1_c   : std_ulogic_vector(6 downto 0) := "1" & "0" & "10001"; -- 17: fast interrupt 1
@@ -775,8 +791,9 @@ package neorv32_package is
   constant irq_firq_13_c : natural := 16; -- fast interrupt channel 13
   constant irq_firq_14_c : natural := 17; -- fast interrupt channel 14
   constant irq_firq_15_c : natural := 18; -- fast interrupt channel 15
-  constant irq_db_halt_c : natural := 19; -- enter debug mode via external halt request
-  constant irq_width_c   : natural := 20; -- length of this list in bits
+  constant irq_lcof_c    : natural := 19; -- local counter overflow interrupt
+  constant irq_db_halt_c : natural := 20; -- enter debug mode via external halt request
+  constant irq_width_c   : natural := 21; -- length of this list in bits
 
   -- Privilege Modes ------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
@@ -798,6 +815,16 @@ package neorv32_package is
   constant cnt_event_load_c     : natural := 8;  -- load operation
   constant cnt_event_store_c    : natural := 9;  -- store operation
   constant cnt_event_wait_lsu_c : natural := 10; -- load-store unit memory wait cycle
+  constant cnt_event_trap_c     : natural := 11; -- trap entry (exception or interrupt)
+  constant cnt_event_irq_c      : natural := 12; -- interrupt entry
+  constant cnt_event_restart_c  : natural := 13; -- instruction dispatch wait cycle after fetch restart
+  -- NEORV32-specific HPM SoC events (CPU hpm_i input) --
+  constant cnt_event_ic_hit_c   : natural := 14; -- i-cache hit
+  constant cnt_event_ic_miss_c  : natural := 15; -- i-cache miss
+  constant cnt_event_dc_hit_c   : natural := 16; -- d-cache hit
+  constant cnt_event_dc_miss_c  : natural := 17; -- d-cache miss
+  constant cnt_event_bus_wait_c : natural := 18; -- bus arbitration wait cycle
+  constant cnt_event_dma_c      : natural := 19; -- DMA bus access
 
 -- **********************************************************************************************************
 -- Helper Functions
@@ -897,6 +924,8 @@ package neorv32_package is
       XBUS_EN             : boolean                        := false;
       XBUS_TIMEOUT        : natural                        := 2048;
       XBUS_REGSTAGE_EN    : boolean                        := false;
+      -- Execute-in-place module (XIP) --
+      XIP_EN              : boolean                        := false;
       -- Processor peripherals --
       IO_DISABLE_SYSINFO  : boolean                        := false;
       IO_GPIO_NUM         : natural range 0 to 64          := 0;
@@ -909,6 +938,7 @@ package neorv32_package is
       IO_UART1_TX_FIFO    : natural range 1 to 2**15       := 1;
       IO_SPI_EN           : boolean                        := false;
       IO_SPI_FIFO         : natural range 1 to 2**15       := 1;
+      IO_SPI_XFER_EN      : boolean                        := false;
       IO_SDI_EN           : boolean                        := false;
       IO_SDI_FIFO         : natural range 1 to 2**15       := 1;
       IO_TWI_EN           : boolean                        := false;
@@ -931,6 +961,8 @@ package neorv32_package is
       IO_SLINK_EN         : boolean                        := false;
       IO_SLINK_RX_FIFO    : natural range 1 to 2**15       := 1;
       IO_SLINK_TX_FIFO    : natural range 1 to 2**15       := 1;
+      IO_MBOX_EN          : boolean                        := false;
+      IO_MBOX_FIFO        : natural range 1 to 2**15       := 1;
       IO_TRACER_EN        : boolean                        := false;
       IO_TRACER_BUFFER    : natural range 1 to 2**15       := 1;
       IO_TRACER_SIMLOG_EN : boolean                        := false
@@ -990,6 +1022,12 @@ package neorv32_package is
       spi_dat_o      : out std_ulogic;
       spi_dat_i      : in  std_ulogic := 'L';
       spi_csn_o      : out std_ulogic_vector(7 downto 0); -- SPI CS
+      -- XIP (available if XIP_EN = true) --
+      xip_csn_o      : out std_ulogic;
+      xip_clk_o      : out std_ulogic;
+      xip_dat_i      : in  std_ulogic_vector(3 downto 0) := (others => 'L');
+      xip_dat_o      : out std_ulogic_vector(3 downto 0);
+      xip_oe_o       : out std_ulogic_vector(3 downto 0);
       -- SDI (available if IO_SDI_EN = true) --
       sdi_clk_i      : in  std_ulogic := 'L';
       sdi_dat_o      : out std_ulogic;
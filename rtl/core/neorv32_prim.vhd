@@ -316,6 +316,7 @@ end neorv32_prim_mul_rtl;
 -- -------------------------------------------------------------------------------- --
 -- High and low words are split across two individual registers to improve timing   --
 -- by cutting the carry chain. The actual counter width can be trimmed via CWIDTH.  --
+-- ovf_o pulses for one cycle when the (trimmed) counter wraps around to zero.      --
 -- [WARNING] High and low words of counter output cnt_o are _NOT_ synchronized!     --
 -- -------------------------------------------------------------------------------- --
 -- The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              --
@@ -342,7 +343,8 @@ entity neorv32_prim_cnt is
     we_i   : in  std_ulogic_vector(1 downto 0);  -- subword write enable
     data_i : in  std_ulogic_vector(31 downto 0); -- subword write data
     oe_i   : in  std_ulogic;                     -- output enable
-    cnt_o  : out std_ulogic_vector(63 downto 0)  -- trimmed counter output
+    cnt_o  : out std_ulogic_vector(63 downto 0); -- trimmed counter output
+    ovf_o  : out std_ulogic                      -- trimmed counter overflow
   );
 end neorv32_prim_cnt;
 
@@ -351,6 +353,7 @@ architecture neorv32_prim_cnt_rtl of neorv32_prim_cnt is
   signal count : std_ulogic_vector(63 downto 0);
   signal carry, incen : std_ulogic_vector(0 downto 0);
   signal inc_lo, inc_hi : std_ulogic_vector(32 downto 0);
+  signal msb, wr : std_ulogic;
 
 begin
 
@@ -386,6 +389,32 @@ begin
   inc_lo <= std_ulogic_vector(unsigned('0' & count(31 downto  0)) + unsigned(incen));
   inc_hi <= std_ulogic_vector(unsigned('0' & count(63 downto 32)) + unsigned(carry));
 
+  -- Overflow Detection ---------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  overflow_enabled:
+  if CWIDTH > 0 generate
+    overflow_detect: process(rstn_i, clk_i)
+    begin
+      if (rstn_i = '0') then
+        msb <= '0';
+        wr  <= '0';
+      elsif rising_edge(clk_i) then
+        msb <= count(CWIDTH-1);
+        wr  <= we_i(1) or we_i(0);
+      end if;
+    end process overflow_detect;
+
+    -- MSB falling without a software write = wrap-around --
+    ovf_o <= msb and (not count(CWIDTH-1)) and (not wr);
+  end generate;
+
+  overflow_disabled:
+  if CWIDTH = 0 generate
+    msb   <= '0';
+    wr    <= '0';
+    ovf_o <= '0';
+  end generate;
+
   -- Output Gating and Trimming -------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   trim: process(oe_i, count)
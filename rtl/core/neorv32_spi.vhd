@@ -3,7 +3,7 @@
 -- -------------------------------------------------------------------------------- --
 -- The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              --
 -- Copyright (c) NEORV32 contributors.                                              --
--- Copyright (c) 2020 - 2025 Stephan Nolting. All rights reserved.                  --
+-- Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  --
 -- Licensed under the BSD-3-Clause license, see LICENSE for details.                --
 -- SPDX-License-Identifier: BSD-3-Clause                                            --
 -- ================================================================================ --
@@ -17,7 +17,8 @@ use neorv32.neorv32_package.all;
 
 entity neorv32_spi is
   generic (
-    IO_SPI_FIFO : natural range 1 to 2**15 -- RTX FIFO depth, has to be a power of two, min 1
+    IO_SPI_FIFO    : natural range 1 to 2**15; -- RTX FIFO depth, has to be a power of two, min 1
+    IO_SPI_XFER_EN : boolean                   -- implement hardware-managed transfers (16/32-bit frames, DMA request)
   );
   port (
     clk_i     : in  std_ulogic;                    -- global clock line
@@ -29,7 +30,8 @@ entity neorv32_spi is
     spi_dat_o : out std_ulogic;                    -- controller data out, peripheral data in
     spi_dat_i : in  std_ulogic;                    -- controller data in, peripheral data out
     spi_csn_o : out std_ulogic_vector(7 downto 0); -- chip-select, low-active
-    irq_o     : out std_ulogic                     -- CPU interrupt
+    irq_o     : out std_ulogic;                    -- CPU interrupt
+    dreq_o    : out std_ulogic                     -- DMA request
   );
 end neorv32_spi;
 
@@ -43,19 +45,33 @@ architecture neorv32_spi_rtl of neorv32_spi is
   constant ctrl_prsc2_c    : natural :=  5; -- r/w: prescaler select, bit 2 (MSB)
   constant ctrl_cdiv0_c    : natural :=  6; -- r/w: clock divider, bit 0 (LSB)
   constant ctrl_cdiv3_c    : natural :=  9; -- r/w: clock divider, bit 3 (MSB)
+  constant ctrl_dwidth0_c  : natural := 10; -- r/w: frame data width (00=8, 01=16, 1-=32 bit), bit 0 (LSB)
+  constant ctrl_dwidth1_c  : natural := 11; -- r/w: frame data width (00=8, 01=16, 1-=32 bit), bit 1 (MSB)
   --
   constant ctrl_rx_avail_c : natural := 16; -- r/-: RX FIFO data available (FIFO not empty)
   constant ctrl_tx_empty_c : natural := 17; -- r/-: TX FIFO empty
   constant ctrl_tx_full_c  : natural := 18; -- r/-: TX FIFO full
+  constant ctrl_xfer_c     : natural := 19; -- r/-: hardware-managed transfers implemented
   --
   constant ctrl_fifo0_c    : natural := 24; -- r/-: log2(FIFO size), bit 0 (LSB)
   constant ctrl_fifo3_c    : natural := 27; -- r/-: log2(FIFO size), bit 3 (MSB)
   --
   constant ctrl_cs_en_c    : natural := 30; -- r/-: a chip-select line is active when set
-  constant ctrl_busy_c     : natural := 31; -- r/-: SPI PHY busy or TX FIFO not empty yet
+  constant ctrl_busy_c     : natural := 31; -- r/-: SPI PHY busy or TX FIFO not empty yet or transfer in progress
+
+  -- transfer register --
+  constant xfer_num_lo_c   : natural :=  0; -- r/w: number of frames to transfer, LSB
+  constant xfer_num_hi_c   : natural := 23; -- r/w: number of frames to transfer, MSB
+  constant xfer_cs_lo_c    : natural := 24; -- r/w: chip-select for automatic CS, LSB
+  constant xfer_cs_hi_c    : natural := 26; -- r/w: chip-select for automatic CS, MSB
+  constant xfer_csen_c     : natural := 27; -- r/w: automatic chip-select enable
+  constant xfer_rxo_c      : natural := 28; -- r/w: receive-only (no TX data, send all-ones)
+  constant xfer_txo_c      : natural := 29; -- r/w: transmit-only (discard RX data)
+  constant xfer_busy_c     : natural := 31; -- r/-: transfer in progress
 
   -- helpers --
   constant log2_fifo_size_c : natural := index_size_f(IO_SPI_FIFO);
+  constant data_width_c     : natural := cond_sel_natural_f(IO_SPI_XFER_EN, 32, 8); -- max frame size
 
   -- control register --
   type ctrl_t is record
@@ -64,9 +80,21 @@ architecture neorv32_spi_rtl of neorv32_spi is
     cpol   : std_ulogic;
     prsc   : std_ulogic_vector(2 downto 0);
     cdiv   : std_ulogic_vector(3 downto 0);
+    dwidth : std_ulogic_vector(1 downto 0);
   end record;
   signal ctrl : ctrl_t;
 
+  -- hardware-managed transfer --
+  type xfer_t is record
+    num  : std_ulogic_vector(23 downto 0); -- remaining frames
+    cs   : std_ulogic_vector(2 downto 0);
+    csen : std_ulogic;
+    rxo  : std_ulogic;
+    txo  : std_ulogic;
+  end record;
+  signal xfer : xfer_t;
+  signal xfer_we, xfer_run, xfer_cs, xfer_dummy, rx_stall : std_ulogic;
+
   -- clock generator --
   signal cdiv_cnt   : std_ulogic_vector(3 downto 0);
   signal spi_clk_en : std_ulogic;
@@ -75,30 +103,33 @@ architecture neorv32_spi_rtl of neorv32_spi is
   type rtx_engine_t is record
     state    : std_ulogic_vector(2 downto 0);
     busy     : std_ulogic;
-    sreg     : std_ulogic_vector(7 downto 0);
-    bitcnt   : std_ulogic_vector(3 downto 0);
+    sreg     : std_ulogic_vector(31 downto 0);
+    bitcnt   : std_ulogic_vector(5 downto 0);
     sdi_sync : std_ulogic;
     sck      : std_ulogic;
     cs_ctrl  : std_ulogic_vector(3 downto 0);
+    drop     : std_ulogic; -- discard RX data of current frame
     done     : std_ulogic;
   end record;
   signal rtx_engine : rtx_engine_t;
+  signal frame_end  : std_ulogic;
 
   -- FIFO interfaces --
   type tx_fifo_t is record
     we,    re    : std_ulogic;
-    wdata, rdata : std_ulogic_vector(8 downto 0);
+    wdata, rdata : std_ulogic_vector(data_width_c downto 0); -- command/data select & command/data
     avail, free  : std_ulogic;
     clear        : std_ulogic;
   end record;
   type rx_fifo_t is record
     we,    re    : std_ulogic;
-    wdata, rdata : std_ulogic_vector(7 downto 0);
+    wdata, rdata : std_ulogic_vector(data_width_c-1 downto 0);
     avail, free  : std_ulogic;
     clear        : std_ulogic;
   end record;
   signal tx_fifo : tx_fifo_t;
   signal rx_fifo : rx_fifo_t;
+  signal tx_data, rx_data : std_ulogic_vector(31 downto 0);
 
 begin
 
@@ -113,6 +144,7 @@ begin
       ctrl.cpol   <= '0';
       ctrl.prsc   <= (others => '0');
       ctrl.cdiv   <= (others => '0');
+      ctrl.dwidth <= (others => '0');
     elsif rising_edge(clk_i) then
       -- bus handshake --
       bus_rsp_o.ack  <= bus_req_i.stb;
@@ -122,28 +154,40 @@ begin
       -- read/write access --
       if (bus_req_i.stb = '1') then
         if (bus_req_i.rw = '1') then -- write access
-          if (bus_req_i.addr(2) = '0') then -- control register
+          if (bus_req_i.addr(3 downto 2) = "00") then -- control register
             ctrl.enable <= bus_req_i.data(ctrl_en_c);
             ctrl.cpha   <= bus_req_i.data(ctrl_cpha_c);
             ctrl.cpol   <= bus_req_i.data(ctrl_cpol_c);
             ctrl.prsc   <= bus_req_i.data(ctrl_prsc2_c downto ctrl_prsc0_c);
             ctrl.cdiv   <= bus_req_i.data(ctrl_cdiv3_c downto ctrl_cdiv0_c);
+            if IO_SPI_XFER_EN then -- 8-bit frames only otherwise
+              ctrl.dwidth <= bus_req_i.data(ctrl_dwidth1_c downto ctrl_dwidth0_c);
+            end if;
           end if;
         else -- read access
-          if (bus_req_i.addr(2) = '0') then -- control register
+          if (bus_req_i.addr(3 downto 2) = "00") then -- control register
             bus_rsp_o.data(ctrl_en_c)                        <= ctrl.enable;
             bus_rsp_o.data(ctrl_cpha_c)                      <= ctrl.cpha;
             bus_rsp_o.data(ctrl_cpol_c)                      <= ctrl.cpol;
             bus_rsp_o.data(ctrl_prsc2_c downto ctrl_prsc0_c) <= ctrl.prsc;
             bus_rsp_o.data(ctrl_cdiv3_c downto ctrl_cdiv0_c) <= ctrl.cdiv;
+            bus_rsp_o.data(ctrl_dwidth1_c downto ctrl_dwidth0_c) <= ctrl.dwidth;
             bus_rsp_o.data(ctrl_rx_avail_c)                  <= rx_fifo.avail;
             bus_rsp_o.data(ctrl_tx_empty_c)                  <= not tx_fifo.avail;
             bus_rsp_o.data(ctrl_tx_full_c)                   <= not tx_fifo.free;
+            bus_rsp_o.data(ctrl_xfer_c)                      <= bool_to_ulogic_f(IO_SPI_XFER_EN);
             bus_rsp_o.data(ctrl_fifo3_c downto ctrl_fifo0_c) <= std_ulogic_vector(to_unsigned(log2_fifo_size_c, 4));
             bus_rsp_o.data(ctrl_cs_en_c)                     <= rtx_engine.cs_ctrl(3);
-            bus_rsp_o.data(ctrl_busy_c)                      <= rtx_engine.busy or tx_fifo.avail;
+            bus_rsp_o.data(ctrl_busy_c)                      <= rtx_engine.busy or tx_fifo.avail or xfer_run;
+          elsif (bus_req_i.addr(3 downto 2) = "10") then -- transfer register
+            bus_rsp_o.data(xfer_num_hi_c downto xfer_num_lo_c) <= xfer.num;
+            bus_rsp_o.data(xfer_cs_hi_c downto xfer_cs_lo_c)   <= xfer.cs;
+            bus_rsp_o.data(xfer_csen_c)                        <= xfer.csen;
+            bus_rsp_o.data(xfer_rxo_c)                         <= xfer.rxo;
+            bus_rsp_o.data(xfer_txo_c)                         <= xfer.txo;
+            bus_rsp_o.data(xfer_busy_c)                        <= xfer_run;
           else -- RX data
-            bus_rsp_o.data(7 downto 0) <= rx_fifo.rdata;
+            bus_rsp_o.data(data_width_c-1 downto 0) <= rx_fifo.rdata;
           end if;
         end if;
       end if;
@@ -158,7 +202,7 @@ begin
   tx_fifo_inst: entity neorv32.neorv32_prim_fifo
   generic map (
     AWIDTH  => log2_fifo_size_c,
-    DWIDTH  => 9,
+    DWIDTH  => data_width_c+1,
     OUTGATE => false
   )
   port map (
@@ -177,16 +221,20 @@ begin
   );
 
   tx_fifo.clear <= not ctrl.enable;
-  tx_fifo.we    <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '1') and (bus_req_i.addr(2) = '1') else '0';
-  tx_fifo.wdata <= bus_req_i.data(31) & bus_req_i.data(7 downto 0); -- command/data select & command/data byte
-  tx_fifo.re    <= '1' when (rtx_engine.state = "100") else '0';
+  tx_fifo.we    <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '1') and (bus_req_i.addr(3 downto 2) = "01") else '0';
+  tx_fifo.wdata <= (bus_req_i.data(31) and (not xfer_run)) & bus_req_i.data(data_width_c-1 downto 0); -- command/data select (data-only during transfer) & command/data
+  tx_fifo.re    <= '1' when (rtx_engine.state = "100") and (xfer_cs = '0') and (xfer_dummy = '0') and
+                            ((tx_fifo.rdata(data_width_c) = '1') or (rx_stall = '0')) else '0';
+
+  -- TX data (zero-extended) --
+  tx_data <= std_ulogic_vector(resize(unsigned(tx_fifo.rdata(data_width_c-1 downto 0)), 32));
 
 
   -- RX FIFO --
   rx_fifo_inst: entity neorv32.neorv32_prim_fifo
   generic map (
     AWIDTH  => log2_fifo_size_c,
-    DWIDTH  => 8,
+    DWIDTH  => data_width_c,
     OUTGATE => false
   )
   port map (
@@ -205,22 +253,60 @@ begin
   );
 
   rx_fifo.clear <= not ctrl.enable;
-  rx_fifo.wdata <= rtx_engine.sreg;
-  rx_fifo.we    <= rtx_engine.done;
-  rx_fifo.re    <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '0') and (bus_req_i.addr(2) = '1') else '0';
+  rx_fifo.we    <= rtx_engine.done and (not rtx_engine.drop);
+  rx_fifo.re    <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '0') and (bus_req_i.addr(3 downto 2) = "01") else '0';
+
+  -- RX data alignment (LSB-aligned) --
+  rx_align: process(ctrl.dwidth, rtx_engine.sreg)
+  begin
+    rx_data <= (others => '0');
+    case ctrl.dwidth is
+      when "00"   => rx_data(7 downto 0)  <= rtx_engine.sreg(7 downto 0);
+      when "01"   => rx_data(15 downto 0) <= rtx_engine.sreg(15 downto 0);
+      when others => rx_data              <= rtx_engine.sreg;
+    end case;
+  end process rx_align;
 
+  rx_fifo.wdata <= rx_data(data_width_c-1 downto 0);
 
-  -- IRQ generator: IRQ if TX FIFO is empty and serial engine is idle --
+
+  -- IRQ generator: IRQ if TX FIFO is empty, serial engine is idle and there is no transfer in progress --
+  -- DMA request: TX FIFO not full (transmit-only transfer) or RX FIFO data available (all other) --
   irq_generator: process(rstn_i, clk_i)
   begin
     if (rstn_i = '0') then
-      irq_o <= '0';
+      irq_o  <= '0';
+      dreq_o <= '0';
     elsif rising_edge(clk_i) then
-      irq_o <= ctrl.enable and (not tx_fifo.avail) and (not rtx_engine.busy);
+      irq_o <= ctrl.enable and (not tx_fifo.avail) and (not rtx_engine.busy) and (not xfer_run);
+      if not IO_SPI_XFER_EN then
+        dreq_o <= '0';
+      elsif (xfer.txo = '1') then
+        dreq_o <= ctrl.enable and tx_fifo.free;
+      else
+        dreq_o <= ctrl.enable and rx_fifo.avail;
+      end if;
     end if;
   end process irq_generator;
 
 
+  -- Hardware-Managed Transfer --------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  xfer_we <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '1') and (bus_req_i.addr(3 downto 2) = "10") else '0';
+
+  -- transfer in progress --
+  xfer_run <= or_reduce_f(xfer.num);
+
+  -- automatic chip-select has to be activated before the first frame --
+  xfer_cs <= xfer_run and xfer.csen and (not rtx_engine.cs_ctrl(3));
+
+  -- receive-only: frames are generated without TX data --
+  xfer_dummy <= xfer_run and xfer.rxo;
+
+  -- do not start a new frame if its RX data cannot be stored --
+  rx_stall <= xfer_run and (not xfer.txo) and (not rx_fifo.free);
+
+
   -- SPI Transceiver ------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   transceiver: process(rstn_i, clk_i)
@@ -233,20 +319,48 @@ begin
       rtx_engine.sdi_sync <= '0';
       rtx_engine.sck      <= '0';
       rtx_engine.cs_ctrl  <= (others => '0');
+      rtx_engine.drop     <= '0';
+      xfer.num            <= (others => '0');
+      xfer.cs             <= (others => '0');
+      xfer.csen           <= '0';
+      xfer.rxo            <= '0';
+      xfer.txo            <= '0';
     elsif rising_edge(clk_i) then
       rtx_engine.done     <= '0';
       rtx_engine.state(2) <= ctrl.enable;
+
+      -- transfer configuration --
+      if (xfer_we = '1') and IO_SPI_XFER_EN then
+        xfer.num  <= bus_req_i.data(xfer_num_hi_c downto xfer_num_lo_c);
+        xfer.cs   <= bus_req_i.data(xfer_cs_hi_c downto xfer_cs_lo_c);
+        xfer.csen <= bus_req_i.data(xfer_csen_c);
+        xfer.rxo  <= bus_req_i.data(xfer_rxo_c);
+        xfer.txo  <= bus_req_i.data(xfer_txo_c);
+      end if;
+
       case rtx_engine.state is
 
         when "100" => -- enabled but idle, waiting for new transmission trigger
         -- ------------------------------------------------------------
           rtx_engine.sck    <= ctrl.cpol;
           rtx_engine.bitcnt <= (others => '0');
-          if (tx_fifo.avail = '1') then -- trigger new transmission
-            if (tx_fifo.rdata(8) = '1') then -- command
+          rtx_engine.drop   <= xfer_run and xfer.txo;
+          if (xfer_cs = '1') then -- activate chip-select of hardware-managed transfer
+            rtx_engine.cs_ctrl <= '1' & xfer.cs;
+          elsif (xfer_dummy = '1') then -- receive-only: no TX data required
+            if (rx_stall = '0') then
+              rtx_engine.sreg              <= (others => '1');
+              rtx_engine.state(1 downto 0) <= "01";
+            end if;
+          elsif (tx_fifo.avail = '1') then -- trigger new transmission
+            if (tx_fifo.rdata(data_width_c) = '1') then -- command
               rtx_engine.cs_ctrl <= tx_fifo.rdata(3 downto 0); -- CS enable + CS select
-            else -- data
-              rtx_engine.sreg              <= tx_fifo.rdata(7 downto 0);
+            elsif (rx_stall = '0') then -- data
+              case ctrl.dwidth is -- MSB-aligned
+                when "00"   => rtx_engine.sreg <= tx_data(7 downto 0) & x"000000";
+                when "01"   => rtx_engine.sreg <= tx_data(15 downto 0) & x"0000";
+                when others => rtx_engine.sreg <= tx_data;
+              end case;
               rtx_engine.state(1 downto 0) <= "01";
             end if;
           end if;
@@ -272,11 +386,17 @@ begin
         when "111" => -- second phase of bit transmission
         -- ------------------------------------------------------------
           if (spi_clk_en = '1') then
-            rtx_engine.sreg <= rtx_engine.sreg(6 downto 0) & rtx_engine.sdi_sync; -- shift and set output
-            if (rtx_engine.bitcnt(3) = '1') then -- all bits transferred?
+            rtx_engine.sreg <= rtx_engine.sreg(30 downto 0) & rtx_engine.sdi_sync; -- shift and set output
+            if (frame_end = '1') then -- all bits transferred?
               rtx_engine.sck               <= ctrl.cpol;
               rtx_engine.done              <= '1'; -- done!
               rtx_engine.state(1 downto 0) <= "00"; -- transmission done
+              if (xfer_run = '1') then -- hardware-managed transfer
+                xfer.num <= std_ulogic_vector(unsigned(xfer.num) - 1);
+                if (xfer.num = x"000001") and (xfer.csen = '1') then -- last frame: release chip-select
+                  rtx_engine.cs_ctrl <= (others => '0');
+                end if;
+              end if;
             else
               rtx_engine.sck               <= ctrl.cpha xor ctrl.cpol;
               rtx_engine.state(1 downto 0) <= "10";
@@ -288,16 +408,22 @@ begin
           rtx_engine.sck               <= ctrl.cpol;
           rtx_engine.cs_ctrl           <= (others => '0');
           rtx_engine.state(1 downto 0) <= "00";
+          xfer.num                     <= (others => '0');
 
       end case;
     end if;
   end process transceiver;
 
+  -- all bits of current frame transferred --
+  frame_end <= rtx_engine.bitcnt(3) when (ctrl.dwidth = "00") else
+               rtx_engine.bitcnt(4) when (ctrl.dwidth = "01") else
+               rtx_engine.bitcnt(5);
+
   -- PHY busy flag --
   rtx_engine.busy <= '0' when (rtx_engine.state(1 downto 0) = "00") else '1';
 
   -- SPI output --
-  spi_dat_o <= rtx_engine.sreg(7); -- MSB first
+  spi_dat_o <= rtx_engine.sreg(31); -- MSB first
   spi_clk_o <= rtx_engine.sck;
 
   -- chip-select --
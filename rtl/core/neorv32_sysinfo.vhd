@@ -35,6 +35,7 @@ entity neorv32_sysinfo is
     CACHE_BLOCK_SIZE  : natural; -- i-cache/d-cache: block size in bytes (min 4), has to be a power of 2
     CACHE_BURSTS_EN   : boolean; -- i-cache/d-cache: enable issuing of burst transfer for cache update
     XBUS_EN           : boolean; -- implement external memory bus interface
+    XIP_EN            : boolean; -- implement execute-in-place module (XIP)
     OCD_EN            : boolean; -- implement OCD
     OCD_AUTH          : boolean; -- implement OCD authenticator
     IO_GPIO_EN        : boolean; -- implement general purpose IO port (GPIO)
@@ -54,6 +55,7 @@ entity neorv32_sysinfo is
     IO_ONEWIRE_EN     : boolean; -- implement 1-wire interface (ONEWIRE)
     IO_DMA_EN         : boolean; -- implement direct memory access controller (DMA)
     IO_SLINK_EN       : boolean; -- implement stream link interface (SLINK)
+    IO_MBOX_EN        : boolean; -- implement inter-core mailbox (MBOX)
     IO_TRACER_EN      : boolean  -- implement execution trace buffer (TRACER)
   );
   port (
@@ -115,8 +117,8 @@ begin
   sysinfo(2)(4)  <= '1' when OCD_EN            else '0'; -- on-chip debugger implemented
   sysinfo(2)(5)  <= '1' when ICACHE_EN         else '0'; -- processor-internal instruction cache implemented
   sysinfo(2)(6)  <= '1' when DCACHE_EN         else '0'; -- processor-internal data cache implemented
-  sysinfo(2)(7)  <= '0';                                 -- reserved
-  sysinfo(2)(8)  <= '0';                                 -- reserved
+  sysinfo(2)(7)  <= '1' when IO_MBOX_EN        else '0'; -- inter-core mailbox (MBOX) implemented
+  sysinfo(2)(8)  <= '1' when XIP_EN            else '0'; -- execute-in-place module (XIP) implemented
   sysinfo(2)(9)  <= '0';                                 -- reserved
   sysinfo(2)(10) <= '0';                                 -- reserved
   sysinfo(2)(11) <= '1' when OCD_AUTH          else '0'; -- on-chip debugger authentication implemented
@@ -103,6 +103,9 @@ entity neorv32_top is
     XBUS_TIMEOUT        : natural                        := 2048;          -- cycles after a pending bus access auto-terminates (0 = disabled)
     XBUS_REGSTAGE_EN    : boolean                        := false;         -- add XBUS register stage
 
+    -- Execute-in-place module (XIP) --
+    XIP_EN              : boolean                        := false;         -- implement execute-in-place module (XIP)
+
     -- Processor peripherals --
     IO_DISABLE_SYSINFO  : boolean                        := false;         -- disable the SYSINFO module (for advanced users only)
     IO_GPIO_NUM         : natural range 0 to 32          := 0;             -- number of GPIO input/output pairs
@@ -115,6 +118,7 @@ entity neorv32_top is
     IO_UART1_TX_FIFO    : natural range 1 to 2**15       := 1;             -- TX FIFO depth, has to be a power of two
     IO_SPI_EN           : boolean                        := false;         -- implement serial peripheral interface (SPI)
     IO_SPI_FIFO         : natural range 1 to 2**15       := 1;             -- RTX FIFO depth, has to be a power of two
+    IO_SPI_XFER_EN      : boolean                        := false;         -- implement hardware-managed transfers (XFER, DMA request)
     IO_SDI_EN           : boolean                        := false;         -- implement serial data interface (SDI)
     IO_SDI_FIFO         : natural range 1 to 2**15       := 1;             -- RTX FIFO depth, has to be zero or a power of two
     IO_TWI_EN           : boolean                        := false;         -- implement two-wire interface (TWI)
@@ -137,6 +141,8 @@ entity neorv32_top is
     IO_SLINK_EN         : boolean                        := false;         -- implement stream link interface (SLINK)
     IO_SLINK_RX_FIFO    : natural range 1 to 2**15       := 1;             -- RX FIFO depth, has to be a power of two
     IO_SLINK_TX_FIFO    : natural range 1 to 2**15       := 1;             -- TX FIFO depth, has to be a power of two
+    IO_MBOX_EN          : boolean                        := false;         -- implement inter-core mailbox (MBOX)
+    IO_MBOX_FIFO        : natural range 1 to 2**15       := 1;             -- per-hart inbox FIFO depth, has to be a power of two
     IO_TRACER_EN        : boolean                        := false;         -- implement instruction tracer
     IO_TRACER_BUFFER    : natural range 1 to 2**15       := 1;             -- trace buffer depth, has to be a power of two
     IO_TRACER_SIMLOG_EN : boolean                        := false          -- write full trace log to file (simulation-only)
@@ -205,6 +211,13 @@ entity neorv32_top is
     spi_dat_i      : in  std_ulogic := 'L';                                  -- controller data in, peripheral data out
     spi_csn_o      : out std_ulogic_vector(7 downto 0);                      -- chip-select, low-active
 
+    -- XIP (available if XIP_EN = true) --
+    xip_csn_o      : out std_ulogic;                                         -- chip-select, low-active
+    xip_clk_o      : out std_ulogic;                                         -- serial clock
+    xip_dat_i      : in  std_ulogic_vector(3 downto 0) := (others => 'L');   -- data input lanes (IO3..IO0)
+    xip_dat_o      : out std_ulogic_vector(3 downto 0);                      -- data output lanes (IO3..IO0)
+    xip_oe_o       : out std_ulogic_vector(3 downto 0);                      -- data output lanes enable (IO3..IO0)
+
     -- SDI (available if IO_SDI_EN = true) --
     sdi_clk_i      : in  std_ulogic := 'L';                                  -- SDI serial clock
     sdi_dat_o      : out std_ulogic;                                         -- controller data out, peripheral data in
@@ -297,6 +310,12 @@ architecture neorv32_top_rtl of neorv32_top is
   type cpu_trace_t is array (0 to num_cores_c-1) of trace_port_t;
   signal cpu_trace : cpu_trace_t;
 
+  -- CPU performance monitor events --
+  type cpu_hpm_t is array (0 to num_cores_c-1) of std_ulogic_vector(19 downto 14);
+  signal cpu_hpm : cpu_hpm_t;
+  signal ic_hit, ic_miss, dc_hit, dc_miss, core_wait : std_ulogic_vector(num_cores_c-1 downto 0);
+  signal sys_wait : std_ulogic;
+
   -- bus: CPU core complex --
   type core_complex_req_t is array (0 to num_cores_c-1) of bus_req_t;
   type core_complex_rsp_t is array (0 to num_cores_c-1) of bus_rsp_t;
@@ -304,15 +323,19 @@ architecture neorv32_top_rtl of neorv32_top is
   signal cpu_i_rsp, cpu_d_rsp, icache_rsp, dcache_rsp, core_rsp : core_complex_rsp_t;
 
   -- bus: system --
-  signal sys1_req, sys2_req, dma_req, amo_req, sys3_req, imem_req, dmem_req, io_req, xbus_req : bus_req_t;
-  signal sys1_rsp, sys2_rsp, dma_rsp, amo_rsp, sys3_rsp, imem_rsp, dmem_rsp, io_rsp, xbus_rsp : bus_rsp_t;
+  signal sys1_req, sys2_req, dma_req, amo_req, sys3_req, imem_req, dmem_req, io_req, xip_req, xbus_req : bus_req_t;
+  signal sys1_rsp, sys2_rsp, dma_rsp, amo_rsp, sys3_rsp, imem_rsp, dmem_rsp, io_rsp, xip_rsp, xbus_rsp : bus_rsp_t;
   signal xbus_terminate : std_ulogic;
+  signal dma_dreq       : std_ulogic_vector(3 downto 0);
+  signal spi_dreq       : std_ulogic;
+  signal tracer_dreq    : std_ulogic;
 
   -- bus: IO devices --
   type io_devices_enum_t is (
     IODEV_BOOTROM, IODEV_OCD, IODEV_SYSINFO, IODEV_NEOLED, IODEV_GPIO, IODEV_WDT, IODEV_TRNG,
     IODEV_TWI, IODEV_SPI, IODEV_SDI, IODEV_UART1, IODEV_UART0, IODEV_CLINT, IODEV_ONEWIRE,
-    IODEV_GPTMR, IODEV_PWM, IODEV_DMA, IODEV_SLINK, IODEV_CFS, IODEV_TWD, IODEV_TRACER
+    IODEV_GPTMR, IODEV_PWM, IODEV_DMA, IODEV_SLINK, IODEV_CFS, IODEV_TWD, IODEV_TRACER, IODEV_MBOX,
+    IODEV_XIP
   );
   type iodev_req_t is array (io_devices_enum_t) of bus_req_t;
   type iodev_rsp_t is array (io_devices_enum_t) of bus_rsp_t;
@@ -329,6 +352,11 @@ architecture neorv32_top_rtl of neorv32_top is
   signal cpu_firq : std_ulogic_vector(15 downto 0);
   signal mti, msi : std_ulogic_vector(num_cores_c-1 downto 0);
 
+  -- per-core fast interrupts --
+  type core_firq_t is array (0 to num_cores_c-1) of std_ulogic_vector(15 downto 0);
+  signal core_firq : core_firq_t;
+  signal mbox_irq  : std_ulogic_vector(num_cores_c-1 downto 0);
+
 begin
 
   -- **************************************************************************************************************************
@@ -358,6 +386,7 @@ begin
       cond_sel_string_f(ICACHE_EN,       "I-CACHE ",  "") &
       cond_sel_string_f(DCACHE_EN,       "D-CACHE ",  "") &
       cond_sel_string_f(XBUS_EN,         "XBUS ",     "") &
+      cond_sel_string_f(XIP_EN,          "XIP ",      "") &
       cond_sel_string_f(IO_CLINT_EN,     "CLINT ",    "") &
       cond_sel_string_f(io_gpio_en_c,    "GPIO ",     "") &
       cond_sel_string_f(IO_UART0_EN,     "UART0 ",    "") &
@@ -375,6 +404,7 @@ begin
       cond_sel_string_f(IO_ONEWIRE_EN,   "ONEWIRE ",  "") &
       cond_sel_string_f(IO_DMA_EN,       "DMA ",      "") &
       cond_sel_string_f(IO_SLINK_EN,     "SLINK ",    "") &
+      cond_sel_string_f(IO_MBOX_EN,      "MBOX ",     "") &
       cond_sel_string_f(io_sysinfo_en_c, "SYSINFO ",  "") &
       cond_sel_string_f(IO_TRACER_EN,    "TRACER ",   "") &
       cond_sel_string_f(OCD_EN,          "OCD ",      "") &
@@ -461,7 +491,7 @@ begin
   cpu_firq(1)  <= firq(FIRQ_CFS);
   cpu_firq(2)  <= firq(FIRQ_UART0);
   cpu_firq(3)  <= firq(FIRQ_UART1);
-  cpu_firq(4)  <= '0'; -- reserved
+  cpu_firq(4)  <= '0'; -- per-core mailbox interrupt, see below
   cpu_firq(5)  <= firq(FIRQ_TRACER);
   cpu_firq(6)  <= firq(FIRQ_SPI);
   cpu_firq(7)  <= firq(FIRQ_TWI);
@@ -478,6 +508,9 @@ begin
   core_complex_gen:
   for i in 0 to num_cores_c-1 generate
 
+    -- each core gets its own mailbox interrupt --
+    core_firq(i) <= cpu_firq(15 downto 5) & mbox_irq(i) & cpu_firq(3 downto 0);
+
     -- CPU Core -------------------------------------------------------------------------------
     -- -------------------------------------------------------------------------------------------
     neorv32_cpu_inst: entity neorv32.neorv32_cpu
@@ -547,8 +580,10 @@ begin
       msi_i      => msi(i),
       mei_i      => irq_mei_i,
       mti_i      => mti(i),
-      firq_i     => cpu_firq,
+      firq_i     => core_firq(i),
       dbi_i      => dci_haltreq(i),
+      -- SoC performance monitor events --
+      hpm_i      => cpu_hpm(i),
       -- instruction bus interface --
       ibus_req_o => cpu_i_req(i),
       ibus_rsp_i => cpu_i_rsp(i),
@@ -575,7 +610,9 @@ begin
         host_req_i => cpu_i_req(i),
         host_rsp_o => cpu_i_rsp(i),
         bus_req_o  => icache_req(i),
-        bus_rsp_i  => icache_rsp(i)
+        bus_rsp_i  => icache_rsp(i),
+        hit_o      => ic_hit(i),
+        miss_o     => ic_miss(i)
       );
     end generate;
 
@@ -583,6 +620,8 @@ begin
     if not ICACHE_EN generate
       icache_req(i) <= cpu_i_req(i);
       cpu_i_rsp(i)  <= icache_rsp(i);
+      ic_hit(i)     <= '0';
+      ic_miss(i)    <= '0';
     end generate;
 
     -- CPU Data Cache -------------------------------------------------------------------------
@@ -603,7 +642,9 @@ begin
         host_req_i => cpu_d_req(i),
         host_rsp_o => cpu_d_rsp(i),
         bus_req_o  => dcache_req(i),
-        bus_rsp_i  => dcache_rsp(i)
+        bus_rsp_i  => dcache_rsp(i),
+        hit_o      => dc_hit(i),
+        miss_o     => dc_miss(i)
       );
     end generate;
 
@@ -611,6 +652,8 @@ begin
     if not DCACHE_EN generate
       dcache_req(i) <= cpu_d_req(i);
       cpu_d_rsp(i)  <= dcache_rsp(i);
+      dc_hit(i)     <= '0';
+      dc_miss(i)    <= '0';
     end generate;
 
     -- Core Instruction/Data Bus Switch -------------------------------------------------------
@@ -632,6 +675,9 @@ begin
       x_rsp_i => core_rsp(i)
     );
 
+    -- SoC performance monitor events; stalls of the DMA bus switch are attributed to all cores --
+    cpu_hpm(i) <= dma_req.stb & (core_wait(i) or sys_wait) & dc_miss(i) & dc_hit(i) & ic_miss(i) & ic_hit(i);
+
   end generate;
 
   -- CPU execution trace ports --
@@ -649,21 +695,24 @@ begin
       B_READ_ONLY    => false
     )
     port map (
-      clk_i   => clk_i,
-      rstn_i  => rstn_sys,
-      a_req_i => core_req(core_req'left),
-      a_rsp_o => core_rsp(core_rsp'left),
-      b_req_i => core_req(core_req'right),
-      b_rsp_o => core_rsp(core_rsp'right),
-      x_req_o => sys1_req,
-      x_rsp_i => sys1_rsp
+      clk_i    => clk_i,
+      rstn_i   => rstn_sys,
+      a_req_i  => core_req(core_req'left),
+      a_rsp_o  => core_rsp(core_rsp'left),
+      b_req_i  => core_req(core_req'right),
+      b_rsp_o  => core_rsp(core_rsp'right),
+      x_req_o  => sys1_req,
+      x_rsp_i  => sys1_rsp,
+      a_wait_o => core_wait(0),
+      b_wait_o => core_wait(1)
     );
   end generate;
 
   core_complex_single:
   if num_cores_c = 1 generate
-    sys1_req    <= core_req(0);
-    core_rsp(0) <= sys1_rsp;
+    sys1_req     <= core_req(0);
+    core_rsp(0)  <= sys1_rsp;
+    core_wait(0) <= '0';
   end generate;
 
   -- **************************************************************************************************************************
@@ -686,9 +735,13 @@ begin
       bus_rsp_o => iodev_rsp(IODEV_DMA),
       dma_req_o => dma_req,
       dma_rsp_i => dma_rsp,
+      dreq_i    => dma_dreq,
       irq_o     => firq(FIRQ_DMA)
     );
 
+    -- DMA request sources (flow control), selected by the descriptor's DSEL field --
+    dma_dreq <= "00" & tracer_dreq & spi_dreq;
+
     -- DMA Bus Switch -------------------------------------------------------------------------
     -- -------------------------------------------------------------------------------------------
     neorv32_dma_bus_switch_inst: entity neorv32.neorv32_bus_switch
@@ -698,14 +751,16 @@ begin
       B_READ_ONLY    => false
     )
     port map (
-      clk_i   => clk_i,
-      rstn_i  => rstn_sys,
-      a_req_i => sys1_req, -- CPU accesses are prioritized
-      a_rsp_o => sys1_rsp,
-      b_req_i => dma_req,
-      b_rsp_o => dma_rsp,
-      x_req_o => sys2_req,
-      x_rsp_i => sys2_rsp
+      clk_i    => clk_i,
+      rstn_i   => rstn_sys,
+      a_req_i  => sys1_req, -- CPU accesses are prioritized
+      a_rsp_o  => sys1_rsp,
+      b_req_i  => dma_req,
+      b_rsp_o  => dma_rsp,
+      x_req_o  => sys2_req,
+      x_rsp_i  => sys2_rsp,
+      a_wait_o => sys_wait, -- CPU access blocked by DMA access
+      b_wait_o => open
     );
 
   end generate;
@@ -718,6 +773,7 @@ begin
     firq(FIRQ_DMA)       <= '0';
     dma_req              <= req_terminate_c;
     dma_rsp              <= rsp_terminate_c;
+    sys_wait             <= '0';
   end generate;
 
   -- **************************************************************************************************************************
@@ -791,6 +847,10 @@ begin
     C_EN    => true,
     C_BASE  => mem_io_base_c,
     C_SIZE  => mem_io_size_c,
+    -- port D: XIP flash window --
+    D_EN    => XIP_EN,
+    D_BASE  => mem_xip_base_c,
+    D_SIZE  => mem_xip_size_c,
     -- port X (the void): XBUS --
     X_EN    => XBUS_EN
   )
@@ -809,6 +869,8 @@ begin
     b_rsp_i => dmem_rsp,
     c_req_o => io_req,
     c_rsp_i => io_rsp,
+    d_req_o => xip_req,
+    d_rsp_i => xip_rsp,
     x_req_o => xbus_req,
     x_rsp_i => xbus_rsp
   );
@@ -906,6 +968,37 @@ begin
       xbus_cyc_o <= '0';
     end generate;
 
+    -- Execute In Place Module (XIP) ----------------------------------------------------------
+    -- -------------------------------------------------------------------------------------------
+    neorv32_xip_enabled:
+    if XIP_EN generate
+      neorv32_xip_inst: entity neorv32.neorv32_xip
+      port map (
+        clk_i     => clk_i,
+        rstn_i    => rstn_sys,
+        bus_req_i => iodev_req(IODEV_XIP),
+        bus_rsp_o => iodev_rsp(IODEV_XIP),
+        xip_req_i => xip_req,
+        xip_rsp_o => xip_rsp,
+        clkgen_i  => clk_gen,
+        xip_csn_o => xip_csn_o,
+        xip_clk_o => xip_clk_o,
+        xip_dat_i => xip_dat_i,
+        xip_dat_o => xip_dat_o,
+        xip_oe_o  => xip_oe_o
+      );
+    end generate;
+
+    neorv32_xip_disabled:
+    if not XIP_EN generate
+      iodev_rsp(IODEV_XIP) <= rsp_terminate_c;
+      xip_rsp              <= rsp_terminate_c;
+      xip_csn_o            <= '1';
+      xip_clk_o            <= '0';
+      xip_dat_o            <= (others => '0');
+      xip_oe_o             <= (others => '0');
+    end generate;
+
   end generate;
 
   -- **************************************************************************************************************************
@@ -934,8 +1027,8 @@ begin
       DEV_11_EN => IO_CFS_EN,       DEV_11_BASE => base_io_cfs_c,
       DEV_12_EN => IO_SLINK_EN,     DEV_12_BASE => base_io_slink_c,
       DEV_13_EN => IO_DMA_EN,       DEV_13_BASE => base_io_dma_c,
-      DEV_14_EN => false,           DEV_14_BASE => (others => '0'), -- reserved
-      DEV_15_EN => false,           DEV_15_BASE => (others => '0'), -- reserved
+      DEV_14_EN => IO_MBOX_EN,      DEV_14_BASE => base_io_mbox_c,
+      DEV_15_EN => XIP_EN,          DEV_15_BASE => base_io_xip_c,
       DEV_16_EN => io_pwm_en_c,     DEV_16_BASE => base_io_pwm_c,
       DEV_17_EN => io_gptmr_en_c,   DEV_17_BASE => base_io_gptmr_c,
       DEV_18_EN => IO_ONEWIRE_EN,   DEV_18_BASE => base_io_onewire_c,
@@ -972,8 +1065,8 @@ begin
       dev_11_req_o => iodev_req(IODEV_CFS),     dev_11_rsp_i => iodev_rsp(IODEV_CFS),
       dev_12_req_o => iodev_req(IODEV_SLINK),   dev_12_rsp_i => iodev_rsp(IODEV_SLINK),
       dev_13_req_o => iodev_req(IODEV_DMA),     dev_13_rsp_i => iodev_rsp(IODEV_DMA),
-      dev_14_req_o => open,                     dev_14_rsp_i => rsp_terminate_c, -- reserved
-      dev_15_req_o => open,                     dev_15_rsp_i => rsp_terminate_c, -- reserved
+      dev_14_req_o => iodev_req(IODEV_MBOX),    dev_14_rsp_i => iodev_rsp(IODEV_MBOX),
+      dev_15_req_o => iodev_req(IODEV_XIP),     dev_15_rsp_i => iodev_rsp(IODEV_XIP),
       dev_16_req_o => iodev_req(IODEV_PWM),     dev_16_rsp_i => iodev_rsp(IODEV_PWM),
       dev_17_req_o => iodev_req(IODEV_GPTMR),   dev_17_rsp_i => iodev_rsp(IODEV_GPTMR),
       dev_18_req_o => iodev_req(IODEV_ONEWIRE), dev_18_rsp_i => iodev_rsp(IODEV_ONEWIRE),
@@ -1205,7 +1298,8 @@ begin
     if IO_SPI_EN generate
       neorv32_spi_inst: entity neorv32.neorv32_spi
       generic map (
-        IO_SPI_FIFO => IO_SPI_FIFO
+        IO_SPI_FIFO    => IO_SPI_FIFO,
+        IO_SPI_XFER_EN => IO_SPI_XFER_EN
       )
       port map (
         clk_i     => clk_i,
@@ -1217,7 +1311,8 @@ begin
         spi_dat_o => spi_dat_o,
         spi_dat_i => spi_dat_i,
         spi_csn_o => spi_csn_o,
-        irq_o     => firq(FIRQ_SPI)
+        irq_o     => firq(FIRQ_SPI),
+        dreq_o    => spi_dreq
       );
     end generate;
 
@@ -1228,6 +1323,7 @@ begin
       spi_dat_o            <= '0';
       spi_csn_o            <= (others => '1');
       firq(FIRQ_SPI)       <= '0';
+      spi_dreq             <= '0';
     end generate;
 
     -- Two-Wire Interface (TWI) ---------------------------------------------------------------
@@ -1454,6 +1550,30 @@ begin
       slink_tx_lst_o         <= '0';
     end generate;
 
+    -- Inter-Core Mailbox (MBOX) --------------------------------------------------------------
+    -- -------------------------------------------------------------------------------------------
+    neorv32_mbox_enabled:
+    if IO_MBOX_EN generate
+      neorv32_mbox_inst: entity neorv32.neorv32_mbox
+      generic map (
+        NUM_HARTS  => num_cores_c,
+        FIFO_DEPTH => IO_MBOX_FIFO
+      )
+      port map (
+        clk_i     => clk_i,
+        rstn_i    => rstn_sys,
+        bus_req_i => iodev_req(IODEV_MBOX),
+        bus_rsp_o => iodev_rsp(IODEV_MBOX),
+        irq_o     => mbox_irq
+      );
+    end generate;
+
+    neorv32_mbox_disabled:
+    if not IO_MBOX_EN generate
+      iodev_rsp(IODEV_MBOX) <= rsp_terminate_c;
+      mbox_irq              <= (others => '0');
+    end generate;
+
     -- Execution Tracer (TRACER) --------------------------------------------------------------
     -- -------------------------------------------------------------------------------------------
     neorv32_tracer_enabled:
@@ -1473,7 +1593,8 @@ begin
         trace1_i  => cpu_trace(cpu_trace'right),
         bus_req_i => iodev_req(IODEV_TRACER),
         bus_rsp_o => iodev_rsp(IODEV_TRACER),
-        irq_o     => firq(FIRQ_TRACER)
+        irq_o     => firq(FIRQ_TRACER),
+        dreq_o    => tracer_dreq
       );
     end generate;
 
@@ -1481,6 +1602,7 @@ begin
     if not IO_TRACER_EN generate
       iodev_rsp(IODEV_TRACER) <= rsp_terminate_c;
       firq(FIRQ_TRACER)       <= '0';
+      tracer_dreq             <= '0';
     end generate;
 
     -- System Configuration Information Memory (SYSINFO) --------------------------------------
@@ -1507,6 +1629,7 @@ begin
         CACHE_BLOCK_SIZE  => CACHE_BLOCK_SIZE,
         CACHE_BURSTS_EN   => CACHE_BURSTS_EN,
         XBUS_EN           => XBUS_EN,
+        XIP_EN            => XIP_EN,
         OCD_EN            => OCD_EN,
         OCD_AUTH          => ocd_auth_en_c,
         IO_GPIO_EN        => io_gpio_en_c,
@@ -1526,6 +1649,7 @@ begin
         IO_ONEWIRE_EN     => IO_ONEWIRE_EN,
         IO_DMA_EN         => IO_DMA_EN,
         IO_SLINK_EN       => IO_SLINK_EN,
+        IO_MBOX_EN        => IO_MBOX_EN,
         IO_TRACER_EN      => IO_TRACER_EN
       )
       port map (
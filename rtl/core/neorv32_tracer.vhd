@@ -3,7 +3,7 @@
 -- -------------------------------------------------------------------------------- --
 -- The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              --
 -- Copyright (c) NEORV32 contributors.                                              --
--- Copyright (c) 2020 - 2025 Stephan Nolting. All rights reserved.                  --
+-- Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  --
 -- Licensed under the BSD-3-Clause license, see LICENSE for details.                --
 -- SPDX-License-Identifier: BSD-3-Clause                                            --
 -- ================================================================================ --
@@ -30,7 +30,8 @@ entity neorv32_tracer is
     trace1_i  : in  trace_port_t; -- CPU 1 trace port
     bus_req_i : in  bus_req_t;    -- bus request
     bus_rsp_o : out bus_rsp_t;    -- bus response
-    irq_o     : out std_ulogic    -- tracing-done interrupt
+    irq_o     : out std_ulogic;   -- tracing-done interrupt
+    dreq_o    : out std_ulogic    -- DMA request: compressed trace data available
   );
 end neorv32_tracer;
 
@@ -46,13 +47,16 @@ architecture neorv32_tracer_rtl of neorv32_tracer is
   constant ctrl_irq_clr_c : natural :=  6; -- r/w: clear pending interrupt by writing one
   constant data_tbm_lsb_c : natural :=  7; -- r/-: log2(RX FIFO size) LSB
   constant data_tbm_msb_c : natural := 10; -- r/-: log2(RX FIFO size) MSB
+  constant ctrl_cmode_c   : natural := 11; -- r/w: compressed trace mode (branch maps + addresses)
+  constant ctrl_lost_c    : natural := 12; -- r/-: compressed trace data lost due to buffer overflow
 
   -- helpers --
   constant log2_fifo_size_c : natural := index_size_f(TRACE_DEPTH);
 
   -- control registers --
-  signal ctrl_en, ctrl_hsel, ctrl_start, ctrl_stop, ctrl_iclr : std_ulogic;
+  signal ctrl_en, ctrl_hsel, ctrl_start, ctrl_stop, ctrl_iclr, ctrl_cmode : std_ulogic;
   signal stop_addr : std_ulogic_vector(30 downto 0);
+  signal rd_hi     : std_ulogic; -- compressed mode: read high word of current packet next
 
   -- trace arbiter --
   type arbiter_t is record
@@ -67,6 +71,22 @@ architecture neorv32_tracer_rtl of neorv32_tracer is
   end record;
   signal arbiter : arbiter_t;
 
+  -- compressed trace encoder --
+  type enc_queue_t is array (0 to 2) of std_ulogic_vector(63 downto 0);
+  type encoder_t is record
+    active : std_ulogic; -- compressed tracing in progress
+    first  : std_ulogic; -- next instruction is the first one
+    icnt   : unsigned(26 downto 0); -- instructions since last address packet
+    bmap   : std_ulogic_vector(55 downto 0); -- branch map (taken = 1), LSB = oldest
+    bcnt   : unsigned(5 downto 0); -- number of valid bits in branch map
+    last   : std_ulogic_vector(31 downto 0); -- address of last traced instruction
+    resync : std_ulogic; -- packets were dropped; next address packet restarts the trace
+    lost   : std_ulogic; -- sticky: packets were dropped during current trace
+    queue  : enc_queue_t; -- output staging queue
+    qlvl   : natural range 0 to 3; -- output staging queue fill level
+  end record;
+  signal enc : encoder_t;
+
   -- trace buffer interface --
   type fifo_t is record
     we,    re    : std_ulogic; -- write/read enable
@@ -94,7 +114,9 @@ begin
       ctrl_start <= '0';
       ctrl_stop  <= '0';
       ctrl_iclr  <= '0';
+      ctrl_cmode <= '0';
       stop_addr  <= (others => '0');
+      rd_hi      <= '0';
     elsif rising_edge(clk_i) then
       -- bus handshake --
       bus_rsp_o.ack <= bus_req_i.stb;
@@ -110,6 +132,7 @@ begin
           ctrl_start <= bus_req_i.data(ctrl_start_c);
           ctrl_stop  <= bus_req_i.data(ctrl_stop_c);
           ctrl_iclr  <= bus_req_i.data(ctrl_irq_clr_c);
+          ctrl_cmode <= bus_req_i.data(ctrl_cmode_c);
         end if;
         if (bus_req_i.addr(3 downto 2) = "01") then -- stop-address register
           stop_addr <= bus_req_i.data(31 downto 1);
@@ -122,17 +145,33 @@ begin
           when "00" => -- control register
             bus_rsp_o.data(ctrl_enable_c) <= ctrl_en;
             bus_rsp_o.data(ctrl_hsel_c)   <= ctrl_hsel and bool_to_ulogic_f(DUAL_CORE_EN);
-            bus_rsp_o.data(ctrl_run_c)    <= arbiter.run;
+            bus_rsp_o.data(ctrl_run_c)    <= arbiter.run or enc.active or bool_to_ulogic_f(enc.qlvl /= 0); -- including encoder flush
             bus_rsp_o.data(ctrl_avail_c)  <= fifo.avail;
             bus_rsp_o.data(data_tbm_msb_c downto data_tbm_lsb_c) <= std_ulogic_vector(to_unsigned(log2_fifo_size_c, 4));
+            bus_rsp_o.data(ctrl_cmode_c)  <= ctrl_cmode;
+            bus_rsp_o.data(ctrl_lost_c)   <= enc.lost;
           when "01" => -- stop-address register
             bus_rsp_o.data <= stop_addr & '0';
-          when "10" => -- trace data: source
-            bus_rsp_o.data <= fifo.rdata(31 downto 0);
+          when "10" => -- trace data: source / compressed trace stream
+            if (ctrl_cmode = '0') then
+              bus_rsp_o.data <= fifo.rdata(31 downto 0);
+            elsif (fifo.avail = '1') then -- packet low word first, then high word
+              if (rd_hi = '0') then
+                bus_rsp_o.data <= fifo.rdata(31 downto 0);
+              else
+                bus_rsp_o.data <= fifo.rdata(63 downto 32);
+              end if;
+            end if;
           when others => -- trace data: destination
             bus_rsp_o.data <= fifo.rdata(63 downto 32);
         end case;
       end if;
+      -- compressed stream word select --
+      if (ctrl_en = '0') or (ctrl_cmode = '0') then
+        rd_hi <= '0';
+      elsif (bus_req_i.stb = '1') and (bus_req_i.rw = '0') and (bus_req_i.addr(3 downto 2) = "10") and (fifo.avail = '1') then
+        rd_hi <= not rd_hi;
+      end if;
     end if;
   end process bus_access;
 
@@ -181,13 +220,151 @@ begin
     end if;
   end process trace_arbiter;
 
-  -- push to trace buffer --
-  arbiter.push <= '1' when (arbiter.valid = "11") and (arbiter.delta = '1') else '0';
+  -- push to trace buffer (delta mode only) --
+  arbiter.push <= '1' when (arbiter.valid = "11") and (arbiter.delta = '1') and (ctrl_cmode = '0') else '0';
 
   -- automatic stop if reaching stop address --
   arbiter.astop <= '1' when (arbiter.dst(31 downto 1) = stop_addr) and (arbiter.valid(0) = '1') else '0';
 
 
+  -- Compressed Trace Encoder ---------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- Each instruction is either covered by a branch map bit (conditional branches), is fully
+  -- inferable from the program binary (linear instructions and direct jumps) or ends a trace
+  -- segment (indirect jumps, trap returns, trap entries). Packets are 64 bit (w1 & w0):
+  -- BRANCH:  w0 = map(23:0) & count(5:0) & "01"; w1 = map(55:24); map LSB = oldest branch
+  -- ADDRESS: w0 = icnt(26:0) & resync & kind(1:0) & "10"; w1 = address
+  --          kind: 00 = jump (w1 = target), 01 = trap (w1 = handler),
+  --                10 = start/sync (w1 = next instruction), 11 = stop (w1 = last instruction)
+  --          icnt: number of instructions executed since the previous address packet
+  trace_encoder: process(rstn_i, clk_i)
+    variable enc_v : encoder_t;
+    variable seq_v : std_ulogic_vector(31 downto 0);
+    variable br_v  : std_ulogic;
+
+    -- append packet to output queue; data is lost if the queue is full --
+    procedure enqueue(pkt : std_ulogic_vector(63 downto 0)) is
+    begin
+      if (enc_v.qlvl = 3) then
+        enc_v.resync := '1';
+        enc_v.lost   := '1';
+      else
+        enc_v.queue(enc_v.qlvl) := pkt;
+        enc_v.qlvl := enc_v.qlvl + 1;
+      end if;
+    end procedure enqueue;
+
+    -- emit branch map (discarded while waiting for resynchronization) --
+    procedure emit_branch is
+    begin
+      if (enc_v.bcnt /= 0) and (enc_v.resync = '0') then
+        enqueue(enc_v.bmap(55 downto 24) & enc_v.bmap(23 downto 0) & std_ulogic_vector(enc_v.bcnt) & "01");
+      end if;
+      enc_v.bmap := (others => '0');
+      enc_v.bcnt := (others => '0');
+    end procedure emit_branch;
+
+    -- emit address packet and start a new trace segment --
+    procedure emit_addr(kind : std_ulogic_vector(1 downto 0); addr : std_ulogic_vector(31 downto 0)) is
+    begin
+      if (enc_v.resync = '1') then -- restart trace: drop pending branch information
+        enc_v.bmap := (others => '0');
+        enc_v.bcnt := (others => '0');
+      end if;
+      enqueue(addr & std_ulogic_vector(enc_v.icnt) & enc_v.resync & kind & "10");
+      enc_v.resync := '0';
+      enc_v.icnt   := (others => '0');
+    end procedure emit_addr;
+
+  begin
+    if (rstn_i = '0') then
+      enc.active <= '0';
+      enc.first  <= '0';
+      enc.icnt   <= (others => '0');
+      enc.bmap   <= (others => '0');
+      enc.bcnt   <= (others => '0');
+      enc.last   <= (others => '0');
+      enc.resync <= '0';
+      enc.lost   <= '0';
+      enc.queue  <= (others => (others => '0'));
+      enc.qlvl   <= 0;
+    elsif rising_edge(clk_i) then
+      enc_v := enc;
+
+      -- output queue: one packet per cycle to the trace buffer --
+      if (enc_v.qlvl /= 0) then
+        if (fifo.free = '0') then -- trace buffer full: drop all staged packets
+          enc_v.qlvl   := 0;
+          enc_v.resync := '1';
+          enc_v.lost   := '1';
+        else
+          enc_v.queue(0 to 1) := enc_v.queue(1 to 2);
+          enc_v.qlvl := enc_v.qlvl - 1;
+        end if;
+      end if;
+
+      -- encoder --
+      if (ctrl_en = '0') or (ctrl_cmode = '0') then -- module disabled or delta mode
+        enc_v.active := '0';
+        enc_v.qlvl   := 0;
+        enc_v.lost   := '0';
+      elsif (enc_v.active = '0') then -- wait for trace start
+        if (arbiter.run = '1') then
+          enc_v.active := '1';
+          enc_v.first  := '1';
+          enc_v.icnt   := (others => '0');
+          enc_v.bmap   := (others => '0');
+          enc_v.bcnt   := (others => '0');
+          enc_v.resync := '0';
+          enc_v.lost   := '0';
+        end if;
+      elsif (arbiter.run = '0') then -- trace stopped: flush branch map and send stop packet
+        emit_branch;
+        emit_addr("11", enc_v.last);
+        enc_v.active := '0';
+      elsif (trace_src.valid = '1') and (trace_src.debug = '0') and (ctrl_stop = '0') then -- valid trace packet and not in debug-mode
+        if (trace_src.compr = '1') then
+          seq_v := std_ulogic_vector(unsigned(trace_src.pc_rdata) + 2);
+        else
+          seq_v := std_ulogic_vector(unsigned(trace_src.pc_rdata) + 4);
+        end if;
+        br_v := '0';
+        if (trace_src.pc_wdata /= seq_v) then
+          br_v := '1';
+        end if;
+        -- new segment at trace start or trap entry --
+        if (enc_v.first = '1') then
+          emit_addr("10", trace_src.pc_rdata);
+          enc_v.first := '0';
+        elsif (trace_src.intr = '1') then
+          emit_addr("01", trace_src.pc_rdata);
+        end if;
+        enc_v.icnt := enc_v.icnt + 1;
+        -- control flow --
+        if (trace_src.insn(6 downto 0) = opcode_branch_c) and (trace_src.trap = '0') then -- conditional branch: add to branch map
+          enc_v.bmap(to_integer(enc_v.bcnt)) := br_v;
+          enc_v.bcnt := enc_v.bcnt + 1;
+          if (enc_v.bcnt = 56) then
+            emit_branch;
+          end if;
+        elsif (trace_src.insn(6 downto 0) /= opcode_jal_c) and (trace_src.trap = '0') and (br_v = '1') then -- uninferable jump
+          emit_addr("00", trace_src.pc_wdata);
+        end if;
+        -- periodic sync to prevent instruction counter overflow --
+        if (and_reduce_f(std_ulogic_vector(enc_v.icnt)) = '1') and (trace_src.trap = '0') then
+          emit_addr("10", trace_src.pc_wdata);
+        end if;
+        enc_v.last := trace_src.pc_rdata;
+      end if;
+
+      enc <= enc_v;
+    end if;
+  end process trace_encoder;
+
+  -- DMA request: compressed trace data available --
+  dreq_o <= ctrl_cmode and fifo.avail;
+
+
   -- Interrupt Generator --------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   irq_generator: process(rstn_i, clk_i)
@@ -231,19 +408,20 @@ begin
 
   -- FIFO access --
   fifo.clear <= not ctrl_en;
-  fifo.we    <= arbiter.push;
-  fifo.wdata <= arbiter.dst & arbiter.src;
+  fifo.we    <= arbiter.push when (ctrl_cmode = '0') else bool_to_ulogic_f(enc.qlvl /= 0);
+  fifo.wdata <= (arbiter.dst & arbiter.src) when (ctrl_cmode = '0') else enc.queue(0);
   fifo.re    <= '1' when (over_trash = '1') or
-                         ((bus_req_i.stb = '1') and (bus_req_i.rw = '0') and (bus_req_i.addr(3 downto 2) = "11")) else '0';
+                         ((bus_req_i.stb = '1') and (bus_req_i.rw = '0') and (ctrl_cmode = '0') and (bus_req_i.addr(3 downto 2) = "11")) or
+                         ((bus_req_i.stb = '1') and (bus_req_i.rw = '0') and (ctrl_cmode = '1') and (bus_req_i.addr(3 downto 2) = "10") and (rd_hi = '1')) else '0';
 
-  -- discard oldest entry if overflowing --
+  -- discard oldest entry if overflowing (delta mode only) --
   discard: process(rstn_i, clk_i)
   begin
     if (rstn_i = '0') then
       over_check <= '0';
       over_trash <= '0';
     elsif rising_edge(clk_i) then
-      if (over_check = '0') or (ctrl_en = '0') or (arbiter.run = '0') then
+      if (over_check = '0') or (ctrl_en = '0') or (arbiter.run = '0') or (ctrl_cmode = '1') then
         over_check <= not fifo.free;
         over_trash <= '0';
       else
@@ -3,7 +3,7 @@
 -- -------------------------------------------------------------------------------- --
 -- The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              --
 -- Copyright (c) NEORV32 contributors.                                              --
--- Copyright (c) 2020 - 2025 Stephan Nolting. All rights reserved.                  --
+-- Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  --
 -- Licensed under the BSD-3-Clause license, see LICENSE for details.                --
 -- SPDX-License-Identifier: BSD-3-Clause                                            --
 -- ================================================================================ --
@@ -58,6 +58,8 @@ architecture neorv32_uart_rtl of neorv32_uart is
   constant ctrl_irq_rx_full_c   : natural := 21; -- r/w: IRQ if RX FIFO full
   constant ctrl_irq_tx_empty_c  : natural := 22; -- r/w: IRQ if TX FIFO empty
   constant ctrl_irq_tx_nfull_c  : natural := 23; -- r/w: IRQ if TX FIFO not full
+  constant ctrl_irq_rx_tout_c   : natural := 24; -- r/w: IRQ on RX timeout
+  constant ctrl_rx_tout_c       : natural := 25; -- r/-: RX timeout (line idle and RX FIFO not empty)
   --
   constant ctrl_rx_over_c       : natural := 30; -- r/-: RX FIFO overflow
   constant ctrl_tx_busy_c       : natural := 31; -- r/-: UART transmitter is busy and TX FIFO not empty
@@ -70,12 +72,33 @@ architecture neorv32_uart_rtl of neorv32_uart is
   constant data_tx_fifo_lsb : natural := 12; -- r/-: log2(TX FIFO size) LSB
   constant data_tx_fifo_msb : natural := 15; -- r/-: log2(TX FIFO size) MSB
 
+  -- baud register bits --
+  constant baud_frac_lsb_c : natural :=  0; -- r/w: fractional divider, LSB
+  constant baud_frac_msb_c : natural :=  3; -- r/w: fractional divider, MSB
+  constant baud_div_lsb_c  : natural :=  4; -- r/w: integer divider, LSB
+  constant baud_div_msb_c  : natural := 19; -- r/w: integer divider, MSB
+  constant baud_osr_lsb_c  : natural := 20; -- r/w: oversampling ratio - 1, LSB
+  constant baud_osr_msb_c  : natural := 23; -- r/w: oversampling ratio - 1, MSB
+  constant baud_rto_lsb_c  : natural := 24; -- r/w: RX timeout in character times - 1, LSB
+  constant baud_rto_msb_c  : natural := 27; -- r/w: RX timeout in character times - 1, MSB
+  constant baud_fen_c      : natural := 31; -- r/w: fractional baud rate generator enable
+
   -- helpers --
   constant log2_rx_fifo_c : natural := index_size_f(UART_RX_FIFO);
   constant log2_tx_fifo_c : natural := index_size_f(UART_TX_FIFO);
 
   -- clock generator --
-  signal uart_clk : std_ulogic;
+  signal uart_clk : std_ulogic; -- sample tick
+  signal baud_rld : std_ulogic_vector(9 downto 0); -- sample ticks per bit - 1
+
+  -- fractional baud rate generator --
+  type frac_gen_t is record
+    cnt  : std_ulogic_vector(15 downto 0); -- cycle counter
+    acc  : std_ulogic_vector(3 downto 0); -- fraction accumulator
+    tick : std_ulogic; -- sample tick
+  end record;
+  signal frac_gen : frac_gen_t;
+  signal frac_sum : std_ulogic_vector(4 downto 0);
 
   -- control register --
   type ctrl_t is record
@@ -88,6 +111,12 @@ architecture neorv32_uart_rtl of neorv32_uart is
     irq_rx_full   : std_ulogic;
     irq_tx_empty  : std_ulogic;
     irq_tx_nfull  : std_ulogic;
+    irq_rx_tout   : std_ulogic;
+    fen           : std_ulogic;
+    frac          : std_ulogic_vector(3 downto 0);
+    div           : std_ulogic_vector(15 downto 0);
+    osr           : std_ulogic_vector(3 downto 0);
+    rto           : std_ulogic_vector(3 downto 0);
   end record;
   signal ctrl : ctrl_t;
 
@@ -98,10 +127,20 @@ architecture neorv32_uart_rtl of neorv32_uart is
     bitcnt  : std_ulogic_vector(3 downto 0); -- frame bit counter
     baudcnt : std_ulogic_vector(9 downto 0); -- baud rate counter
     sync    : std_ulogic_vector(2 downto 0); -- input synchronizer
+    vote    : std_ulogic_vector(1 downto 0); -- previous samples for majority vote
     done    : std_ulogic; -- operation done
   end record;
   signal tx_engine, rx_engine : serial_engine_t;
-  signal rx_overrun : std_ulogic;
+  signal rx_overrun, rx_vote, rx_sample : std_ulogic;
+
+  -- RX timeout --
+  type rx_tout_t is record
+    tcnt : std_ulogic_vector(9 downto 0); -- sample tick counter
+    bcnt : std_ulogic_vector(3 downto 0); -- bit counter
+    ccnt : std_ulogic_vector(3 downto 0); -- character counter
+    flag : std_ulogic; -- timeout
+  end record;
+  signal rx_tout : rx_tout_t;
 
   -- FIFO interface --
   type fifo_t is record
@@ -128,6 +167,12 @@ begin
       ctrl.irq_rx_full   <= '0';
       ctrl.irq_tx_empty  <= '0';
       ctrl.irq_tx_nfull  <= '0';
+      ctrl.irq_rx_tout   <= '0';
+      ctrl.fen           <= '0';
+      ctrl.frac          <= (others => '0');
+      ctrl.div           <= (others => '0');
+      ctrl.osr           <= (others => '0');
+      ctrl.rto           <= (others => '0');
     elsif rising_edge(clk_i) then
       -- bus handshake --
       bus_rsp_o.ack  <= bus_req_i.stb;
@@ -136,7 +181,7 @@ begin
       -- bus access --
       if (bus_req_i.stb = '1') then
         if (bus_req_i.rw = '1') then -- write access
-          if (bus_req_i.addr(2) = '0') then -- control register
+          if (bus_req_i.addr(3 downto 2) = "00") then -- control register
             ctrl.enable        <= bus_req_i.data(ctrl_en_c);
             ctrl.sim_mode      <= bus_req_i.data(ctrl_sim_en_c) and bool_to_ulogic_f(is_simulation_c);
             ctrl.hwfc_en       <= bus_req_i.data(ctrl_hwfc_en_c);
@@ -146,9 +191,17 @@ begin
             ctrl.irq_rx_full   <= bus_req_i.data(ctrl_irq_rx_full_c);
             ctrl.irq_tx_empty  <= bus_req_i.data(ctrl_irq_tx_empty_c);
             ctrl.irq_tx_nfull  <= bus_req_i.data(ctrl_irq_tx_nfull_c);
+            ctrl.irq_rx_tout   <= bus_req_i.data(ctrl_irq_rx_tout_c);
+          end if;
+          if (bus_req_i.addr(3 downto 2) = "10") then -- baud register
+            ctrl.frac <= bus_req_i.data(baud_frac_msb_c downto baud_frac_lsb_c);
+            ctrl.div  <= bus_req_i.data(baud_div_msb_c downto baud_div_lsb_c);
+            ctrl.osr  <= bus_req_i.data(baud_osr_msb_c downto baud_osr_lsb_c);
+            ctrl.rto  <= bus_req_i.data(baud_rto_msb_c downto baud_rto_lsb_c);
+            ctrl.fen  <= bus_req_i.data(baud_fen_c);
           end if;
         else -- read access
-          if (bus_req_i.addr(2) = '0') then -- control register
+          if (bus_req_i.addr(3 downto 2) = "00") then -- control register
             bus_rsp_o.data(ctrl_en_c)                        <= ctrl.enable;
             bus_rsp_o.data(ctrl_sim_en_c)                    <= ctrl.sim_mode and bool_to_ulogic_f(is_simulation_c);
             bus_rsp_o.data(ctrl_hwfc_en_c)                   <= ctrl.hwfc_en;
@@ -162,9 +215,17 @@ begin
             bus_rsp_o.data(ctrl_irq_rx_full_c)               <= ctrl.irq_rx_full;
             bus_rsp_o.data(ctrl_irq_tx_empty_c)              <= ctrl.irq_tx_empty;
             bus_rsp_o.data(ctrl_irq_tx_nfull_c)              <= ctrl.irq_tx_nfull;
+            bus_rsp_o.data(ctrl_irq_rx_tout_c)               <= ctrl.irq_rx_tout;
+            bus_rsp_o.data(ctrl_rx_tout_c)                   <= rx_tout.flag;
             bus_rsp_o.data(ctrl_rx_over_c)                   <= rx_overrun;
             bus_rsp_o.data(ctrl_tx_busy_c)                   <= tx_engine.state(0) or tx_fifo.avail;
-          else -- data register
+          elsif (bus_req_i.addr(3 downto 2) = "10") then -- baud register
+            bus_rsp_o.data(baud_frac_msb_c downto baud_frac_lsb_c) <= ctrl.frac;
+            bus_rsp_o.data(baud_div_msb_c downto baud_div_lsb_c)   <= ctrl.div;
+            bus_rsp_o.data(baud_osr_msb_c downto baud_osr_lsb_c)   <= ctrl.osr;
+            bus_rsp_o.data(baud_rto_msb_c downto baud_rto_lsb_c)   <= ctrl.rto;
+            bus_rsp_o.data(baud_fen_c)                             <= ctrl.fen;
+          elsif (bus_req_i.addr(3 downto 2) = "01") then -- data register
             bus_rsp_o.data(data_rtx_msb_c   downto data_rtx_lsb_c)   <= rx_fifo.rdata;
             bus_rsp_o.data(data_rx_fifo_msb downto data_rx_fifo_lsb) <= std_ulogic_vector(to_unsigned(log2_rx_fifo_c, 4));
             bus_rsp_o.data(data_tx_fifo_msb downto data_tx_fifo_lsb) <= std_ulogic_vector(to_unsigned(log2_tx_fifo_c, 4));
@@ -174,8 +235,40 @@ begin
     end if;
   end process bus_access;
 
-  -- UART clock enable --
-  uart_clk <= clkgen_i(to_integer(unsigned(ctrl.prsc)));
+
+  -- Baud Rate Generator --------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- fractional divider: one sample tick every DIV + FRAC/16 clock cycles (on average) --
+  frac_generator: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      frac_gen.cnt  <= (others => '0');
+      frac_gen.acc  <= (others => '0');
+      frac_gen.tick <= '0';
+    elsif rising_edge(clk_i) then
+      frac_gen.tick <= '0'; -- default
+      if (ctrl.enable = '0') or (ctrl.fen = '0') then
+        frac_gen.cnt <= (others => '0');
+        frac_gen.acc <= (others => '0');
+      elsif (frac_gen.cnt = x"0000") then
+        frac_gen.tick <= '1';
+        frac_gen.acc  <= frac_sum(3 downto 0);
+        if (frac_sum(4) = '1') then -- accumulated fraction overflow: stretch period by one cycle
+          frac_gen.cnt <= ctrl.div;
+        else
+          frac_gen.cnt <= std_ulogic_vector(unsigned(ctrl.div) - 1);
+        end if;
+      else
+        frac_gen.cnt <= std_ulogic_vector(unsigned(frac_gen.cnt) - 1);
+      end if;
+    end if;
+  end process frac_generator;
+
+  frac_sum <= std_ulogic_vector(unsigned('0' & frac_gen.acc) + unsigned('0' & ctrl.frac));
+
+  -- sample tick and sample ticks per bit --
+  uart_clk <= frac_gen.tick when (ctrl.fen = '1') else clkgen_i(to_integer(unsigned(ctrl.prsc)));
+  baud_rld <= "000000" & ctrl.osr when (ctrl.fen = '1') else ctrl.baud;
 
 
   -- TX FIFO --------------------------------------------------------------------------------
@@ -203,7 +296,7 @@ begin
 
   tx_fifo.clr   <= '1' when (ctrl.enable = '0') or (ctrl.sim_mode = '1') else '0';
   tx_fifo.wdata <= bus_req_i.data(data_rtx_msb_c downto data_rtx_lsb_c);
-  tx_fifo.we    <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '1') and (bus_req_i.addr(2) = '1') else '0';
+  tx_fifo.we    <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '1') and (bus_req_i.addr(3 downto 2) = "01") else '0';
   tx_fifo.re    <= tx_engine.done;
 
 
@@ -233,7 +326,7 @@ begin
   rx_fifo.clr   <= '1' when (ctrl.enable = '0') or (ctrl.sim_mode = '1') else '0';
   rx_fifo.wdata <= rx_engine.sreg(7 downto 0);
   rx_fifo.we    <= rx_engine.done;
-  rx_fifo.re    <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '0') and (bus_req_i.addr(2) = '1') else '0';
+  rx_fifo.re    <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '0') and (bus_req_i.addr(3 downto 2) = "01") else '0';
 
 
   -- Interrupt Generator --------------------------------------------------------------------
@@ -247,7 +340,8 @@ begin
                (ctrl.irq_tx_empty  and (not tx_fifo.avail)) or -- TX FIFO empty
                (ctrl.irq_tx_nfull  and tx_fifo.free)        or -- TX FIFO not full
                (ctrl.irq_rx_nempty and rx_fifo.avail)       or -- RX FIFO not empty
-               (ctrl.irq_rx_full   and (not rx_fifo.free)));   -- RX FIFO full
+               (ctrl.irq_rx_full   and (not rx_fifo.free))  or -- RX FIFO full
+               (ctrl.irq_rx_tout   and rx_tout.flag));         -- RX timeout
     end if;
   end process irq_gen;
 
@@ -262,6 +356,7 @@ begin
       tx_engine.bitcnt  <= (others => '0');
       tx_engine.baudcnt <= (others => '0');
       tx_engine.sync    <= (others => '0');
+      tx_engine.vote    <= (others => '0');
       tx_engine.done    <= '0';
       uart_txd_o        <= '1';
     elsif rising_edge(clk_i) then
@@ -275,7 +370,7 @@ begin
 
         when "10" => -- wait for new data to send
         -- ------------------------------------------------------------
-          tx_engine.baudcnt <= ctrl.baud;
+          tx_engine.baudcnt <= baud_rld;
           tx_engine.bitcnt  <= "1011"; -- 1 start-bit + 8 data-bits + 1 stop-bit + 1 pause-bit
           tx_engine.sreg    <= tx_fifo.rdata & '0'; -- data & start-bit
           if (tx_fifo.avail = '1') and (tx_engine.done = '0') then -- data available and previous transfer done
@@ -290,7 +385,7 @@ begin
           uart_txd_o <= tx_engine.sreg(0);
           if (uart_clk = '1') then
             if (tx_engine.baudcnt = "0000000000") then -- bit done
-              tx_engine.baudcnt <= ctrl.baud;
+              tx_engine.baudcnt <= baud_rld;
               tx_engine.bitcnt  <= std_ulogic_vector(unsigned(tx_engine.bitcnt) - 1);
               tx_engine.sreg    <= '1' & tx_engine.sreg(tx_engine.sreg'left downto 1);
             else
@@ -321,10 +416,12 @@ begin
       rx_engine.bitcnt  <= (others => '0');
       rx_engine.baudcnt <= (others => '0');
       rx_engine.sync    <= (others => '0');
+      rx_engine.vote    <= (others => '0');
       rx_engine.done    <= '0';
     elsif rising_edge(clk_i) then
       if (uart_clk = '1') then
         rx_engine.sync <= rx_engine.sync(1 downto 0) & uart_rxd_i; -- RXD synchronizer
+        rx_engine.vote <= rx_engine.vote(0) & rx_engine.sync(2); -- sample history
       end if;
       rx_engine.done     <= '0'; -- default
       rx_engine.state(1) <= ctrl.enable; -- disable-override
@@ -332,7 +429,12 @@ begin
 
         when "10" => -- wait for incoming transmission
         -- ------------------------------------------------------------
-          rx_engine.baudcnt <= '0' & ctrl.baud(9 downto 1); -- half baud delay at the beginning to sample in the middle of each bit
+          -- half baud delay at the beginning to sample in the middle of each bit --
+          if (rx_vote = '1') then -- one more tick to center the majority vote window
+            rx_engine.baudcnt <= std_ulogic_vector(unsigned('0' & baud_rld(9 downto 1)) + 1);
+          else
+            rx_engine.baudcnt <= '0' & baud_rld(9 downto 1);
+          end if;
           rx_engine.bitcnt  <= "1010"; -- 1 start-bit + 8 data-bits + 1 stop-bit
           if (rx_engine.sync(2 downto 1) = "10") then -- start bit detected (falling edge)?
             if (uart_clk = '1') then -- start with next clock tick
@@ -344,9 +446,12 @@ begin
         -- ------------------------------------------------------------
           if (uart_clk = '1') then
             if (rx_engine.baudcnt = "0000000000") then -- bit done
-              rx_engine.baudcnt <= ctrl.baud;
+              rx_engine.baudcnt <= baud_rld;
               rx_engine.bitcnt  <= std_ulogic_vector(unsigned(rx_engine.bitcnt) - 1);
-              rx_engine.sreg    <= rx_engine.sync(2) & rx_engine.sreg(rx_engine.sreg'left downto 1);
+              rx_engine.sreg    <= rx_sample & rx_engine.sreg(rx_engine.sreg'left downto 1);
+              if (rx_engine.bitcnt = "1010") and (rx_sample = '1') then -- start bit not low: glitch, abort
+                rx_engine.state(0) <= '0';
+              end if;
             else
               rx_engine.baudcnt <= std_ulogic_vector(unsigned(rx_engine.baudcnt) - 1);
             end if;
@@ -364,6 +469,44 @@ begin
     end if;
   end process receiver;
 
+  -- majority vote of three consecutive samples (if there are at least 4 samples per bit) --
+  rx_vote   <= '0' when (baud_rld(9 downto 2) = "00000000") else '1';
+  rx_sample <= (rx_engine.vote(1) and rx_engine.vote(0)) or (rx_engine.vote(1) and rx_engine.sync(2)) or
+               (rx_engine.vote(0) and rx_engine.sync(2)) when (rx_vote = '1') else rx_engine.sync(2);
+
+  -- RX timeout: RX FIFO not empty and no RX activity / no FIFO read for RTO+1 character times --
+  rx_timeout: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      rx_tout.tcnt <= (others => '0');
+      rx_tout.bcnt <= (others => '0');
+      rx_tout.ccnt <= (others => '0');
+      rx_tout.flag <= '0';
+    elsif rising_edge(clk_i) then
+      if (ctrl.enable = '0') or (rx_fifo.avail = '0') or (rx_fifo.we = '1') or (rx_fifo.re = '1') or (rx_engine.state(0) = '1') then
+        rx_tout.tcnt <= (others => '0');
+        rx_tout.bcnt <= (others => '0');
+        rx_tout.ccnt <= (others => '0');
+        rx_tout.flag <= '0';
+      elsif (uart_clk = '1') and (rx_tout.flag = '0') then
+        if (rx_tout.tcnt = baud_rld) then -- one bit time elapsed
+          rx_tout.tcnt <= (others => '0');
+          if (rx_tout.bcnt = "1001") then -- one character time (10 bits) elapsed
+            rx_tout.bcnt <= (others => '0');
+            rx_tout.ccnt <= std_ulogic_vector(unsigned(rx_tout.ccnt) + 1);
+            if (rx_tout.ccnt = ctrl.rto) then
+              rx_tout.flag <= '1';
+            end if;
+          else
+            rx_tout.bcnt <= std_ulogic_vector(unsigned(rx_tout.bcnt) + 1);
+          end if;
+        else
+          rx_tout.tcnt <= std_ulogic_vector(unsigned(rx_tout.tcnt) + 1);
+        end if;
+      end if;
+    end if;
+  end process rx_timeout;
+
   -- RX flow monitor --
   rx_flow: process(rstn_i, clk_i)
   begin
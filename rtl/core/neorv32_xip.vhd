@@ -0,0 +1,441 @@
+-- ================================================================================ --
+-- NEORV32 SoC - Execute In-Place Module (XIP)                                      --
+-- -------------------------------------------------------------------------------- --
+-- Maps an external SPI/dual-SPI/quad-SPI flash into the processor's address space  --
+-- (read-only). Sequential word accesses (e.g. cache block bursts or linear code)   --
+-- are served from a single continuous read command without re-sending the command  --
+-- and address. A direct SPI mode (single-lane) is provided to configure and to     --
+-- program the flash while the memory window is disabled.                          --
+-- -------------------------------------------------------------------------------- --
+-- The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              --
+-- Copyright (c) NEORV32 contributors.                                              --
+-- Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  --
+-- Licensed under the BSD-3-Clause license, see LICENSE for details.                --
+-- SPDX-License-Identifier: BSD-3-Clause                                            --
+-- ================================================================================ --
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library neorv32;
+use neorv32.neorv32_package.all;
+
+entity neorv32_xip is
+  port (
+    clk_i     : in  std_ulogic;                    -- global clock line
+    rstn_i    : in  std_ulogic;                    -- global reset line, low-active, async
+    bus_req_i : in  bus_req_t;                     -- control register bus request
+    bus_rsp_o : out bus_rsp_t;                     -- control register bus response
+    xip_req_i : in  bus_req_t;                     -- memory window bus request
+    xip_rsp_o : out bus_rsp_t;                     -- memory window bus response
+    clkgen_i  : in  std_ulogic_vector(7 downto 0); -- prescaled clock enables
+    xip_csn_o : out std_ulogic;                    -- chip-select, low-active
+    xip_clk_o : out std_ulogic;                    -- serial clock
+    xip_dat_i : in  std_ulogic_vector(3 downto 0); -- data input lanes
+    xip_dat_o : out std_ulogic_vector(3 downto 0); -- data output lanes
+    xip_oe_o  : out std_ulogic_vector(3 downto 0)  -- data output lanes enable
+  );
+end neorv32_xip;
+
+architecture neorv32_xip_rtl of neorv32_xip is
+
+  -- control register --
+  constant ctrl_en_c       : natural :=  0; -- r/w: module enable
+  constant ctrl_xip_en_c   : natural :=  1; -- r/w: memory window enable (disables direct mode)
+  constant ctrl_hspeed_c   : natural :=  2; -- r/w: high-speed mode: SCK = clk/2 (ignore PRSC and CDIV)
+  constant ctrl_prsc0_c    : natural :=  3; -- r/w: prescaler select, bit 0 (LSB)
+  constant ctrl_prsc2_c    : natural :=  5; -- r/w: prescaler select, bit 2 (MSB)
+  constant ctrl_cdiv0_c    : natural :=  6; -- r/w: clock divider, bit 0 (LSB)
+  constant ctrl_cdiv3_c    : natural :=  9; -- r/w: clock divider, bit 3 (MSB)
+  constant ctrl_abytes0_c  : natural := 10; -- r/w: number of address bytes - 1, bit 0 (LSB)
+  constant ctrl_abytes1_c  : natural := 11; -- r/w: number of address bytes - 1, bit 1 (MSB)
+  constant ctrl_mode0_c    : natural := 12; -- r/w: read mode, bit 0 (LSB)
+  constant ctrl_mode1_c    : natural := 13; -- r/w: read mode, bit 1 (MSB)
+  constant ctrl_dummy0_c   : natural := 14; -- r/w: number of dummy clock cycles, bit 0 (LSB)
+  constant ctrl_dummy4_c   : natural := 18; -- r/w: number of dummy clock cycles, bit 4 (MSB)
+  constant ctrl_rdcmd0_c   : natural := 19; -- r/w: read command, bit 0 (LSB)
+  constant ctrl_rdcmd7_c   : natural := 26; -- r/w: read command, bit 7 (MSB)
+  constant ctrl_cs_c       : natural := 27; -- r/w: direct mode chip-select enable
+  --
+  constant ctrl_session_c  : natural := 30; -- r/-: continuous read session active (XIP chip-select asserted)
+  constant ctrl_busy_c     : natural := 31; -- r/-: PHY busy
+
+  -- read modes (command - address - data lanes) --
+  constant mode_111_c : std_ulogic_vector(1 downto 0) := "00"; -- standard SPI
+  constant mode_112_c : std_ulogic_vector(1 downto 0) := "01"; -- dual output
+  constant mode_114_c : std_ulogic_vector(1 downto 0) := "10"; -- quad output
+  constant mode_144_c : std_ulogic_vector(1 downto 0) := "11"; -- quad input/output
+
+  -- lane configuration of the current phase --
+  constant io_single_c : std_ulogic_vector(1 downto 0) := "00"; -- lane 0 out, lane 1 in
+  constant io_dual_c   : std_ulogic_vector(1 downto 0) := "01"; -- lanes 1:0 in
+  constant io_quad_c   : std_ulogic_vector(1 downto 0) := "10"; -- lanes 3:0 in
+  constant io_quado_c  : std_ulogic_vector(1 downto 0) := "11"; -- lanes 3:0 out
+
+  -- control register --
+  type ctrl_t is record
+    enable : std_ulogic;
+    xip_en : std_ulogic;
+    hspeed : std_ulogic;
+    prsc   : std_ulogic_vector(2 downto 0);
+    cdiv   : std_ulogic_vector(3 downto 0);
+    abytes : std_ulogic_vector(1 downto 0);
+    mode   : std_ulogic_vector(1 downto 0);
+    dummy  : std_ulogic_vector(4 downto 0);
+    rdcmd  : std_ulogic_vector(7 downto 0);
+    cs     : std_ulogic;
+  end record;
+  signal ctrl : ctrl_t;
+  signal ctrl_we, direct_we : std_ulogic;
+
+  -- clock generator --
+  signal cdiv_cnt   : std_ulogic_vector(3 downto 0);
+  signal spi_clk_en : std_ulogic;
+
+  -- SPI engine --
+  type state_t is (S_IDLE, S_CSH, S_CMD, S_ADDR, S_DUMMY, S_DATA, S_DIRECT);
+  type engine_t is record
+    state : state_t;
+    sreg  : std_ulogic_vector(31 downto 0); -- TX/RX shift register
+    sdi   : std_ulogic_vector(3 downto 0);  -- sampled input lanes
+    cnt   : std_ulogic_vector(5 downto 0);  -- remaining clock cycles of current phase
+    io    : std_ulogic_vector(1 downto 0);  -- lane configuration of current phase
+    sck   : std_ulogic;
+    cs    : std_ulogic; -- XIP chip-select active
+    cont  : std_ulogic; -- continuous read possible
+    addr  : std_ulogic_vector(27 downto 0); -- address of current/next sequential word
+    done  : std_ulogic;
+    rdata : std_ulogic_vector(31 downto 0);
+  end record;
+  signal engine : engine_t;
+
+  -- memory window request tracking --
+  signal win_en   : std_ulogic;
+  signal win_pend : std_ulogic_vector(10 downto 0); -- number of pending read requests
+  signal win_addr : std_ulogic_vector(27 downto 0); -- address of next pending request
+  signal win_err  : std_ulogic;
+
+  -- shift in new input data --
+  function shift_f(sreg : std_ulogic_vector(31 downto 0); sdi : std_ulogic_vector(3 downto 0);
+                   io : std_ulogic_vector(1 downto 0)) return std_ulogic_vector is
+  begin
+    case io is
+      when io_single_c => return sreg(30 downto 0) & sdi(1);
+      when io_dual_c   => return sreg(29 downto 0) & sdi(1 downto 0);
+      when others      => return sreg(27 downto 0) & sdi(3 downto 0);
+    end case;
+  end function shift_f;
+
+begin
+
+  -- Control Register Access ----------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  bus_access: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      bus_rsp_o   <= rsp_terminate_c;
+      ctrl.enable <= '0';
+      ctrl.xip_en <= '0';
+      ctrl.hspeed <= '0';
+      ctrl.prsc   <= (others => '0');
+      ctrl.cdiv   <= (others => '0');
+      ctrl.abytes <= (others => '0');
+      ctrl.mode   <= (others => '0');
+      ctrl.dummy  <= (others => '0');
+      ctrl.rdcmd  <= (others => '0');
+      ctrl.cs     <= '0';
+    elsif rising_edge(clk_i) then
+      -- bus handshake --
+      bus_rsp_o.ack  <= bus_req_i.stb;
+      bus_rsp_o.err  <= '0';
+      bus_rsp_o.data <= (others => '0');
+
+      -- read/write access --
+      if (bus_req_i.stb = '1') then
+        if (bus_req_i.rw = '1') then -- write access
+          if (bus_req_i.addr(2) = '0') then -- control register
+            ctrl.enable <= bus_req_i.data(ctrl_en_c);
+            ctrl.xip_en <= bus_req_i.data(ctrl_xip_en_c);
+            ctrl.hspeed <= bus_req_i.data(ctrl_hspeed_c);
+            ctrl.prsc   <= bus_req_i.data(ctrl_prsc2_c downto ctrl_prsc0_c);
+            ctrl.cdiv   <= bus_req_i.data(ctrl_cdiv3_c downto ctrl_cdiv0_c);
+            ctrl.abytes <= bus_req_i.data(ctrl_abytes1_c downto ctrl_abytes0_c);
+            ctrl.mode   <= bus_req_i.data(ctrl_mode1_c downto ctrl_mode0_c);
+            ctrl.dummy  <= bus_req_i.data(ctrl_dummy4_c downto ctrl_dummy0_c);
+            ctrl.rdcmd  <= bus_req_i.data(ctrl_rdcmd7_c downto ctrl_rdcmd0_c);
+            ctrl.cs     <= bus_req_i.data(ctrl_cs_c);
+          end if;
+        else -- read access
+          if (bus_req_i.addr(2) = '0') then -- control register
+            bus_rsp_o.data(ctrl_en_c)                            <= ctrl.enable;
+            bus_rsp_o.data(ctrl_xip_en_c)                        <= ctrl.xip_en;
+            bus_rsp_o.data(ctrl_hspeed_c)                        <= ctrl.hspeed;
+            bus_rsp_o.data(ctrl_prsc2_c downto ctrl_prsc0_c)     <= ctrl.prsc;
+            bus_rsp_o.data(ctrl_cdiv3_c downto ctrl_cdiv0_c)     <= ctrl.cdiv;
+            bus_rsp_o.data(ctrl_abytes1_c downto ctrl_abytes0_c) <= ctrl.abytes;
+            bus_rsp_o.data(ctrl_mode1_c downto ctrl_mode0_c)     <= ctrl.mode;
+            bus_rsp_o.data(ctrl_dummy4_c downto ctrl_dummy0_c)   <= ctrl.dummy;
+            bus_rsp_o.data(ctrl_rdcmd7_c downto ctrl_rdcmd0_c)   <= ctrl.rdcmd;
+            bus_rsp_o.data(ctrl_cs_c)                            <= ctrl.cs;
+            bus_rsp_o.data(ctrl_session_c)                       <= engine.cs;
+            bus_rsp_o.data(ctrl_busy_c)                          <= '0' when (engine.state = S_IDLE) else '1';
+          else -- direct mode RX data
+            bus_rsp_o.data(7 downto 0) <= engine.sreg(7 downto 0);
+          end if;
+        end if;
+      end if;
+    end if;
+  end process bus_access;
+
+  -- write access strobes --
+  ctrl_we   <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '1') and (bus_req_i.addr(2) = '0') else '0';
+  direct_we <= '1' when (bus_req_i.stb = '1') and (bus_req_i.rw = '1') and (bus_req_i.addr(2) = '1') else '0';
+
+  -- memory window available --
+  win_en <= ctrl.enable and ctrl.xip_en;
+
+
+  -- Memory Window Request Tracking ---------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- Burst requests are issued back-to-back before the first response is returned, so we only
+  -- count them; their addresses are consecutive words starting at the first request's address.
+  window_tracking: process(rstn_i, clk_i)
+    variable pend_v : unsigned(10 downto 0);
+  begin
+    if (rstn_i = '0') then
+      win_pend <= (others => '0');
+      win_addr <= (others => '0');
+      win_err  <= '0';
+    elsif rising_edge(clk_i) then
+      pend_v  := unsigned(win_pend);
+      win_err <= '0';
+      -- new request --
+      if (xip_req_i.stb = '1') then
+        if (xip_req_i.rw = '1') or (win_en = '0') then -- read-only / window disabled
+          win_err <= '1';
+        else
+          if (pend_v = 0) then -- first request of a new access
+            win_addr <= xip_req_i.addr(27 downto 2) & "00";
+          end if;
+          pend_v := pend_v + 1;
+        end if;
+      end if;
+      -- request completed --
+      if (engine.done = '1') and (pend_v /= 0) then
+        pend_v := pend_v - 1;
+        if (pend_v /= 0) then -- next burst element
+          win_addr <= std_ulogic_vector(unsigned(win_addr) + 4);
+        end if;
+      end if;
+      -- discard all pending requests if the window gets disabled --
+      if (win_en = '0') then
+        pend_v := (others => '0');
+      end if;
+      win_pend <= std_ulogic_vector(pend_v);
+    end if;
+  end process window_tracking;
+
+  -- bus response --
+  xip_rsp_o.ack  <= engine.done or win_err;
+  xip_rsp_o.err  <= win_err;
+  xip_rsp_o.data <= engine.rdata;
+
+
+  -- SPI Engine -----------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  spi_engine: process(rstn_i, clk_i)
+    variable sreg_v : std_ulogic_vector(31 downto 0);
+  begin
+    if (rstn_i = '0') then
+      engine.state <= S_IDLE;
+      engine.sreg  <= (others => '0');
+      engine.sdi   <= (others => '0');
+      engine.cnt   <= (others => '0');
+      engine.io    <= io_single_c;
+      engine.sck   <= '0';
+      engine.cs    <= '0';
+      engine.cont  <= '0';
+      engine.addr  <= (others => '0');
+      engine.done  <= '0';
+      engine.rdata <= (others => '0');
+    elsif rising_edge(clk_i) then
+      engine.done  <= '0';
+      engine.rdata <= (others => '0');
+      sreg_v       := shift_f(engine.sreg, engine.sdi, engine.io);
+
+      -- configuration change: start a new read session for the next access --
+      if (ctrl_we = '1') then
+        engine.cont <= '0';
+      end if;
+
+      if (ctrl.enable = '0') then -- module disabled
+        engine.state <= S_IDLE;
+        engine.sck   <= '0';
+        engine.cs    <= '0';
+        engine.cont  <= '0';
+      else
+        case engine.state is
+
+          when S_IDLE => -- wait for new request
+          -- ------------------------------------------------------------
+            engine.sck <= '0';
+            if (engine.cs = '0') then -- keep data phase lane configuration while a session is open
+              engine.io <= io_single_c;
+            end if;
+            if (ctrl.xip_en = '0') then -- direct mode
+              engine.cs   <= '0';
+              engine.cont <= '0';
+              if (direct_we = '1') then
+                engine.sreg  <= bus_req_i.data(7 downto 0) & x"000000";
+                engine.cnt   <= "001000"; -- 8 bits
+                engine.state <= S_DIRECT;
+              end if;
+            elsif (unsigned(win_pend) /= 0) and (engine.done = '0') then -- XIP read request
+              if (engine.cs = '1') and (engine.cont = '1') and (engine.addr = win_addr) and (ctrl_we = '0') then
+                case ctrl.mode is -- just continue reading
+                  when mode_111_c => engine.io <= io_single_c; engine.cnt <= "100000"; -- 32 bits
+                  when mode_112_c => engine.io <= io_dual_c;   engine.cnt <= "010000"; -- 16 x 2 bits
+                  when others     => engine.io <= io_quad_c;   engine.cnt <= "001000"; -- 8 x 4 bits
+                end case;
+                engine.state <= S_DATA;
+              else
+                engine.addr  <= win_addr;
+                engine.cs    <= '0'; -- terminate current session
+                engine.cnt   <= "000010"; -- min. chip-select high time
+                engine.state <= S_CSH;
+              end if;
+            elsif (engine.cont = '0') then -- session invalidated
+              engine.cs <= '0';
+            end if;
+
+          when S_CSH => -- chip-select high time, then start new session
+          -- ------------------------------------------------------------
+            engine.io <= io_single_c; -- flash releases the data lanes while chip-select is high
+            if (spi_clk_en = '1') then
+              engine.cnt <= std_ulogic_vector(unsigned(engine.cnt) - 1);
+              if (unsigned(engine.cnt) = 1) then
+                engine.cs    <= '1';
+                engine.sreg  <= ctrl.rdcmd & x"000000";
+                engine.cnt   <= "001000"; -- 8 command bits
+                engine.state <= S_CMD;
+              end if;
+            end if;
+
+          when others => -- S_CMD, S_ADDR, S_DUMMY, S_DATA, S_DIRECT: serial transfer
+          -- ------------------------------------------------------------
+            if (spi_clk_en = '1') then
+              if (engine.sck = '0') then -- rising edge: sample input
+                engine.sck <= '1';
+                engine.sdi <= xip_dat_i;
+              else -- falling edge: shift and output next bits
+                engine.sck  <= '0';
+                engine.sreg <= sreg_v;
+                engine.cnt  <= std_ulogic_vector(unsigned(engine.cnt) - 1);
+                -- drive mode bits (all-one) only for the first two dummy cycles --
+                if (engine.state = S_DUMMY) and (ctrl.mode = mode_144_c) and (unsigned(engine.cnt) = (unsigned(ctrl.dummy) - 1)) then
+                  engine.io <= io_quad_c;
+                end if;
+                if (unsigned(engine.cnt) = 1) then -- end of phase
+                  case engine.state is
+
+                    when S_CMD => -- send address
+                      engine.sreg <= std_ulogic_vector(shift_left(unsigned(x"0" & engine.addr), 8*(3-to_integer(unsigned(ctrl.abytes)))));
+                      if (ctrl.mode = mode_144_c) then
+                        engine.io  <= io_quado_c;
+                        engine.cnt <= std_ulogic_vector(to_unsigned(2*(to_integer(unsigned(ctrl.abytes))+1), 6));
+                      else
+                        engine.io  <= io_single_c;
+                        engine.cnt <= std_ulogic_vector(to_unsigned(8*(to_integer(unsigned(ctrl.abytes))+1), 6));
+                      end if;
+                      engine.state <= S_ADDR;
+
+                    when S_ADDR | S_DUMMY => -- dummy cycles / receive data
+                      if (engine.state = S_ADDR) and (ctrl.dummy /= "00000") then
+                        engine.sreg <= (others => '1');
+                        engine.cnt  <= '0' & ctrl.dummy;
+                        case ctrl.mode is
+                          when mode_111_c => engine.io <= io_single_c;
+                          when mode_112_c => engine.io <= io_dual_c;
+                          when mode_114_c => engine.io <= io_quad_c;
+                          when others     => engine.io <= io_quado_c; -- mode bits
+                        end case;
+                        engine.state <= S_DUMMY;
+                      else
+                        case ctrl.mode is
+                          when mode_111_c => engine.io <= io_single_c; engine.cnt <= "100000"; -- 32 bits
+                          when mode_112_c => engine.io <= io_dual_c;   engine.cnt <= "010000"; -- 16 x 2 bits
+                          when others     => engine.io <= io_quad_c;   engine.cnt <= "001000"; -- 8 x 4 bits
+                        end case;
+                        engine.state <= S_DATA;
+                      end if;
+
+                    when S_DATA => -- word complete; first received byte is the lowest byte
+                      engine.rdata <= sreg_v(7 downto 0) & sreg_v(15 downto 8) & sreg_v(23 downto 16) & sreg_v(31 downto 24);
+                      engine.done  <= '1';
+                      engine.cont  <= '1';
+                      engine.addr  <= std_ulogic_vector(unsigned(engine.addr) + 4);
+                      engine.state <= S_IDLE;
+
+                    when others => -- S_DIRECT: byte complete
+                      engine.state <= S_IDLE;
+
+                  end case;
+                end if;
+              end if;
+            end if;
+
+        end case;
+      end if;
+    end if;
+  end process spi_engine;
+
+
+  -- Serial Interface -----------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  xip_clk_o <= engine.sck;
+  xip_csn_o <= '0' when (engine.cs = '1') or ((ctrl.enable = '1') and (ctrl.xip_en = '0') and (ctrl.cs = '1')) else '1';
+
+  -- data lanes; lanes 3:2 are kept high (WP#/HOLD#) if not used for data --
+  data_lanes: process(ctrl.enable, engine)
+  begin
+    if (ctrl.enable = '0') then
+      xip_dat_o <= (others => '0');
+      xip_oe_o  <= (others => '0');
+    else
+      case engine.io is
+        when io_single_c => xip_dat_o <= "110" & engine.sreg(31); xip_oe_o <= "1101";
+        when io_dual_c   => xip_dat_o <= "1100";                  xip_oe_o <= "1100";
+        when io_quad_c   => xip_dat_o <= "0000";                  xip_oe_o <= "0000";
+        when others      => xip_dat_o <= engine.sreg(31 downto 28); xip_oe_o <= "1111";
+      end case;
+    end if;
+  end process data_lanes;
+
+
+  -- SPI Clock Generator --------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  clock_generator: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      spi_clk_en <= '0';
+      cdiv_cnt   <= (others => '0');
+    elsif rising_edge(clk_i) then
+      spi_clk_en <= '0'; -- default
+      if (ctrl.enable = '0') then -- reset/disabled
+        cdiv_cnt <= (others => '0');
+      elsif (ctrl.hspeed = '1') then -- high-speed mode: SCK = clk/2
+        spi_clk_en <= '1';
+      elsif (clkgen_i(to_integer(unsigned(ctrl.prsc))) = '1') then -- pre-scaled clock
+        if (cdiv_cnt = ctrl.cdiv) then -- clock divider for fine-tuning
+          spi_clk_en <= '1';
+          cdiv_cnt   <= (others => '0');
+        else
+          cdiv_cnt <= std_ulogic_vector(unsigned(cdiv_cnt) + 1);
+        end if;
+      end if;
+    end if;
+  end process clock_generator;
+
+
+end neorv32_xip_rtl;
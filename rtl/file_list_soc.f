@@ -25,6 +25,7 @@ NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_dma.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_imem.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_dmem.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_xbus.vhd
+NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_xip.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_bootrom.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_cfs.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_sdi.vhd
@@ -41,6 +42,7 @@ NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_neoled.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_gptmr.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_onewire.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_slink.vhd
+NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_mbox.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_tracer.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_sysinfo.vhd
 NEORV32_RTL_PATH_PLACEHOLDER/core/neorv32_debug_dtm.vhd
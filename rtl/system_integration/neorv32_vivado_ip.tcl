@@ -129,6 +129,7 @@ proc setup_ip_gui {} {
   set_property enablement_dependency {$IO_UART0_EN}   [ipx::get_ports uart0_*          -of_objects [ipx::current_core]]
   set_property enablement_dependency {$IO_UART1_EN}   [ipx::get_ports uart1_*          -of_objects [ipx::current_core]]
   set_property enablement_dependency {$IO_SPI_EN}     [ipx::get_ports spi_*            -of_objects [ipx::current_core]]
+  set_property enablement_dependency {$XIP_EN}        [ipx::get_ports xip_*            -of_objects [ipx::current_core]]
   set_property enablement_dependency {$IO_SDI_EN}     [ipx::get_ports sdi_*            -of_objects [ipx::current_core]]
   set_property enablement_dependency {$IO_TWI_EN}     [ipx::get_ports twi_*            -of_objects [ipx::current_core]]
   set_property enablement_dependency {$IO_TWD_EN}     [ipx::get_ports twd_*            -of_objects [ipx::current_core]]
@@ -395,7 +396,13 @@ proc setup_ip_gui {} {
   set group [add_group $page {SPI Host Controller (SPI)}]
   add_params $group {
     { IO_SPI_EN   {Enable SPI} }
-    { IO_SPI_FIFO {FIFO depth} {Number of entries (use a power of two)} {$IO_SPI_EN} }
+    { IO_SPI_FIFO    {FIFO depth} {Number of entries (use a power of two)} {$IO_SPI_EN} }
+    { IO_SPI_XFER_EN {Enable hardware transfers} {16/32-bit frames and DMA requests} {$IO_SPI_EN} }
+  }
+
+  set group [add_group $page {Execute-In-Place Module (XIP)}]
+  add_params $group {
+    { XIP_EN {Enable XIP} {SPI/dual-SPI/quad-SPI flash memory window at 0xE0000000} }
   }
 
   set group [add_group $page {SPI Device Controller (SDI)}]
@@ -461,6 +468,12 @@ proc setup_ip_gui {} {
     { IO_DMA_EN       {Enable DMA} }
     { IO_DMA_DSC_FIFO {Descriptor FIFO depth} {Number of entries (use a power of two)} {$IO_DMA_EN} }
   }
+
+  set group [add_group $page {Inter-Core Mailbox (MBOX)}]
+  add_params $group {
+    { IO_MBOX_EN   {Enable MBOX} }
+    { IO_MBOX_FIFO {Inbox FIFO depth} {Number of entries per hart (use a power of two)} {$IO_MBOX_EN} }
+  }
 }
 
 setup_ip_gui
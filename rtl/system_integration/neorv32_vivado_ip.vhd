@@ -96,6 +96,8 @@ entity neorv32_vivado_ip is
     XBUS_EN               : boolean                        := false;
     XBUS_TIMEOUT          : natural                        := 2048;
     XBUS_REGSTAGE_EN      : boolean                        := false;
+    -- Execute-In-Place Module --
+    XIP_EN                : boolean                        := false;
     -- Processor peripherals --
     IO_GPIO_EN            : boolean                        := false;
     IO_GPIO_IN_NUM        : natural range 1 to 32          := 1; -- variable-sized ports must be at least 0 downto 0; #974
@@ -109,6 +111,7 @@ entity neorv32_vivado_ip is
     IO_UART1_TX_FIFO      : natural range 1 to 2**15       := 1;
     IO_SPI_EN             : boolean                        := false;
     IO_SPI_FIFO           : natural range 1 to 2**15       := 1;
+    IO_SPI_XFER_EN        : boolean                        := false;
     IO_SDI_EN             : boolean                        := false;
     IO_SDI_FIFO           : natural range 1 to 2**15       := 1;
     IO_TWI_EN             : boolean                        := false;
@@ -132,6 +135,8 @@ entity neorv32_vivado_ip is
     IO_SLINK_EN           : boolean                        := false;
     IO_SLINK_RX_FIFO      : natural range 1 to 2**15       := 1;
     IO_SLINK_TX_FIFO      : natural range 1 to 2**15       := 1;
+    IO_MBOX_EN            : boolean                        := false;
+    IO_MBOX_FIFO          : natural range 1 to 2**15       := 1;
     IO_TRACER_EN          : boolean                        := false;
     IO_TRACER_BUFFER      : natural range 1 to 2**15       := 1
 
@@ -229,6 +234,12 @@ entity neorv32_vivado_ip is
     spi_dat_o      : out std_logic;
     spi_dat_i      : in  std_logic := '0';
     spi_csn_o      : out std_logic_vector(7 downto 0); -- SPI CS
+    -- XIP (available if XIP_EN = true) --
+    xip_csn_o      : out std_logic;
+    xip_clk_o      : out std_logic;
+    xip_dat_i      : in  std_logic_vector(3 downto 0) := (others => '0');
+    xip_dat_o      : out std_logic_vector(3 downto 0);
+    xip_oe_o       : out std_logic_vector(3 downto 0);
     -- SDI (available if IO_SDI_EN = true) --
     sdi_clk_i      : in  std_logic := '0';
     sdi_dat_o      : out std_logic;
@@ -338,6 +349,8 @@ architecture neorv32_vivado_ip_rtl of neorv32_vivado_ip is
   signal uart0_txd_aux, uart0_rtsn_aux, uart1_txd_aux, uart1_rtsn_aux : std_ulogic;
   signal spi_clk_aux, spi_do_aux : std_ulogic;
   signal spi_csn_aux : std_ulogic_vector(7 downto 0);
+  signal xip_csn_aux, xip_clk_aux : std_ulogic;
+  signal xip_do_aux, xip_oe_aux : std_ulogic_vector(3 downto 0);
   signal sdi_do_aux : std_ulogic;
   signal twi_sda_o_aux, twi_scl_o_aux : std_ulogic;
   signal twd_sda_o_aux, twd_scl_o_aux : std_ulogic;
@@ -430,6 +443,8 @@ begin
     XBUS_EN             => XBUS_EN,
     XBUS_TIMEOUT        => XBUS_TIMEOUT,
     XBUS_REGSTAGE_EN    => XBUS_REGSTAGE_EN,
+    -- Execute-in-place module --
+    XIP_EN              => XIP_EN,
     -- Processor peripherals --
     IO_DISABLE_SYSINFO  => false,
     IO_GPIO_NUM         => num_gpio_c,
@@ -442,6 +457,7 @@ begin
     IO_UART1_TX_FIFO    => IO_UART1_TX_FIFO,
     IO_SPI_EN           => IO_SPI_EN,
     IO_SPI_FIFO         => IO_SPI_FIFO,
+    IO_SPI_XFER_EN      => IO_SPI_XFER_EN,
     IO_SDI_EN           => IO_SDI_EN,
     IO_SDI_FIFO         => IO_SDI_FIFO,
     IO_TWI_EN           => IO_TWI_EN,
@@ -463,6 +479,8 @@ begin
     IO_SLINK_EN         => IO_SLINK_EN,
     IO_SLINK_RX_FIFO    => IO_SLINK_RX_FIFO,
     IO_SLINK_TX_FIFO    => IO_SLINK_TX_FIFO,
+    IO_MBOX_EN          => IO_MBOX_EN,
+    IO_MBOX_FIFO        => IO_MBOX_FIFO,
     IO_TRACER_EN        => IO_TRACER_EN,
     IO_TRACER_BUFFER    => IO_TRACER_BUFFER
   )
@@ -518,6 +536,12 @@ begin
     spi_dat_o      => spi_do_aux,
     spi_dat_i      => std_ulogic(spi_dat_i),
     spi_csn_o      => spi_csn_aux,
+    -- XIP (available if XIP_EN = true) --
+    xip_csn_o      => xip_csn_aux,
+    xip_clk_o      => xip_clk_aux,
+    xip_dat_i      => std_ulogic_vector(xip_dat_i),
+    xip_dat_o      => xip_do_aux,
+    xip_oe_o       => xip_oe_aux,
     -- SDI (available if IO_SDI_EN = true) --
     sdi_clk_i      => std_ulogic(sdi_clk_i),
     sdi_dat_o      => sdi_do_aux,
@@ -575,6 +599,11 @@ begin
   spi_dat_o <= std_logic(spi_do_aux);
   spi_csn_o <= std_logic_vector(spi_csn_aux);
 
+  xip_csn_o <= std_logic(xip_csn_aux);
+  xip_clk_o <= std_logic(xip_clk_aux);
+  xip_dat_o <= std_logic_vector(xip_do_aux);
+  xip_oe_o  <= std_logic_vector(xip_oe_aux);
+
   sdi_dat_o <= std_logic(sdi_do_aux);
 
   twi_sda_o <= std_logic(twi_sda_o_aux);
@@ -0,0 +1,179 @@
+// ================================================================================ //
+// NEORV32 - Instruction Set Simulator (ISS) Command Line Front-End                 //
+// -------------------------------------------------------------------------------- //
+// Runs a NEORV32 executable (main.elf) on the functional model. UART0/1 output is  //
+// printed to stdout, UART0 input is taken from stdin. Optionally writes a          //
+// per-instruction execution trace.                                                 //
+// -------------------------------------------------------------------------------- //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "neorv32_iss.h"
+
+// exit code if the instruction limit has been reached
+static const int EXIT_TIMEOUT = 124;
+
+
+// ************************************************************************************************
+// Configuration
+// ************************************************************************************************
+struct options_t {
+  std::string  elf;               // executable
+  std::string  trace;             // execution trace file
+  uint64_t     max_instr = 0;     // instruction limit (0 = unlimited)
+  bool         quiet     = false; // no statistics
+  iss_config_t iss;
+};
+
+static void usage(const char *prog) {
+  std::printf(
+    "Usage: %s [options] <main.elf>\n"
+    "Options:\n"
+    "  --max-instr N    stop after N instructions (exit code %d); default: unlimited\n"
+    "  --imem-size N    IMEM size at 0x00000000 in bytes (power of two); default: 65536\n"
+    "  --dmem-size N    DMEM size at 0x80000000 in bytes (power of two); default: 65536\n"
+    "  --boot ADDR      CPU boot address; default: 0x00000000\n"
+    "  --clock HZ       processor clock (SYSINFO); default: 100000000\n"
+    "  --hpm N          number of HPM counters (0..13); default: 8\n"
+    "  --latency N      memory latency for the cycle estimation; default: 1\n"
+    "  --trace FILE     write execution trace to FILE ('-' = stderr)\n"
+    "  --no-stdin       do not feed stdin to UART0 RX\n"
+    "  --quiet          do not print simulation statistics\n"
+    "The simulation ends when the CPU halts (exit code = mscratch, i.e. main's return value),\n"
+    "when writing to 0xF0000000 (exit code = data) or when the instruction limit is reached.\n",
+    prog, EXIT_TIMEOUT);
+}
+
+static bool parse_args(int argc, char **argv, options_t &opt) {
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool has_arg = (i + 1) < argc;
+    if ((arg == "-h") || (arg == "--help")) {
+      return false;
+    } else if ((arg == "--max-instr") && has_arg) {
+      opt.max_instr = std::strtoull(argv[++i], nullptr, 0);
+    } else if ((arg == "--imem-size") && has_arg) {
+      opt.iss.imem_size = std::strtoul(argv[++i], nullptr, 0);
+    } else if ((arg == "--dmem-size") && has_arg) {
+      opt.iss.dmem_size = std::strtoul(argv[++i], nullptr, 0);
+    } else if ((arg == "--boot") && has_arg) {
+      opt.iss.boot_addr = std::strtoul(argv[++i], nullptr, 0);
+    } else if ((arg == "--clock") && has_arg) {
+      opt.iss.clock = std::strtoul(argv[++i], nullptr, 0);
+    } else if ((arg == "--hpm") && has_arg) {
+      opt.iss.hpm_num = std::strtoul(argv[++i], nullptr, 0);
+    } else if ((arg == "--latency") && has_arg) {
+      opt.iss.mem_latency = std::strtoul(argv[++i], nullptr, 0);
+    } else if ((arg == "--trace") && has_arg) {
+      opt.trace = argv[++i];
+    } else if (arg == "--no-stdin") {
+      opt.iss.uart_rx = false;
+    } else if (arg == "--quiet") {
+      opt.quiet = true;
+    } else if ((arg[0] != '-') && opt.elf.empty()) {
+      opt.elf = arg;
+    } else {
+      std::fprintf(stderr, "ERROR! Invalid option '%s'.\n", arg.c_str());
+      return false;
+    }
+  }
+  return !opt.elf.empty();
+}
+
+
+// ************************************************************************************************
+// Execution trace: <order> <cycle> 0x<pc> 0x<insn> <mode> [c.] [rd=data] [memory access] [<TRAP_ENTRY>]
+// ************************************************************************************************
+static void trace_line(FILE *f, const iss_retire_t &r) {
+  std::fprintf(f, "%llu %llu 0x%08x 0x%08x %c %s", (unsigned long long)r.order, (unsigned long long)r.cycle,
+               r.pc, r.insn, (r.mode == 3) ? 'M' : 'U', r.compr ? "c." : "  ");
+  if (r.trap) {
+    std::fprintf(f, " <EXCEPTION>");
+  }
+  if (r.rd) {
+    std::fprintf(f, " x%u=0x%08x", r.rd, r.rd_data);
+  }
+  if (r.mem_rmask) {
+    std::fprintf(f, " rd[0x%08x]", r.mem_addr);
+  }
+  if (r.mem_wmask) {
+    std::fprintf(f, " wr[0x%08x]=0x%08x/%x", r.mem_addr, r.mem_wdata, r.mem_wmask);
+  }
+  if (r.intr) {
+    std::fprintf(f, " <TRAP_ENTRY>");
+  }
+  std::fputc('\n', f);
+}
+
+
+// ************************************************************************************************
+// Main
+// ************************************************************************************************
+int main(int argc, char **argv) {
+
+  options_t opt;
+  if (!parse_args(argc, argv, opt)) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  neorv32_iss iss(opt.iss);
+  std::string err;
+  if (!iss.load_elf(opt.elf, err)) {
+    std::fprintf(stderr, "ERROR! %s.\n", err.c_str());
+    return 1;
+  }
+
+  FILE *trace = nullptr;
+  if (!opt.trace.empty()) {
+    trace = (opt.trace == "-") ? stderr : std::fopen(opt.trace.c_str(), "w");
+    if (trace == nullptr) {
+      std::fprintf(stderr, "ERROR! Cannot open trace file '%s'.\n", opt.trace.c_str());
+      return 1;
+    }
+  }
+
+  auto t_start = std::chrono::steady_clock::now();
+  if (trace) {
+    iss_retire_t r;
+    for (uint64_t n = 0; (opt.max_instr == 0) || (n < opt.max_instr); n++) {
+      if (!iss.step(&r)) {
+        break;
+      }
+      trace_line(trace, r);
+    }
+  } else {
+    iss.run(opt.max_instr);
+  }
+  double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+  std::fflush(stdout);
+  if (trace && (trace != stderr)) {
+    std::fclose(trace);
+  }
+
+  int exit_code = iss.terminated() ? iss.exit_code() : EXIT_TIMEOUT;
+  if (!opt.quiet) {
+    const char *reason = iss.terminated() ? iss.exit_reason() : "instruction limit reached";
+    uint64_t n = iss.instret;
+    std::fprintf(stderr, "\n[neorv32-iss] %s; exit code %d\n", reason, exit_code);
+    std::fprintf(stderr, "[neorv32-iss] %llu instructions, %llu cycles (estimated, CPI %.2f, %.6f s simulated)\n",
+                 (unsigned long long)n, (unsigned long long)iss.cycle, n ? ((double)iss.cycle / n) : 0.0,
+                 (double)iss.cycle / opt.iss.clock);
+    std::fprintf(stderr, "[neorv32-iss] compressed %.1f%%, loads %llu, stores %llu, branches %llu (%llu taken/jumps), traps %llu\n",
+                 n ? (100.0 * iss.stat_compr / n) : 0.0, (unsigned long long)iss.stat_loads,
+                 (unsigned long long)iss.stat_stores, (unsigned long long)iss.stat_branches,
+                 (unsigned long long)iss.stat_taken, (unsigned long long)iss.stat_traps);
+    std::fprintf(stderr, "[neorv32-iss] %.3f s host time (%.1f MIPS)\n", secs, (secs > 0) ? (n / secs / 1e6) : 0.0);
+  }
+  return exit_code;
+}
@@ -0,0 +1,1780 @@
+// ================================================================================ //
+// NEORV32 - Instruction Set Simulator (ISS) / Functional Reference Model           //
+// -------------------------------------------------------------------------------- //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+#include "neorv32_iss.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <poll.h>
+#include <unistd.h>
+
+
+// ************************************************************************************************
+// Memory map
+// ************************************************************************************************
+static const uint32_t IMEM_BASE     = 0x00000000u;
+static const uint32_t DMEM_BASE     = 0x80000000u;
+static const uint32_t IO_BASE       = 0xFFE00000u;
+static const uint32_t SIM_CTRL_ADDR = 0xF0000000u; // simulation control register (same as the Verilator harness)
+
+// IO devices (64kB each)
+static const uint32_t IO_DMA     = 0xFFED0000u;
+static const uint32_t IO_SLINK   = 0xFFEC0000u;
+static const uint32_t IO_CLINT   = 0xFFF40000u;
+static const uint32_t IO_UART0   = 0xFFF50000u;
+static const uint32_t IO_UART1   = 0xFFF60000u;
+static const uint32_t IO_GPIO    = 0xFFFC0000u;
+static const uint32_t IO_SYSINFO = 0xFFFE0000u;
+
+// peripheral FIFO sizes (log2)
+static const uint32_t UART_FIFO_LOG2  = 4;
+static const uint32_t DMA_FIFO_LOG2   = 4;
+static const uint32_t SLINK_FIFO_LOG2 = 4;
+
+
+// ************************************************************************************************
+// CPU
+// ************************************************************************************************
+enum {
+  OPC_LOAD = 0x03, OPC_FENCE = 0x0f, OPC_ALUI = 0x13, OPC_AUIPC = 0x17, OPC_STORE = 0x23, OPC_AMO = 0x2f,
+  OPC_ALU = 0x33, OPC_LUI = 0x37, OPC_BRANCH = 0x63, OPC_JALR = 0x67, OPC_JAL = 0x6f, OPC_SYSTEM = 0x73
+};
+
+// synchronous exceptions
+enum {
+  TRAP_IALIGN = 0, TRAP_IACCESS = 1, TRAP_ILLEGAL = 2, TRAP_BREAK = 3, TRAP_LALIGN = 4, TRAP_LACCESS = 5,
+  TRAP_SALIGN = 6, TRAP_SACCESS = 7, TRAP_UENV = 8, TRAP_MENV = 11
+};
+
+// interrupts (mie/mip bits)
+static const uint32_t IRQ_MSI = 3, IRQ_MTI = 7, IRQ_MEI = 11, IRQ_LCOF = 13, IRQ_FIRQ0 = 16;
+static const uint32_t FIRQ_UART0 = 2, FIRQ_UART1 = 3, FIRQ_GPIO = 8, FIRQ_DMA = 10, FIRQ_SLINK = 14;
+
+// mstatus
+static const uint32_t MSTATUS_MIE  = 1u << 3;
+static const uint32_t MSTATUS_MPIE = 1u << 7;
+static const uint32_t MSTATUS_MPP  = 3u << 11;
+static const uint32_t MSTATUS_MPRV = 1u << 17;
+static const uint32_t MSTATUS_TW   = 1u << 21;
+
+// mhpmevent*h
+static const uint32_t HPMEVH_OF = 1u << 31, HPMEVH_MINH = 1u << 30, HPMEVH_UINH = 1u << 28;
+
+// HPM events
+enum {
+  HPM_CY = 0, HPM_TM = 1, HPM_IR = 2, HPM_COMPR = 3, HPM_WAIT_DIS = 4, HPM_WAIT_ALU = 5, HPM_BRANCH = 6,
+  HPM_CTRLFLOW = 7, HPM_LOAD = 8, HPM_STORE = 9, HPM_WAIT_LSU = 10, HPM_TRAP = 11, HPM_IRQ = 12, HPM_WAIT_RST = 13
+  // cache, bus and DMA events (14..19) are not modeled
+};
+
+// estimated latencies of the multi-cycle units (fast multiplier and barrel shifter)
+static const uint32_t T_SHIFT = 1;
+static const uint32_t T_MUL   = 2;
+static const uint32_t T_DIV   = 32;
+
+static inline uint32_t sext(uint32_t x, int bits) {
+  return (uint32_t)((int32_t)(x << (32 - bits)) >> (32 - bits));
+}
+
+static inline uint32_t log2_size(uint32_t x) {
+  uint32_t r = 0;
+  while ((x >>= 1) != 0) {
+    r++;
+  }
+  return r;
+}
+
+
+// ************************************************************************************************
+// Setup
+// ************************************************************************************************
+neorv32_iss::neorv32_iss(const iss_config_t &c) : cfg(c) {
+  imem.resize(cfg.imem_size, 0);
+  dmem.resize(cfg.dmem_size, 0);
+  if (cfg.hpm_num > 13) {
+    cfg.hpm_num = 13;
+  }
+  c_table.resize(65536, 0);
+  for (uint32_t i = 0; i < 65536; i++) {
+    if ((i & 3) != 3) {
+      c_table[i] = decompress((uint16_t)i);
+    }
+  }
+  dcache.resize(imem.size() / 2);
+  reset();
+}
+
+void neorv32_iss::reset() {
+  std::memset(x, 0, sizeof(x));
+  pc      = cfg.boot_addr;
+  cycle   = 0;
+  instret = 0;
+  term    = false;
+
+  mode          = 3;
+  mstatus       = 0;
+  mie           = 0;
+  mtvec         = 0;
+  mscratch      = 0;
+  mepc          = 0;
+  mcause        = 0;
+  mtval         = 0;
+  mtinst        = 0;
+  mcounteren    = 0;
+  mcountinhibit = 0;
+  std::memset(hpm_cnt, 0, sizeof(hpm_cnt));
+  std::memset(hpm_evt, 0, sizeof(hpm_evt));
+  std::memset(hpm_evth, 0, sizeof(hpm_evth));
+  hpm_active = false;
+  hpm_of     = 0;
+  intr_entry = false;
+  lr_valid   = false;
+  lr_addr    = 0;
+
+  mtime_offset = 0;
+  mtimecmp     = 0;
+  mswi         = 0;
+  for (int i = 0; i < 2; i++) {
+    uart[i].ctrl    = 0;
+    uart[i].baud    = 0;
+    uart[i].overrun = false;
+    uart[i].rx.clear();
+  }
+  uart[0].out = cfg.uart0_out;
+  uart[1].out = cfg.uart1_out;
+  uart_poll   = 0;
+  stdin_eof   = !cfg.uart_rx;
+  gpio_out = gpio_in = gpio_type = gpio_pol = gpio_en = gpio_pend = 0;
+  dma.ctrl = 0;
+  dma.desc.clear();
+  dma.done = false;
+  dma.err  = false;
+  slink.ctrl     = 0;
+  slink.tx_route = 0;
+  slink.rx_route = 0;
+  slink.rx_last  = false;
+  slink.fifo.clear();
+  sysinfo_clk = cfg.clock;
+  firq        = 0;
+}
+
+void neorv32_iss::terminate(int code, const char *reason) {
+  term        = true;
+  term_code   = code;
+  term_reason = reason;
+}
+
+// load all PT_LOAD segments of a 32-bit little-endian ELF file to their physical (load) addresses
+bool neorv32_iss::load_elf(const std::string &file, std::string &err) {
+  std::ifstream f(file, std::ios::binary);
+  if (!f.is_open()) {
+    err = "cannot open '" + file + "'";
+    return false;
+  }
+  std::vector<uint8_t> img((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+  auto u16 = [&](size_t o) { return (uint32_t)img[o] | ((uint32_t)img[o+1] << 8); };
+  auto u32 = [&](size_t o) { return u16(o) | (u16(o+2) << 16); };
+
+  if ((img.size() < 52) || (std::memcmp(img.data(), "\x7f" "ELF", 4) != 0) || (img[4] != 1) || (img[5] != 1)) {
+    err = "'" + file + "' is not a 32-bit little-endian ELF file";
+    return false;
+  }
+  uint32_t phoff = u32(28), phentsize = u16(42), phnum = u16(44);
+  for (uint32_t i = 0; i < phnum; i++) {
+    size_t ph = phoff + i * phentsize;
+    if ((ph + 32) > img.size()) {
+      break;
+    }
+    if (u32(ph) != 1) { // PT_LOAD
+      continue;
+    }
+    uint32_t offset = u32(ph + 4), paddr = u32(ph + 12), filesz = u32(ph + 16), memsz = u32(ph + 20);
+    for (uint32_t j = 0; j < memsz; j++) {
+      uint8_t *p = map(paddr + j);
+      if (p == nullptr) {
+        char buf[128];
+        std::snprintf(buf, sizeof(buf), "ELF segment at 0x%08x (%u bytes) exceeds IMEM/DMEM", paddr, memsz);
+        err = buf;
+        return false;
+      }
+      *p = ((j < filesz) && ((offset + j) < img.size())) ? img[offset + j] : 0;
+    }
+  }
+  std::fill(dcache.begin(), dcache.end(), dec_t());
+  return true;
+}
+
+
+// ************************************************************************************************
+// Execution
+// ************************************************************************************************
+bool neorv32_iss::step(iss_retire_t *ret) {
+  if (term) {
+    return false;
+  }
+
+  // interrupts: FIRQ0..15 > MEI > MSI > MTI
+  uint32_t pend = cfg.cosim ? 0 : (irq_pending() & mie);
+  const bool irq_taken = pend && ((mode == 0) || (mstatus & MSTATUS_MIE));
+  if (irq_taken) {
+    uint32_t cause;
+    if (pend >> IRQ_FIRQ0) {
+      cause = IRQ_FIRQ0;
+      while (((pend >> cause) & 1) == 0) {
+        cause++;
+      }
+    } else if (pend & (1u << IRQ_MEI)) {
+      cause = IRQ_MEI;
+    } else if (pend & (1u << IRQ_MSI)) {
+      cause = IRQ_MSI;
+    } else if (pend & (1u << IRQ_MTI)) {
+      cause = IRQ_MTI;
+    } else {
+      cause = IRQ_LCOF;
+    }
+    trap_enter(0x80000000u | cause, 0, 0, false);
+    cycle += 3 + cfg.mem_latency;
+  }
+
+  if (ret) {
+    std::memset(ret, 0, sizeof(*ret));
+    ret->order = instret;
+    ret->pc    = pc;
+    ret->mode  = mode;
+    ret->intr  = intr_entry;
+  }
+  intr_entry = false;
+
+  // instruction fetch
+  uint32_t insn = 0;
+  bool compr = false;
+  uint16_t lo, hi = 0;
+  bool fetch_ok;
+  if (((uint64_t)(pc - IMEM_BASE) + 4) <= imem.size()) { // fast path: IMEM
+    std::memcpy(&lo, &imem[pc - IMEM_BASE], 2);
+    std::memcpy(&hi, &imem[pc - IMEM_BASE + 2], 2);
+    fetch_ok = true;
+  } else {
+    fetch_ok = fetch(pc, lo) && (((lo & 3) != 3) || fetch(pc + 2, hi));
+  }
+  if (!fetch_ok) {
+    cycles = 3 + cfg.mem_latency;
+    event_mask = (1u << HPM_CY) | (1u << HPM_CTRLFLOW) | (1u << HPM_TRAP);
+    trap_enter(TRAP_IACCESS, 0, 0, false);
+  } else {
+    if ((lo & 3) != 3) {
+      insn  = c_table[lo] ? c_table[lo] : lo; // illegal compressed instruction
+      compr = true;
+    } else {
+      insn = (uint32_t)lo | ((uint32_t)hi << 16);
+    }
+    execute(insn, compr, ret);
+  }
+  if (irq_taken) {
+    event_mask |= (1u << HPM_TRAP) | (1u << HPM_IRQ);
+  }
+
+  cycle += cycles;
+  if (!(mcountinhibit & (1u << HPM_CY))) {
+    hpm_cnt[0] += cycles;
+  }
+  if (!(mcountinhibit & (1u << HPM_IR)) && (event_mask & (1u << HPM_IR))) {
+    hpm_cnt[2]++;
+  }
+  if (hpm_active) {
+    count_events(cycles);
+  }
+  instret++;
+
+  if (ret) {
+    ret->insn    = insn;
+    ret->compr   = compr;
+    ret->trap    = intr_entry; // set by a synchronous trap
+    ret->next_pc = pc;
+    ret->cycle   = cycle;
+  }
+  return true;
+}
+
+uint64_t neorv32_iss::run(uint64_t max_instr) {
+  uint64_t n = 0;
+  while (!term && ((max_instr == 0) || (n < max_instr))) {
+    n += run_fast((max_instr == 0) ? UINT64_MAX : (max_instr - n));
+    if ((max_instr == 0) || (n < max_instr)) {
+      step(nullptr);
+      n++;
+    }
+  }
+  return n;
+}
+
+// decode instruction at IMEM offset off into the decode cache
+void neorv32_iss::decode(uint32_t off, dec_t &d) {
+  uint16_t lo, hi;
+  std::memcpy(&lo, &imem[off], 2);
+  std::memcpy(&hi, &imem[off + 2], 2);
+  d.compr = (lo & 3) != 3;
+
+  const uint32_t insn = d.compr ? (c_table[lo] ? c_table[lo] : lo) : ((uint32_t)lo | ((uint32_t)hi << 16));
+  const uint32_t opcode = insn & 0x7f, funct3 = (insn >> 12) & 7, funct7 = insn >> 25;
+  d.rd  = (insn >> 7) & 31;
+  d.rs1 = (insn >> 15) & 31;
+  d.rs2 = (insn >> 20) & 31;
+  d.imm = (uint32_t)((int32_t)insn >> 20);
+  d.op  = DEC_SLOW;
+
+  switch (opcode) {
+    case OPC_LUI:   d.op = DEC_LUI;   d.imm = insn & 0xfffff000u; break;
+    case OPC_AUIPC: d.op = DEC_AUIPC; d.imm = insn & 0xfffff000u; break;
+    case OPC_JAL:
+      d.op  = DEC_JAL;
+      d.imm = sext(((insn >> 31) << 20) | (((insn >> 12) & 0xff) << 12) | (((insn >> 20) & 1) << 11) |
+                   (((insn >> 21) & 0x3ff) << 1), 21);
+      break;
+    case OPC_JALR:
+      if (funct3 == 0) {
+        d.op = DEC_JALR;
+      }
+      break;
+    case OPC_BRANCH:
+      if ((funct3 != 2) && (funct3 != 3)) {
+        d.op  = DEC_BEQ + funct3;
+        d.imm = sext(((insn >> 31) << 12) | (((insn >> 7) & 1) << 11) | (((insn >> 25) & 0x3f) << 5) |
+                     (((insn >> 8) & 0xf) << 1), 13);
+      }
+      break;
+    case OPC_LOAD:
+      if ((funct3 != 3) && (funct3 <= 5)) {
+        d.op = DEC_LB + funct3;
+      }
+      break;
+    case OPC_STORE:
+      if (funct3 <= 2) {
+        d.op  = DEC_SB + funct3;
+        d.imm = sext(((insn >> 25) << 5) | ((insn >> 7) & 31), 12);
+      }
+      break;
+    case OPC_ALUI:
+      if ((funct3 != 1) && (funct3 != 5)) {
+        d.op = DEC_ADDI + funct3;
+      } else if (funct7 == 0x00) {
+        d.op = (funct3 == 1) ? DEC_SLLI : DEC_SRLI;
+      } else if ((funct7 == 0x20) && (funct3 == 5)) {
+        d.op = DEC_SRAI;
+      }
+      break;
+    case OPC_ALU:
+      if (funct7 == 0x00) {
+        d.op = DEC_ADD + funct3;
+      } else if ((funct7 == 0x20) && (funct3 == 0)) {
+        d.op = DEC_SUB;
+      } else if ((funct7 == 0x20) && (funct3 == 5)) {
+        d.op = DEC_SRA;
+      } else if ((funct7 == 0x01) && (funct3 == 0)) {
+        d.op = DEC_MUL;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+// fast path of run(): execute pre-decoded base ISA instructions from IMEM until an instruction has
+// to be executed by step() (interrupt, not in IMEM, IO/unaligned access, all other instructions) or
+// max_instr is reached; returns the number of executed instructions. Cycle estimation and HPM events
+// are identical to step(). Interrupts can only become pending by time (MTI) or by instructions that
+// are executed by step(), so the full interrupt check is done only once. The program counter and all
+// counters are kept in local variables and are written back at the end.
+uint64_t neorv32_iss::run_fast(uint64_t max_instr) {
+  uint64_t cyc_max = UINT64_MAX; // cycles until the timer interrupt becomes pending
+  if (!cfg.cosim && ((mode == 0) || (mstatus & MSTATUS_MIE))) {
+    if (irq_pending() & mie) {
+      return 0;
+    }
+    if (mie & (1u << IRQ_MTI)) {
+      cyc_max = mtimecmp - mtime();
+    }
+  }
+
+  const uint32_t L = cfg.mem_latency, hpm_of_start = hpm_of;
+  const uint64_t imem_size = imem.size();
+  uint32_t pc_l = pc;
+  uint64_t n = 0, cyc_sum = 0, loads = 0, stores = 0, branches = 0, taken = 0, compr = 0;
+
+  while ((n < max_instr) && (cyc_sum < cyc_max)) {
+    const uint32_t off = pc_l - IMEM_BASE;
+    if (((uint64_t)off + 4) > imem_size) {
+      break;
+    }
+    dec_t &d = dcache[off >> 1];
+    if (d.op == DEC_NONE) {
+      decode(off, d);
+    }
+    if (d.op == DEC_SLOW) {
+      break;
+    }
+
+    const uint32_t a = x[d.rs1], b = x[d.rs2];
+    uint32_t next_pc = pc_l + (d.compr ? 2 : 4);
+    uint32_t res = 0, cyc = 2, wlsu = 0;
+    uint32_t evt = (1u << HPM_CY) | (1u << HPM_IR) | ((uint32_t)d.compr << HPM_COMPR);
+    bool wb = true;
+
+    switch (d.op) {
+      case DEC_LUI:   res = d.imm; break;
+      case DEC_AUIPC: res = pc_l + d.imm; break;
+      case DEC_JAL:
+      case DEC_JALR:
+        res     = next_pc;
+        next_pc = (d.op == DEC_JAL) ? (pc_l + d.imm) : ((a + d.imm) & ~1u);
+        cyc     = 5 + L;
+        evt    |= (1u << HPM_CTRLFLOW) | (1u << HPM_WAIT_DIS) | (1u << HPM_WAIT_RST);
+        taken++;
+        break;
+      case DEC_BEQ: case DEC_BNE: case DEC_BLT: case DEC_BGE: case DEC_BLTU: case DEC_BGEU: {
+        bool take;
+        switch (d.op) {
+          case DEC_BEQ:  take = (a == b); break;
+          case DEC_BNE:  take = (a != b); break;
+          case DEC_BLT:  take = ((int32_t)a <  (int32_t)b); break;
+          case DEC_BGE:  take = ((int32_t)a >= (int32_t)b); break;
+          case DEC_BLTU: take = (a <  b); break;
+          default:       take = (a >= b); break;
+        }
+        branches++;
+        evt |= 1u << HPM_BRANCH;
+        cyc  = 3;
+        if (take) {
+          next_pc = pc_l + d.imm;
+          cyc     = 5 + L;
+          evt    |= (1u << HPM_CTRLFLOW) | (1u << HPM_WAIT_DIS) | (1u << HPM_WAIT_RST);
+          taken++;
+        }
+        wb = false;
+        break;
+      }
+      case DEC_LB: case DEC_LH: case DEC_LW: case DEC_LBU: case DEC_LHU: { // IMEM/DMEM only, naturally aligned
+        const uint32_t addr = a + d.imm, size = 1u << ((d.op - DEC_LB) & 3);
+        const uint8_t *p = map(addr);
+        if ((p == nullptr) || (addr & (size - 1))) {
+          goto done;
+        }
+        switch (d.op) {
+          case DEC_LB:  res = sext(p[0], 8); break;
+          case DEC_LH:  res = sext((uint32_t)p[0] | ((uint32_t)p[1] << 8), 16); break;
+          case DEC_LW:  std::memcpy(&res, p, 4); break; // host is little-endian
+          case DEC_LBU: res = p[0]; break;
+          default:      res = (uint32_t)p[0] | ((uint32_t)p[1] << 8); break;
+        }
+        cyc  = 4 + L;
+        wlsu = L;
+        evt |= (1u << HPM_LOAD) | (1u << HPM_WAIT_LSU);
+        loads++;
+        break;
+      }
+      case DEC_SB: case DEC_SH: case DEC_SW: { // IMEM/DMEM only, naturally aligned
+        const uint32_t addr = a + d.imm, size = 1u << (d.op - DEC_SB);
+        uint8_t *p = map(addr);
+        if ((p == nullptr) || (addr & (size - 1))) {
+          goto done;
+        }
+        std::memcpy(p, &b, size); // host is little-endian
+        if ((addr - IMEM_BASE) < imem_size) { // self-modifying code
+          dcache_invalidate(addr & ~3u);
+        }
+        if (lr_valid && (((addr ^ lr_addr) & ~3u) == 0)) {
+          lr_valid = false;
+        }
+        cyc  = 4 + L;
+        wlsu = L;
+        evt |= (1u << HPM_STORE) | (1u << HPM_WAIT_LSU);
+        stores++;
+        wb = false;
+        break;
+      }
+      case DEC_ADDI:  res = a + d.imm; break;
+      case DEC_SLTI:  res = ((int32_t)a < (int32_t)d.imm); break;
+      case DEC_SLTIU: res = (a < d.imm); break;
+      case DEC_XORI:  res = a ^ d.imm; break;
+      case DEC_ORI:   res = a | d.imm; break;
+      case DEC_ANDI:  res = a & d.imm; break;
+      case DEC_SLLI:  res = a << d.rs2; cyc = 3 + T_SHIFT; break;
+      case DEC_SRLI:  res = a >> d.rs2; cyc = 3 + T_SHIFT; break;
+      case DEC_SRAI:  res = (uint32_t)((int32_t)a >> d.rs2); cyc = 3 + T_SHIFT; break;
+      case DEC_ADD:   res = a + b; break;
+      case DEC_SUB:   res = a - b; break;
+      case DEC_SLL:   res = a << (b & 31); cyc = 3 + T_SHIFT; break;
+      case DEC_SLT:   res = ((int32_t)a < (int32_t)b); break;
+      case DEC_SLTU:  res = (a < b); break;
+      case DEC_XOR:   res = a ^ b; break;
+      case DEC_SRL:   res = a >> (b & 31); cyc = 3 + T_SHIFT; break;
+      case DEC_SRA:   res = (uint32_t)((int32_t)a >> (b & 31)); cyc = 3 + T_SHIFT; break;
+      case DEC_OR:    res = a | b; break;
+      case DEC_AND:   res = a & b; break;
+      case DEC_MUL:   res = a * b; cyc = 3 + T_MUL; break;
+      default: break;
+    }
+
+    if (wb) {
+      x[d.rd] = res;
+      x[0]    = 0;
+    }
+    compr   += d.compr;
+    pc_l     = next_pc;
+    cyc_sum += cyc;
+    n++;
+    if (hpm_active) { // needs the events of this instruction
+      const bool multi = (d.op >= DEC_ADDI) && (cyc > 2); // multi-cycle ALU operation
+      cycles     = cyc;
+      event_mask = evt | ((uint32_t)multi << HPM_WAIT_ALU);
+      wait_alu   = multi ? (cyc - 2) : 0;
+      wait_lsu   = wlsu;
+      count_events(cyc);
+      if (hpm_of != hpm_of_start) { // counter overflow: LCOF interrupt might be pending now
+        break;
+      }
+    }
+  }
+
+done:
+  if (n) {
+    pc         = pc_l;
+    intr_entry = false;
+    cycle     += cyc_sum;
+    instret   += n;
+    if (!(mcountinhibit & (1u << HPM_CY))) {
+      hpm_cnt[0] += cyc_sum;
+    }
+    if (!(mcountinhibit & (1u << HPM_IR))) {
+      hpm_cnt[2] += n;
+    }
+    stat_loads    += loads;
+    stat_stores   += stores;
+    stat_branches += branches;
+    stat_taken    += taken;
+    stat_compr    += compr;
+  }
+  return n;
+}
+
+// invalidate all decode cache entries that overlap the IMEM word at addr
+void neorv32_iss::dcache_invalidate(uint32_t addr) {
+  const uint32_t idx = (addr - IMEM_BASE) >> 1;
+  for (uint32_t i = (idx ? (idx - 1) : 0); (i <= (idx + 1)) && (i < dcache.size()); i++) {
+    dcache[i].op = DEC_NONE;
+  }
+}
+
+// execute a single (de-compressed) instruction
+void neorv32_iss::execute(uint32_t insn, bool compr, iss_retire_t *ret) {
+  const uint32_t opcode = insn & 0x7f, rd = (insn >> 7) & 31, funct3 = (insn >> 12) & 7;
+  const uint32_t rs1 = (insn >> 15) & 31, rs2 = (insn >> 20) & 31, funct7 = insn >> 25;
+  const uint32_t a = x[rs1], b = x[rs2];
+  const uint32_t imm_i = (uint32_t)((int32_t)insn >> 20);
+  const uint32_t L = cfg.mem_latency;
+
+  uint32_t next_pc = pc + (compr ? 2 : 4);
+  uint32_t res = 0;
+  bool wb = false, trap = false;
+
+  cycles     = 2;
+  event_mask = (1u << HPM_CY) | (1u << HPM_IR) | ((uint32_t)compr << HPM_COMPR);
+  wait_alu   = 0;
+  wait_lsu   = 0;
+  exc        = {TRAP_ILLEGAL, 0};
+
+  switch (opcode) {
+
+    case OPC_LUI:
+      res = insn & 0xfffff000u;
+      wb  = true;
+      break;
+
+    case OPC_AUIPC:
+      res = pc + (insn & 0xfffff000u);
+      wb  = true;
+      break;
+
+    case OPC_JAL:
+    case OPC_JALR: {
+      if ((opcode == OPC_JALR) && (funct3 != 0)) {
+        trap = true;
+        break;
+      }
+      uint32_t imm_j = sext(((insn >> 31) << 20) | (((insn >> 12) & 0xff) << 12) | (((insn >> 20) & 1) << 11) |
+                            (((insn >> 21) & 0x3ff) << 1), 21);
+      res     = next_pc;
+      wb      = true;
+      next_pc = (opcode == OPC_JAL) ? (pc + imm_j) : ((a + imm_i) & ~1u);
+      cycles  = 5 + L;
+      event_mask |= (1u << HPM_CTRLFLOW) | (1u << HPM_WAIT_DIS) | (1u << HPM_WAIT_RST);
+      stat_taken++;
+      break;
+    }
+
+    case OPC_BRANCH: {
+      bool take;
+      switch (funct3) {
+        case 0: take = (a == b); break;
+        case 1: take = (a != b); break;
+        case 4: take = ((int32_t)a <  (int32_t)b); break;
+        case 5: take = ((int32_t)a >= (int32_t)b); break;
+        case 6: take = (a <  b); break;
+        case 7: take = (a >= b); break;
+        default: trap = true; take = false; break;
+      }
+      if (trap) {
+        break;
+      }
+      stat_branches++;
+      event_mask |= 1u << HPM_BRANCH;
+      cycles = 3;
+      if (take) {
+        uint32_t imm_b = sext(((insn >> 31) << 12) | (((insn >> 7) & 1) << 11) | (((insn >> 25) & 0x3f) << 5) |
+                              (((insn >> 8) & 0xf) << 1), 13);
+        next_pc = pc + imm_b;
+        cycles  = 5 + L;
+        event_mask |= (1u << HPM_CTRLFLOW) | (1u << HPM_WAIT_DIS) | (1u << HPM_WAIT_RST);
+        stat_taken++;
+      }
+      break;
+    }
+
+    case OPC_LOAD: {
+      int size = 1 << (funct3 & 3);
+      if ((funct3 == 3) || (funct3 > 5)) {
+        trap = true;
+        break;
+      }
+      cycles   = 4 + L;
+      wait_lsu = L;
+      event_mask |= (1u << HPM_LOAD) | (1u << HPM_WAIT_LSU);
+      stat_loads++;
+      trap = !load(a + imm_i, size, (funct3 & 4) == 0, res, ret);
+      wb   = true;
+      break;
+    }
+
+    case OPC_STORE: {
+      if (funct3 > 2) {
+        trap = true;
+        break;
+      }
+      uint32_t imm_s = sext(((insn >> 25) << 5) | ((insn >> 7) & 31), 12);
+      cycles   = 4 + L;
+      wait_lsu = L;
+      event_mask |= (1u << HPM_STORE) | (1u << HPM_WAIT_LSU);
+      stat_stores++;
+      trap = !store(a + imm_s, 1 << funct3, b, ret);
+      break;
+    }
+
+    case OPC_ALUI: {
+      const uint32_t shamt = rs2, f12 = insn >> 20;
+      wb = true;
+      switch (funct3) {
+        case 0: res = a + imm_i; break;
+        case 2: res = ((int32_t)a < (int32_t)imm_i); break;
+        case 3: res = (a < imm_i); break;
+        case 4: res = a ^ imm_i; break;
+        case 6: res = a | imm_i; break;
+        case 7: res = a & imm_i; break;
+        case 1:
+          if (funct7 == 0x00) { // slli
+            res = a << shamt;
+            cycles = 3 + T_SHIFT;
+          } else if (funct7 == 0x24) { // bclri
+            res = a & ~(1u << shamt);
+            cycles = 4;
+          } else if (funct7 == 0x14) { // bseti
+            res = a | (1u << shamt);
+            cycles = 4;
+          } else if (funct7 == 0x34) { // binvi
+            res = a ^ (1u << shamt);
+            cycles = 4;
+          } else if (funct7 == 0x30) {
+            cycles = 4 + T_SHIFT;
+            switch (rs2) {
+              case 0: res = a ? (uint32_t)__builtin_clz(a) : 32; break; // clz
+              case 1: res = a ? (uint32_t)__builtin_ctz(a) : 32; break; // ctz
+              case 2: res = (uint32_t)__builtin_popcount(a); break; // cpop
+              case 4: res = sext(a, 8); cycles = 4; break; // sext.b
+              case 5: res = sext(a, 16); cycles = 4; break; // sext.h
+              default: trap = true; break;
+            }
+          } else {
+            trap = true;
+          }
+          break;
+        case 5:
+          if (funct7 == 0x00) { // srli
+            res = a >> shamt;
+            cycles = 3 + T_SHIFT;
+          } else if (funct7 == 0x20) { // srai
+            res = (uint32_t)((int32_t)a >> shamt);
+            cycles = 3 + T_SHIFT;
+          } else if (funct7 == 0x30) { // rori
+            res = (a >> shamt) | (a << ((32 - shamt) & 31));
+            cycles = 4 + T_SHIFT;
+          } else if (funct7 == 0x24) { // bexti
+            res = (a >> shamt) & 1;
+            cycles = 4;
+          } else if (f12 == 0x287) { // orc.b
+            res = 0;
+            for (int i = 0; i < 32; i += 8) {
+              if ((a >> i) & 0xff) {
+                res |= 0xffu << i;
+              }
+            }
+            cycles = 4;
+          } else if (f12 == 0x698) { // rev8
+            res = __builtin_bswap32(a);
+            cycles = 4;
+          } else {
+            trap = true;
+          }
+          break;
+      }
+      wait_alu = cycles - 2;
+      if (wait_alu) {
+        event_mask |= 1u << HPM_WAIT_ALU;
+      }
+      break;
+    }
+
+    case OPC_ALU: {
+      wb = true;
+      switch ((funct7 << 3) | funct3) {
+        // base ISA
+        case (0x00 << 3) | 0: res = a + b; break;
+        case (0x20 << 3) | 0: res = a - b; break;
+        case (0x00 << 3) | 1: res = a << (b & 31); cycles = 3 + T_SHIFT; break;
+        case (0x00 << 3) | 2: res = ((int32_t)a < (int32_t)b); break;
+        case (0x00 << 3) | 3: res = (a < b); break;
+        case (0x00 << 3) | 4: res = a ^ b; break;
+        case (0x00 << 3) | 5: res = a >> (b & 31); cycles = 3 + T_SHIFT; break;
+        case (0x20 << 3) | 5: res = (uint32_t)((int32_t)a >> (b & 31)); cycles = 3 + T_SHIFT; break;
+        case (0x00 << 3) | 6: res = a | b; break;
+        case (0x00 << 3) | 7: res = a & b; break;
+        // M
+        case (0x01 << 3) | 0: res = a * b; cycles = 3 + T_MUL; break;
+        case (0x01 << 3) | 1: res = (uint32_t)(((int64_t)(int32_t)a * (int64_t)(int32_t)b) >> 32); cycles = 3 + T_MUL; break;
+        case (0x01 << 3) | 2: res = (uint32_t)(((int64_t)(int32_t)a * (int64_t)(uint64_t)b) >> 32); cycles = 3 + T_MUL; break;
+        case (0x01 << 3) | 3: res = (uint32_t)(((uint64_t)a * (uint64_t)b) >> 32); cycles = 3 + T_MUL; break;
+        case (0x01 << 3) | 4:
+          res = (b == 0) ? 0xffffffffu : (((a == 0x80000000u) && (b == 0xffffffffu)) ? a : (uint32_t)((int32_t)a / (int32_t)b));
+          cycles = 3 + T_DIV;
+          break;
+        case (0x01 << 3) | 5: res = (b == 0) ? 0xffffffffu : (a / b); cycles = 3 + T_DIV; break;
+        case (0x01 << 3) | 6:
+          res = (b == 0) ? a : (((a == 0x80000000u) && (b == 0xffffffffu)) ? 0 : (uint32_t)((int32_t)a % (int32_t)b));
+          cycles = 3 + T_DIV;
+          break;
+        case (0x01 << 3) | 7: res = (b == 0) ? a : (a % b); cycles = 3 + T_DIV; break;
+        // Zba
+        case (0x10 << 3) | 2: res = (a << 1) + b; cycles = 4; break;
+        case (0x10 << 3) | 4: res = (a << 2) + b; cycles = 4; break;
+        case (0x10 << 3) | 6: res = (a << 3) + b; cycles = 4; break;
+        // Zbb
+        case (0x20 << 3) | 7: res = a & ~b; cycles = 4; break;
+        case (0x20 << 3) | 6: res = a | ~b; cycles = 4; break;
+        case (0x20 << 3) | 4: res = ~(a ^ b); cycles = 4; break;
+        case (0x05 << 3) | 4: res = ((int32_t)a < (int32_t)b) ? a : b; cycles = 4; break;
+        case (0x05 << 3) | 5: res = (a < b) ? a : b; cycles = 4; break;
+        case (0x05 << 3) | 6: res = ((int32_t)a < (int32_t)b) ? b : a; cycles = 4; break;
+        case (0x05 << 3) | 7: res = (a < b) ? b : a; cycles = 4; break;
+        case (0x30 << 3) | 1: res = (a << (b & 31)) | (a >> ((32 - (b & 31)) & 31)); cycles = 4 + T_SHIFT; break;
+        case (0x30 << 3) | 5: res = (a >> (b & 31)) | (a << ((32 - (b & 31)) & 31)); cycles = 4 + T_SHIFT; break;
+        case (0x04 << 3) | 4: // zext.h
+          if (rs2 != 0) {
+            trap = true;
+          }
+          res = a & 0xffff;
+          cycles = 4;
+          break;
+        // Zbs
+        case (0x24 << 3) | 1: res = a & ~(1u << (b & 31)); cycles = 4; break;
+        case (0x24 << 3) | 5: res = (a >> (b & 31)) & 1; cycles = 4; break;
+        case (0x14 << 3) | 1: res = a | (1u << (b & 31)); cycles = 4; break;
+        case (0x34 << 3) | 1: res = a ^ (1u << (b & 31)); cycles = 4; break;
+        // Zicond
+        case (0x07 << 3) | 5: res = (b == 0) ? 0 : a; cycles = 3; break;
+        case (0x07 << 3) | 7: res = (b != 0) ? 0 : a; cycles = 3; break;
+        default: trap = true; break;
+      }
+      wait_alu = cycles - 2;
+      if (wait_alu) {
+        event_mask |= 1u << HPM_WAIT_ALU;
+      }
+      break;
+    }
+
+    case OPC_AMO: {
+      const uint32_t funct5 = insn >> 27;
+      if (funct3 != 2) {
+        trap = true;
+        break;
+      }
+      cycles   = 4 + L;
+      wait_lsu = L;
+      wb       = true;
+      if (funct5 == 0x02) { // lr.w
+        if (rs2 != 0) {
+          trap = true;
+          break;
+        }
+        event_mask |= (1u << HPM_LOAD) | (1u << HPM_WAIT_LSU);
+        stat_loads++;
+        trap = !load(a, 4, false, res, ret);
+        if (!trap) {
+          lr_valid = true;
+          lr_addr  = a;
+        }
+      } else if (funct5 == 0x03) { // sc.w
+        event_mask |= (1u << HPM_STORE) | (1u << HPM_WAIT_LSU);
+        stat_stores++;
+        if (lr_valid && (lr_addr == a)) {
+          trap = !store(a, 4, b, ret);
+          res  = 0;
+        } else {
+          if (a & 3) {
+            exc  = {TRAP_SALIGN, a};
+            trap = true;
+          }
+          res = 1;
+        }
+        lr_valid = false;
+      } else { // AMOs: read-modify-write
+        uint32_t mem;
+        switch (funct5) {
+          case 0x00: case 0x01: case 0x04: case 0x08: case 0x0c: case 0x10: case 0x14: case 0x18: case 0x1c: break;
+          default: trap = true; break;
+        }
+        if (trap) {
+          break;
+        }
+        cycles   = 5 + 2 * L;
+        wait_lsu = 2 * L;
+        event_mask |= (1u << HPM_LOAD) | (1u << HPM_STORE) | (1u << HPM_WAIT_LSU);
+        stat_loads++;
+        stat_stores++;
+        if (a & 3) {
+          exc  = {TRAP_SALIGN, a};
+          trap = true;
+          break;
+        }
+        if (!load(a, 4, false, mem, ret)) {
+          exc.cause = TRAP_SACCESS; // AMOs report store/AMO faults
+          trap = true;
+          break;
+        }
+        uint32_t val;
+        switch (funct5) {
+          case 0x00: val = mem + b; break;
+          case 0x01: val = b; break;
+          case 0x04: val = mem ^ b; break;
+          case 0x08: val = mem | b; break;
+          case 0x0c: val = mem & b; break;
+          case 0x10: val = ((int32_t)mem < (int32_t)b) ? mem : b; break;
+          case 0x14: val = ((int32_t)mem < (int32_t)b) ? b : mem; break;
+          case 0x18: val = (mem < b) ? mem : b; break;
+          default:   val = (mem < b) ? b : mem; break;
+        }
+        trap = !store(a, 4, val, ret);
+        res  = mem;
+      }
+      break;
+    }
+
+    case OPC_FENCE:
+      if (funct3 == 0) { // fence
+        cycles = 2;
+      } else if (funct3 == 1) { // fence.i
+        cycles = 5 + L;
+        event_mask |= (1u << HPM_WAIT_DIS) | (1u << HPM_WAIT_RST);
+      } else {
+        trap = true;
+      }
+      break;
+
+    case OPC_SYSTEM:
+      if (funct3 == 0) { // environment
+        const uint32_t f12 = insn >> 20;
+        if ((rs1 != 0) || (rd != 0)) {
+          trap = true;
+        } else if (f12 == 0x000) { // ecall
+          exc  = {(mode == 0) ? (uint32_t)TRAP_UENV : (uint32_t)TRAP_MENV, 0};
+          trap = true;
+        } else if (f12 == 0x001) { // ebreak
+          exc  = {TRAP_BREAK, 0};
+          trap = true;
+        } else if ((f12 == 0x302) && (mode == 3)) { // mret
+          next_pc = mepc;
+          mode    = (mstatus & MSTATUS_MPP) ? 3 : 0;
+          if (mode != 3) {
+            mstatus &= ~MSTATUS_MPRV;
+          }
+          mstatus &= ~MSTATUS_MPP;
+          mstatus = (mstatus & ~(MSTATUS_MIE | MSTATUS_MPIE)) | ((mstatus & MSTATUS_MPIE) ? MSTATUS_MIE : 0) | MSTATUS_MPIE;
+          cycles = 7 + L;
+          event_mask |= (1u << HPM_CTRLFLOW) | (1u << HPM_WAIT_DIS) | (1u << HPM_WAIT_RST);
+        } else if ((f12 == 0x105) && ((mode == 3) || !(mstatus & MSTATUS_TW))) { // wfi
+          cycles = 3;
+          pc = next_pc;
+          if (!cfg.cosim && !wait_for_irq()) {
+            terminate((int)mscratch, "CPU halted (wfi without wake-up source)");
+          }
+        } else {
+          trap = true;
+        }
+        if (trap) {
+          cycles = 7 + L;
+        }
+      } else if (funct3 == 4) { // Zimop: mop.r.n / mop.rr.n
+        if (((insn & 0xb3c00000u) == 0x81c00000u) || ((insn & 0xb2000000u) == 0x82000000u)) {
+          res    = 0;
+          wb     = true;
+          cycles = 3;
+        } else {
+          trap = true;
+        }
+      } else { // Zicsr
+        cycles = 3;
+        const bool do_write = ((funct3 & 3) == 1) || (rs1 != 0);
+        trap = !csr_access(insn >> 20, funct3, (funct3 & 4) ? rs1 : a, do_write, res);
+        wb   = true;
+      }
+      break;
+
+    default:
+      trap = true;
+      break;
+  }
+
+  if (trap) {
+    if (exc.cause == TRAP_ILLEGAL) {
+      exc.tval = 0;
+    }
+    event_mask = (1u << HPM_CY) | (1u << HPM_CTRLFLOW) | (1u << HPM_TRAP) | ((uint32_t)compr << HPM_COMPR);
+    trap_enter(exc.cause, exc.tval, insn, compr);
+    stat_traps++;
+    return;
+  }
+
+  if (wb && (rd != 0)) {
+    x[rd] = res;
+    if (ret) {
+      ret->rd      = rd;
+      ret->rd_data = res;
+    }
+  }
+  if (compr) {
+    stat_compr++;
+  }
+  pc = next_pc;
+}
+
+// enter machine-mode trap
+void neorv32_iss::trap_enter(uint32_t cause, uint32_t tval, uint32_t insn, bool compr) {
+  const bool irq = (cause >> 31) != 0;
+  const uint32_t mpp = (mode == 3) ? MSTATUS_MPP : 0;
+  mstatus = (mstatus & ~(MSTATUS_MPP | MSTATUS_MPIE | MSTATUS_MIE)) | mpp | ((mstatus & MSTATUS_MIE) ? MSTATUS_MPIE : 0);
+  mode    = 3;
+  mcause  = cause & 0x8000001fu;
+  mepc    = pc & ~1u;
+  mtval   = (!irq && (cause >= TRAP_LALIGN) && (cause <= TRAP_SACCESS)) ? tval : 0;
+  mtinst  = compr ? (insn & ~2u) : insn;
+  if ((mtvec & 1) && irq) {
+    pc = (mtvec & 0xffffff80u) | ((cause & 31) << 2);
+  } else {
+    pc = mtvec & 0xfffffffcu;
+  }
+  lr_valid   = false;
+  intr_entry = true;
+}
+
+// interrupt requested by the co-simulation environment
+void neorv32_iss::interrupt(uint32_t cause) {
+  trap_enter(0x80000000u | cause, 0, 0, false);
+}
+
+// pending interrupts (mip)
+uint32_t neorv32_iss::irq_pending() {
+  return firq | ((uint32_t)(hpm_of != 0) << IRQ_LCOF) | ((uint32_t)(mtime() >= mtimecmp) << IRQ_MTI) | ((mswi & 1) << IRQ_MSI);
+}
+
+// wfi: fast-forward simulated time until an interrupt becomes pending;
+// returns false if there is no source that could ever wake up the CPU
+bool neorv32_iss::wait_for_irq() {
+  while (true) {
+    if (irq_pending() & mie) {
+      return true;
+    }
+    uint64_t now = mtime();
+    bool timer = (mie & (1u << IRQ_MTI)) && ((mtimecmp - now) < (1ull << 62));
+    bool rx    = (mie & (1u << (IRQ_FIRQ0 + FIRQ_UART0))) && (uart[0].ctrl & 1) && !stdin_eof;
+    if (!timer && !rx) {
+      return false;
+    }
+    if (rx) { // block on stdin if there is no timer that could fire earlier
+      uart_poll = 0;
+      uart_rx_poll();
+      if (!timer && uart[0].rx.empty() && !stdin_eof) {
+        struct pollfd pfd = {0, POLLIN, 0};
+        poll(&pfd, 1, -1);
+      }
+      if (!uart[0].rx.empty()) {
+        continue;
+      }
+    }
+    if (timer) {
+      cycle += mtimecmp - now;
+    }
+  }
+}
+
+// count HPM events
+void neorv32_iss::count_events(uint32_t cyc) {
+  for (uint32_t i = 3; i < 3 + cfg.hpm_num; i++) {
+    uint32_t evt = hpm_evt[i] & event_mask;
+    if ((evt == 0) || (mcountinhibit & (1u << i)) || (hpm_evth[i] & ((mode == 3) ? HPMEVH_MINH : HPMEVH_UINH))) {
+      continue;
+    }
+    // counters increment once per cycle if any of the selected events is active
+    uint64_t inc = 1;
+    if (evt & (1u << HPM_CY)) {
+      inc = cyc;
+    } else {
+      if ((evt & (1u << HPM_WAIT_ALU)) && (wait_alu > inc)) {
+        inc = wait_alu;
+      }
+      if ((evt & (1u << HPM_WAIT_LSU)) && (wait_lsu > inc)) {
+        inc = wait_lsu;
+      }
+      if ((evt & ((1u << HPM_WAIT_DIS) | (1u << HPM_WAIT_RST))) && (cfg.mem_latency > inc)) {
+        inc = cfg.mem_latency;
+      }
+    }
+    hpm_cnt[i] += inc;
+    if (hpm_cnt[i] < inc) { // wrap-around: set overflow flag (local counter overflow interrupt)
+      hpm_evth[i] |= HPMEVH_OF;
+      hpm_of |= 1u << i;
+    }
+  }
+}
+
+
+// ************************************************************************************************
+// Control and status registers
+// ************************************************************************************************
+bool neorv32_iss::csr_access(uint32_t addr, uint32_t funct3, uint32_t wdata, bool do_write, uint32_t &rdata) {
+  if ((mode == 0) && (((addr >> 8) & 3) != 0)) { // privilege level
+    return false;
+  }
+  if (do_write && ((addr >> 10) == 3)) { // read-only CSR
+    return false;
+  }
+  if (!csr_read(addr, rdata)) {
+    return false;
+  }
+  if (do_write) {
+    switch (funct3 & 3) {
+      case 1:  csr_write(addr, wdata); break;
+      case 2:  csr_write(addr, rdata | wdata); break;
+      default: csr_write(addr, rdata & ~wdata); break;
+    }
+  }
+  return true;
+}
+
+bool neorv32_iss::csr_read(uint32_t addr, uint32_t &data) {
+  const uint32_t hpm_max = 3 + cfg.hpm_num; // first unimplemented HPM counter
+  data = 0;
+  switch (addr) {
+    case 0x300: // mstatus
+      data = mstatus;
+      break;
+    case 0x301: // misa: MXL=32, A B C I M U X
+      data = 0x40000000u | (1u << 0) | (1u << 1) | (1u << 2) | (1u << 8) | (1u << 12) | (1u << 20) | (1u << 23);
+      break;
+    case 0x304: data = mie; break;
+    case 0x305: data = mtvec; break;
+    case 0x306: data = mcounteren; break;
+    case 0x30a: case 0x31a: case 0x310: break; // menvcfg(h), mstatush
+    case 0x320: data = mcountinhibit; break;
+    case 0x340: data = mscratch; break;
+    case 0x341: data = mepc; break;
+    case 0x342: data = mcause; break;
+    case 0x343: data = mtval; break;
+    case 0x344: data = irq_pending(); break;
+    case 0x34a: data = mtinst; break;
+    case 0xb00: case 0xc00: data = (uint32_t)hpm_cnt[0]; break;
+    case 0xb80: case 0xc80: data = (uint32_t)(hpm_cnt[0] >> 32); break;
+    case 0xb02: case 0xc02: data = (uint32_t)hpm_cnt[2]; break;
+    case 0xb82: case 0xc82: data = (uint32_t)(hpm_cnt[2] >> 32); break;
+    case 0xf11: break; // mvendorid
+    case 0xf12: data = 19; break; // marchid
+    case 0xf13: data = NEORV32_MIMPID; break;
+    case 0xf14: case 0xf15: break; // mhartid, mconfigptr
+    case 0xfc0: // mxisa
+      data = (1u << 0) | (1u << 1) | (1u << 2) | (1u << 6) | (1u << 7) | ((cfg.hpm_num != 0) << 9) |
+             (1u << 22) | (1u << 23) | (1u << 24) | (1u << 25) | (1u << 26) | (1u << 27) | (1u << 28) | (1u << 30);
+      break;
+    default:
+      if ((addr >= 0x323) && (addr <= 0x32f) && cfg.hpm_num) { // mhpmevent
+        data = ((addr & 31) < hpm_max) ? hpm_evt[addr & 31] : 0;
+      } else if ((addr >= 0x723) && (addr <= 0x72f) && cfg.hpm_num) { // mhpmeventh
+        data = ((addr & 31) < hpm_max) ? hpm_evth[addr & 31] : 0;
+      } else if ((addr >= 0xb03) && (addr <= 0xb0f) && cfg.hpm_num) { // mhpmcounter
+        data = ((addr & 31) < hpm_max) ? (uint32_t)hpm_cnt[addr & 31] : 0;
+      } else if ((addr >= 0xb83) && (addr <= 0xb8f) && cfg.hpm_num) { // mhpmcounterh
+        data = ((addr & 31) < hpm_max) ? (uint32_t)(hpm_cnt[addr & 31] >> 32) : 0;
+      } else {
+        return false;
+      }
+      break;
+  }
+  // user-mode counter access
+  if ((mode == 0) && ((addr & 0xf7f) == 0xc00) && !(mcounteren & 1)) {
+    return false;
+  }
+  if ((mode == 0) && ((addr & 0xf7f) == 0xc02) && !(mcounteren & 4)) {
+    return false;
+  }
+  return true;
+}
+
+void neorv32_iss::csr_write(uint32_t addr, uint32_t data) {
+  const uint32_t hpm_max = 3 + cfg.hpm_num;
+  const uint32_t idx = addr & 31;
+  switch (addr) {
+    case 0x300:
+      mstatus = data & (MSTATUS_MIE | MSTATUS_MPIE | MSTATUS_MPRV | MSTATUS_TW);
+      if (data & MSTATUS_MPP) { // everything != U will fall back to M
+        mstatus |= MSTATUS_MPP;
+      }
+      break;
+    case 0x304: mie = data & (0xffff0888u | (cfg.hpm_num ? (1u << IRQ_LCOF) : 0)); break;
+    case 0x305: mtvec = data & 0xfffffffdu; break;
+    case 0x306: mcounteren = data & 5; break;
+    case 0x320: mcountinhibit = data & (5u | (((1u << cfg.hpm_num) - 1) << 3)); break;
+    case 0x340: mscratch = data; break;
+    case 0x341: mepc = data & ~1u; break;
+    case 0x342: mcause = data & 0x8000001fu; break;
+    case 0x343: mtval = data; break;
+    case 0x34a: mtinst = data; break;
+    case 0xb00: hpm_cnt[0] = (hpm_cnt[0] & 0xffffffff00000000ull) | data; break;
+    case 0xb80: hpm_cnt[0] = (hpm_cnt[0] & 0xffffffffull) | ((uint64_t)data << 32); break;
+    case 0xb02: hpm_cnt[2] = (hpm_cnt[2] & 0xffffffff00000000ull) | data; break;
+    case 0xb82: hpm_cnt[2] = (hpm_cnt[2] & 0xffffffffull) | ((uint64_t)data << 32); break;
+    default:
+      if ((idx < 3) || (idx >= hpm_max)) {
+        break;
+      }
+      if ((addr >= 0x323) && (addr <= 0x32f)) {
+        hpm_evt[idx] = data & 0xfffffu;
+        hpm_active = false;
+        for (uint32_t i = 3; i < hpm_max; i++) {
+          hpm_active |= (hpm_evt[i] != 0);
+        }
+      } else if ((addr >= 0x723) && (addr <= 0x72f)) {
+        hpm_evth[idx] = data & (HPMEVH_OF | HPMEVH_MINH | HPMEVH_UINH);
+        hpm_of = (hpm_of & ~(1u << idx)) | ((data >> 31) << idx);
+      } else if ((addr >= 0xb03) && (addr <= 0xb0f)) {
+        hpm_cnt[idx] = (hpm_cnt[idx] & 0xffffffff00000000ull) | data;
+      } else if ((addr >= 0xb83) && (addr <= 0xb8f)) {
+        hpm_cnt[idx] = (hpm_cnt[idx] & 0xffffffffull) | ((uint64_t)data << 32);
+      }
+      break;
+  }
+}
+
+
+// ************************************************************************************************
+// Compressed instructions (RV32C + Zcb): expand to the equivalent 32-bit instruction; 0 = illegal
+// ************************************************************************************************
+static uint32_t enc_r(uint32_t f7, uint32_t rs2, uint32_t rs1, uint32_t f3, uint32_t rd, uint32_t opc) {
+  return (f7 << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | opc;
+}
+
+static uint32_t enc_i(uint32_t imm, uint32_t rs1, uint32_t f3, uint32_t rd, uint32_t opc) {
+  return ((imm & 0xfff) << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | opc;
+}
+
+static uint32_t enc_s(uint32_t imm, uint32_t rs2, uint32_t rs1, uint32_t f3) {
+  return (((imm >> 5) & 0x7f) << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | ((imm & 31) << 7) | OPC_STORE;
+}
+
+static uint32_t enc_b(uint32_t imm, uint32_t rs1, uint32_t f3) {
+  return (((imm >> 12) & 1) << 31) | (((imm >> 5) & 0x3f) << 25) | (rs1 << 15) | (f3 << 12) |
+         (((imm >> 1) & 0xf) << 8) | (((imm >> 11) & 1) << 7) | OPC_BRANCH;
+}
+
+static uint32_t enc_j(uint32_t imm, uint32_t rd) {
+  return (((imm >> 20) & 1) << 31) | (((imm >> 1) & 0x3ff) << 21) | (((imm >> 11) & 1) << 20) |
+         (((imm >> 12) & 0xff) << 12) | (rd << 7) | OPC_JAL;
+}
+
+uint32_t neorv32_iss::decompress(uint16_t ci) {
+  const uint32_t c = ci;
+  auto bit = [c](int i) { return (c >> i) & 1u; };
+  auto fld = [c](int hi, int lo) { return (c >> lo) & ((1u << (hi - lo + 1)) - 1); };
+  const uint32_t rd = fld(11, 7), rs2 = fld(6, 2), rdp = 8 + fld(4, 2), rs1p = 8 + fld(9, 7);
+  const uint32_t imm6 = sext((bit(12) << 5) | rs2, 6);
+  const uint32_t f3 = fld(15, 13);
+
+  switch (((c & 3) << 3) | f3) {
+
+    // quadrant 0
+    case 0x00: { // c.addi4spn
+      uint32_t imm = (fld(12, 11) << 4) | (fld(10, 7) << 6) | (bit(6) << 2) | (bit(5) << 3);
+      return imm ? enc_i(imm, 2, 0, rdp, OPC_ALUI) : 0;
+    }
+    case 0x02: // c.lw
+      return enc_i((fld(12, 10) << 3) | (bit(6) << 2) | (bit(5) << 6), rs1p, 2, rdp, OPC_LOAD);
+    case 0x06: // c.sw
+      return enc_s((fld(12, 10) << 3) | (bit(6) << 2) | (bit(5) << 6), rdp, rs1p, 2);
+    case 0x04: { // Zcb loads/stores
+      uint32_t uimm_b = bit(6) | (bit(5) << 1), uimm_h = bit(5) << 1;
+      switch (fld(12, 10)) {
+        case 0: return enc_i(uimm_b, rs1p, 4, rdp, OPC_LOAD); // c.lbu
+        case 1: return enc_i(uimm_h, rs1p, bit(6) ? 1 : 5, rdp, OPC_LOAD); // c.lh / c.lhu
+        case 2: return enc_s(uimm_b, rdp, rs1p, 0); // c.sb
+        case 3: return bit(6) ? 0 : enc_s(uimm_h, rdp, rs1p, 1); // c.sh
+        default: return 0;
+      }
+    }
+
+    // quadrant 1
+    case 0x08: // c.addi
+      return enc_i(imm6, rd, 0, rd, OPC_ALUI);
+    case 0x09: case 0x0d: { // c.jal / c.j
+      uint32_t imm = (bit(12) << 11) | (bit(11) << 4) | (fld(10, 9) << 8) | (bit(8) << 10) | (bit(7) << 6) |
+                     (bit(6) << 7) | (fld(5, 3) << 1) | (bit(2) << 5);
+      return enc_j(sext(imm, 12), (f3 == 1) ? 1 : 0);
+    }
+    case 0x0a: // c.li
+      return enc_i(imm6, 0, 0, rd, OPC_ALUI);
+    case 0x0b:
+      if (rd == 2) { // c.addi16sp
+        uint32_t imm = (bit(12) << 9) | (bit(6) << 4) | (bit(5) << 6) | (fld(4, 3) << 7) | (bit(2) << 5);
+        return imm ? enc_i(sext(imm, 10), 2, 0, 2, OPC_ALUI) : 0;
+      } else { // c.lui
+        uint32_t imm = (bit(12) << 17) | (rs2 << 12);
+        return imm ? ((sext(imm, 18) & 0xfffff000u) | (rd << 7) | OPC_LUI) : 0;
+      }
+    case 0x0c:
+      switch (fld(11, 10)) {
+        case 0: return bit(12) ? 0 : enc_r(0x00, rs2, rs1p, 5, rs1p, OPC_ALUI); // c.srli
+        case 1: return bit(12) ? 0 : enc_r(0x20, rs2, rs1p, 5, rs1p, OPC_ALUI); // c.srai
+        case 2: return enc_i(imm6, rs1p, 0x7, rs1p, OPC_ALUI); // c.andi
+        default:
+          if (!bit(12)) {
+            switch (fld(6, 5)) {
+              case 0:  return enc_r(0x20, rdp, rs1p, 0, rs1p, OPC_ALU); // c.sub
+              case 1:  return enc_r(0x00, rdp, rs1p, 4, rs1p, OPC_ALU); // c.xor
+              case 2:  return enc_r(0x00, rdp, rs1p, 6, rs1p, OPC_ALU); // c.or
+              default: return enc_r(0x00, rdp, rs1p, 7, rs1p, OPC_ALU); // c.and
+            }
+          }
+          if (fld(6, 5) == 2) { // c.mul
+            return enc_r(0x01, rdp, rs1p, 0, rs1p, OPC_ALU);
+          }
+          if (fld(6, 5) == 3) {
+            switch (fld(4, 2)) {
+              case 0:  return enc_i(0xff, rs1p, 7, rs1p, OPC_ALUI); // c.zext.b
+              case 1:  return enc_r(0x30, 4, rs1p, 1, rs1p, OPC_ALUI); // c.sext.b
+              case 2:  return enc_r(0x04, 0, rs1p, 4, rs1p, OPC_ALU); // c.zext.h
+              case 3:  return enc_r(0x30, 5, rs1p, 1, rs1p, OPC_ALUI); // c.sext.h
+              case 5:  return enc_i(0xfff, rs1p, 4, rs1p, OPC_ALUI); // c.not
+              default: return 0;
+            }
+          }
+          return 0;
+      }
+    case 0x0e: case 0x0f: { // c.beqz / c.bnez
+      uint32_t imm = (bit(12) << 8) | (fld(11, 10) << 3) | (fld(6, 5) << 6) | (fld(4, 3) << 1) | (bit(2) << 5);
+      return enc_b(sext(imm, 9), rs1p, (f3 == 6) ? 0 : 1);
+    }
+
+    // quadrant 2
+    case 0x10: // c.slli
+      return bit(12) ? 0 : enc_r(0x00, rs2, rd, 1, rd, OPC_ALUI);
+    case 0x12: // c.lwsp
+      return (rd == 0) ? 0 : enc_i((bit(12) << 5) | (fld(6, 4) << 2) | (fld(3, 2) << 6), 2, 2, rd, OPC_LOAD);
+    case 0x14:
+      if (!bit(12)) {
+        if (rs2 == 0) { // c.jr
+          return (rd == 0) ? 0 : enc_i(0, rd, 0, 0, OPC_JALR);
+        }
+        return enc_r(0x00, rs2, 0, 0, rd, OPC_ALU); // c.mv
+      }
+      if (rs2 == 0) {
+        return (rd == 0) ? 0x00100073u : enc_i(0, rd, 0, 1, OPC_JALR); // c.ebreak / c.jalr
+      }
+      return enc_r(0x00, rs2, rd, 0, rd, OPC_ALU); // c.add
+    case 0x16: // c.swsp
+      return enc_s((fld(12, 9) << 2) | (fld(8, 7) << 6), rs2, 2, 2);
+
+    default: // floating-point loads/stores
+      return 0;
+  }
+}
+
+
+// ************************************************************************************************
+// Bus system
+// ************************************************************************************************
+uint8_t *neorv32_iss::map(uint32_t addr) {
+  if ((addr - IMEM_BASE) < imem.size()) {
+    return &imem[addr - IMEM_BASE];
+  }
+  if ((addr - DMEM_BASE) < dmem.size()) {
+    return &dmem[addr - DMEM_BASE];
+  }
+  return nullptr;
+}
+
+bool neorv32_iss::mem_read(uint32_t addr, uint32_t &data) {
+  uint8_t *p = map(addr & ~3u);
+  if (p == nullptr) {
+    return false;
+  }
+  std::memcpy(&data, p, 4); // host is little-endian
+  return true;
+}
+
+bool neorv32_iss::mem_write(uint32_t addr, uint32_t data, uint32_t ben) {
+  uint8_t *p = map(addr & ~3u);
+  if (p == nullptr) {
+    return false;
+  }
+  for (int i = 0; i < 4; i++) {
+    if (ben & (1u << i)) {
+      p[i] = (uint8_t)(data >> (8 * i));
+    }
+  }
+  if (((addr & ~3u) - IMEM_BASE) < imem.size()) { // self-modifying code
+    dcache_invalidate(addr & ~3u);
+  }
+  return true;
+}
+
+bool neorv32_iss::fetch(uint32_t addr, uint16_t &data) {
+  uint8_t *p = map(addr);
+  if (p == nullptr) {
+    return false;
+  }
+  data = (uint16_t)(p[0] | (p[1] << 8));
+  return true;
+}
+
+// aligned word access
+bool neorv32_iss::bus_read(uint32_t addr, uint32_t &data) {
+  if (mem_read(addr, data)) {
+    return true;
+  }
+  if (addr >= IO_BASE) {
+    data = 0;
+    return cfg.cosim || io_read(addr, data);
+  }
+  if (addr == SIM_CTRL_ADDR) {
+    data = 0;
+    return true;
+  }
+  return false;
+}
+
+bool neorv32_iss::bus_write(uint32_t addr, uint32_t data, uint32_t ben) {
+  if (mem_write(addr, data, ben)) {
+    return true;
+  }
+  if (addr >= IO_BASE) {
+    return cfg.cosim || io_write(addr, data); // IO devices only support full-word writes
+  }
+  if (addr == SIM_CTRL_ADDR) {
+    terminate((int)data, "simulation control write");
+    return true;
+  }
+  return false;
+}
+
+bool neorv32_iss::load(uint32_t addr, int size, bool sign, uint32_t &data, iss_retire_t *ret) {
+  if (addr & (size - 1)) {
+    exc = {TRAP_LALIGN, addr};
+    return false;
+  }
+  uint32_t w;
+  if (!bus_read(addr & ~3u, w)) {
+    exc = {TRAP_LACCESS, addr};
+    return false;
+  }
+  w >>= 8 * (addr & 3);
+  switch (size) {
+    case 1:  data = sign ? sext(w, 8) : (w & 0xff); break;
+    case 2:  data = sign ? sext(w, 16) : (w & 0xffff); break;
+    default: data = w; break;
+  }
+  if (ret) {
+    ret->mem_addr  = addr;
+    ret->mem_rmask = ((1u << size) - 1) << (addr & 3);
+  }
+  return true;
+}
+
+bool neorv32_iss::store(uint32_t addr, int size, uint32_t data, iss_retire_t *ret) {
+  if (addr & (size - 1)) {
+    exc = {TRAP_SALIGN, addr};
+    return false;
+  }
+  switch (size) { // replicate data to all byte lanes
+    case 1:  data = (data & 0xff) * 0x01010101u; break;
+    case 2:  data = (data & 0xffff) * 0x00010001u; break;
+    default: break;
+  }
+  uint32_t ben = ((1u << size) - 1) << (addr & 3);
+  if (!bus_write(addr & ~3u, data, ben)) {
+    exc = {TRAP_SACCESS, addr};
+    return false;
+  }
+  if (lr_valid && (((addr ^ lr_addr) & ~3u) == 0)) {
+    lr_valid = false;
+  }
+  if (ret) {
+    ret->mem_addr  = addr;
+    ret->mem_wmask = ben;
+    ret->mem_wdata = data;
+  }
+  return true;
+}
+
+
+// ************************************************************************************************
+// IO devices
+// ************************************************************************************************
+bool neorv32_iss::io_read(uint32_t addr, uint32_t &data) {
+  const uint32_t offs = addr & 0xffffu;
+  data = 0;
+  switch (addr & 0xffff0000u) {
+
+    case IO_CLINT:
+      if (offs < 0x4000) { // MSWI
+        data = (offs == 0) ? mswi : 0;
+      } else if (offs == 0x4000) {
+        data = (uint32_t)mtimecmp;
+      } else if (offs == 0x4004) {
+        data = (uint32_t)(mtimecmp >> 32);
+      } else if (offs == 0xbff8) {
+        data = (uint32_t)mtime();
+      } else if (offs == 0xbffc) {
+        data = (uint32_t)(mtime() >> 32);
+      }
+      return true;
+
+    case IO_UART0:
+    case IO_UART1: {
+      uart_t &u = uart[((addr & 0xffff0000u) == IO_UART0) ? 0 : 1];
+      if (&u == &uart[0]) {
+        uart_rx_poll();
+      }
+      switch (offs & 0xc) {
+        case 0x0: // CTRL
+          data = u.ctrl | ((uint32_t)!u.rx.empty() << 16) | ((uint32_t)(u.rx.size() >= (1u << UART_FIFO_LOG2)) << 17) |
+                 (1u << 18) | (1u << 19) | ((uint32_t)u.overrun << 30);
+          break;
+        case 0x4: // DATA
+          if (!u.rx.empty()) {
+            data = u.rx.front();
+            u.rx.pop_front();
+          }
+          data |= (UART_FIFO_LOG2 << 8) | (UART_FIFO_LOG2 << 12);
+          break;
+        case 0x8: // BAUD
+          data = u.baud;
+          break;
+        default:
+          break;
+      }
+      break;
+    }
+
+    case IO_GPIO:
+      switch (offs & 0x1c) {
+        case 0x00: data = gpio_in; break;
+        case 0x04: data = gpio_out; break;
+        case 0x10: data = gpio_type; break;
+        case 0x14: data = gpio_pol; break;
+        case 0x18: data = gpio_en; break;
+        case 0x1c: data = gpio_pend; break;
+        default: break;
+      }
+      break;
+
+    case IO_DMA:
+      if ((offs & 4) == 0) { // CTRL
+        data = dma.ctrl | (DMA_FIFO_LOG2 << 16) | ((uint32_t)dma.desc.empty() << 27) |
+               ((uint32_t)(dma.desc.size() >= (1u << DMA_FIFO_LOG2)) << 28) | ((uint32_t)dma.err << 29) |
+               ((uint32_t)dma.done << 30);
+      }
+      break;
+
+    case IO_SLINK:
+      switch (offs & 0xc) {
+        case 0x0: { // CTRL
+          bool full = slink.fifo.size() >= (1u << SLINK_FIFO_LOG2);
+          data = slink.ctrl | ((uint32_t)slink.fifo.empty() << 8) | ((uint32_t)full << 9) | (1u << 10) |
+                 ((uint32_t)full << 11) | ((uint32_t)slink.rx_last << 12) | (SLINK_FIFO_LOG2 << 24) | (SLINK_FIFO_LOG2 << 28);
+          break;
+        }
+        case 0x4: // ROUTE
+          data = slink.rx_route;
+          break;
+        default: // DATA, DATA_LAST
+          if (!slink.fifo.empty()) {
+            uint64_t e = slink.fifo.front();
+            slink.fifo.pop_front();
+            data           = (uint32_t)e;
+            slink.rx_route = (uint32_t)(e >> 32) & 0xf;
+            slink.rx_last  = (e >> 36) & 1;
+          }
+          break;
+      }
+      break;
+
+    case IO_SYSINFO:
+      switch (offs & 0xc) {
+        case 0x0: // CLK
+          data = sysinfo_clk;
+          break;
+        case 0x4: // MISC: memory sizes, number of harts, boot mode
+          data = (cfg.imem_size ? log2_size(cfg.imem_size) : 0) | ((cfg.dmem_size ? log2_size(cfg.dmem_size) : 0) << 8) |
+                 (1u << 16) | (1u << 20);
+          break;
+        case 0x8: // SOC: implemented modules
+          data = ((uint32_t)(cfg.imem_size != 0) << 2) | ((uint32_t)(cfg.dmem_size != 0) << 3) | (1u << 14) |
+                 (1u << 15) | (1u << 16) | (1u << 17) | (1u << 25) | (1u << 29) | (1u << 31);
+          break;
+        default: // CACHE: no caches
+          break;
+      }
+      break;
+
+    default: // device not implemented
+      return false;
+  }
+  update_firq();
+  return true;
+}
+
+bool neorv32_iss::io_write(uint32_t addr, uint32_t data) {
+  const uint32_t offs = addr & 0xffffu;
+  switch (addr & 0xffff0000u) {
+
+    case IO_CLINT:
+      if (offs == 0) {
+        mswi = data & 1;
+      } else if (offs == 0x4000) {
+        mtimecmp = (mtimecmp & 0xffffffff00000000ull) | data;
+      } else if (offs == 0x4004) {
+        mtimecmp = (mtimecmp & 0xffffffffull) | ((uint64_t)data << 32);
+      } else if (offs == 0xbff8) {
+        mtime_offset = ((mtime() & 0xffffffff00000000ull) | data) - cycle;
+      } else if (offs == 0xbffc) {
+        mtime_offset = ((mtime() & 0xffffffffull) | ((uint64_t)data << 32)) - cycle;
+      }
+      return true;
+
+    case IO_UART0:
+    case IO_UART1: {
+      uart_t &u = uart[((addr & 0xffff0000u) == IO_UART0) ? 0 : 1];
+      switch (offs & 0xc) {
+        case 0x0: // CTRL
+          u.ctrl = data & 0x01f0ffffu;
+          if ((u.ctrl & 1) == 0) {
+            u.rx.clear();
+            u.overrun = false;
+          }
+          break;
+        case 0x4: // DATA
+          if ((u.ctrl & 1) && u.out) {
+            std::fputc((int)(data & 0xff), u.out);
+          }
+          break;
+        case 0x8: // BAUD
+          u.baud = data & 0x0fffffffu;
+          break;
+        default:
+          break;
+      }
+      break;
+    }
+
+    case IO_GPIO: {
+      uint32_t old_in = gpio_in;
+      switch (offs & 0x1c) {
+        case 0x04: gpio_out = data; gpio_in = data; break; // output is looped back to the input port
+        case 0x10: gpio_type = data; break;
+        case 0x14: gpio_pol = data; break;
+        case 0x18: gpio_en = data; gpio_pend &= data; break;
+        case 0x1c: gpio_pend &= data; break; // write zero to clear
+        default: break;
+      }
+      gpio_update(old_in);
+      break;
+    }
+
+    case IO_DMA:
+      if ((offs & 4) == 0) { // CTRL
+        dma.ctrl = data & 1;
+        if (dma.ctrl == 0) {
+          dma.desc.clear();
+          dma.done = false;
+          dma.err  = false;
+        }
+        if (data & ((1u << 1) | (1u << 26))) { // START or ACK
+          dma.done = false;
+          dma.err  = false;
+        }
+        if ((data & (1u << 1)) && dma.ctrl) {
+          dma_execute();
+        }
+      } else if (dma.ctrl && (dma.desc.size() < (1u << DMA_FIFO_LOG2))) { // DESC
+        dma.desc.push_back(data);
+      }
+      break;
+
+    case IO_SLINK:
+      switch (offs & 0xc) {
+        case 0x0: // CTRL
+          slink.ctrl = data & ((1u << 0) | (1u << 16) | (1u << 18) | (1u << 19) | (1u << 21));
+          if ((slink.ctrl & 1) == 0) {
+            slink.fifo.clear();
+            slink.rx_last = false;
+          }
+          break;
+        case 0x4: // ROUTE
+          slink.tx_route = data & 0xf;
+          break;
+        default: // DATA, DATA_LAST: TX is looped back to RX
+          if ((slink.ctrl & 1) && (slink.fifo.size() < (1u << SLINK_FIFO_LOG2))) {
+            slink.fifo.push_back((uint64_t)data | ((uint64_t)slink.tx_route << 32) | ((uint64_t)((offs & 0xc) == 0xc) << 36));
+          }
+          break;
+      }
+      break;
+
+    case IO_SYSINFO:
+      if ((offs & 0xc) == 0) {
+        sysinfo_clk = data;
+      }
+      break;
+
+    default:
+      return false;
+  }
+  update_firq();
+  return true;
+}
+
+void neorv32_iss::update_firq() {
+  const bool slink_full = slink.fifo.size() >= (1u << SLINK_FIFO_LOG2);
+  const bool slink_irq  = (slink.ctrl & 1) && (((slink.ctrl & (1u << 16)) && !slink.fifo.empty()) ||
+                          ((slink.ctrl & (1u << 18)) && slink_full) || (slink.ctrl & (1u << 19)) ||
+                          ((slink.ctrl & (1u << 21)) && !slink_full));
+  firq = ((uint32_t)uart_irq(uart[0]) << (IRQ_FIRQ0 + FIRQ_UART0)) |
+         ((uint32_t)uart_irq(uart[1]) << (IRQ_FIRQ0 + FIRQ_UART1)) |
+         ((uint32_t)(gpio_pend != 0)  << (IRQ_FIRQ0 + FIRQ_GPIO)) |
+         ((uint32_t)dma.done          << (IRQ_FIRQ0 + FIRQ_DMA)) |
+         ((uint32_t)slink_irq         << (IRQ_FIRQ0 + FIRQ_SLINK));
+}
+
+// UART interrupt: TX is always empty (instant transmission)
+bool neorv32_iss::uart_irq(const uart_t &u) const {
+  if ((u.ctrl & 1) == 0) {
+    return false;
+  }
+  return ((u.ctrl & (1u << 20)) && !u.rx.empty()) ||
+         ((u.ctrl & (1u << 21)) && (u.rx.size() >= (1u << UART_FIFO_LOG2))) ||
+         (u.ctrl & (1u << 22)) || (u.ctrl & (1u << 23));
+}
+
+// fetch available stdin data into the UART0 RX FIFO (rate-limited)
+void neorv32_iss::uart_rx_poll() {
+  if (stdin_eof || (cycle < uart_poll) || ((uart[0].ctrl & 1) == 0)) {
+    return;
+  }
+  uart_poll = cycle + 4096;
+  while (uart[0].rx.size() < (1u << UART_FIFO_LOG2)) {
+    struct pollfd pfd = {0, POLLIN, 0};
+    if (poll(&pfd, 1, 0) <= 0) {
+      break;
+    }
+    uint8_t c;
+    if (read(0, &c, 1) != 1) {
+      stdin_eof = true;
+      break;
+    }
+    uart[0].rx.push_back(c);
+  }
+  update_firq();
+}
+
+// GPIO input change detection and interrupt trigger
+void neorv32_iss::gpio_update(uint32_t old_in) {
+  const uint32_t level = (gpio_in & gpio_pol) | (~gpio_in & ~gpio_pol);
+  const uint32_t edge  = ((~old_in & gpio_in) & gpio_pol) | ((old_in & ~gpio_in) & ~gpio_pol);
+  const uint32_t trig  = (level & ~gpio_type) | (edge & gpio_type);
+  gpio_pend = gpio_en & (gpio_pend | trig);
+}
+
+// process all descriptors (instant transfer)
+void neorv32_iss::dma_execute() {
+  while (!dma.err && (dma.desc.size() >= 3)) {
+    uint32_t src  = dma.desc[0];
+    uint32_t dst  = dma.desc[1];
+    uint32_t conf = dma.desc[2];
+    dma.desc.erase(dma.desc.begin(), dma.desc.begin() + 3);
+    const uint32_t num = conf & 0xffffffu, src_type = (conf >> 28) & 3, dst_type = (conf >> 30) & 3;
+    const bool bswap = (conf >> 27) & 1;
+    for (uint32_t i = 0; i < num; i++) {
+      uint32_t data;
+      if (!bus_read(src & ~3u, data)) {
+        dma.err = true;
+        break;
+      }
+      if ((src_type & 1) == 0) { // byte: replicate to all lanes
+        data = ((data >> (8 * (src & 3))) & 0xff) * 0x01010101u;
+      } else if (bswap) {
+        data = __builtin_bswap32(data);
+      }
+      bool ok;
+      if ((dst_type & 1) == 0) {
+        ok = bus_write(dst & ~3u, data, 1u << (dst & 3));
+      } else {
+        ok = bus_write(dst & ~3u, data, 0xf);
+      }
+      if (!ok) {
+        dma.err = true;
+        break;
+      }
+      if (src_type & 2) {
+        src += (src_type & 1) ? 4 : 1;
+      }
+      if (dst_type & 2) {
+        dst += (dst_type & 1) ? 4 : 1;
+      }
+    }
+  }
+  dma.done = true;
+  update_firq();
+}
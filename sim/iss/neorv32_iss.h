@@ -0,0 +1,218 @@
+// ================================================================================ //
+// NEORV32 - Instruction Set Simulator (ISS) / Functional Reference Model           //
+// -------------------------------------------------------------------------------- //
+// Instruction-accurate model of a single-core NEORV32 processor: CPU (rv32imcbu +  //
+// Zicsr, Zifencei, Zicntr, Zihpm, Zicond, Zimop, Zaamo, Zalrsc, Zcb), IMEM, DMEM,  //
+// CLINT, UART0/1, GPIO, DMA, SLINK and SYSINFO using the processor's memory map.   //
+// -------------------------------------------------------------------------------- //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+#ifndef NEORV32_ISS_H
+#define NEORV32_ISS_H
+
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <vector>
+
+// machine implementation ID (hardware version); provided by the makefile
+#ifndef NEORV32_MIMPID
+#define NEORV32_MIMPID 0
+#endif
+
+
+// ************************************************************************************************
+// Configuration
+// ************************************************************************************************
+struct iss_config_t {
+  uint32_t clock       = 100000000;  // processor clock in Hz (SYSINFO.CLK)
+  uint32_t boot_addr   = 0x00000000; // CPU boot address
+  uint32_t imem_size   = 64 * 1024;  // IMEM size in bytes at 0x00000000 (power of two, 0 = none)
+  uint32_t dmem_size   = 64 * 1024;  // DMEM size in bytes at 0x80000000 (power of two, 0 = none)
+  uint32_t hpm_num     = 8;          // number of HPM counters (0..13)
+  uint32_t mem_latency = 1;          // memory latency for the cycle estimation
+  bool     uart_rx     = true;       // feed UART0 RX from stdin
+  FILE    *uart0_out   = stdout;     // UART0 TX output
+  FILE    *uart1_out   = stdout;     // UART1 TX output
+  bool     cosim       = false;      // lock-step mode: no internal interrupts, wfi does not wait,
+                                     // IO accesses are handled externally (read zero, no side effects)
+};
+
+
+// ************************************************************************************************
+// Retired instruction record (similar to the CPU's execution trace port)
+// ************************************************************************************************
+struct iss_retire_t {
+  uint64_t order;     // instruction index
+  uint64_t cycle;     // estimated cycle count after execution
+  uint32_t pc;        // instruction address
+  uint32_t next_pc;   // next instruction address
+  uint32_t insn;      // instruction word (de-compressed if compr)
+  bool     compr;     // compressed instruction
+  bool     trap;      // instruction caused a synchronous exception
+  bool     intr;      // first instruction of a trap handler
+  int      mode;      // privilege mode: 3 = machine, 0 = user
+  uint32_t rd;        // destination register (0 = no write-back)
+  uint32_t rd_data;   // write-back data
+  uint32_t mem_addr;  // memory access address
+  uint32_t mem_rmask; // memory read byte-enable
+  uint32_t mem_wmask; // memory write byte-enable
+  uint32_t mem_wdata; // memory write data
+};
+
+
+// ************************************************************************************************
+// Simulator
+// ************************************************************************************************
+class neorv32_iss {
+public:
+  explicit neorv32_iss(const iss_config_t &cfg);
+
+  bool load_elf(const std::string &file, std::string &err);
+  void reset();
+
+  // execute a single instruction; returns false if the simulation has terminated
+  bool step(iss_retire_t *ret = nullptr);
+  // execute up to max_instr instructions (0 = unlimited); returns number of executed instructions
+  uint64_t run(uint64_t max_instr);
+
+  bool        terminated() const { return term; }
+  int         exit_code() const { return term_code; }
+  const char *exit_reason() const { return term_reason; }
+
+  // lock-step co-simulation: enter interrupt trap before the next instruction; raw CSR access
+  void interrupt(uint32_t cause);
+  bool csr_get(uint32_t addr, uint32_t &data) { return csr_read(addr, data); }
+  void csr_set(uint32_t addr, uint32_t data) { csr_write(addr, data); }
+
+  // architecture state
+  uint32_t x[32];
+  uint32_t pc;
+  uint64_t cycle, instret;
+
+  // statistics
+  uint64_t stat_loads = 0, stat_stores = 0, stat_branches = 0, stat_taken = 0, stat_traps = 0, stat_compr = 0;
+
+  // raw memory access (host/debugger view, no side effects for memories); returns false if unmapped
+  bool mem_read(uint32_t addr, uint32_t &data);
+  bool mem_write(uint32_t addr, uint32_t data, uint32_t ben);
+
+private:
+  iss_config_t cfg;
+  std::vector<uint8_t> imem, dmem;
+  std::vector<uint32_t> c_table; // pre-decoded compressed instructions (0 = illegal)
+
+  // decode cache: one entry per IMEM half-word, used by the fast path of run()
+  enum {
+    DEC_NONE = 0, DEC_SLOW, DEC_LUI, DEC_AUIPC, DEC_JAL, DEC_JALR,
+    DEC_BEQ, DEC_BNE, DEC_BR2, DEC_BR3, DEC_BLT, DEC_BGE, DEC_BLTU, DEC_BGEU, // + funct3
+    DEC_LB, DEC_LH, DEC_LW, DEC_LD3, DEC_LBU, DEC_LHU, DEC_SB, DEC_SH, DEC_SW,  // + funct3
+    DEC_ADDI, DEC_SLI1, DEC_SLTI, DEC_SLTIU, DEC_XORI, DEC_SRI5, DEC_ORI, DEC_ANDI, DEC_SLLI, DEC_SRLI, DEC_SRAI, // + funct3
+    DEC_ADD, DEC_SLL, DEC_SLT, DEC_SLTU, DEC_XOR, DEC_SRL, DEC_OR, DEC_AND, DEC_SUB, DEC_SRA, DEC_MUL // + funct3
+  };
+  struct dec_t {
+    uint8_t  op = DEC_NONE; // operation (DEC_*); DEC_NONE = not decoded yet, DEC_SLOW = execute via step()
+    uint8_t  rd = 0, rs1 = 0, rs2 = 0;
+    bool     compr = false; // compressed instruction
+    uint32_t imm = 0;       // immediate (branch/jump/store offset, LUI/AUIPC upper immediate)
+  };
+  std::vector<dec_t> dcache;
+  void decode(uint32_t off, dec_t &d);
+  uint64_t run_fast(uint64_t max_instr);
+  void dcache_invalidate(uint32_t addr);
+
+  // termination
+  bool term = false;
+  int term_code = 0;
+  const char *term_reason = "";
+  void terminate(int code, const char *reason);
+
+  // CSRs
+  int      mode;     // 3 = machine, 0 = user
+  uint32_t mstatus;  // MIE, MPIE, MPP, MPRV, TW
+  uint32_t mie, mtvec, mscratch, mepc, mcause, mtval, mtinst;
+  uint32_t mcounteren, mcountinhibit;
+  uint64_t hpm_cnt[16];
+  uint32_t hpm_evt[16];
+  uint32_t hpm_evth[16]; // overflow flag and privilege-mode filter (OF, MINH, UINH)
+  bool     hpm_active; // any HPM event configured
+  uint32_t hpm_of;     // HPM counters with overflow flag set (mhpmevent*h.OF), LCOF interrupt pending
+  bool     intr_entry; // next instruction is the first one of a trap handler
+
+  // atomics
+  bool     lr_valid;
+  uint32_t lr_addr;
+
+  // execution
+  struct exc_t { uint32_t cause; uint32_t tval; } exc; // pending synchronous exception
+  uint32_t event_mask; // HPM events of the current instruction
+  uint32_t cycles;     // estimated cycles of the current instruction
+  uint32_t wait_alu;   // estimated cycles waiting for a multi-cycle ALU operation
+  uint32_t wait_lsu;   // estimated cycles waiting for a memory access
+
+  void     execute(uint32_t insn, bool compr, iss_retire_t *ret);
+  void     trap_enter(uint32_t cause, uint32_t tval, uint32_t insn, bool compr);
+  bool     csr_access(uint32_t addr, uint32_t funct3, uint32_t wdata, bool do_write, uint32_t &rdata);
+  bool     csr_read(uint32_t addr, uint32_t &data);
+  void     csr_write(uint32_t addr, uint32_t data);
+  void     count_events(uint32_t cyc);
+  uint32_t irq_pending();
+  bool     wait_for_irq();
+  static uint32_t decompress(uint16_t ci);
+
+  // bus
+  uint8_t *map(uint32_t addr); // IMEM/DMEM byte pointer; nullptr if unmapped
+  bool load(uint32_t addr, int size, bool sign, uint32_t &data, iss_retire_t *ret);
+  bool store(uint32_t addr, int size, uint32_t data, iss_retire_t *ret);
+  bool bus_read(uint32_t addr, uint32_t &data);
+  bool bus_write(uint32_t addr, uint32_t data, uint32_t ben);
+  bool fetch(uint32_t addr, uint16_t &data);
+  bool io_read(uint32_t addr, uint32_t &data);
+  bool io_write(uint32_t addr, uint32_t data);
+
+  // peripherals
+  uint64_t mtime_offset;  // mtime = cycle + mtime_offset
+  uint64_t mtimecmp;
+  uint32_t mswi;
+  uint64_t mtime() const { return cycle + mtime_offset; }
+
+  struct uart_t {
+    uint32_t ctrl, baud;
+    std::deque<uint8_t> rx;
+    bool overrun;
+    FILE *out;
+  } uart[2];
+  uint64_t uart_poll; // cycle of next stdin poll
+  bool     stdin_eof;
+  void     uart_rx_poll();
+  bool     uart_irq(const uart_t &u) const;
+
+  uint32_t gpio_out, gpio_in, gpio_type, gpio_pol, gpio_en, gpio_pend;
+  void     gpio_update(uint32_t old_in);
+
+  struct dma_t {
+    uint32_t ctrl; // enable
+    std::deque<uint32_t> desc;
+    bool done, err;
+  } dma;
+  void dma_execute();
+
+  struct slink_t {
+    uint32_t ctrl, tx_route, rx_route;
+    bool rx_last;
+    std::deque<uint64_t> fifo; // loop-back: [36] last, [35:32] route, [31:0] data
+  } slink;
+
+  uint32_t sysinfo_clk;
+
+  uint32_t firq;       // fast interrupt request lines (mip layout)
+  void     update_firq();
+};
+
+#endif // NEORV32_ISS_H
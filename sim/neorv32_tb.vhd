@@ -96,6 +96,8 @@ architecture neorv32_tb_rtl of neorv32_tb is
   signal spi_csn : std_ulogic_vector(7 downto 0);
   signal spi_di, spi_do, spi_clk : std_ulogic;
   signal sdi_di, sdi_do, sdi_clk, sdi_csn : std_ulogic;
+  signal xip_csn, xip_clk : std_ulogic;
+  signal xip_dat_i, xip_dat_o, xip_oe : std_ulogic_vector(3 downto 0);
   signal msi, mei, mti : std_ulogic;
 
   -- slink --
@@ -198,6 +200,8 @@ begin
     XBUS_EN             => true,
     XBUS_TIMEOUT        => 2048,
     XBUS_REGSTAGE_EN    => true,
+    -- Execute-in-place module --
+    XIP_EN              => true,
     -- Processor peripherals --
     IO_GPIO_NUM         => 32,
     IO_CLINT_EN         => true,
@@ -209,6 +213,7 @@ begin
     IO_UART1_TX_FIFO    => 1,
     IO_SPI_EN           => true,
     IO_SPI_FIFO         => 4,
+    IO_SPI_XFER_EN      => true,
     IO_SDI_EN           => true,
     IO_SDI_FIFO         => 4,
     IO_TWI_EN           => true,
@@ -231,6 +236,8 @@ begin
     IO_SLINK_EN         => true,
     IO_SLINK_RX_FIFO    => 4,
     IO_SLINK_TX_FIFO    => 1,
+    IO_MBOX_EN          => true,
+    IO_MBOX_FIFO        => 4,
     IO_TRACER_EN        => true,
     IO_TRACER_BUFFER    => 32,
     IO_TRACER_SIMLOG_EN => TRACE_LOG_EN
@@ -290,6 +297,12 @@ begin
     spi_dat_o      => spi_do,
     spi_dat_i      => spi_di,
     spi_csn_o      => spi_csn,
+    -- XIP --
+    xip_csn_o      => xip_csn,
+    xip_clk_o      => xip_clk,
+    xip_dat_i      => xip_dat_i,
+    xip_dat_o      => xip_dat_o,
+    xip_oe_o       => xip_oe,
     -- SDI --
     sdi_clk_i      => sdi_clk,
     sdi_dat_o      => sdi_do,
@@ -358,6 +371,18 @@ begin
   spi_di  <= sdi_do when (spi_csn(7) = '0') else spi_do;
 
 
+  -- XIP Flash ------------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  sim_xip_flash: entity work.sim_spi_flash
+  port map (
+    csn_i => xip_csn,
+    clk_i => xip_clk,
+    dat_i => xip_dat_o,
+    oe_i  => xip_oe,
+    dat_o => xip_dat_i
+  );
+
+
   -- Stream-Link FIFO Buffer ----------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   slink_buffer: entity neorv32.neorv32_prim_fifo
@@ -0,0 +1,135 @@
+-- ================================================================================ --
+-- NEORV32 - Simulation SPI Flash (read-only model for the XIP module)              --
+-- -------------------------------------------------------------------------------- --
+-- Supports READ (0x03), FAST_READ (0x0B), dual output (0x3B), quad output (0x6B)   --
+-- and quad I/O (0xEB) reads with 24-bit addresses. Reads continue as long as the   --
+-- chip-select stays asserted. The word at (word-aligned) flash address A reads as  --
+-- A (little-endian). An error is reported if the host drives a data lane while the --
+-- flash is driving it.                                                             --
+-- -------------------------------------------------------------------------------- --
+-- The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              --
+-- Copyright (c) NEORV32 contributors.                                              --
+-- Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  --
+-- Licensed under the BSD-3-Clause license, see LICENSE for details.                --
+-- SPDX-License-Identifier: BSD-3-Clause                                            --
+-- ================================================================================ --
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity sim_spi_flash is
+  port (
+    csn_i : in  std_ulogic;                    -- chip-select, low-active
+    clk_i : in  std_ulogic;                    -- serial clock (mode 0)
+    dat_i : in  std_ulogic_vector(3 downto 0); -- host data lanes
+    oe_i  : in  std_ulogic_vector(3 downto 0); -- host data lanes output enable
+    dat_o : out std_ulogic_vector(3 downto 0)  -- data lanes as seen by the host
+  );
+end entity sim_spi_flash;
+
+architecture sim_spi_flash_rtl of sim_spi_flash is
+
+  type state_t is (S_CMD, S_ADDR, S_DUMMY, S_DATA, S_IGNORE);
+
+  signal lanes : std_ulogic_vector(3 downto 0); -- lane levels driven by the host (or pull-ups)
+  signal drive : std_ulogic_vector(3 downto 0) := (others => '0'); -- lanes driven by the flash
+  signal sdo   : std_ulogic_vector(3 downto 0) := (others => '0'); -- flash output data
+
+  -- flash content: byte k of the word at address A is byte k of A --
+  function byte_f(addr : unsigned(23 downto 0)) return std_ulogic_vector is
+    variable word_v : std_ulogic_vector(31 downto 0);
+  begin
+    word_v := x"00" & std_ulogic_vector(addr(23 downto 2)) & "00";
+    return word_v(8*to_integer(addr(1 downto 0))+7 downto 8*to_integer(addr(1 downto 0)));
+  end function byte_f;
+
+begin
+
+  lanes <= dat_i or (not oe_i); -- weak pull-ups on all lanes
+  dat_o <= (sdo and drive) or (lanes and (not drive));
+
+  -- the host must release all lanes that are driven by the flash --
+  assert ((drive and oe_i) = "0000") report "sim_spi_flash: data lane contention!" severity error;
+
+  flash_model: process(csn_i, clk_i)
+    variable state_v : state_t;
+    variable cmd_v   : std_ulogic_vector(7 downto 0);
+    variable addr_v  : unsigned(23 downto 0);
+    variable cnt_v   : natural; -- remaining cycles of current phase
+    variable awid_v  : natural; -- address lanes
+    variable dwid_v  : natural; -- data lanes
+    variable dummy_v : natural; -- dummy cycles (including mode bits)
+    variable bit_v   : natural; -- next bit of current data byte (MSB first)
+    variable byte_v  : std_ulogic_vector(7 downto 0);
+  begin
+    if (csn_i = '1') then -- deselected: end of command
+      state_v := S_CMD;
+      cnt_v   := 8;
+      bit_v   := 0;
+      drive   <= (others => '0');
+      sdo     <= (others => '0');
+    elsif rising_edge(clk_i) then -- sample input
+      case state_v is
+
+        when S_CMD =>
+          cmd_v := cmd_v(6 downto 0) & lanes(0);
+          cnt_v := cnt_v - 1;
+          if (cnt_v = 0) then
+            state_v := S_ADDR;
+            awid_v  := 1;
+            dummy_v := 8;
+            case cmd_v is
+              when x"03"  => dwid_v := 1; dummy_v := 0;
+              when x"0B"  => dwid_v := 1;
+              when x"3B"  => dwid_v := 2;
+              when x"6B"  => dwid_v := 4;
+              when x"EB"  => dwid_v := 4; awid_v := 4; dummy_v := 6;
+              when others => state_v := S_IGNORE;
+                             report "sim_spi_flash: unsupported command 0x" & to_hstring(cmd_v) severity warning;
+            end case;
+            cnt_v := 24 / awid_v;
+          end if;
+
+        when S_ADDR =>
+          if (awid_v = 4) then
+            addr_v := addr_v(19 downto 0) & unsigned(lanes(3 downto 0));
+          else
+            addr_v := addr_v(22 downto 0) & lanes(0);
+          end if;
+          cnt_v := cnt_v - 1;
+          if (cnt_v = 0) then
+            cnt_v := dummy_v;
+            if (dummy_v = 0) then
+              state_v := S_DATA;
+            else
+              state_v := S_DUMMY;
+            end if;
+          end if;
+
+        when S_DUMMY =>
+          cnt_v := cnt_v - 1;
+          if (cnt_v = 0) then
+            state_v := S_DATA;
+          end if;
+
+        when others => -- S_DATA, S_IGNORE: nothing to sample
+          null;
+
+      end case;
+    elsif falling_edge(clk_i) and (state_v = S_DATA) then -- output next data bits
+      byte_v := byte_f(addr_v);
+      case dwid_v is
+        when 1      => sdo <= "00" & byte_v(7-bit_v) & '0';          drive <= "0010";
+        when 2      => sdo <= "00" & byte_v(7-bit_v downto 6-bit_v); drive <= "0011";
+        when others => sdo <= byte_v(7-bit_v downto 4-bit_v);        drive <= "1111";
+      end case;
+      bit_v := bit_v + dwid_v;
+      if (bit_v = 8) then -- next byte
+        bit_v  := 0;
+        addr_v := addr_v + 1;
+      end if;
+    end if;
+  end process flash_model;
+
+end architecture sim_spi_flash_rtl;
@@ -0,0 +1,151 @@
+-- ================================================================================ --
+-- NEORV32 Wrapper for the Verilator Simulation Harness                             --
+-- -------------------------------------------------------------------------------- --
+-- All memory is provided by the C++ harness via the external bus interface (XBUS): --
+-- executable at 0x00000000 (boot address), data at 0x80000000. The CPU execution  --
+-- trace port is exported for the harness' lock-step co-simulation checker.         --
+-- -------------------------------------------------------------------------------- --
+-- The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              --
+-- Copyright (c) NEORV32 contributors.                                              --
+-- Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  --
+-- Licensed under the BSD-3-Clause license, see LICENSE for details.                --
+-- SPDX-License-Identifier: BSD-3-Clause                                            --
+-- ================================================================================ --
+
+library ieee;
+use ieee.std_logic_1164.all;
+
+library neorv32;
+use neorv32.neorv32_package.all;
+
+entity neorv32_verilator_wrapper is
+  port ( -- [NOTE] generics/parameters CANNOT be used here
+    -- Global control --
+    clk_i       : in  std_ulogic; -- global clock, rising edge
+    rstn_i      : in  std_ulogic; -- global reset, low-active, async
+    -- External bus interface --
+    xbus_adr_o  : out std_ulogic_vector(31 downto 0); -- address
+    xbus_dat_o  : out std_ulogic_vector(31 downto 0); -- write data
+    xbus_cti_o  : out std_ulogic_vector(2 downto 0);  -- cycle type
+    xbus_tag_o  : out std_ulogic_vector(2 downto 0);  -- access tag
+    xbus_we_o   : out std_ulogic;                     -- read/write
+    xbus_sel_o  : out std_ulogic_vector(3 downto 0);  -- byte enable
+    xbus_stb_o  : out std_ulogic;                     -- strobe
+    xbus_cyc_o  : out std_ulogic;                     -- valid cycle
+    xbus_dat_i  : in  std_ulogic_vector(31 downto 0); -- read data
+    xbus_ack_i  : in  std_ulogic;                     -- transfer acknowledge
+    xbus_err_i  : in  std_ulogic;                     -- transfer error
+    -- UART0 --
+    uart0_txd_o : out std_ulogic; -- UART0 send data
+    uart0_rxd_i : in  std_ulogic; -- UART0 receive data
+    -- CPU execution trace --
+    trace_valid_o     : out std_ulogic;                     -- retired instruction, all other signals valid
+    trace_insn_o      : out std_ulogic_vector(31 downto 0); -- instruction word (de-compressed)
+    trace_trap_o      : out std_ulogic;                     -- instruction caused a synchronous exception
+    trace_intr_o      : out std_ulogic;                     -- first instruction of a trap handler
+    trace_mode_o      : out std_ulogic_vector(1 downto 0);  -- privilege mode
+    trace_compr_o     : out std_ulogic;                     -- compressed instruction
+    trace_pc_o        : out std_ulogic_vector(31 downto 0); -- instruction address
+    trace_npc_o       : out std_ulogic_vector(31 downto 0); -- next instruction address
+    trace_rd_addr_o   : out std_ulogic_vector(4 downto 0);  -- destination register (0 = no write-back)
+    trace_rd_data_o   : out std_ulogic_vector(31 downto 0); -- write-back data
+    trace_mem_addr_o  : out std_ulogic_vector(31 downto 0); -- memory access address
+    trace_mem_rmask_o : out std_ulogic_vector(3 downto 0);  -- memory read byte-enable
+    trace_mem_wmask_o : out std_ulogic_vector(3 downto 0);  -- memory write byte-enable
+    trace_mem_wdata_o : out std_ulogic_vector(31 downto 0)  -- memory write data
+  );
+end entity;
+
+architecture neorv32_verilator_wrapper_rtl of neorv32_verilator_wrapper is
+
+  signal trace : trace_port_t;
+
+begin
+
+  -- The core of the problem ----------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  neorv32_top_inst: neorv32_top
+  generic map ( -- [NOTE] CLOCK_FREQUENCY has to match the harness' --clock option
+    -- Processor Clocking --
+    CLOCK_FREQUENCY     => 100_000_000, -- clock frequency of clk_i in Hz
+    TRACE_PORT_EN       => true,        -- CPU execution trace port (co-simulation checker)
+    -- Boot Configuration --
+    BOOT_MODE_SELECT    => 1,           -- boot from custom address
+    BOOT_ADDR_CUSTOM    => x"00000000", -- executable is loaded by the harness
+    -- RISC-V CPU Extensions --
+    RISCV_ISA_C         => true,        -- compressed extension
+    RISCV_ISA_M         => true,        -- mul/div extension
+    RISCV_ISA_U         => true,        -- user mode extension
+    RISCV_ISA_Zalrsc    => true,        -- atomic reservation-set operations extension
+    RISCV_ISA_Zaamo     => true,        -- atomic memory operations extension
+    RISCV_ISA_Zba       => true,        -- shifted-add bit-manipulation extension
+    RISCV_ISA_Zbb       => true,        -- basic bit-manipulation extension
+    RISCV_ISA_Zbs       => true,        -- single-bit bit-manipulation extension
+    RISCV_ISA_Zicntr    => true,        -- base counters
+    RISCV_ISA_Zicond    => true,        -- integer conditional operations
+    RISCV_ISA_Zihpm     => true,        -- hardware performance monitors
+    -- Tuning Options --
+    CPU_FAST_MUL_EN     => true,        -- use DSPs for M extension's multiplier
+    CPU_FAST_SHIFT_EN   => true,        -- use barrel shifter for shift operations
+    -- Hardware Performance Monitors (HPM) --
+    HPM_NUM_CNTS        => 8,           -- number of implemented HPM counters
+    HPM_CNT_WIDTH       => 64,          -- total size of HPM counters
+    -- CPU Caches --
+    ICACHE_EN           => true,        -- implement instruction cache (i-cache)
+    ICACHE_NUM_BLOCKS   => 32,          -- i-cache: number of blocks, has to be a power of 2
+    DCACHE_EN           => true,        -- implement data cache (d-cache)
+    DCACHE_NUM_BLOCKS   => 32,          -- d-cache: number of blocks, has to be a power of 2
+    CACHE_BLOCK_SIZE    => 64,          -- i-cache/d-cache: block size in bytes, has to be a power of 2
+    CACHE_BURSTS_EN     => true,        -- use burst transfers for cache line accesses
+    -- External bus interface (XBUS) --
+    XBUS_EN             => true,        -- implement external memory bus interface?
+    XBUS_TIMEOUT        => 0,           -- the harness responds with ERR on unmapped accesses
+    XBUS_REGSTAGE_EN    => false,       -- no XBUS register stage
+    -- Processor peripherals --
+    IO_CLINT_EN         => true,        -- implement core local interruptor (CLINT)
+    IO_UART0_EN         => true,        -- implement primary universal asynchronous receiver/transmitter (UART0)
+    IO_UART0_RX_FIFO    => 64,          -- RX FIFO depth, has to be a power of two
+    IO_UART0_TX_FIFO    => 64,          -- TX FIFO depth, has to be a power of two
+    IO_GPTMR_NUM        => 1,           -- number of GPTMR slices to implement
+    IO_DMA_EN           => true         -- implement direct memory access controller (DMA)
+  )
+  port map (
+    -- Global control --
+    clk_i       => clk_i,       -- global clock, rising edge
+    rstn_i      => rstn_i,      -- global reset, low-active, async
+    -- External bus interface --
+    xbus_adr_o  => xbus_adr_o,  -- address
+    xbus_dat_o  => xbus_dat_o,  -- write data
+    xbus_cti_o  => xbus_cti_o,  -- cycle type
+    xbus_tag_o  => xbus_tag_o,  -- access tag
+    xbus_we_o   => xbus_we_o,   -- read/write
+    xbus_sel_o  => xbus_sel_o,  -- byte enable
+    xbus_stb_o  => xbus_stb_o,  -- strobe
+    xbus_cyc_o  => xbus_cyc_o,  -- valid cycle
+    xbus_dat_i  => xbus_dat_i,  -- read data
+    xbus_ack_i  => xbus_ack_i,  -- transfer acknowledge
+    xbus_err_i  => xbus_err_i,  -- transfer error
+    -- primary UART0 --
+    uart0_txd_o => uart0_txd_o, -- UART0 send data
+    uart0_rxd_i => uart0_rxd_i, -- UART0 receive data
+    -- Execution trace --
+    trace_cpu0_o => trace        -- CPU 0 trace port
+  );
+
+  -- execution trace --
+  trace_valid_o     <= trace.valid;
+  trace_insn_o      <= trace.insn;
+  trace_trap_o      <= trace.trap;
+  trace_intr_o      <= trace.intr;
+  trace_mode_o      <= trace.mode;
+  trace_compr_o     <= trace.compr;
+  trace_pc_o        <= trace.pc_rdata;
+  trace_npc_o       <= trace.pc_wdata;
+  trace_rd_addr_o   <= trace.rd_addr;
+  trace_rd_data_o   <= trace.rd_rdata;
+  trace_mem_addr_o  <= trace.mem_addr;
+  trace_mem_rmask_o <= trace.mem_rmask;
+  trace_mem_wmask_o <= trace.mem_wmask;
+  trace_mem_wdata_o <= trace.mem_wdata;
+
+end architecture;
@@ -0,0 +1,600 @@
+// ================================================================================ //
+// NEORV32 - Verilator Simulation Harness                                           //
+// -------------------------------------------------------------------------------- //
+// Cycle-accurate full-system simulation of the Verilog-converted processor         //
+// (neorv32_verilator_wrapper). Provides ELF loading, an XBUS memory model, a UART0 //
+// receiver that prints to stdout, a simulation control register and an optional    //
+// lock-step co-simulation checker using the instruction set simulator (../iss).    //
+// -------------------------------------------------------------------------------- //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <verilated.h>
+#include "Vneorv32_verilator_wrapper.h"
+#include "neorv32_iss.h"
+#if VM_TRACE
+#include <verilated_fst_c.h>
+#endif
+
+// simulation control register (XBUS); a write terminates the simulation with exit code = data
+static const uint32_t SIM_CTRL_ADDR = 0xF0000000u;
+// processor-internal IO devices
+static const uint32_t IO_BASE = 0xFFE00000u;
+// exit code if the cycle limit has been reached
+static const int EXIT_TIMEOUT = 124;
+// exit code if the co-simulation checker detected a divergence
+static const int EXIT_MISMATCH = 125;
+
+
+// ************************************************************************************************
+// Configuration
+// ************************************************************************************************
+struct config_t {
+  std::string elf;                    // executable
+  uint64_t    max_cycles = 0;         // simulation cycle limit (0 = unlimited)
+  uint32_t    clock      = 100000000; // processor clock in Hz (has to match the wrapper)
+  uint32_t    baud       = 19200;     // UART0 baud rate
+  uint32_t    rom_size   = 1 << 20;   // memory at 0x00000000
+  uint32_t    ram_size   = 1 << 20;   // memory at 0x80000000
+  uint32_t    latency    = 1;         // XBUS access latency in cycles (min 1)
+  std::string stop;                   // terminate when UART0 has sent this string
+  std::string trace;                  // waveform file (FST)
+  bool        cosim      = false;     // lock-step co-simulation against the ISS
+  bool        quiet      = false;     // no statistics
+};
+
+static void usage(const char *prog) {
+  std::printf(
+    "Usage: %s [options] <main.elf>\n"
+    "Options:\n"
+    "  --max-cycles N   stop after N clock cycles (exit code %d); default: unlimited\n"
+    "  --clock HZ       processor clock (has to match the wrapper's CLOCK_FREQUENCY); default: 100000000\n"
+    "  --baud RATE      UART0 baud rate; default: 19200\n"
+    "  --rom-size N     memory size at 0x00000000 in bytes; default: 1048576\n"
+    "  --ram-size N     memory size at 0x80000000 in bytes; default: 1048576\n"
+    "  --latency N      XBUS memory access latency in cycles (min 1); default: 1\n"
+    "  --stop STRING    terminate successfully when UART0 has sent STRING\n"
+    "  --trace FILE     dump waveform data (FST; requires TRACE=1 build)\n"
+    "  --cosim          check each retired instruction against the ISS (exit code %d on divergence)\n"
+    "  --quiet          do not print simulation statistics\n"
+    "Writing to 0x%08X terminates the simulation using the written data as exit code.\n",
+    prog, EXIT_TIMEOUT, EXIT_MISMATCH, SIM_CTRL_ADDR);
+}
+
+static bool parse_args(int argc, char **argv, config_t &cfg) {
+  for (int i = 1; i < argc; i++) {
+    std::string opt = argv[i];
+    bool has_arg = (i + 1) < argc;
+    if ((opt == "-h") || (opt == "--help")) {
+      return false;
+    } else if ((opt == "--max-cycles") && has_arg) {
+      cfg.max_cycles = std::strtoull(argv[++i], nullptr, 0);
+    } else if ((opt == "--clock") && has_arg) {
+      cfg.clock = std::strtoul(argv[++i], nullptr, 0);
+    } else if ((opt == "--baud") && has_arg) {
+      cfg.baud = std::strtoul(argv[++i], nullptr, 0);
+    } else if ((opt == "--rom-size") && has_arg) {
+      cfg.rom_size = std::strtoul(argv[++i], nullptr, 0);
+    } else if ((opt == "--ram-size") && has_arg) {
+      cfg.ram_size = std::strtoul(argv[++i], nullptr, 0);
+    } else if ((opt == "--latency") && has_arg) {
+      cfg.latency = std::strtoul(argv[++i], nullptr, 0);
+    } else if ((opt == "--stop") && has_arg) {
+      cfg.stop = argv[++i];
+    } else if ((opt == "--trace") && has_arg) {
+      cfg.trace = argv[++i];
+    } else if (opt == "--cosim") {
+      cfg.cosim = true;
+    } else if (opt == "--quiet") {
+      cfg.quiet = true;
+    } else if ((opt[0] != '-') && cfg.elf.empty()) {
+      cfg.elf = opt;
+    } else {
+      std::fprintf(stderr, "ERROR! Invalid option '%s'.\n", opt.c_str());
+      return false;
+    }
+  }
+  if (cfg.latency < 1) {
+    cfg.latency = 1;
+  }
+  return !cfg.elf.empty() && (cfg.baud != 0) && (cfg.clock / cfg.baud >= 4);
+}
+
+
+// ************************************************************************************************
+// Memory model
+// ************************************************************************************************
+struct region_t {
+  uint32_t base;
+  std::vector<uint8_t> data;
+};
+
+class memory_t {
+public:
+  void add(uint32_t base, uint32_t size) {
+    regions.push_back({base, std::vector<uint8_t>(size, 0)});
+  }
+
+  // byte pointer; nullptr if unmapped
+  uint8_t *map(uint32_t addr) {
+    for (auto &r : regions) {
+      if ((addr - r.base) < r.data.size()) {
+        return &r.data[addr - r.base];
+      }
+    }
+    return nullptr;
+  }
+
+private:
+  std::vector<region_t> regions;
+};
+
+// load all PT_LOAD segments of a 32-bit little-endian ELF file to their physical (load) addresses
+static bool load_elf(const std::string &file, memory_t &mem) {
+  std::ifstream f(file, std::ios::binary);
+  std::vector<uint8_t> img((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+  if (!f.good() && !f.eof()) {
+    return false;
+  }
+  auto u16 = [&](size_t o) { return (uint32_t)img[o] | ((uint32_t)img[o+1] << 8); };
+  auto u32 = [&](size_t o) { return u16(o) | (u16(o+2) << 16); };
+
+  if ((img.size() < 52) || (std::memcmp(img.data(), "\x7f" "ELF", 4) != 0) || (img[4] != 1) || (img[5] != 1)) {
+    std::fprintf(stderr, "ERROR! '%s' is not a 32-bit little-endian ELF file.\n", file.c_str());
+    return false;
+  }
+  uint32_t phoff = u32(28), phentsize = u16(42), phnum = u16(44);
+  for (uint32_t i = 0; i < phnum; i++) {
+    size_t ph = phoff + i * phentsize;
+    if ((ph + 32) > img.size()) {
+      break;
+    }
+    if (u32(ph) != 1) { // PT_LOAD
+      continue;
+    }
+    uint32_t offset = u32(ph + 4), paddr = u32(ph + 12), filesz = u32(ph + 16), memsz = u32(ph + 20);
+    for (uint32_t j = 0; j < memsz; j++) {
+      uint8_t *p = mem.map(paddr + j);
+      if (p == nullptr) {
+        std::fprintf(stderr, "ERROR! ELF segment at 0x%08x (%u bytes) exceeds simulated memory.\n", paddr, memsz);
+        return false;
+      }
+      *p = ((j < filesz) && ((offset + j) < img.size())) ? img[offset + j] : 0;
+    }
+  }
+  return true;
+}
+
+
+// ************************************************************************************************
+// XBUS slave: every request (STB) is answered (ACK/ERR) after a fixed latency
+// ************************************************************************************************
+struct xbus_rsp_t {
+  uint64_t due;
+  uint32_t data;
+  bool     err;
+};
+
+class xbus_t {
+public:
+  xbus_t(memory_t &m, uint32_t l) : mem(m), latency(l) {}
+
+  // process request sampled at the rising edge of cycle 'cycle'
+  void request(uint64_t cycle, uint32_t addr, uint32_t wdata, uint32_t sel, bool we) {
+    xbus_rsp_t rsp = {cycle + latency, 0, false};
+    addr &= ~3u;
+    if (we && (addr == SIM_CTRL_ADDR)) {
+      exit_req  = true;
+      exit_code = (int)wdata;
+    } else if (uint8_t *p = mem.map(addr)) {
+      for (int i = 0; i < 4; i++) {
+        if (sel & (1u << i)) {
+          if (we) {
+            p[i] = (uint8_t)(wdata >> (8 * i));
+          } else {
+            rsp.data |= (uint32_t)p[i] << (8 * i);
+          }
+        }
+      }
+    } else {
+      rsp.err = true;
+    }
+    pending.push_back(rsp);
+  }
+
+  // bus response for cycle 'cycle'
+  void respond(uint64_t cycle, uint32_t &rdata, uint8_t &ack, uint8_t &err) {
+    rdata = 0;
+    ack   = 0;
+    err   = 0;
+    if (!pending.empty() && (pending.front().due == cycle)) {
+      rdata = pending.front().data;
+      ack   = !pending.front().err;
+      err   = pending.front().err;
+      pending.pop_front();
+    }
+  }
+
+  // discard outstanding responses (bus cycle aborted)
+  void abort() { pending.clear(); }
+
+  bool exit_req  = false;
+  int  exit_code = 0;
+
+private:
+  memory_t &mem;
+  uint32_t latency;
+  std::deque<xbus_rsp_t> pending;
+};
+
+
+// ************************************************************************************************
+// UART receiver (8N1): samples the TX line in the middle of each bit
+// ************************************************************************************************
+class uart_rx_t {
+public:
+  explicit uart_rx_t(uint32_t cycles_per_bit) : period(cycles_per_bit) {}
+
+  // sample line once per clock cycle; returns true if a character has been received
+  bool sample(bool line, uint8_t &c) {
+    if (cnt == 0) { // idle: wait for start bit
+      if (!line) {
+        cnt = period + period / 2; // middle of first data bit
+        bits = 0;
+        sreg = 0;
+      }
+      return false;
+    }
+    if (--cnt != 0) {
+      return false;
+    }
+    if (bits < 8) {
+      sreg |= (uint32_t)line << bits;
+      bits++;
+      cnt = period;
+      return false;
+    }
+    c = (uint8_t)sreg; // stop bit
+    return true;
+  }
+
+private:
+  uint32_t period;
+  uint32_t cnt  = 0;
+  uint32_t bits = 0;
+  uint32_t sreg = 0;
+};
+
+
+// ************************************************************************************************
+// Lock-step co-simulation: every instruction retired by the RTL (CPU execution trace port) is
+// executed on the ISS and both results are compared. Values the ISS cannot know (IO device
+// registers, counters, pending interrupts, ISA configuration, asynchronous traps) are taken over
+// from the RTL.
+// ************************************************************************************************
+class cosim_t {
+public:
+  explicit cosim_t(const config_t &cfg) : iss(iss_config(cfg)) {}
+
+  bool load(const std::string &elf) {
+    std::string err;
+    if (!iss.load_elf(elf, err)) {
+      std::fprintf(stderr, "ERROR! %s.\n", err.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  // check instruction retired by the RTL; returns false on the first divergence
+  bool check(const iss_retire_t &rtl) {
+    // trap entry that is not caused by a synchronous exception: interrupt
+    if (rtl.intr && !prev_trap) {
+      uint32_t mtvec = 0, cause = 0;
+      iss.csr_get(0x305, mtvec);
+      mcause_sync = (mtvec & 1) == 0;
+      if (!mcause_sync) { // vectored mode: cause from the handler address
+        cause = ((rtl.pc - (mtvec & 0xffffff80u)) >> 2) & 31;
+      }
+      iss.interrupt(cause);
+    }
+    prev_trap = rtl.trap;
+
+    iss_retire_t ref;
+    if (!iss.step(&ref)) {
+      return true; // ISS has terminated (simulation control write)
+    }
+    checked++;
+
+    // take over values that are unknown to the ISS
+    if (ref.rd && (ref.rd == rtl.rd) && (ref.rd_data != rtl.rd_data)) {
+      const uint32_t csr = ref.insn >> 20;
+      const bool is_csr = ((ref.insn & 0x7f) == 0x73) && (((ref.insn >> 12) & 3) != 0);
+      const bool is_io  = ref.mem_rmask && (ref.mem_addr >= IO_BASE);
+      if (is_io || (is_csr && (volatile_csr(csr) || (mcause_sync && (csr == 0x342))))) {
+        iss.x[ref.rd] = ref.rd_data = rtl.rd_data;
+        if (is_csr && (csr == 0x342)) {
+          iss.csr_set(0x342, rtl.rd_data);
+          mcause_sync = false;
+        }
+      }
+    }
+
+    const char *diff = nullptr;
+    if (ref.pc != rtl.pc) {
+      diff = "program counter";
+    } else if ((ref.compr != rtl.compr) || (!rtl.compr && (ref.insn != rtl.insn))) {
+      diff = "instruction word"; // de-compressed encodings are implementation-specific
+    } else if (ref.trap != rtl.trap) {
+      diff = "exception";
+    } else if (ref.mode != rtl.mode) {
+      diff = "privilege mode";
+    } else if (!rtl.trap) {
+      if (ref.next_pc != rtl.next_pc) {
+        diff = "next program counter";
+      } else if ((ref.rd != rtl.rd) || (ref.rd && (ref.rd_data != rtl.rd_data))) {
+        diff = "register write-back";
+      } else if (((ref.insn & 0x7f) == 0x23) &&
+                 ((ref.mem_addr != rtl.mem_addr) || (ref.mem_wmask != rtl.mem_wmask) ||
+                  ((ref.mem_wdata ^ rtl.mem_wdata) & byte_mask(ref.mem_wmask)))) {
+        diff = "memory write";
+      }
+    }
+    if (diff) {
+      std::fprintf(stderr, "\n[neorv32-verilator] co-simulation mismatch (%s) at instruction %llu, cycle %llu\n",
+                   diff, (unsigned long long)rtl.order, (unsigned long long)rtl.cycle);
+      std::fprintf(stderr, "[neorv32-verilator]   RTL: %s\n", record(rtl).c_str());
+      std::fprintf(stderr, "[neorv32-verilator]   ISS: %s\n", record(ref).c_str());
+      return false;
+    }
+    return true;
+  }
+
+  uint64_t checked = 0; // number of compared instructions
+
+private:
+  neorv32_iss iss;
+  bool prev_trap   = false; // previous instruction caused a synchronous exception
+  bool mcause_sync = false; // take mcause of an interrupt from the RTL (non-vectored mode)
+
+  static iss_config_t iss_config(const config_t &cfg) {
+    iss_config_t c;
+    c.clock     = cfg.clock;
+    c.imem_size = cfg.rom_size;
+    c.dmem_size = cfg.ram_size;
+    c.uart_rx   = false;
+    c.uart0_out = nullptr;
+    c.uart1_out = nullptr;
+    c.cosim     = true;
+    return c;
+  }
+
+  // CSRs whose values depend on timing or on the hardware configuration
+  static bool volatile_csr(uint32_t addr) {
+    return (addr == 0x301) || (addr == 0x344) || (addr == 0xfc0) || // misa, mip, mxisa
+           ((addr >> 8) == 0xb) || ((addr >> 8) == 0xc);             // counters
+  }
+
+  static uint32_t byte_mask(uint32_t ben) {
+    uint32_t m = 0;
+    for (int i = 0; i < 4; i++) {
+      m |= (ben & (1u << i)) ? (0xffu << (8 * i)) : 0;
+    }
+    return m;
+  }
+
+  // <pc> <insn> <mode> [c.] [<EXCEPTION>] [xN=data] [memory access] [<TRAP_ENTRY>] -> <next pc>
+  static std::string record(const iss_retire_t &r) {
+    char buf[256];
+    int n = std::snprintf(buf, sizeof(buf), "0x%08x 0x%08x %c %s", r.pc, r.insn, (r.mode == 3) ? 'M' : 'U',
+                          r.compr ? "c." : "  ");
+    if (r.trap) {
+      n += std::snprintf(buf + n, sizeof(buf) - n, " <EXCEPTION>");
+    }
+    if (r.rd) {
+      n += std::snprintf(buf + n, sizeof(buf) - n, " x%u=0x%08x", r.rd, r.rd_data);
+    }
+    if (r.mem_rmask) {
+      n += std::snprintf(buf + n, sizeof(buf) - n, " rd[0x%08x]", r.mem_addr);
+    }
+    if (r.mem_wmask) {
+      n += std::snprintf(buf + n, sizeof(buf) - n, " wr[0x%08x]=0x%08x/%x", r.mem_addr, r.mem_wdata, r.mem_wmask);
+    }
+    if (r.intr) {
+      n += std::snprintf(buf + n, sizeof(buf) - n, " <TRAP_ENTRY>");
+    }
+    std::snprintf(buf + n, sizeof(buf) - n, " -> 0x%08x", r.next_pc);
+    return buf;
+  }
+};
+
+// sample the wrapper's execution trace port
+static iss_retire_t trace_sample(const Vneorv32_verilator_wrapper *top, uint64_t order, uint64_t cycle) {
+  iss_retire_t r;
+  r.order     = order;
+  r.cycle     = cycle;
+  r.pc        = top->trace_pc_o;
+  r.next_pc   = top->trace_npc_o;
+  r.insn      = top->trace_insn_o;
+  r.compr     = top->trace_compr_o;
+  r.trap      = top->trace_trap_o;
+  r.intr      = top->trace_intr_o;
+  r.mode      = top->trace_mode_o;
+  r.rd        = top->trace_rd_addr_o;
+  r.rd_data   = top->trace_rd_data_o;
+  r.mem_addr  = top->trace_mem_addr_o;
+  r.mem_rmask = top->trace_mem_rmask_o;
+  r.mem_wmask = top->trace_mem_wmask_o;
+  r.mem_wdata = top->trace_mem_wdata_o;
+  return r;
+}
+
+
+// ************************************************************************************************
+// Main
+// ************************************************************************************************
+int main(int argc, char **argv) {
+
+  config_t cfg;
+  Verilated::commandArgs(argc, argv);
+  if (!parse_args(argc, argv, cfg)) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  memory_t mem;
+  mem.add(0x00000000u, cfg.rom_size);
+  mem.add(0x80000000u, cfg.ram_size);
+  if (!load_elf(cfg.elf, mem)) {
+    return 1;
+  }
+
+  cosim_t *cosim = nullptr;
+  if (cfg.cosim) {
+    cosim = new cosim_t(cfg);
+    if (!cosim->load(cfg.elf)) {
+      return 1;
+    }
+  }
+
+  xbus_t xbus(mem, cfg.latency);
+  uart_rx_t uart(cfg.clock / cfg.baud);
+  std::string uart_tail; // last characters for stop string detection
+
+  auto *top = new Vneorv32_verilator_wrapper;
+#if VM_TRACE
+  VerilatedFstC *tfp = nullptr;
+  if (!cfg.trace.empty()) {
+    Verilated::traceEverOn(true);
+    tfp = new VerilatedFstC;
+    top->trace(tfp, 99);
+    tfp->open(cfg.trace.c_str());
+  }
+#else
+  if (!cfg.trace.empty()) {
+    std::fprintf(stderr, "WARNING! Waveform tracing not available (rebuild with TRACE=1).\n");
+  }
+#endif
+
+  top->clk_i       = 0;
+  top->rstn_i      = 0;
+  top->uart0_rxd_i = 1;
+  top->xbus_dat_i  = 0;
+  top->xbus_ack_i  = 0;
+  top->xbus_err_i  = 0;
+
+  auto t_start = std::chrono::steady_clock::now();
+  uint64_t cycle = 0, retired = 0;
+  int exit_code = EXIT_TIMEOUT;
+  const char *reason = "cycle limit reached";
+
+  while (!Verilated::gotFinish()) {
+    if (cfg.max_cycles && (cycle >= cfg.max_cycles)) {
+      break;
+    }
+    top->rstn_i = (cycle >= 8);
+
+    // low phase: apply slave response for this cycle
+    uint32_t rdata;
+    uint8_t ack, err;
+    xbus.respond(cycle, rdata, ack, err);
+    top->xbus_dat_i = rdata;
+    top->xbus_ack_i = ack;
+    top->xbus_err_i = err;
+    top->clk_i = 0;
+    top->eval();
+#if VM_TRACE
+    if (tfp) tfp->dump(cycle * 10);
+#endif
+
+    // sample bus request (seen by the slave at the rising edge)
+    if (top->xbus_cyc_o == 0) {
+      xbus.abort();
+    } else if (top->xbus_stb_o) {
+      xbus.request(cycle, top->xbus_adr_o, top->xbus_dat_o, top->xbus_sel_o, top->xbus_we_o);
+    }
+
+    // rising edge
+    top->clk_i = 1;
+    top->eval();
+#if VM_TRACE
+    if (tfp) tfp->dump(cycle * 10 + 5);
+#endif
+
+    // co-simulation: check retired instruction
+    if (cosim && top->trace_valid_o) {
+      if (!cosim->check(trace_sample(top, retired++, cycle))) {
+        exit_code = EXIT_MISMATCH;
+        reason = "co-simulation mismatch";
+        cycle++;
+        break;
+      }
+    }
+
+    // UART0 output
+    uint8_t c;
+    if (uart.sample(top->uart0_txd_o, c)) {
+      std::putchar(c);
+      if (c == '\n') {
+        std::fflush(stdout);
+      }
+      if (!cfg.stop.empty()) {
+        uart_tail += (char)c;
+        if (uart_tail.size() > cfg.stop.size()) {
+          uart_tail.erase(0, uart_tail.size() - cfg.stop.size());
+        }
+        if (uart_tail == cfg.stop) {
+          exit_code = 0;
+          reason = "stop string received";
+          cycle++;
+          break;
+        }
+      }
+    }
+
+    cycle++;
+    if (xbus.exit_req) {
+      exit_code = xbus.exit_code;
+      reason = "simulation control write";
+      break;
+    }
+  }
+  std::fflush(stdout);
+
+  if (!cfg.quiet) {
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+    std::fprintf(stderr, "\n[neorv32-verilator] %s; exit code %d\n", reason, exit_code);
+    std::fprintf(stderr, "[neorv32-verilator] %llu cycles (%.6f s simulated) in %.3f s (%.1f kHz)\n",
+                 (unsigned long long)cycle, (double)cycle / cfg.clock, secs,
+                 (secs > 0) ? ((double)cycle / secs / 1000.0) : 0.0);
+    if (cosim) {
+      std::fprintf(stderr, "[neorv32-verilator] co-simulation: %llu instructions checked\n",
+                   (unsigned long long)cosim->checked);
+    }
+  }
+  delete cosim;
+
+#if VM_TRACE
+  if (tfp) {
+    tfp->close();
+    delete tfp;
+  }
+#endif
+  top->final();
+  delete top;
+  return exit_code;
+}
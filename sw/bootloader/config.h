@@ -23,6 +23,15 @@
 #define EXE_BASE_ADDR 0x00000000
 #endif
 
+/**********************************************************************
+ * Executable format
+ **********************************************************************/
+
+// Enable support for compressed (LZ4) executables (0,1)
+#ifndef COMP_EN
+#define COMP_EN 1
+#endif
+
 /**********************************************************************
  * Serial console
  **********************************************************************/
@@ -37,6 +46,11 @@
 #define UART_BAUD 19200
 #endif
 
+// Enable high-speed block upload protocol (CRC-protected frames, baud rate switch) (0,1)
+#ifndef UART_BLOCK_EN
+#define UART_BLOCK_EN 1
+#endif
+
 /**********************************************************************
  * Status LED (high-active)
  **********************************************************************/
@@ -148,6 +162,16 @@
 #define SPI_FLASH_SECTOR_SIZE (64*1024)
 #endif
 
+// SPI flash page size in bytes (power of two, at least 4); maximum size of a single page program operation
+#ifndef SPI_FLASH_PAGE_SIZE
+#define SPI_FLASH_PAGE_SIZE 256
+#endif
+
+// Use FAST_READ command (with dummy byte) instead of READ (0,1); required by some flashes for high SPI clocks
+#ifndef SPI_FLASH_FAST_READ
+#define SPI_FLASH_FAST_READ 0
+#endif
+
 /**********************************************************************
  * SD card (via SPI; FAT32 file system)
  **********************************************************************/
@@ -172,6 +196,16 @@
 #define SPI_SDCARD_CLK_DIV 0
 #endif
 
+// SD card SPI clock prescaler after card initialization (#NEORV32_CLOCK_PRSC_enum, max 25MHz SPI clock)
+#ifndef SPI_SDCARD_FAST_PRSC
+#define SPI_SDCARD_FAST_PRSC CLK_PRSC_2
+#endif
+
+// SD card SPI clock divider after card initialization (0..15; -1 = smallest divider for max 25MHz SPI clock)
+#ifndef SPI_SDCARD_FAST_DIV
+#define SPI_SDCARD_FAST_DIV -1
+#endif
+
 // Binary executable file name (must be located in root directory, string, 8.3-DOS-names only)
 #ifndef SPI_SDCARD_FILE
 #define SPI_SDCARD_FILE "boot.bin"
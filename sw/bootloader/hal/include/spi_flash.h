@@ -21,5 +21,6 @@ int spi_flash_setup(void);
 int spi_flash_erase(void);
 int spi_flash_stream_get(uint32_t* rdata);
 int spi_flash_stream_put(uint32_t wdata);
+int spi_flash_stream_flush(void);
 
 #endif // SPI_FLASH_H
@@ -22,11 +22,12 @@
 #define BIN_OFFSET_CHECKSUM    8 // byte offset to checksum
 #define BIN_OFFSET_DATA       12 // byte offset to data start
 #define BIN_SIGNATURE 0xB007C0DE // executable identifier
+#define BIN_SIGNATURE_LZ4 0xB007C0DF // compressed (LZ4 block) executable identifier
 
 // prototypes
 void system_setup(void);
 int  system_app_load(int (*dev_init)(void), int (*stream_get)(uint32_t* rdata));
-int  system_app_store(int (*dev_init)(void), int (*dev_erase)(void), int (*stream_put)(uint32_t wdata));
+int  system_app_store(int (*dev_init)(void), int (*dev_erase)(void), int (*stream_put)(uint32_t wdata), int (*stream_flush)(void));
 void system_app_boot(uint32_t boot_addr);
 
 #endif // SYSTEM_H
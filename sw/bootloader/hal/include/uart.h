@@ -31,5 +31,7 @@ void uart_puts(const char *s);
 void uart_puth(uint32_t num);
 int  uart_setup(void);
 int  uart_stream_get(uint32_t* rdata);
+int  uart_block_setup(void);
+int  uart_block_stream_get(uint32_t* rdata);
 
 #endif // UART_H
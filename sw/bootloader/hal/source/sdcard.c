@@ -15,6 +15,7 @@
 #include <config.h>
 #include <sdcard.h>
 #include <pff.h>
+#include <diskio.h>
 
 // global variables
 FATFS fs;
@@ -32,7 +33,7 @@ int sdcard_setup(void) {
     return 1;
   }
 
-  // setup SPI, clock mode 0
+  // setup SPI, clock mode 0; switched to SPI_SDCARD_FAST_* after card initialization
   neorv32_spi_setup(SPI_SDCARD_CLK_PRSC, SPI_SDCARD_CLK_DIV, 0, 0);
 
   // mount card and file system
@@ -67,6 +68,11 @@ int sdcard_stream_get(uint32_t* rdata) {
   rc = (int)pf_read(&tmp.uint8, 4, &len);
   *rdata = tmp.uint32;
 
+  // terminate multi-block read at end of file / on error
+  if ((rc != FR_OK) || (fs.fptr >= fs.fsize)) {
+    disk_stop();
+  }
+
   if (rc != FR_OK) {
     return 1;
   }
@@ -26,6 +26,7 @@ enum SPI_FLASH_CMD_enum {
   SPI_FLASH_CMD_WRITE_DISABLE = 0x04, /**< Disallow write access */
   SPI_FLASH_CMD_READ_STATUS   = 0x05, /**< Get status register */
   SPI_FLASH_CMD_WRITE_ENABLE  = 0x06, /**< Allow write access */
+  SPI_FLASH_CMD_FAST_READ     = 0x0B, /**< Read data at higher clock speed (one dummy byte) */
   SPI_FLASH_CMD_WAKE          = 0xAB, /**< Wake up from sleep mode */
   SPI_FLASH_CMD_SECTOR_ERASE  = 0xD8  /**< Erase complete sector */
 };
@@ -36,6 +37,16 @@ enum SPI_FLASH_SREG_enum {
   FLASH_SREG_WEL  = 1  /**< Write access enabled when set, read-only */
 };
 
+// open flash transfer (chip-select kept asserted between stream accesses)
+enum SPI_FLASH_SESSION_enum {
+  SPI_FLASH_SESSION_NONE    = 0, /**< No transfer in progress */
+  SPI_FLASH_SESSION_READ    = 1, /**< Continuous (FAST_)READ in progress */
+  SPI_FLASH_SESSION_PROGRAM = 2  /**< PAGE_PROGRAM in progress */
+};
+
+static uint32_t spi_flash_session;   // type of the open transfer
+static uint32_t spi_flash_next_addr; // flash address continuing the open transfer
+
 
 /**********************************************************************//**
  * Send single command to SPI flash.
@@ -69,30 +80,46 @@ static uint8_t spi_flash_read_status(void) {
 
 
 /**********************************************************************//**
- * Send address to flash.
+ * Send command and address to flash.
+ *
+ * @param[in] cmd Command byte.
+ * @param[in] addr Flash address.
  **************************************************************************/
-static void spi_flash_send_addr(void) {
-
-  subwords32_t addr;
-  addr.uint32 = g_flash_addr;
-
-#if (SPI_FLASH_ADDR_BYTES == 1)
-  neorv32_spi_transfer(addr.uint8[0]);
-#elif (SPI_FLASH_ADDR_BYTES == 2)
-  neorv32_spi_transfer(addr.uint8[1]);
-  neorv32_spi_transfer(addr.uint8[0]);
-#elif (SPI_FLASH_ADDR_BYTES == 3)
-  neorv32_spi_transfer(addr.uint8[2]);
-  neorv32_spi_transfer(addr.uint8[1]);
-  neorv32_spi_transfer(addr.uint8[0]);
-#elif (SPI_FLASH_ADDR_BYTES == 4)
-  neorv32_spi_transfer(addr.uint8[3]);
-  neorv32_spi_transfer(addr.uint8[2]);
-  neorv32_spi_transfer(addr.uint8[1]);
-  neorv32_spi_transfer(addr.uint8[0]);
-#else
+static void spi_flash_send_cmd_addr(uint8_t cmd, uint32_t addr) {
+
+  uint8_t tmp[5];
+
+#if (SPI_FLASH_ADDR_BYTES < 1) || (SPI_FLASH_ADDR_BYTES > 4)
   #error "Invalid SPI_FLASH_ADDR_BYTES configuration!"
 #endif
+
+  int i;
+  tmp[0] = cmd;
+  for (i=0; i<SPI_FLASH_ADDR_BYTES; i++) { // MSB first
+    tmp[1+i] = (uint8_t)(addr >> (8*(SPI_FLASH_ADDR_BYTES-1-i)));
+  }
+  neorv32_spi_rw(tmp, NULL, 1+SPI_FLASH_ADDR_BYTES);
+}
+
+
+/**********************************************************************//**
+ * Terminate the open flash transfer (if any). A page program operation
+ * is started by releasing the chip-select; wait for it to complete.
+ **************************************************************************/
+static void spi_flash_session_end(void) {
+
+  if (spi_flash_session == SPI_FLASH_SESSION_NONE) { // nothing to do
+    return;
+  }
+
+  neorv32_spi_cs_dis();
+
+  if (spi_flash_session == SPI_FLASH_SESSION_PROGRAM) {
+    // wait for write-in-progress flag to clear
+    while ((spi_flash_read_status() & (1 << FLASH_SREG_BUSY)));
+  }
+
+  spi_flash_session = SPI_FLASH_SESSION_NONE;
 }
 
 
@@ -108,6 +135,9 @@ int spi_flash_setup(void) {
     return 1;
   }
 
+  // terminate transfer left open by a previous stream
+  spi_flash_session_end();
+
   // setup SPI, clock mode 0
   neorv32_spi_setup(SPI_FLASH_CLK_PRSC, SPI_FLASH_CLK_DIV, 0, 0);
 
@@ -140,6 +170,8 @@ int spi_flash_setup(void) {
  **************************************************************************/
 int spi_flash_erase(void) {
 
+  spi_flash_session_end();
+
   // set base address
   g_flash_addr = (uint32_t)SPI_FLASH_BASE_ADDR;
 
@@ -148,10 +180,7 @@ int spi_flash_erase(void) {
     spi_flash_cmd(SPI_FLASH_CMD_WRITE_ENABLE); // allow write-access
 
     neorv32_spi_cs_en(SPI_FLASH_CS);
-
-    neorv32_spi_transfer(SPI_FLASH_CMD_SECTOR_ERASE);
-    spi_flash_send_addr();
-
+    spi_flash_send_cmd_addr(SPI_FLASH_CMD_SECTOR_ERASE, g_flash_addr);
     neorv32_spi_cs_dis();
 
     // write-in-progress flag cleared?
@@ -173,61 +202,85 @@ int spi_flash_erase(void) {
 
 
 /**********************************************************************//**
- * Read stream word from SPI flash.
+ * Read stream word from SPI flash. Consecutive words are fetched using a
+ * single continuous (FAST_)READ command; call spi_flash_stream_flush() to
+ * terminate the read access.
  *
  * @param[in,out] rdata Pointer for returned data (uint32_t).
  * @return 0 if success, !=0 if error
  **************************************************************************/
 int spi_flash_stream_get(uint32_t* rdata) {
 
-  neorv32_spi_cs_en(SPI_FLASH_CS);
-
-  neorv32_spi_transfer(SPI_FLASH_CMD_READ);
-  spi_flash_send_addr();
+  // (re-)start read access if the requested word does not continue the open one
+  if ((spi_flash_session != SPI_FLASH_SESSION_READ) || (spi_flash_next_addr != g_flash_addr)) {
+    spi_flash_session_end();
 
-  int i;
-  subwords32_t tmp;
-  for (i=0; i<4; i++) {
-    tmp.uint8[i] = neorv32_spi_transfer(0);
+    neorv32_spi_cs_en(SPI_FLASH_CS);
+#if (SPI_FLASH_FAST_READ == 1)
+    spi_flash_send_cmd_addr(SPI_FLASH_CMD_FAST_READ, g_flash_addr);
+    neorv32_spi_transfer(0); // dummy byte
+#else
+    spi_flash_send_cmd_addr(SPI_FLASH_CMD_READ, g_flash_addr);
+#endif
+    spi_flash_session = SPI_FLASH_SESSION_READ;
   }
 
-  neorv32_spi_cs_dis();
+  subwords32_t tmp;
+  neorv32_spi_rw(NULL, tmp.uint8, 4);
 
   *rdata = tmp.uint32;
   g_flash_addr += 4; // next source word address
+  spi_flash_next_addr = g_flash_addr;
 
   return 0;
 }
 
 
 /**********************************************************************//**
- * Write stream word to SPI flash.
+ * Write stream word to SPI flash. Consecutive words are appended to the open
+ * page program command, which is committed when the end of the page is reached;
+ * call spi_flash_stream_flush() to program the remaining bytes.
  *
  * @param wdata SPI flash write data.
  * @return 0 if success, !=0 if error
  **************************************************************************/
 int spi_flash_stream_put(uint32_t wdata) {
 
-  subwords32_t tmp;
-  tmp.uint32 = wdata;
-  int i;
+  // start page program if the word does not continue the open one
+  if ((spi_flash_session != SPI_FLASH_SESSION_PROGRAM) || (spi_flash_next_addr != g_flash_addr)) {
+    spi_flash_session_end();
 
-  for (i=0; i<4; i++) {
     spi_flash_cmd(SPI_FLASH_CMD_WRITE_ENABLE); // allow write-access
 
     neorv32_spi_cs_en(SPI_FLASH_CS);
+    spi_flash_send_cmd_addr(SPI_FLASH_CMD_PAGE_PROGRAM, g_flash_addr);
+    spi_flash_session = SPI_FLASH_SESSION_PROGRAM;
+  }
 
-    neorv32_spi_transfer(SPI_FLASH_CMD_PAGE_PROGRAM);
-    spi_flash_send_addr();
-    neorv32_spi_transfer(tmp.uint8[i]);
-
-    neorv32_spi_cs_dis();
+  subwords32_t tmp;
+  tmp.uint32 = wdata;
+  neorv32_spi_rw(tmp.uint8, NULL, 4);
 
-    // wait for write-in-progress flag to clear
-    while ((spi_flash_read_status() & (1 << FLASH_SREG_BUSY)));
+  g_flash_addr += 4; // next destination word address
+  spi_flash_next_addr = g_flash_addr;
 
-    g_flash_addr++; // next destination byte address
+  // end of page reached: program page
+  if ((g_flash_addr & (SPI_FLASH_PAGE_SIZE-1)) == 0) {
+    spi_flash_session_end();
   }
 
   return 0;
 }
+
+
+/**********************************************************************//**
+ * Terminate stream access: program all remaining stream data to SPI flash
+ * or release the flash after reading.
+ *
+ * @return 0 if success, !=0 if error
+ **************************************************************************/
+int spi_flash_stream_flush(void) {
+
+  spi_flash_session_end();
+  return 0;
+}
@@ -20,6 +20,14 @@
 uint32_t g_exe_size = 0; // size of the loaded executable; 0 if no executable available
 uint32_t g_flash_addr = 0; // current flash/stream address
 
+#if (COMP_EN == 1)
+// LZ4 input stream
+static int (*lz4_stream_get)(uint32_t* rdata); // device stream
+static uint32_t lz4_buf = 0; // current stream word
+static uint32_t lz4_cnt = 0; // remaining bytes in lz4_buf
+static int lz4_err = 0; // device error
+#endif
+
 
 /**********************************************************************//**
  * Bare-metal trap handler.
@@ -104,6 +112,97 @@ void system_setup(void) {
 }
 
 
+#if (COMP_EN == 1)
+/**********************************************************************//**
+ * Get next byte from compressed input stream.
+ *
+ * @return Next byte.
+ **************************************************************************/
+static uint32_t lz4_get(void) {
+
+  if (lz4_cnt == 0) {
+    lz4_err |= lz4_stream_get(&lz4_buf);
+    lz4_cnt = 4;
+  }
+  uint32_t tmp = lz4_buf & 0xff;
+  lz4_buf >>= 8;
+  lz4_cnt--;
+  return tmp;
+}
+
+
+/**********************************************************************//**
+ * Get LZ4 length value (4-bit token field plus optional extension bytes).
+ *
+ * @param len Token length field.
+ * @return Decoded length.
+ **************************************************************************/
+static uint32_t lz4_len(uint32_t len) {
+
+  uint32_t tmp = 0;
+  if (len == 15) {
+    do {
+      tmp = lz4_get();
+      len += tmp;
+    } while ((tmp == 255) && (lz4_err == 0));
+  }
+  return len;
+}
+
+
+/**********************************************************************//**
+ * Decompress LZ4 block from device stream directly into main memory.
+ * Matches are copied from the already decompressed data so no
+ * additional buffer is required.
+ *
+ * @param stream_get Function pointer ("int bar(uint32_t* rdata)") to get
+ * the next consecutive 32-bit word from an application source stream.
+ * @param size Size of the decompressed executable in bytes.
+ * @return 0 if success, 1 if device error, 2 if data error.
+ **************************************************************************/
+static int system_app_unpack(int (*stream_get)(uint32_t* rdata), uint32_t size) {
+
+  uint32_t dst = (uint32_t)EXE_BASE_ADDR;
+  uint32_t end = dst + size;
+  uint32_t token = 0, num = 0, offs = 0;
+
+  lz4_stream_get = stream_get;
+  lz4_cnt = 0;
+  lz4_err = 0;
+
+  while (lz4_err == 0) {
+    token = lz4_get();
+
+    // literals
+    num = lz4_len(token >> 4);
+    if (num > (end - dst)) {
+      break;
+    }
+    while (num--) {
+      neorv32_cpu_store_unsigned_byte(dst++, (uint8_t)lz4_get());
+    }
+    if (dst == end) { // last sequence has no match
+      return lz4_err;
+    }
+
+    // match
+    offs = lz4_get();
+    offs |= lz4_get() << 8;
+    num = lz4_len(token & 15) + 4;
+    if ((offs == 0) || (offs > (dst - (uint32_t)EXE_BASE_ADDR)) || (num > (end - dst))) {
+      break;
+    }
+    while (num--) {
+      neorv32_cpu_store_unsigned_byte(dst, neorv32_cpu_load_unsigned_byte(dst - offs));
+      dst++;
+    }
+  }
+
+  return (lz4_err) ? 1 : 2;
+}
+#endif
+
+
 /**********************************************************************//**
  * Load application executable: get data from device stream and store to main memory.
  *
@@ -130,6 +229,30 @@ int system_app_load(int (*dev_init)(void), int (*stream_get)(uint32_t* rdata)) {
   rc |= stream_get(&exe_size);
   rc |= stream_get(&exe_checksum);
 
+  uint32_t tmp = 0;
+  uint32_t i = 0;
+
+#if (COMP_EN == 1)
+  // compressed executable: decompress to main memory, then compute checksum
+  if ((rc == 0) && (exe_signature == (uint32_t)BIN_SIGNATURE_LZ4)) {
+    tmp = (uint32_t)system_app_unpack(stream_get, exe_size);
+    if (tmp == 1) { // device error
+      rc = 1;
+    }
+    else if (tmp == 2) { // corrupted stream: force checksum error
+      exe_checksum = 0;
+    }
+    else {
+      while (i < exe_size) {
+        exe_checksum += neorv32_cpu_load_unsigned_word((uint32_t)EXE_BASE_ADDR + i);
+        i += 4;
+      }
+    }
+    i = exe_size; // nothing left to transfer
+    exe_signature = (uint32_t)BIN_SIGNATURE;
+  }
+#endif
+
   // signature OK?
   if (exe_signature != (uint32_t)BIN_SIGNATURE) {
     uart_puts("\aERROR_SIGNATURE\n");
@@ -137,8 +260,6 @@ int system_app_load(int (*dev_init)(void), int (*stream_get)(uint32_t* rdata)) {
   }
 
   // transfer executable
-  uint32_t tmp = 0;
-  uint32_t i = 0;
   while (i < exe_size) { // in chunks of 4 bytes
     if (rc) {
       break;
@@ -176,9 +297,11 @@ int system_app_load(int (*dev_init)(void), int (*stream_get)(uint32_t* rdata)) {
  * @param dev_erase Function pointer ("int tmp(void)") for device erasure.
  * @param stream_put Function pointer ("int bar(uint32_t wdata)") to put
  * the next consecutive 32-bit word to an application source stream.
+ * @param stream_flush Function pointer ("int baz(void)") to write remaining
+ * buffered stream data to the device; can be NULL if not required.
  * @return 0 if success, non-zero 0 if error.
  **************************************************************************/
-int system_app_store(int (*dev_init)(void), int (*dev_erase)(void), int (*stream_put)(uint32_t wdata)) {
+int system_app_store(int (*dev_init)(void), int (*dev_erase)(void), int (*stream_put)(uint32_t wdata), int (*stream_flush)(void)) {
 
   // executable available at all?
   if (g_exe_size == 0) {
@@ -235,6 +358,9 @@ int system_app_store(int (*dev_init)(void), int (*dev_erase)(void), int (*stream
   rc |= stream_put(BIN_SIGNATURE);
   rc |= stream_put(g_exe_size);
   rc |= stream_put(~checksum);
+  if (stream_flush != NULL) {
+    rc |= stream_flush();
+  }
 
   if (rc) {
     uart_puts("\aERROR_DEVICE\n");
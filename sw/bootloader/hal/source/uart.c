@@ -123,3 +123,241 @@ int uart_stream_get(uint32_t* rdata) {
   return 1;
 #endif
 }
+
+
+#if (UART_EN == 1) && (UART_BLOCK_EN == 1)
+/**********************************************************************//**
+ * @name Block upload protocol
+ *
+ * Frame (host -> bootloader), all multi-byte fields are little-endian:
+ * [SOH][type:8][length:16][argument:32][CRC32(type..argument):32][data:length][CRC32(data):32]
+ *
+ * Every frame is answered by a single ACK or NAK byte (bootloader -> host).
+ * Write frames carry their own memory offset so a retransmitted frame simply
+ * overwrites the same memory location - no frame buffer is required. Frames
+ * that exceed the executable memory window are rejected (NAK).
+ *
+ * All timeouts are numbers of polling loop iterations derived from the
+ * processor clock. As every iteration takes several clock cycles the actual
+ * time is a multiple of the given lower bound.
+ **************************************************************************/
+/**@{*/
+#define BLK_SOH       0x01 // start of frame
+#define BLK_ACK       0x06 // frame OK
+#define BLK_NAK       0x15 // frame corrupted, please repeat
+#define BLK_MAX_LEN   1024 // maximum payload size in bytes
+#define BLK_CMD_PING  'P'  // no operation
+#define BLK_CMD_BAUD  'B'  // switch to baud rate <argument>
+#define BLK_CMD_WRITE 'W'  // write <data> to EXE_BASE_ADDR + <argument>
+#define BLK_CMD_DONE  'D'  // transfer done, image starts at EXE_BASE_ADDR + <argument>
+#define BLK_TIMEOUT   (NEORV32_SYSINFO->CLK >> 7) // inter-byte timeout (at least 1/128s)
+/**@}*/
+
+static uint32_t blk_rptr; // memory stream read pointer
+
+
+/**********************************************************************//**
+ * Update CRC32 (IEEE 802.3, reflected) with one byte.
+ *
+ * @param[in] crc Current CRC.
+ * @param[in] data Data byte.
+ * @return Updated CRC.
+ **************************************************************************/
+static uint32_t blk_crc(uint32_t crc, uint32_t data) {
+
+  static const uint32_t lut[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+  };
+  crc = (crc >> 4) ^ lut[(crc ^ data) & 0xf];
+  crc = (crc >> 4) ^ lut[(crc ^ (data >> 4)) & 0xf];
+  return crc;
+}
+
+
+/**********************************************************************//**
+ * Get size of the executable memory window starting at EXE_BASE_ADDR: the
+ * internal IMEM (if the executable is located there) or the address space
+ * below the DMEM (which holds the bootloader's stack).
+ *
+ * @return Window size in bytes.
+ **************************************************************************/
+static uint32_t blk_exe_size(void) {
+
+  uint32_t end = neorv32_sysinfo_get_imemsize(); // IMEM starts at address 0
+  if ((uint32_t)EXE_BASE_ADDR >= end) { // external memory
+    end = ((uint32_t)EXE_BASE_ADDR < 0x80000000U) ? 0x80000000U : 0; // 0: end of address space
+  }
+  return end - (uint32_t)EXE_BASE_ADDR;
+}
+
+
+/**********************************************************************//**
+ * Read single byte from UART0 with timeout.
+ *
+ * @param[in] timeout Timeout in polling loop iterations.
+ * @return Received byte or -1 if timeout.
+ **************************************************************************/
+static int blk_getc(uint32_t timeout) {
+
+  while (timeout--) {
+    if (neorv32_uart_char_received(NEORV32_UART0)) {
+      return (int)(uint8_t)neorv32_uart_char_received_get(NEORV32_UART0);
+    }
+  }
+  return -1;
+}
+
+
+/**********************************************************************//**
+ * Receive little-endian word from UART0 and update CRC.
+ *
+ * @param[in,out] word Pointer for returned data.
+ * @param[in,out] crc Pointer to CRC.
+ * @param[in] num Number of bytes (1..4).
+ * @return 0 if success, != 0 if timeout
+ **************************************************************************/
+static int blk_get_word(uint32_t *word, uint32_t *crc, int num) {
+
+  uint32_t tmp = 0;
+  int i, c;
+  for (i=0; i<num; i++) {
+    c = blk_getc(BLK_TIMEOUT);
+    if (c < 0) {
+      return 1;
+    }
+    *crc = blk_crc(*crc, (uint32_t)c);
+    tmp |= (uint32_t)c << (i*8);
+  }
+  *word = tmp;
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Receive and execute single block protocol frame.
+ *
+ * @param[in,out] arg Pointer for returned frame argument.
+ * @param[in] idle Timeout for the start of the frame in polling loop iterations.
+ * @return Frame type; 0 if corrupted/timeout (NAK has been sent), -1 if idle timeout.
+ **************************************************************************/
+static int blk_frame(uint32_t *arg, uint32_t idle) {
+
+  // wait for start of frame
+  int c;
+  do {
+    c = blk_getc(idle);
+    if (c < 0) {
+      return -1;
+    }
+  } while (c != BLK_SOH);
+
+  // header
+  uint32_t crc = 0xffffffff, type = 0, len = 0, chk = 0, dummy = 0;
+  if (blk_get_word(&type, &crc, 1) || blk_get_word(&len, &crc, 2) || blk_get_word(arg, &crc, 4)) {
+    goto nak;
+  }
+  crc = ~crc;
+  if (blk_get_word(&chk, &dummy, 4) || (chk != crc) || (len > BLK_MAX_LEN)) {
+    goto nak;
+  }
+
+  // data has to fit into the executable memory window
+  uint32_t size = blk_exe_size();
+  if (((type == BLK_CMD_WRITE) || (type == BLK_CMD_DONE)) && ((*arg > size) || (len > (size - *arg)))) {
+    goto nak;
+  }
+
+  // payload; written to memory right away - location is protected by the header CRC
+  crc = 0xffffffff;
+  uint32_t i, addr = (uint32_t)EXE_BASE_ADDR + *arg;
+  for (i=0; i<len; i++) {
+    if (blk_get_word(&chk, &crc, 1)) {
+      goto nak;
+    }
+    if (type == BLK_CMD_WRITE) {
+      neorv32_cpu_store_unsigned_byte(addr + i, (uint8_t)chk);
+    }
+  }
+  crc = ~crc;
+  if (len && (blk_get_word(&chk, &dummy, 4) || (chk != crc))) {
+    goto nak;
+  }
+
+  neorv32_uart_putc(NEORV32_UART0, BLK_ACK);
+  return (int)type;
+
+nak: // discard the rest of the frame so the NAK is not mistaken for the response to a repeated frame
+  while (blk_getc(BLK_TIMEOUT) >= 0);
+  neorv32_uart_putc(NEORV32_UART0, BLK_NAK);
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Set UART0 baud rate (waits until all pending data has been sent).
+ *
+ * @param[in] baud New baud rate.
+ **************************************************************************/
+static void blk_set_baud(uint32_t baud) {
+
+  while (neorv32_uart_tx_busy(NEORV32_UART0));
+  neorv32_uart_setup(NEORV32_UART0, baud, 0);
+}
+
+
+/**********************************************************************//**
+ * Receive executable via the block upload protocol.
+ *
+ * The image is stored in main memory; use #uart_block_stream_get
+ * to read it afterwards.
+ *
+ * @return 0 if success, !=0 if error
+ **************************************************************************/
+int uart_block_setup(void) {
+
+  // hello: marker + processor clock (for the host's baud rate selection)
+  uint32_t i, clk = NEORV32_SYSINFO->CLK;
+  uart_puts("NVB");
+  for (i=0; i<4; i++) {
+    neorv32_uart_putc(NEORV32_UART0, (char)(clk >> (i*8)));
+  }
+
+  // idle timeouts: at least 1s for regular frames, at least 1/32s for the baud rate confirmation
+  uint32_t arg = 0;
+  while (1) {
+    int type = blk_frame(&arg, clk);
+    if (type < 0) { // host is gone
+      break;
+    }
+    else if (type == BLK_CMD_BAUD) { // new baud rate has to be confirmed by a ping
+      blk_set_baud(arg);
+      if (blk_frame(&arg, clk >> 5) != BLK_CMD_PING) {
+        blk_set_baud(UART_BAUD);
+      }
+    }
+    else if (type == BLK_CMD_DONE) {
+      blk_set_baud(UART_BAUD);
+      blk_rptr = (uint32_t)EXE_BASE_ADDR + arg;
+      return 0;
+    }
+  }
+
+  blk_set_baud(UART_BAUD);
+  return 1;
+}
+
+
+/**********************************************************************//**
+ * Read 32-bit binary word from the image received by #uart_block_setup.
+ *
+ * @param[in,out] rdata Pointer for returned data (uint32_t).
+ * @return 0 if success, != 0 if error
+ **************************************************************************/
+int uart_block_stream_get(uint32_t* rdata) {
+
+  *rdata = neorv32_cpu_load_unsigned_word(blk_rptr);
+  blk_rptr += 4;
+  return 0;
+}
+#endif
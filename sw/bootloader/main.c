@@ -76,7 +76,9 @@ int main(void) {
 #if (SPI_FLASH_EN == 1)
   uart_putc('\n');
   uart_puts("Loading from SPI flash @"xstr(SPI_FLASH_BASE_ADDR)"... ");
-  if (system_app_load(spi_flash_setup, spi_flash_stream_get) == 0) {
+  int rc = system_app_load(spi_flash_setup, spi_flash_stream_get);
+  spi_flash_stream_flush(); // release flash
+  if (rc == 0) {
     system_app_boot((uint32_t)EXE_BASE_ADDR);
   }
 #endif
@@ -121,6 +123,13 @@ skip_auto_boot:
       }
     }
 
+#if (UART_BLOCK_EN == 1)
+    /**** get executable via UART block upload protocol ****/
+    if (cmd == 'b') { // frames are checked individually; no need to halt on error
+      system_app_load(uart_block_setup, uart_block_stream_get);
+    }
+#endif
+
     /**** start application program from main memory ****/
     if (cmd == 'e') {
       system_app_boot((uint32_t)EXE_BASE_ADDR);
@@ -139,6 +148,9 @@ skip_auto_boot:
         "i: System info\n"
         "r: Restart\n"
         "u: Upload via UART\n"
+#if (UART_BLOCK_EN == 1)
+        "b: Fast UART upload\n"
+#endif
 #if (TWI_FLASH_EN == 1)
         "t: TWI flash - load\n"
 #if (TWI_FLASH_PROG_EN == 1)
@@ -180,7 +192,7 @@ skip_auto_boot:
 #if (TWI_FLASH_EN == 1)
 #if (TWI_FLASH_PROG_EN == 1)
     if (cmd == 'w') { // program TWI flash
-      system_app_store(twi_flash_setup, twi_flash_erase, twi_flash_stream_put);
+      system_app_store(twi_flash_setup, twi_flash_erase, twi_flash_stream_put, NULL);
     }
 #endif
     if (cmd == 't') { // get executable from TWI flash
@@ -193,12 +205,13 @@ skip_auto_boot:
 #if (SPI_FLASH_EN == 1)
 #if (SPI_FLASH_PROG_EN == 1)
     if (cmd == 's') { // program SPI flash
-      system_app_store(spi_flash_setup, spi_flash_erase, spi_flash_stream_put);
+      system_app_store(spi_flash_setup, spi_flash_erase, spi_flash_stream_put, spi_flash_stream_flush);
     }
 #endif
     if (cmd == 'l') { // get executable from SPI flash
       uart_puts("Loading from SPI flash @"xstr(SPI_FLASH_BASE_ADDR)"... ");
       system_app_load(spi_flash_setup, spi_flash_stream_get);
+      spi_flash_stream_flush(); // release flash
     }
 #endif
 
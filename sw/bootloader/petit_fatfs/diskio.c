@@ -34,8 +34,10 @@ void dly_1ms(void) {
 #define CMD1   (0x40+1)  /* SEND_OP_COND (MMC) */
 #define ACMD41 (0xC0+41) /* SEND_OP_COND (SDC) */
 #define CMD8   (0x40+8)  /* SEND_IF_COND */
+#define CMD12 (0x40+12)  /* STOP_TRANSMISSION */
 #define CMD16 (0x40+16)  /* SET_BLOCKLEN */
 #define CMD17 (0x40+17)  /* READ_SINGLE_BLOCK */
+#define CMD18 (0x40+18)  /* READ_MULTIPLE_BLOCK */
 #define CMD24 (0x40+24)  /* WRITE_BLOCK */
 #define CMD55 (0x40+55)  /* APP_CMD */
 #define CMD58 (0x40+58)  /* READ_OCR */
@@ -48,6 +50,40 @@ void dly_1ms(void) {
 
 static BYTE CardType;
 
+/* Multi-block read stream state: consecutive partial reads are served from a
+   single CMD18 transfer instead of issuing a new command for every access */
+static BYTE  RdActive; /* CMD18 transfer in progress */
+static DWORD RdSector; /* Sector currently being transferred */
+static UINT  RdOffset; /* Bytes of the current sector already clocked out */
+
+/*-----------------------------------------------------------------------*/
+/* Receive multiple bytes (hardware-managed SPI transfer, sends 0xFF)    */
+/*-----------------------------------------------------------------------*/
+
+static void rcvr_spi_multi (
+  BYTE *buff, /* Pointer to the read buffer (NULL: discard data) */
+  UINT count  /* Number of bytes to receive */
+)
+{
+  neorv32_spi_rw(0, buff, (int)count);
+}
+
+/*-----------------------------------------------------------------------*/
+/* Wait for data block token                                             */
+/*-----------------------------------------------------------------------*/
+
+static int wait_token (void)
+{
+  BYTE rc;
+  UINT bc = 40000; /* Time counter */
+
+  do {
+    rc = (BYTE)neorv32_spi_transfer(0xff);
+  } while (rc == 0xFF && --bc);
+
+  return (rc == 0xFE) ? 0 : 1;
+}
+
 /*-----------------------------------------------------------------------*/
 /* Send a command packet to MMC                                          */
 /*-----------------------------------------------------------------------*/
@@ -66,11 +102,13 @@ static BYTE send_cmd (
     if (res > 1) return res;
   }
 
-  /* Select the card */
-  neorv32_spi_cs_dis();
-  neorv32_spi_transfer(0xff);
-  neorv32_spi_cs_en(SPI_SDCARD_CS);
-  neorv32_spi_transfer(0xff);
+  /* Select the card (keep selected when stopping a multi-block read) */
+  if (cmd != CMD12) {
+    neorv32_spi_cs_dis();
+    neorv32_spi_transfer(0xff);
+    neorv32_spi_cs_en(SPI_SDCARD_CS);
+    neorv32_spi_transfer(0xff);
+  }
 
   /* Send a command packet */
   neorv32_spi_transfer((uint8_t)cmd);         /* Start + Command index */
@@ -82,6 +120,7 @@ static BYTE send_cmd (
   if (cmd == CMD0) n = 0x95; /* Valid CRC for CMD0(0) */
   if (cmd == CMD8) n = 0x87; /* Valid CRC for CMD8(0x1AA) */
   neorv32_spi_transfer((uint8_t)n);
+  if (cmd == CMD12) neorv32_spi_transfer(0xff); /* Skip a stuff byte when stop reading */
 
   /* Receive a command response */
   n = 10; /* Wait for a valid response in timeout of 10 attempts */
@@ -111,6 +150,7 @@ DSTATUS disk_initialize (void)
 #if PF_USE_WRITE
   if (CardType != 0 && is_cs_low) disk_writep(0, 0);  /* Finalize write process if it is in progress */
 #endif
+  RdActive = 0;
   neorv32_spi_cs_dis();
   for (n = 10; n; n--) (BYTE)neorv32_spi_transfer(0xff);  /* 80 dummy clocks with CS=H */
 
@@ -141,10 +181,46 @@ DSTATUS disk_initialize (void)
   neorv32_spi_cs_dis();
   neorv32_spi_transfer(0xff);
 
+  /* Switch to high-speed SPI clock */
+  if (ty) {
+#if (SPI_SDCARD_FAST_DIV < 0)
+    /* Smallest clock divider that keeps the SPI clock at 25MHz or below */
+    static const uint8_t prsc_log2[8] = {1, 2, 3, 6, 7, 10, 11, 12};
+    uint32_t sck = neorv32_sysinfo_get_clk() >> (prsc_log2[SPI_SDCARD_FAST_PRSC & 7] + 1); /* SPI clock without divider */
+    uint32_t lim = 25000000;
+    int cdiv = 0;
+    while ((sck > lim) && (cdiv < 15)) {
+      lim += 25000000;
+      cdiv++;
+    }
+    neorv32_spi_setup(SPI_SDCARD_FAST_PRSC, cdiv, 0, 0);
+#else
+    neorv32_spi_setup(SPI_SDCARD_FAST_PRSC, SPI_SDCARD_FAST_DIV, 0, 0);
+#endif
+  }
+
   return ty ? 0 : STA_NOINIT;
 }
 
 
+/*-----------------------------------------------------------------------*/
+/* Stop multi-block read stream                                          */
+/*-----------------------------------------------------------------------*/
+
+void disk_stop (void)
+{
+  UINT bc;
+
+  if (RdActive) {
+    RdActive = 0;
+    send_cmd(CMD12, 0); /* STOP_TRANSMISSION */
+    for (bc = 40000; (BYTE)neorv32_spi_transfer(0xff) != 0xFF && bc; bc--); /* Wait for ready */
+    neorv32_spi_cs_dis();
+    neorv32_spi_transfer(0xff);
+  }
+}
+
+
 /*-----------------------------------------------------------------------*/
 /* Read partial sector                                                   */
 /*-----------------------------------------------------------------------*/
@@ -156,50 +232,44 @@ DRESULT disk_readp (
   UINT count    /* Number of bytes to read (ofs + cnt mus be <= 512) */
 )
 {
-  DRESULT res;
-  BYTE rc;
-  UINT bc;
-
-
-  if (!(CardType & CT_BLOCK)) sector *= 512;  /* Convert to byte address if needed */
-
-  res = RES_ERROR;
-  if (send_cmd(CMD17, sector) == 0) { /* READ_SINGLE_BLOCK */
-
-    bc = 40000; /* Time counter */
-    do { /* Wait for data block */
-      rc = (BYTE)neorv32_spi_transfer(0xff);
-    } while (rc == 0xFF && --bc);
-
-    if (rc == 0xFE) { /* A data block arrived */
-
-      bc = 512 + 2 - offset - count; /* Number of trailing bytes to skip */
-
-      /* Skip leading bytes in the sector */
-      while (offset--) (BYTE)neorv32_spi_transfer(0xff);
-
-      /* Receive a part of the sector */
-      if (buff) { /* Store data to the memory */
-        do {
-          *buff++ = (BYTE)neorv32_spi_transfer(0xff);
-        } while (--count);
-      } else { /* Forward data to the outgoing stream */
-        do {
-          neorv32_uart0_putc((char)neorv32_spi_transfer(0xff));
-        } while (--count);
-      }
-
-      /* Skip trailing bytes in the sector and block CRC */
-      do neorv32_spi_transfer(0xff); while (--bc);
-
-      res = RES_OK;
+  /* Continue the current multi-block read if possible */
+  if (RdActive && (sector == RdSector + 1)) {
+    rcvr_spi_multi(0, 512 + 2 - RdOffset); /* Skip rest of the current sector and block CRC */
+    RdSector = sector;
+    RdOffset = 0;
+    if (wait_token()) {
+      disk_stop();
+      return RES_ERROR;
+    }
+  }
+  else if (!RdActive || (sector != RdSector) || (offset < RdOffset)) {
+    disk_stop();
+    if (send_cmd(CMD18, (CardType & CT_BLOCK) ? sector : sector * 512) != 0) { /* READ_MULTIPLE_BLOCK */
+      neorv32_spi_cs_dis();
+      neorv32_spi_transfer(0xff);
+      return RES_ERROR;
+    }
+    RdActive = 1;
+    RdSector = sector;
+    RdOffset = 0;
+    if (wait_token()) {
+      disk_stop();
+      return RES_ERROR;
     }
   }
 
-  neorv32_spi_cs_dis();
-  neorv32_spi_transfer(0xff);
+  /* Skip leading bytes in the sector */
+  rcvr_spi_multi(0, offset - RdOffset);
+  RdOffset = offset + count;
 
-  return res;
+  /* Receive a part of the sector */
+  if (buff) { /* Store data to the memory */
+    rcvr_spi_multi(buff, count);
+  } else { /* Forward data to the outgoing stream */
+    while (count--) neorv32_uart0_putc((char)neorv32_spi_transfer(0xff));
+  }
+
+  return RES_OK;
 }
 
 
@@ -228,6 +298,7 @@ DRESULT disk_writep (
     res = RES_OK;
   } else {
     if (sc) { /* Initiate sector write process */
+      disk_stop(); /* Terminate multi-block read */
       if (!(CardType & CT_BLOCK)) sc *= 512; /* Convert to byte address if needed */
       if (send_cmd(CMD24, sc) == 0) { /* WRITE_SINGLE_BLOCK */
         neorv32_spi_transfer(0xFF); neorv32_spi_transfer(0xFE); /* Data block header */
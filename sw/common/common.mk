@@ -80,6 +80,7 @@ LD_SCRIPT ?= $(NEORV32_COM_PATH)/neorv32.ld
 APP_ELF = main.elf
 APP_ASM = main.asm
 APP_EXE = neorv32_exe.bin
+APP_CEXE = neorv32_cexe.bin
 APP_VHD = neorv32_imem_image.vhd
 APP_HEX = neorv32_raw_exe.hex
 APP_BIN = neorv32_raw_exe.bin
@@ -118,13 +119,14 @@ GDB     = $(RISCV_PREFIX)gdb
 CC_HOST = gcc -Wall -O -g
 
 # System tools
-ECHO  = @echo
-SET   = set
-CP    = cp
-RM    = rm
-MKDIR = mkdir
-WC    = wc
-CHMOD = chmod
+ECHO   = @echo
+SET    = set
+CP     = cp
+RM     = rm
+MKDIR  = mkdir
+WC     = wc
+CHMOD  = chmod
+PYTHON = python3
 
 # NEORV32 executable image generator
 IMAGE_GEN = $(NEORV32_EXG_PATH)/image_gen
@@ -156,6 +158,7 @@ NEO_ASFLAGS  = $(CC_FLAGS) $(ASFLAGS)
 elf:     $(APP_ELF)
 asm:     $(APP_ASM)
 exe:     $(APP_EXE)
+cexe:    $(APP_CEXE)
 hex:     $(APP_HEX)
 bin:     $(APP_BIN)
 coe:     $(APP_COE)
@@ -242,6 +245,12 @@ $(APP_EXE): $(BIN_MAIN) $(IMAGE_GEN)
 	$(ECHO) "Executable size in bytes:"
 	$(Q)$(WC) -c < $(APP_EXE)
 
+# Generate compressed NEORV32 executable image for upload via bootloader
+$(APP_CEXE): $(BIN_MAIN) $(IMAGE_GEN)
+	$(Q)$(SET) -e
+	$(ECHO) "Generating $(APP_CEXE)"
+	$(Q)$(IMAGE_GEN) -t cexe -i $< -o $@
+
 # Generate NEORV32 executable VHDL boot image
 $(APP_VHD): $(BIN_MAIN) $(IMAGE_GEN)
 	$(Q)$(SET) -e
@@ -335,6 +344,13 @@ upload: $(APP_EXE)
 	$(Q)$(CHMOD) +rx $(NEORV32_EXG_PATH)/uart_upload.sh
 	$(Q)./$(NEORV32_EXG_PATH)/uart_upload.sh $(UART_TTY) $(APP_EXE)
 
+upload_c: $(APP_CEXE)
+	$(Q)$(CHMOD) +rx $(NEORV32_EXG_PATH)/uart_upload.sh
+	$(Q)./$(NEORV32_EXG_PATH)/uart_upload.sh $(UART_TTY) $(APP_CEXE)
+
+upload_fast: $(APP_CEXE)
+	$(Q)$(PYTHON) $(NEORV32_EXG_PATH)/uart_upload.py $(UART_TTY) $(APP_CEXE)
+
 # -----------------------------------------------------------------------------
 # Run GDB
 # -----------------------------------------------------------------------------
@@ -349,7 +365,7 @@ gdb: $(APP_ELF)
 # remove all build artifacts
 clean:
 	$(Q)$(RM) -rf $(BUILD_DIR)
-	$(Q)$(RM) -f $(APP_EXE) $(APP_ELF) $(APP_HEX) $(APP_BIN) $(APP_COE) $(APP_MEM) $(APP_MIF) $(APP_ASM) $(APP_VHD) $(BLD_VHD)
+	$(Q)$(RM) -f $(APP_EXE) $(APP_CEXE) $(APP_ELF) $(APP_HEX) $(APP_BIN) $(APP_COE) $(APP_MEM) $(APP_MIF) $(APP_ASM) $(APP_VHD) $(BLD_VHD)
 	$(Q)$(RM) -f .gdb_history
 
 # also remove image generator
@@ -451,6 +467,7 @@ help:
 	$(ECHO) "  asm        build and generate <$(APP_ASM)> assembly listing file"
 	$(ECHO) "  elf        build and generate <$(APP_ELF)> ELF file"
 	$(ECHO) "  exe        build and generate <$(APP_EXE)> executable file for bootloader upload"
+	$(ECHO) "  cexe       build and generate <$(APP_CEXE)> compressed executable file for bootloader upload"
 	$(ECHO) "  bin        build and generate <$(APP_BIN)> executable memory image"
 	$(ECHO) "  hex        build and generate <$(APP_HEX)> executable memory image"
 	$(ECHO) "  coe        build and generate <$(APP_COE)> executable memory image"
@@ -467,6 +484,8 @@ help:
 	$(ECHO) "  sim           in-console simulation using default testbench (sim folder) and GHDL"
 	$(ECHO) "  hdl_lists     regenerate HDL file-lists (*.f) in NEORV32_HOME/rtl"
 	$(ECHO) "  upload        upload executable to bootloader via UART ($(UART_TTY))"
+	$(ECHO) "  upload_c      upload compressed executable to bootloader via UART ($(UART_TTY))"
+	$(ECHO) "  upload_fast   upload compressed executable via the high-speed UART block protocol ($(UART_TTY))"
 	$(ECHO) "  elf_info      show ELF layout info"
 	$(ECHO) "  elf_sections  show ELF sections"
 	$(ECHO) "  bl_image      build and generate VHDL BOOTROM bootloader memory image <$(BLD_VHD)> in local folder"
@@ -28,7 +28,9 @@ Original Author: Shay Gal-on
 #include <neorv32.h>
 
 #define BAUD_RATE  (19200)
+#ifndef ITERATIONS
 #define ITERATIONS (2000)
+#endif
 
 /* Configuration : HAS_FLOAT
  * Define to 1 if the platform supports floating point.
@@ -0,0 +1,121 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+
+/**********************************************************************//**
+ * @file demo_alloc/main.c
+ * @brief Fixed-size pool and TLSF heap allocator demo and benchmark.
+ **************************************************************************/
+
+#include <neorv32.h>
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE 19200
+/** Number of allocation rounds per benchmark */
+#define NUM_ROUNDS 256
+/** Number of blocks allocated per round */
+#define NUM_BLOCKS 8
+/**@}*/
+
+// memory for the fixed-size pool
+uint32_t pool_mem[16*NUM_BLOCKS/4];
+
+
+/**********************************************************************//**
+ * Print allocator statistics.
+ *
+ * @param[in] name Allocator name.
+ * @param[in] stats Statistics.
+ **************************************************************************/
+void print_stats(const char *name, neorv32_alloc_stats_t *stats) {
+
+  neorv32_uart0_printf("[%s] total=%u used=%u peak=%u largest=%u fragmentation=%u%% allocs=%u fails=%u\n",
+                       name, stats->total, stats->used, stats->peak, stats->largest,
+                       stats->fragment, stats->num_alloc, stats->num_fail);
+}
+
+
+/**********************************************************************//**
+ * Main function.
+ *
+ * @note This program requires UART0, the Zicntr ISA extension and a heap
+ * (see makefile: __neorv32_heap_size).
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  neorv32_alloc_stats_t stats;
+  void *blk[NUM_BLOCKS];
+  uint32_t i, j, cycles;
+
+  // setup NEORV32 runtime environment
+  neorv32_rte_setup();
+
+  // setup UART at default baud rate, no interrupts
+  neorv32_uart0_setup(BAUD_RATE, 0);
+
+  neorv32_uart0_printf("\n<<< Memory Allocator Demo >>>\n\n");
+
+  // setup per-hart arenas; all heap memory goes to hart 0 on a single-core system
+  if (neorv32_alloc_setup(50)) {
+    neorv32_uart0_printf("ERROR! No heap available (set __neorv32_heap_size).\n");
+    return -1;
+  }
+
+  // fixed-size pool benchmark
+  neorv32_pool_t pool;
+  neorv32_pool_init(&pool, pool_mem, 16, NUM_BLOCKS);
+  cycles = neorv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<NUM_ROUNDS; i++) {
+    for (j=0; j<NUM_BLOCKS; j++) {
+      blk[j] = neorv32_pool_alloc(&pool);
+    }
+    for (j=0; j<NUM_BLOCKS; j++) {
+      neorv32_pool_free(&pool, blk[j]);
+    }
+  }
+  cycles = neorv32_cpu_csr_read(CSR_MCYCLE) - cycles;
+  neorv32_uart0_printf("pool:  %u cycles per alloc+free\n", cycles / (NUM_ROUNDS * NUM_BLOCKS));
+  neorv32_pool_get_stats(&pool, &stats);
+  print_stats("pool", &stats);
+
+  // TLSF arena benchmark with varying block sizes
+  cycles = neorv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<NUM_ROUNDS; i++) {
+    for (j=0; j<NUM_BLOCKS; j++) {
+      blk[j] = neorv32_alloc_malloc(8 + ((i + j * 37) & 127));
+    }
+    for (j=0; j<NUM_BLOCKS; j+=2) { // free every other block first to provoke fragmentation
+      neorv32_alloc_free(blk[j]);
+    }
+    for (j=1; j<NUM_BLOCKS; j+=2) {
+      neorv32_alloc_free(blk[j]);
+    }
+  }
+  cycles = neorv32_cpu_csr_read(CSR_MCYCLE) - cycles;
+  neorv32_uart0_printf("TLSF:  %u cycles per malloc+free\n", cycles / (NUM_ROUNDS * NUM_BLOCKS));
+  neorv32_alloc_get_stats(0, &stats);
+  print_stats("arena0", &stats);
+
+  // realloc: grows in-place if the following block is free
+  char *buf = (char*)neorv32_alloc_malloc(32);
+  char *tmp = (char*)neorv32_alloc_realloc(buf, 256);
+  neorv32_uart0_printf("realloc 32 -> 256 bytes: %s\n", (tmp == buf) ? "in-place" : "moved");
+  neorv32_alloc_free(tmp);
+
+  neorv32_alloc_get_stats(0, &stats);
+  print_stats("arena0", &stats);
+  neorv32_uart0_printf("\nProgram completed.\n");
+  return 0;
+}
@@ -0,0 +1,142 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**********************************************************************//**
+ * @file demo_dual_core_queue/main.c
+ * @brief Inter-core message queue demo and throughput benchmark.
+ **************************************************************************/
+#include <neorv32.h>
+
+/** User configuration */
+#define BAUD_RATE  19200 // UART0 Baud rate
+#define NUM_MSG    4096  // number of messages per benchmark
+#define QUEUE_SIZE 64    // queue size in entries (power of two)
+
+/** Global variables */
+volatile uint8_t __attribute__ ((aligned (16))) core1_stack[2048]; // stack memory for core1
+neorv32_queue_spsc_t spsc_queue, reply_queue;
+neorv32_queue_mpmc_t mpmc_queue;
+uint32_t spsc_buf[QUEUE_SIZE], reply_buf[4];
+neorv32_queue_cell_t mpmc_cells[QUEUE_SIZE];
+
+
+/**********************************************************************//**
+ * Main function for core 1 (secondary core): message consumer.
+ *
+ * @return Irrelevant (but can be inspected by the debugger).
+ **************************************************************************/
+int main_core1(void) {
+
+  uint32_t i, sum;
+
+  // setup NEORV32 runtime-environment (RTE) for _this_ core (core1)
+  neorv32_rte_setup();
+
+  // benchmark 1: SPSC queue (sleeping on doorbell when empty)
+  sum = 0;
+  for (i=0; i<NUM_MSG; i++) {
+    sum += neorv32_queue_spsc_pop_wait(&spsc_queue);
+  }
+  neorv32_queue_spsc_push_wait(&reply_queue, sum);
+
+  // benchmark 2: MPMC queue
+  sum = 0;
+  for (i=0; i<NUM_MSG; i++) {
+    sum += neorv32_queue_mpmc_pop_wait(&mpmc_queue);
+  }
+  neorv32_queue_spsc_push_wait(&reply_queue, sum);
+
+  return 0; // return to crt0 and halt
+}
+
+
+/**********************************************************************//**
+ * Print benchmark results.
+ *
+ * @param[in] name Benchmark name.
+ * @param[in] cycles Elapsed clock cycles.
+ * @param[in] sum Checksum reported by core 1.
+ **************************************************************************/
+void print_result(const char *name, uint32_t cycles, uint32_t sum) {
+
+  uint32_t expected = (NUM_MSG * (NUM_MSG - 1)) / 2;
+  uint32_t rate = (uint32_t)(((uint64_t)NUM_MSG * neorv32_sysinfo_get_clk()) / cycles);
+
+  neorv32_uart0_printf("[%s] %u messages in %u cycles (%u cycles/msg, %u msg/s) - %s\n",
+                       name, (uint32_t)NUM_MSG, cycles, cycles / NUM_MSG, rate,
+                       (sum == expected) ? "ok" : "FAILED");
+}
+
+
+/**********************************************************************//**
+ * Main function for core 0 (primary core): message producer.
+ *
+ * @attention This program requires the dual-core configuration, the CLINT, UART0
+ * and the A ISA extension.
+ *
+ * @return Irrelevant (but can be inspected by the debugger).
+ **************************************************************************/
+int main(void) {
+
+  uint32_t i, cycles;
+
+  // setup NEORV32 runtime-environment (RTE) for _this_ core (core0)
+  neorv32_rte_setup();
+
+  // setup UART0 at default baud rate, no interrupts
+  if (neorv32_uart0_available() == 0) { // UART0 available?
+    return -1;
+  }
+  neorv32_uart0_setup(BAUD_RATE, 0);
+  neorv32_uart0_printf("\n<< NEORV32 SMP Inter-Core Message Queues >>\n\n");
+
+  // check hardware/software configuration
+  if (neorv32_sysinfo_get_numcores() < 2) { // two cores available?
+    neorv32_uart0_printf("[ERROR] dual-core option not enabled!\n");
+    return -1;
+  }
+  if (neorv32_clint_available() == 0) { // CLINT available?
+    neorv32_uart0_printf("[ERROR] CLINT module not available!\n");
+    return -1;
+  }
+
+  // setup queues before launching core 1; core 1 gets a doorbell for the SPSC queue
+  if (neorv32_queue_spsc_init(&spsc_queue, spsc_buf, QUEUE_SIZE, 1) ||
+      neorv32_queue_spsc_init(&reply_queue, reply_buf, 4, NEORV32_QUEUE_NO_DOORBELL) ||
+      neorv32_queue_mpmc_init(&mpmc_queue, mpmc_cells, QUEUE_SIZE, NEORV32_QUEUE_NO_DOORBELL)) {
+    neorv32_uart0_printf("[ERROR] Queue setup failed! Compiled without 'A' ISA extension?\n");
+    return -1;
+  }
+
+  // launch consumer on core 1
+  int smp_launch_rc = neorv32_smp_launch(main_core1, (uint8_t*)core1_stack, sizeof(core1_stack));
+  if (smp_launch_rc) {
+    neorv32_uart0_printf("[ERROR] Launching core1 failed (%d)!\n", smp_launch_rc);
+    return -1;
+  }
+
+  // benchmark 1: SPSC
+  cycles = neorv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<NUM_MSG; i++) {
+    neorv32_queue_spsc_push_wait(&spsc_queue, i);
+  }
+  uint32_t sum = neorv32_queue_spsc_pop_wait(&reply_queue);
+  cycles = neorv32_cpu_csr_read(CSR_MCYCLE) - cycles;
+  print_result("SPSC", cycles, sum);
+
+  // benchmark 2: MPMC
+  cycles = neorv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<NUM_MSG; i++) {
+    neorv32_queue_mpmc_push_wait(&mpmc_queue, i);
+  }
+  sum = neorv32_queue_spsc_pop_wait(&reply_queue);
+  cycles = neorv32_cpu_csr_read(CSR_MCYCLE) - cycles;
+  print_result("MPMC", cycles, sum);
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**********************************************************************//**
+ * @file demo_dual_core_sched/main.c
+ * @brief Irregular dual-core workload balanced by the work-stealing task scheduler.
+ **************************************************************************/
+#include <neorv32.h>
+
+/** User configuration */
+#define BAUD_RATE 19200 // UART0 Baud rate
+#define NUM_MAX   2000  // count all prime numbers between 0 and this value
+#define GRAIN     16    // parallel-for chunk size
+
+/** Global variables */
+volatile uint8_t __attribute__ ((aligned (16))) core1_stack[2048]; // stack memory for core1
+uint32_t num_primes[NEORV32_SCHED_HARTS]; // per-hart partial results
+
+
+/**********************************************************************//**
+ * Check if number is prime. The cost of this check grows with n.
+ *
+ * @param[in] n Number to check.
+ * @return 1 if number is prime; 0 otherwise.
+ **************************************************************************/
+uint32_t is_prime(uint32_t n) {
+
+  uint32_t i = 0;
+  if (n < 2) {
+    return 0;
+  }
+  for (i = 2; i*i <= n; ++i) {
+    if (n % i == 0) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+
+/**********************************************************************//**
+ * Parallel-for body: count primes in [begin, end).
+ *
+ * @param[in] begin Chunk start.
+ * @param[in] end Chunk end.
+ * @param[in] arg Unused.
+ **************************************************************************/
+void count_primes(uint32_t begin, uint32_t end, void *arg) {
+
+  (void)arg;
+  uint32_t i = 0, cnt = 0;
+  for (i=begin; i<end; ++i) {
+    cnt += is_prime(i);
+  }
+  neorv32_cpu_amoadd((uint32_t)&num_primes[neorv32_smp_whoami()], cnt); // bypass data cache
+}
+
+
+/**********************************************************************//**
+ * Demonstrate the work-stealing scheduler.
+ *
+ * @note This program requires the dual-core configuration, the CLINT, UART0
+ * and the A ISA extension.
+ *
+ * @return Irrelevant (but can be inspected by the debugger).
+ **************************************************************************/
+int main(void) {
+
+  // setup NEORV32 runtime-environment (RTE) for _this_ core (core0)
+  neorv32_rte_setup();
+
+  // setup UART0 at default baud rate, no interrupts
+  if (neorv32_uart0_available() == 0) { // UART0 available?
+    return -1;
+  }
+  neorv32_uart0_setup(BAUD_RATE, 0);
+  neorv32_uart0_printf("\n<< NEORV32 SMP Work-Stealing Scheduler Demo >>\n\n");
+
+  // check hardware/software configuration
+  if (neorv32_sysinfo_get_numcores() < 2) { // two cores available?
+    neorv32_uart0_printf("[ERROR] dual-core option not enabled!\n");
+    return -1;
+  }
+  if (neorv32_clint_available() == 0) { // CLINT available?
+    neorv32_uart0_printf("[ERROR] CLINT module not available!\n");
+    return -1;
+  }
+
+  // launch scheduler worker loop on core 1
+  neorv32_uart0_printf("Launching scheduler on core 1...\n");
+  int rc = neorv32_sched_start((uint8_t*)core1_stack, sizeof(core1_stack));
+  if (rc) {
+    neorv32_uart0_printf("[ERROR] Starting scheduler failed (%d)!\n", rc);
+    return -1;
+  }
+
+  // count primes using the parallel-for helper
+  neorv32_uart0_printf("Counting all prime numbers in range 0 to %u...\n", (uint32_t)NUM_MAX);
+  uint64_t time_delta = neorv32_clint_time_get();
+  neorv32_sched_parallel_for(0, NUM_MAX, GRAIN, count_primes, NULL);
+  time_delta = neorv32_clint_time_get() - time_delta;
+  neorv32_sched_stop();
+
+  // results
+  neorv32_sched_stats_t stats[NEORV32_SCHED_HARTS];
+  int i;
+  for (i=0; i<NEORV32_SCHED_HARTS; i++) {
+    neorv32_sched_get_stats(i, &stats[i]);
+  }
+  uint32_t n0 = neorv32_cpu_amoadd((uint32_t)&num_primes[0], 0);
+  uint32_t n1 = neorv32_cpu_amoadd((uint32_t)&num_primes[1], 0);
+  neorv32_uart0_printf("%u primes in %u cycles\n", n0 + n1, (uint32_t)time_delta);
+  for (i=0; i<NEORV32_SCHED_HARTS; i++) {
+    neorv32_uart0_printf("core %u: %u tasks executed, %u tasks stolen\n",
+                         (uint32_t)i, stats[i].executed, stats[i].stolen);
+  }
+
+  return 0;
+}
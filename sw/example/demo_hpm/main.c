@@ -59,7 +59,7 @@ int main() {
 
   // intro
   neorv32_uart0_printf("\n<<< NEORV32 Hardware Performance Monitors (HPMs) Example Program >>>\n\n");
-  neorv32_uart0_printf("[NOTE] This program will use up to 9 HPM counters (if available).\n\n");
+  neorv32_uart0_printf("[NOTE] This program will use up to 13 HPM counters (if available).\n\n");
 
 
   // show HPM hardware configuration
@@ -84,6 +84,10 @@ int main() {
   if (hpm_num > 6) { neorv32_cpu_csr_write(CSR_MHPMCOUNTER9,  0); neorv32_cpu_csr_write(CSR_MHPMCOUNTER9H,  0); }
   if (hpm_num > 7) { neorv32_cpu_csr_write(CSR_MHPMCOUNTER10, 0); neorv32_cpu_csr_write(CSR_MHPMCOUNTER10H, 0); }
   if (hpm_num > 8) { neorv32_cpu_csr_write(CSR_MHPMCOUNTER11, 0); neorv32_cpu_csr_write(CSR_MHPMCOUNTER11H, 0); }
+  if (hpm_num > 9) { neorv32_cpu_csr_write(CSR_MHPMCOUNTER12, 0); neorv32_cpu_csr_write(CSR_MHPMCOUNTER12H, 0); }
+  if (hpm_num > 10) { neorv32_cpu_csr_write(CSR_MHPMCOUNTER13, 0); neorv32_cpu_csr_write(CSR_MHPMCOUNTER13H, 0); }
+  if (hpm_num > 11) { neorv32_cpu_csr_write(CSR_MHPMCOUNTER14, 0); neorv32_cpu_csr_write(CSR_MHPMCOUNTER14H, 0); }
+  if (hpm_num > 12) { neorv32_cpu_csr_write(CSR_MHPMCOUNTER15, 0); neorv32_cpu_csr_write(CSR_MHPMCOUNTER15H, 0); }
 
   // NOTE regarding HPMs 0..2, which are not "actual" HPMs
   // - HPM 0 is the machine cycle counter
@@ -109,6 +113,11 @@ int main() {
   if (hpm_num > 5) { neorv32_cpu_csr_write(CSR_MHPMEVENT8,  1 << HPMCNT_EVENT_LOAD);     } // executed load operation
   if (hpm_num > 6) { neorv32_cpu_csr_write(CSR_MHPMEVENT9,  1 << HPMCNT_EVENT_STORE);    } // executed store operation
   if (hpm_num > 7) { neorv32_cpu_csr_write(CSR_MHPMEVENT10, 1 << HPMCNT_EVENT_WAIT_LSU); } // load-store unit memory wait cycle
+  if (hpm_num > 8) { neorv32_cpu_csr_write(CSR_MHPMEVENT11, 1 << HPMCNT_EVENT_TRAP);     } // trap entry
+  if (hpm_num > 9) { neorv32_cpu_csr_write(CSR_MHPMEVENT12, 1 << HPMCNT_EVENT_WAIT_RST); } // dispatch wait cycle after fetch restart
+  if (hpm_num > 10) { neorv32_cpu_csr_write(CSR_MHPMEVENT13, 1 << HPMCNT_EVENT_IC_MISS); } // i-cache miss
+  if (hpm_num > 11) { neorv32_cpu_csr_write(CSR_MHPMEVENT14, 1 << HPMCNT_EVENT_DC_MISS); } // d-cache miss
+  if (hpm_num > 12) { neorv32_cpu_csr_write(CSR_MHPMEVENT15, 1 << HPMCNT_EVENT_WAIT_BUS); } // bus arbitration wait cycle
 
 
   // enable all CPU counters including HPMs
@@ -146,6 +155,11 @@ int main() {
   if (hpm_num > 5) { neorv32_uart0_printf(" HPM08 (load instructions)           : %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER8));  }
   if (hpm_num > 6) { neorv32_uart0_printf(" HPM09 (store instructions)          : %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER9));  }
   if (hpm_num > 7) { neorv32_uart0_printf(" HPM10 (load/store wait cycles)      : %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER10)); }
+  if (hpm_num > 8) { neorv32_uart0_printf(" HPM11 (trap entries)                : %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER11)); }
+  if (hpm_num > 9) { neorv32_uart0_printf(" HPM12 (fetch restart wait cycles)   : %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER12)); }
+  if (hpm_num > 10) { neorv32_uart0_printf(" HPM13 (i-cache misses)              : %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER13)); }
+  if (hpm_num > 11) { neorv32_uart0_printf(" HPM14 (d-cache misses)              : %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER14)); }
+  if (hpm_num > 12) { neorv32_uart0_printf(" HPM15 (bus arbitration wait cycles) : %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER15)); }
 
   neorv32_uart0_printf("\nProgram completed.\n");
 
@@ -0,0 +1,90 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+
+/**********************************************************************//**
+ * @file demo_log/main.c
+ * @brief Binary deferred logging demo. The log output is a binary stream
+ * that has to be decoded on the host:
+ * python3 sw/image_gen/log_decode.py main.elf /dev/ttyUSB0 --baud 19200
+ **************************************************************************/
+
+#include <neorv32.h>
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE 19200
+/** Log ring buffer size in bytes (power of two) */
+#define LOG_BUF_SIZE 1024
+/**@}*/
+
+// ring buffer memory
+uint32_t log_buf[LOG_BUF_SIZE/4];
+
+// constant string (resolved by the host decoder)
+static const char state_run[] = "RUN";
+
+
+/**********************************************************************//**
+ * Main function.
+ *
+ * @note This program requires UART0 and the Zicntr ISA extension.
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  uint32_t cycles_printf, cycles_log;
+  int i;
+
+  // setup NEORV32 runtime environment
+  neorv32_rte_setup();
+
+  // setup UART at default baud rate, no interrupts
+  neorv32_uart0_setup(BAUD_RATE, 0);
+
+  // measure a formatted text line
+  cycles_printf = neorv32_cpu_csr_read(CSR_MCYCLE);
+  neorv32_uart0_printf("\n<<< Deferred Logging Demo >>>\nsetpoint=%d actual=%d state=%s\n", 1000, 998, state_run);
+  cycles_printf = neorv32_cpu_csr_read(CSR_MCYCLE) - cycles_printf;
+  neorv32_uart0_flush();
+
+  // from here on UART0 transmits binary log records
+  if (neorv32_log_setup(log_buf, LOG_BUF_SIZE, NEORV32_LOG_SINK_UART0)) {
+    neorv32_uart0_printf("ERROR! Logging setup failed.\n");
+    return -1;
+  }
+
+  // measure the same message as log record
+  cycles_log = neorv32_cpu_csr_read(CSR_MCYCLE);
+  NEORV32_LOG_INFO("setpoint=%d actual=%d state=%s", 1000, 998, (uint32_t)state_run);
+  cycles_log = neorv32_cpu_csr_read(CSR_MCYCLE) - cycles_log;
+
+  NEORV32_LOG_INFO("CPU cycles: printf = %u, log = %u", cycles_printf, cycles_log);
+
+  // some more messages; the application drains the log whenever it is idle
+  for (i=0; i<16; i++) {
+    NEORV32_LOG_DEBUG("iteration %d: square = %u, cycles = %llu", i, i*i, NEORV32_LOG_U64(neorv32_cpu_get_cycle()));
+    if ((i & 3) == 3) {
+      NEORV32_LOG_WARN("i = %#x is a multiple of four minus one", i);
+    }
+    neorv32_log_drain();
+  }
+
+  neorv32_log_stats_t stats;
+  neorv32_log_get_stats(&stats);
+  NEORV32_LOG_INFO("records: %u, dropped: %u, peak fill: %u bytes", stats.records, stats.dropped, stats.peak);
+  NEORV32_LOG_INFO("Program completed.");
+
+  neorv32_log_flush();
+  return 0;
+}
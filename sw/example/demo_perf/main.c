@@ -0,0 +1,162 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+
+/**********************************************************************//**
+ * @file demo_perf/main.c
+ * @brief Region-scoped performance measurement demo (neorv32_perf.h).
+ **************************************************************************/
+
+#include <neorv32.h>
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE 19200
+/** Workload size in words */
+#define DATA_SIZE 128
+/**@}*/
+
+/** Region IDs */
+enum REGION_enum {
+  REGION_FILL  = 0,
+  REGION_CRC   = 1,
+  REGION_SORT  = 2,
+  REGION_TOTAL = 3,
+  REGION_NUM   = 4
+};
+
+// region statistics
+neorv32_perf_region_t perf_tab[REGION_NUM];
+
+// workload data
+static uint32_t data[DATA_SIZE];
+
+
+/**********************************************************************//**
+ * Workload: fill with pseudo-random numbers.
+ *
+ * @param[in] seed Start value.
+ **************************************************************************/
+void __attribute__((noinline)) work_fill(uint32_t seed) {
+
+  uint32_t i;
+
+  neorv32_perf_begin(REGION_FILL);
+  for (i=0; i<DATA_SIZE; i++) {
+    seed = seed * 1664525 + 1013904223;
+    data[i] = seed;
+  }
+  neorv32_perf_end(REGION_FILL);
+}
+
+
+/**********************************************************************//**
+ * Workload: bit-wise CRC32.
+ *
+ * @return CRC.
+ **************************************************************************/
+uint32_t __attribute__((noinline)) work_crc32(void) {
+
+  uint32_t crc = 0xffffffff;
+  uint32_t i;
+  int b;
+
+  neorv32_perf_begin(REGION_CRC);
+  for (i=0; i<DATA_SIZE; i++) {
+    crc ^= data[i];
+    for (b=0; b<32; b++) {
+      crc = (crc >> 1) ^ (0xedb88320 & (-(crc & 1)));
+    }
+  }
+  neorv32_perf_end(REGION_CRC);
+  return ~crc;
+}
+
+
+/**********************************************************************//**
+ * Workload: bubble sort (data-dependent run time).
+ *
+ * @param[in] len Number of words to sort.
+ **************************************************************************/
+void __attribute__((noinline)) work_sort(uint32_t len) {
+
+  uint32_t i, j, tmp;
+
+  neorv32_perf_begin(REGION_SORT);
+  for (i=0; i<len; i++) {
+    for (j=0; j<(len-1-i); j++) {
+      if (data[j] > data[j+1]) {
+        tmp = data[j];
+        data[j] = data[j+1];
+        data[j+1] = tmp;
+      }
+    }
+  }
+  neorv32_perf_end(REGION_SORT);
+}
+
+
+/**********************************************************************//**
+ * Main function.
+ *
+ * @note This program requires UART0 and the Zicntr CPU extension. The HPM
+ * metrics are only shown if the Zihpm CPU extension is implemented.
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  uint32_t i, crc = 0;
+
+  // setup NEORV32 runtime environment
+  neorv32_rte_setup();
+
+  // setup UART at default baud rate, no interrupts
+  neorv32_uart0_setup(BAUD_RATE, 0);
+
+  neorv32_uart0_printf("\n<<< Region-Scoped Performance Measurement Demo >>>\n\n");
+
+  // configure HPM events first (captured: mhpmcounter3 .. 3+NEORV32_PERF_HPM_NUM-1);
+  // unused or unimplemented counters are skipped in the report
+  if (neorv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_ZIHPM)) {
+    neorv32_cpu_csr_write(CSR_MHPMEVENT3, 1 << HPMCNT_EVENT_LOAD);
+    neorv32_cpu_csr_write(CSR_MHPMEVENT4, 1 << HPMCNT_EVENT_BRANCH);
+    neorv32_cpu_csr_write(CSR_MHPMEVENT5, 1 << HPMCNT_EVENT_WAIT_DIS);
+    neorv32_cpu_csr_write(CSR_MHPMEVENT6, 1 << HPMCNT_EVENT_WAIT_LSU);
+  }
+  neorv32_cpu_csr_write(CSR_MCOUNTINHIBIT, 0);
+
+  // setup measurement (calibrates the measurement overhead)
+  if (neorv32_perf_setup(perf_tab, REGION_NUM)) {
+    neorv32_uart0_printf("ERROR! Setup failed (Zicntr not implemented?).\n");
+    return 1;
+  }
+  neorv32_perf_name(REGION_FILL,  "work_fill");
+  neorv32_perf_name(REGION_CRC,   "work_crc32");
+  neorv32_perf_name(REGION_SORT,  "work_sort");
+  neorv32_perf_name(REGION_TOTAL, "total");
+
+  // run workload; regions can be nested
+  neorv32_perf_begin(REGION_TOTAL);
+  for (i=0; i<8; i++) {
+    work_fill(i);
+    crc ^= work_crc32();
+    work_sort(DATA_SIZE >> (i & 3));
+  }
+  neorv32_perf_end(REGION_TOTAL);
+
+  neorv32_uart0_printf("Checksum: 0x%x\n", crc);
+  neorv32_perf_report(NEORV32_UART0);
+
+  neorv32_uart0_printf("\nProgram completed.\n");
+  return 0;
+}
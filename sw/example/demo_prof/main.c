@@ -0,0 +1,156 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+
+/**********************************************************************//**
+ * @file demo_prof/main.c
+ * @brief Sampling profiler demo. Capture the console output to a file and
+ * evaluate it on the host:
+ * python3 sw/image_gen/prof_report.py main.elf console.log
+ **************************************************************************/
+
+#include <neorv32.h>
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE 19200
+/** Sampling rate in Hz */
+#define PROF_RATE 10000
+/** Histogram size in bytes */
+#define PROF_BUF_SIZE 2048
+/** Event-based sampling: sample every PROF_EVENT_PERIOD HPM events of type PROF_EVENT
+ * (#NEORV32_HPMCNT_EVENT_enum, e.g. HPMCNT_EVENT_DC_MISS); -1 = timer-based sampling */
+#define PROF_EVENT -1
+/** Number of events between two samples (event-based sampling) */
+#define PROF_EVENT_PERIOD 1000
+/**@}*/
+
+// histogram memory
+uint16_t prof_buf[PROF_BUF_SIZE/2];
+
+// workload data
+static uint32_t data[256];
+
+
+/**********************************************************************//**
+ * Workload: bit-wise CRC32 (hot inner loop).
+ *
+ * @param[in] len Number of words.
+ * @return CRC.
+ **************************************************************************/
+uint32_t __attribute__((noinline)) work_crc32(uint32_t len) {
+
+  uint32_t crc = 0xffffffff;
+  uint32_t i;
+  int b;
+
+  for (i=0; i<len; i++) {
+    crc ^= data[i];
+    for (b=0; b<32; b++) {
+      crc = (crc >> 1) ^ (0xedb88320 & (-(crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+
+/**********************************************************************//**
+ * Workload: bubble sort.
+ *
+ * @param[in] len Number of words.
+ **************************************************************************/
+void __attribute__((noinline)) work_sort(uint32_t len) {
+
+  uint32_t i, j, tmp;
+
+  for (i=0; i<len; i++) {
+    for (j=0; j<(len-1-i); j++) {
+      if (data[j] > data[j+1]) {
+        tmp = data[j];
+        data[j] = data[j+1];
+        data[j+1] = tmp;
+      }
+    }
+  }
+}
+
+
+/**********************************************************************//**
+ * Workload: fill with pseudo-random numbers.
+ *
+ * @param[in] len Number of words.
+ * @param[in] seed Start value.
+ **************************************************************************/
+void __attribute__((noinline)) work_fill(uint32_t len, uint32_t seed) {
+
+  uint32_t i;
+
+  for (i=0; i<len; i++) {
+    seed = seed * 1664525 + 1013904223;
+    data[i] = seed;
+  }
+}
+
+
+/**********************************************************************//**
+ * Main function.
+ *
+ * @note This program requires UART0 and the CLINT (timer-based sampling) or
+ * at least one HPM counter (event-based sampling).
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  uint32_t i, crc = 0;
+
+  // setup NEORV32 runtime environment
+  neorv32_rte_setup();
+
+  // setup UART at default baud rate, no interrupts
+  neorv32_uart0_setup(BAUD_RATE, 0);
+
+  neorv32_uart0_printf("\n<<< Sampling Profiler Demo >>>\n\n");
+
+  // profile the entire .text section
+  if (neorv32_prof_setup(prof_buf, sizeof(prof_buf), 0, 0, PROF_RATE)) {
+    neorv32_uart0_printf("ERROR! Profiler setup failed (CLINT not implemented?).\n");
+    return 1;
+  }
+#if (PROF_EVENT != -1)
+  if (neorv32_prof_event(PROF_EVENT, PROF_EVENT_PERIOD)) {
+    neorv32_uart0_printf("ERROR! Event-based sampling setup failed (HPMs not implemented?).\n");
+    return 1;
+  }
+#endif
+
+  // run workload
+  neorv32_prof_start();
+  for (i=0; i<16; i++) {
+    work_fill(sizeof(data)/4, i);
+    crc ^= work_crc32(sizeof(data)/4);
+    work_sort(sizeof(data)/4);
+  }
+  neorv32_prof_stop();
+
+  neorv32_prof_stats_t stats;
+  neorv32_prof_get_stats(&stats);
+  neorv32_uart0_printf("Checksum: 0x%x\n", crc);
+  neorv32_uart0_printf("Samples: %u (outside: %u, saturated: %u, missed: %u)\n",
+                       stats.samples, stats.outside, stats.saturated, stats.missed);
+
+  // send histogram to host
+  neorv32_prof_dump(NEORV32_UART0);
+
+  neorv32_uart0_printf("\nProgram completed.\n");
+  return 0;
+}
@@ -1,7 +1,7 @@
 // ================================================================================ //
 // The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
 // Copyright (c) NEORV32 contributors.                                              //
-// Copyright (c) 2020 - 2025 Stephan Nolting. All rights reserved.                  //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
 // Licensed under the BSD-3-Clause license, see LICENSE for details.                //
 // SPDX-License-Identifier: BSD-3-Clause                                            //
 // ================================================================================ //
@@ -14,6 +14,11 @@
 
 /** User configuration */
 #define BAUD_RATE 19200
+/** Compressed trace stream buffer size in words */
+#define STREAM_SIZE 512
+
+/** Compressed trace stream buffer (filled by the DMA) */
+uint32_t trace_stream[STREAM_SIZE];
 
 
 /**********************************************************************//**
@@ -75,7 +80,7 @@ void __attribute__ ((noinline)) test_code(void) {
  * Main function for core 0 (primary core).
  *
  * @attention This program requires the dual-core configuration, the CLINT, UART0
- * and the A/Zalrsc ISA extension.
+ * and the A/Zalrsc ISA extension. The compressed trace part requires the DMA.
  *
  * @return Irrelevant (but can be inspected by the debugger).
  **************************************************************************/
@@ -129,6 +134,34 @@ int main(void) {
   neorv32_tracer_stop();  // stop trace logging
 
 
+  // ----------------------------------------------------------------
+  // Compressed trace mode: the DMA streams the trace into a RAM buffer
+  // while the traced code is running. Decode the dump on the host:
+  // python3 sw/image_gen/trace_decode.py main.elf <console log>
+  // ----------------------------------------------------------------
+
+  if (neorv32_dma_available()) {
+    neorv32_uart0_printf("\nStarting compressed trace...\n");
+    neorv32_cpu_csr_clr(CSR_MIE, 1 << TRACER_FIRQ_ENABLE);
+    neorv32_tracer_stream_enable(0, -1); // 0 = trace CPU core 0, no auto-stop
+    neorv32_dma_enable();
+    neorv32_tracer_stream_dma(trace_stream, STREAM_SIZE);
+
+    neorv32_tracer_start();
+    test_code();
+    neorv32_tracer_stop();
+
+    while (neorv32_tracer_run()); // wait until the final packets are written to the trace buffer
+    while (neorv32_tracer_data_avail()); // wait until the DMA has drained the trace buffer
+    neorv32_dma_disable(); // abort the remaining transfer
+
+    if (neorv32_tracer_stream_lost()) {
+      neorv32_uart0_printf("[WARNING] trace data lost\n");
+    }
+    neorv32_tracer_stream_dump(NEORV32_UART0, trace_stream, STREAM_SIZE);
+  }
+
+
   neorv32_uart0_printf("\nProgram completed\n");
 
   return 0; // return to crt0 and halt
@@ -0,0 +1,112 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+
+/**********************************************************************//**
+ * @file demo_uart_buffered/main.c
+ * @brief Interrupt-driven buffered UART demo: compares the CPU time spent for
+ * printing a log line in direct (polling) and buffered mode.
+ **************************************************************************/
+
+#include <neorv32.h>
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE 19200
+/** TX ring buffer size in bytes (power of two) */
+#define TX_BUF_SIZE 512
+/** RX ring buffer size in bytes (power of two) */
+#define RX_BUF_SIZE 64
+/**@}*/
+
+// ring buffer memory
+uint8_t tx_buf[TX_BUF_SIZE];
+uint8_t rx_buf[RX_BUF_SIZE];
+
+// 100-character log line
+static const char log_line[] = "[log] control loop: setpoint=1000 actual=0998 error=+002 output=0512 state=RUN --------------------\n";
+
+
+/**********************************************************************//**
+ * Main function.
+ *
+ * @note This program requires UART0 and the Zicntr ISA extension.
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  uint32_t cycles_direct, cycles_buffered, cycles_write;
+
+  // setup NEORV32 runtime environment
+  neorv32_rte_setup();
+
+  // setup UART at default baud rate, no interrupts
+  neorv32_uart0_setup(BAUD_RATE, 0);
+
+  neorv32_uart0_printf("\n<<< Buffered UART Demo >>>\n\n");
+
+  // direct mode: CPU waits for free space in the TX FIFO
+  neorv32_uart0_flush();
+  cycles_direct = neorv32_cpu_csr_read(CSR_MCYCLE);
+  neorv32_uart0_puts(log_line);
+  cycles_direct = neorv32_cpu_csr_read(CSR_MCYCLE) - cycles_direct;
+
+  // enable interrupt-driven buffered mode
+  if (neorv32_uart_buffered_setup(NEORV32_UART0, tx_buf, TX_BUF_SIZE, rx_buf, RX_BUF_SIZE)) {
+    neorv32_uart0_printf("ERROR! Invalid ring buffer configuration.\n");
+    return -1;
+  }
+  neorv32_cpu_csr_set(CSR_MSTATUS, 1 << CSR_MSTATUS_MIE); // enable machine-mode interrupts
+
+  // buffered mode: data is copied to the TX ring buffer
+  neorv32_uart0_flush();
+  cycles_buffered = neorv32_cpu_csr_read(CSR_MCYCLE);
+  neorv32_uart0_puts(log_line);
+  cycles_buffered = neorv32_cpu_csr_read(CSR_MCYCLE) - cycles_buffered;
+
+  // bulk write (no line break conversion)
+  neorv32_uart0_flush();
+  cycles_write = neorv32_cpu_csr_read(CSR_MCYCLE);
+  neorv32_uart0_write(log_line, sizeof(log_line) - 1);
+  cycles_write = neorv32_cpu_csr_read(CSR_MCYCLE) - cycles_write;
+  neorv32_uart0_putc('\r');
+
+  neorv32_uart0_printf("\nCPU cycles for printing %u chars:\n", sizeof(log_line) - 1);
+  neorv32_uart0_printf("direct mode (puts):   %u\n", cycles_direct);
+  neorv32_uart0_printf("buffered mode (puts): %u\n", cycles_buffered);
+  neorv32_uart0_printf("buffered mode (write): %u\n", cycles_write);
+
+  // echo received data until ESC is received
+  neorv32_uart0_printf("\nType something (ESC to exit)...\n");
+  char buf[16];
+  int i, n, done = 0;
+  while (!done) {
+    n = neorv32_uart0_read(buf, sizeof(buf));
+    for (i=0; i<n; i++) {
+      if (buf[i] == 27) {
+        done = 1;
+      }
+    }
+    neorv32_uart0_write(buf, n);
+    // the CPU is free to do other things here
+  }
+
+  neorv32_uart_stats_t stats;
+  neorv32_uart_get_stats(NEORV32_UART0, &stats);
+  neorv32_uart0_printf("\n\nTX bytes: %u, TX stalls: %u\nRX bytes: %u, RX dropped: %u, RX FIFO overrun: %u\n",
+                       stats.tx_bytes, stats.tx_stalls, stats.rx_bytes, stats.rx_dropped, stats.rx_overrun);
+
+  neorv32_uart_buffered_disable(NEORV32_UART0);
+  neorv32_uart0_printf("\nProgram completed.\n");
+  return 0;
+}
@@ -82,6 +82,8 @@ long            Begin_Time,
                 User_Time;
 float           Microseconds,
                 Dhrystones_Per_Second;
+uint32_t        Begin_Instret, /* NEORV32-SPECIFIC */
+                End_Instret;
 
 /* end of variables for time measurement */
 
@@ -196,6 +198,7 @@ int main (void)
 
   { /* *****  NEORV32-SPECIFIC ***** */
     Begin_Time = (long)neorv32_clint_time_get();
+    Begin_Instret = neorv32_cpu_csr_read(CSR_MINSTRET);
   } /* ***** /NEORV32-SPECIFIC ***** */
 
   for (Run_Index = 1; Run_Index <= Number_Of_Runs; ++Run_Index)
@@ -262,6 +265,7 @@ int main (void)
 */
 
   { /* *****  NEORV32-SPECIFIC ***** */
+    End_Instret = neorv32_cpu_csr_read(CSR_MINSTRET);
     End_Time = (long)neorv32_clint_time_get();
   } /* ***** /NEORV32-SPECIFIC ***** */
 
@@ -350,6 +354,7 @@ int main (void)
 
       neorv32_uart0_printf("NEORV32: << DETAILED RESULTS (integer parts only) >>\n");
       neorv32_uart0_printf("NEORV32: Total cycles:      %u\n", (uint32_t)User_Time);
+      neorv32_uart0_printf("NEORV32: Total instructions: %u\n", End_Instret - Begin_Instret);
       neorv32_uart0_printf("NEORV32: Cycles per second: %u\n", (uint32_t)neorv32_sysinfo_get_clk());
       neorv32_uart0_printf("NEORV32: Total runs:        %u\n", (uint32_t)Number_Of_Runs);
 
@@ -0,0 +1,478 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+
+/**********************************************************************//**
+ * @file membench/main.c
+ * @author Stephan Nolting
+ * @brief Memory subsystem micro-benchmarks: load-to-use latency over the working-set
+ * size, CPU vs. DMA copy/fill bandwidth and instruction fetch vs. code footprint.
+ **************************************************************************/
+#include <neorv32.h>
+#include <string.h>
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE 19200
+/** Benchmark data buffer size in bytes (power of two, max. working set) */
+#ifndef MEMBENCH_BUF_SIZE
+#define MEMBENCH_BUF_SIZE 4096
+#endif
+/** Instruction fetch test: maximum code footprint in bytes (power of two) */
+#ifndef MEMBENCH_SLED_SIZE
+#define MEMBENCH_SLED_SIZE 4096
+#endif
+/** Number of dependent loads per latency measurement (multiple of 16) */
+#ifndef MEMBENCH_LOADS
+#define MEMBENCH_LOADS 1024
+#endif
+/** Number of code footprint executions per instruction fetch measurement */
+#ifndef MEMBENCH_REPS
+#define MEMBENCH_REPS 8
+#endif
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Helper macros
+ **************************************************************************/
+/**@{*/
+#define xstr(a) str(a)
+#define str(a) #a
+/**@}*/
+
+
+/**********************************************************************//**
+ * Counter snapshot.
+ **************************************************************************/
+typedef struct {
+  uint32_t cycle;    /**< active clock cycles */
+  uint32_t wait_lsu; /**< load/store unit wait cycles (HPM counter 3) */
+  uint32_t wait_dis; /**< instruction dispatch wait cycles (HPM counter 4) */
+} snapshot_t;
+
+
+/**********************************************************************//**
+ * @name Global variables
+ **************************************************************************/
+/**@{*/
+/** Benchmark data buffer (located in regular data memory) */
+static uint32_t buffer[MEMBENCH_BUF_SIZE/4] __attribute__((aligned(64)));
+/** Fill pattern for the DMA (constant source) */
+static volatile uint32_t fill_word = 0;
+/** Number of available HPM counters */
+static uint32_t hpm_num;
+/** Number of failed checks */
+static int errors = 0;
+/**@}*/
+
+
+/**********************************************************************//**
+ * Instruction fetch test: straight-line code of MEMBENCH_SLED_SIZE bytes (uncompressed
+ * NOPs) followed by a return. Calling (sled_end - n) executes n bytes of code.
+ **************************************************************************/
+extern const uint32_t sled_end[];
+asm (
+  ".section .text.membench_sled, \"ax\", @progbits \n"
+  ".balign 4                                        \n"
+  ".option push                                     \n"
+  ".option norvc                                    \n"
+  ".rept " xstr(MEMBENCH_SLED_SIZE) "/4             \n"
+  "  nop                                            \n"
+  ".endr                                            \n"
+  "sled_end:                                        \n"
+  "  ret                                            \n"
+  ".option pop                                      \n"
+  ".previous                                        \n"
+);
+
+
+// Prototypes
+static void test_latency(uint32_t stride);
+static void test_bandwidth(void);
+static void test_ifetch(void);
+static void snapshot(snapshot_t *s);
+static int dma_run(uint32_t src, uint32_t dst, uint32_t config);
+static uint32_t chase(uint32_t *ptr, uint32_t num);
+static uint32_t chase_overhead(uint32_t num);
+static void print_fix(uint32_t num, uint32_t den);
+
+
+/**********************************************************************//**
+ * Main function
+ *
+ * @note This program requires the Zicntr CPU extension and UART0. The DMA tests
+ * require the DMA controller, the wait-cycle columns require at least one (LSU)
+ * or two (fetch) HPM counters.
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  // initialize NEORV32 run-time environment
+  neorv32_rte_setup();
+
+  // setup UART at default baud rate, no interrupts
+  neorv32_uart0_setup(BAUD_RATE, 0);
+
+  // check if UART0 is implemented
+  if (neorv32_uart0_available() == 0) {
+    return 1; // UART0 not available, exit
+  }
+
+  // intro
+  neorv32_uart0_printf("\n<<< NEORV32 Memory Subsystem Benchmarks >>>\n\n");
+
+  // check if Zicntr is implemented
+  if ((neorv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_ZICNTR)) == 0) {
+    neorv32_uart0_printf("ERROR! Zicntr CPU extension not implemented!\n");
+    return 1;
+  }
+
+  // setup HPM counters: LSU and dispatch wait cycles
+  hpm_num = 0;
+  if (neorv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_ZIHPM)) {
+    hpm_num = neorv32_cpu_hpm_get_num_counters();
+  }
+  if (hpm_num > 0) { neorv32_cpu_csr_write(CSR_MHPMEVENT3, 1 << HPMCNT_EVENT_WAIT_LSU); }
+  if (hpm_num > 1) { neorv32_cpu_csr_write(CSR_MHPMEVENT4, 1 << HPMCNT_EVENT_WAIT_DIS); }
+  neorv32_cpu_csr_write(CSR_MCOUNTINHIBIT, 0);
+
+  // show memory system configuration
+  uint32_t soc = NEORV32_SYSINFO->SOC;
+  uint32_t cache = NEORV32_SYSINFO->CACHE;
+  uint32_t dblock = 4;
+  neorv32_uart0_printf("Clock:   %u Hz\n", neorv32_sysinfo_get_clk());
+  neorv32_uart0_printf("IMEM:    ");
+  if (soc & (1 << SYSINFO_SOC_IMEM)) { neorv32_uart0_printf("%u bytes\n", neorv32_sysinfo_get_imemsize()); }
+  else                               { neorv32_uart0_printf("-\n"); }
+  neorv32_uart0_printf("DMEM:    ");
+  if (soc & (1 << SYSINFO_SOC_DMEM)) { neorv32_uart0_printf("%u bytes\n", neorv32_sysinfo_get_dmemsize()); }
+  else                               { neorv32_uart0_printf("-\n"); }
+  neorv32_uart0_printf("XBUS:    %s\n", (soc & (1 << SYSINFO_SOC_XBUS)) ? "yes" : "-");
+  neorv32_uart0_printf("i-cache: ");
+  if (soc & (1 << SYSINFO_SOC_ICACHE)) {
+    neorv32_uart0_printf("%u blocks x %u bytes\n", 1 << ((cache >> 4) & 0xf), 1 << ((cache >> 0) & 0xf));
+  }
+  else {
+    neorv32_uart0_printf("-\n");
+  }
+  neorv32_uart0_printf("d-cache: ");
+  if (soc & (1 << SYSINFO_SOC_DCACHE)) {
+    dblock = 1 << ((cache >> 8) & 0xf);
+    neorv32_uart0_printf("%u blocks x %u bytes\n", 1 << ((cache >> 12) & 0xf), dblock);
+  }
+  else {
+    neorv32_uart0_printf("-\n");
+  }
+  neorv32_uart0_printf("DMA:     %s\n", (soc & (1 << SYSINFO_SOC_IO_DMA)) ? "yes" : "-");
+  neorv32_uart0_printf("HPMs:    %u\n", hpm_num);
+  neorv32_uart0_printf("Buffer:  %u bytes @ 0x%x\n", (uint32_t)sizeof(buffer), (uint32_t)&buffer[0]);
+  neorv32_uart0_printf("Code:    %u bytes @ 0x%x\n\n", (uint32_t)MEMBENCH_SLED_SIZE,
+                       (uint32_t)sled_end - (uint32_t)MEMBENCH_SLED_SIZE);
+
+  neorv32_uart0_printf("[NOTE] All results in clock cycles. Each line: <test> <bytes> B: <cycles> cycles,\n"
+                       "       <cycles per operation>, <wait cycles per operation> (HPM, 0 if not available).\n\n");
+
+  // run tests
+  test_latency(dblock);
+  test_bandwidth();
+  test_ifetch();
+
+  neorv32_uart0_printf("\nmembench done, %u error(s).\n", errors);
+  return (errors != 0);
+}
+
+
+/**********************************************************************//**
+ * Load-to-use latency: chase a ring of dependent loads through a working set of
+ * increasing size. One load per d-cache block so every load misses as soon as
+ * the working set exceeds the cache capacity.
+ *
+ * @param[in] stride Distance between two loads in bytes (d-cache block size).
+ **************************************************************************/
+static void test_latency(uint32_t stride) {
+
+  snapshot_t s0, s1;
+  uint32_t size, i, n, cycles, wait;
+
+  neorv32_uart0_printf("Load-to-use latency (stride %u bytes, %u dependent loads):\n", stride, (uint32_t)MEMBENCH_LOADS);
+
+  uint32_t overhead = chase_overhead(MEMBENCH_LOADS);
+
+  for (size = (stride > 256) ? stride : 256; size <= sizeof(buffer); size <<= 1) {
+
+    // build ring: each element holds the byte offset to the next one
+    for (i = 0; i < size; i += stride) {
+      buffer[i/4] = stride;
+    }
+    buffer[(size - stride)/4] = -(size - stride);
+    asm volatile ("fence");
+
+    // warm-up: touch the entire working set once
+    n = ((size / stride) + 15) & ~15;
+    chase(buffer, n);
+
+    snapshot(&s0);
+    chase(buffer, MEMBENCH_LOADS);
+    snapshot(&s1);
+
+    cycles = s1.cycle - s0.cycle;
+    cycles = (cycles > overhead) ? (cycles - overhead) : 0;
+    wait = s1.wait_lsu - s0.wait_lsu;
+    neorv32_uart0_printf("lat     %6u B: %8u cycles, ", size, cycles);
+    print_fix(cycles, MEMBENCH_LOADS);
+    neorv32_uart0_printf(" cyc/load, ");
+    print_fix(wait, MEMBENCH_LOADS);
+    neorv32_uart0_printf(" wait/load\n");
+  }
+  neorv32_uart0_printf("\n");
+}
+
+
+/**********************************************************************//**
+ * Copy and fill bandwidth: libc memcpy/memset vs. DMA word transfers. The DMA
+ * timing includes programming the descriptor and the cache synchronization.
+ **************************************************************************/
+static void test_bandwidth(void) {
+
+  snapshot_t s0, s1;
+  uint32_t size, i, cycles;
+  int rc;
+  int dma_en = neorv32_dma_available();
+  uint8_t *src = (uint8_t*)&buffer[0];
+  uint8_t *dst = (uint8_t*)&buffer[MEMBENCH_BUF_SIZE/8];
+
+  neorv32_uart0_printf("Copy/fill bandwidth (CPU = libc, DMA = word transfers):\n");
+
+  if (dma_en) {
+    neorv32_dma_enable();
+  }
+  else {
+    neorv32_uart0_printf("[NOTE] DMA controller not implemented, skipping DMA tests.\n");
+  }
+
+  for (size = 256; size <= (sizeof(buffer) / 2); size <<= 1) {
+
+    for (i = 0; i < (sizeof(buffer) / 4); i++) {
+      buffer[i] = i;
+    }
+
+    // CPU copy
+    asm volatile ("fence");
+    snapshot(&s0);
+    memcpy(dst, src, size);
+    snapshot(&s1);
+    cycles = s1.cycle - s0.cycle;
+    if (memcmp(dst, src, size)) {
+      neorv32_uart0_printf("ERROR! CPU copy failed!\n");
+      errors++;
+    }
+    neorv32_uart0_printf("cpy_cpu %6u B: %8u cycles, ", size, cycles);
+    print_fix(size, cycles);
+    neorv32_uart0_printf(" bytes/cyc, ");
+    print_fix(s1.wait_lsu - s0.wait_lsu, size / 4);
+    neorv32_uart0_printf(" wait/word\n");
+
+    // DMA copy
+    if (dma_en) {
+      memset(dst, 0, size);
+      asm volatile ("fence");
+      snapshot(&s0);
+      rc = dma_run((uint32_t)src, (uint32_t)dst, DMA_SRC_INC_WORD | DMA_DST_INC_WORD | (size / 4));
+      snapshot(&s1);
+      cycles = s1.cycle - s0.cycle;
+      if ((rc != DMA_STATUS_DONE) || memcmp(dst, src, size)) {
+        neorv32_uart0_printf("ERROR! DMA copy failed!\n");
+        errors++;
+      }
+      neorv32_uart0_printf("cpy_dma %6u B: %8u cycles, ", size, cycles);
+      print_fix(size, cycles);
+      neorv32_uart0_printf(" bytes/cyc\n");
+    }
+
+    // CPU fill
+    asm volatile ("fence");
+    snapshot(&s0);
+    memset(dst, 0xa5, size);
+    snapshot(&s1);
+    cycles = s1.cycle - s0.cycle;
+    if (((uint32_t*)dst)[size/4 - 1] != 0xa5a5a5a5U) {
+      neorv32_uart0_printf("ERROR! CPU fill failed!\n");
+      errors++;
+    }
+    neorv32_uart0_printf("set_cpu %6u B: %8u cycles, ", size, cycles);
+    print_fix(size, cycles);
+    neorv32_uart0_printf(" bytes/cyc, ");
+    print_fix(s1.wait_lsu - s0.wait_lsu, size / 4);
+    neorv32_uart0_printf(" wait/word\n");
+
+    // DMA fill
+    if (dma_en) {
+      fill_word = 0x5a5a5a5aU;
+      asm volatile ("fence");
+      snapshot(&s0);
+      rc = dma_run((uint32_t)&fill_word, (uint32_t)dst, DMA_SRC_CONST_WORD | DMA_DST_INC_WORD | (size / 4));
+      snapshot(&s1);
+      cycles = s1.cycle - s0.cycle;
+      if ((rc != DMA_STATUS_DONE) || (((uint32_t*)dst)[size/4 - 1] != 0x5a5a5a5aU)) {
+        neorv32_uart0_printf("ERROR! DMA fill failed!\n");
+        errors++;
+      }
+      neorv32_uart0_printf("set_dma %6u B: %8u cycles, ", size, cycles);
+      print_fix(size, cycles);
+      neorv32_uart0_printf(" bytes/cyc\n");
+    }
+  }
+
+  if (dma_en) {
+    neorv32_dma_disable();
+  }
+  neorv32_uart0_printf("\n");
+}
+
+
+/**********************************************************************//**
+ * Instruction fetch: execute straight-line code of increasing footprint. The
+ * cycles per instruction rise as soon as the footprint exceeds the i-cache.
+ **************************************************************************/
+static void test_ifetch(void) {
+
+  snapshot_t s0, s1;
+  uint32_t size, i, cycles, ninst;
+  void (*code)(void);
+
+  neorv32_uart0_printf("Instruction fetch (%u executions of straight-line code):\n", (uint32_t)MEMBENCH_REPS);
+
+  for (size = 256; size <= MEMBENCH_SLED_SIZE; size <<= 1) {
+
+    code = (void (*)(void))((uint32_t)sled_end - size);
+    ninst = MEMBENCH_REPS * (size / 4);
+
+    code(); // warm-up
+    snapshot(&s0);
+    for (i = 0; i < MEMBENCH_REPS; i++) {
+      code();
+    }
+    snapshot(&s1);
+
+    cycles = s1.cycle - s0.cycle;
+    neorv32_uart0_printf("ifetch  %6u B: %8u cycles, ", size, cycles);
+    print_fix(cycles, ninst);
+    neorv32_uart0_printf(" cyc/inst, ");
+    print_fix(s1.wait_dis - s0.wait_dis, ninst);
+    neorv32_uart0_printf(" wait/inst\n");
+  }
+}
+
+
+/**********************************************************************//**
+ * Take a snapshot of the cycle counter and the wait-cycle HPM counters.
+ *
+ * @param[in,out] s Snapshot.
+ **************************************************************************/
+static void __attribute__((noinline)) snapshot(snapshot_t *s) {
+
+  s->wait_lsu = (hpm_num > 0) ? neorv32_cpu_csr_read(CSR_MHPMCOUNTER3) : 0;
+  s->wait_dis = (hpm_num > 1) ? neorv32_cpu_csr_read(CSR_MHPMCOUNTER4) : 0;
+  s->cycle = neorv32_cpu_csr_read(CSR_MCYCLE);
+}
+
+
+/**********************************************************************//**
+ * Execute a single DMA transfer (busy wait) and synchronize the caches.
+ *
+ * @param[in] src Source base address.
+ * @param[in] dst Destination base address.
+ * @param[in] config Transfer configuration (type and number of elements).
+ * @return DMA status (#NEORV32_DMA_STATUS_enum).
+ **************************************************************************/
+static int dma_run(uint32_t src, uint32_t dst, uint32_t config) {
+
+  int rc;
+
+  neorv32_dma_irq_ack(); // clear DONE/ERROR of the previous transfer
+  neorv32_dma_program_nocheck(src, dst, config);
+  neorv32_dma_start();
+  do {
+    rc = neorv32_dma_status();
+  } while ((rc != DMA_STATUS_DONE) && (rc != DMA_STATUS_ERROR));
+  asm volatile ("fence"); // synchronize caches
+
+  return rc;
+}
+
+
+/**********************************************************************//**
+ * Pointer chase: every element holds the byte offset to the next one, so each
+ * load address depends on the data of the previous load.
+ *
+ * @param[in] ptr Start of the ring.
+ * @param[in] num Number of loads (multiple of 16).
+ * @return Final pointer (keeps the chain alive).
+ **************************************************************************/
+static uint32_t __attribute__((noinline)) chase(uint32_t *ptr, uint32_t num) {
+
+  uint32_t p = (uint32_t)ptr;
+
+  asm volatile (
+    "1:                      \n"
+    ".rept 16                \n"
+    "  lw   t0, 0(%[p])      \n"
+    "  add  %[p], %[p], t0   \n"
+    ".endr                   \n"
+    "  addi %[n], %[n], -16  \n"
+    "  bnez %[n], 1b         \n"
+    : [p] "+r" (p), [n] "+r" (num) : : "t0", "memory"
+  );
+
+  return p;
+}
+
+
+/**********************************************************************//**
+ * Loop and measurement overhead of #chase: same loop without the loads.
+ *
+ * @param[in] num Number of (virtual) loads (multiple of 16).
+ * @return Overhead in clock cycles.
+ **************************************************************************/
+static uint32_t __attribute__((noinline)) chase_overhead(uint32_t num) {
+
+  snapshot_t s0, s1;
+
+  snapshot(&s0);
+  asm volatile (
+    "1:                      \n"
+    "  addi %[n], %[n], -16  \n"
+    "  bnez %[n], 1b         \n"
+    : [n] "+r" (num) : : "memory"
+  );
+  snapshot(&s1);
+
+  return s1.cycle - s0.cycle;
+}
+
+
+/**********************************************************************//**
+ * Print quotient with two decimal places.
+ *
+ * @param[in] num Numerator.
+ * @param[in] den Denominator.
+ **************************************************************************/
+static void print_fix(uint32_t num, uint32_t den) {
+
+  uint32_t q = 0;
+  if (den) {
+    q = (uint32_t)((100ULL * num) / den);
+  }
+  neorv32_uart0_printf("%4u.%02u", q / 100, q % 100);
+}
@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+
+# ================================================================================ #
+# The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              #
+# Copyright (c) NEORV32 contributors.                                              #
+# Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  #
+# Licensed under the BSD-3-Clause license, see LICENSE for details.                #
+# SPDX-License-Identifier: BSD-3-Clause                                            #
+# ================================================================================ #
+
+# Performance regression suite. Builds the benchmark programs for every processor
+# configuration of the matrix, runs them on the default testbench (GHDL, generics
+# overridden per configuration), extracts the cycle/instruction/HPM counts from the
+# UART0 output and compares them against stored baselines.
+#
+# All metrics are event or cycle counts: a metric exceeding its baseline by more
+# than the threshold is a regression. Fewer counts are reported as improvement.
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import time
+
+HOME = os.path.dirname(os.path.abspath(__file__))
+NEORV32_HOME = os.path.abspath(os.path.join(HOME, "..", "..", ".."))
+EXAMPLES = os.path.join(NEORV32_HOME, "sw", "example")
+GHDL_SCRIPT = os.path.join(NEORV32_HOME, "sim", "ghdl.sh")
+
+# testbench generics common to all configurations
+TB_COMMON = {
+    "DUAL_CORE_EN": "false",
+    "TRACE_LOG_EN": "false",
+    "IMEM_SIZE": "131072",
+    "DMEM_SIZE": "65536",
+}
+
+# processor configuration matrix: testbench generics and C extension (MARCH)
+CONFIGS = {
+    "default":    ({}, True),
+    "no_cache":   ({"ICACHE_EN": "false", "DCACHE_EN": "false"}, True),
+    "slow_mul":   ({"CPU_FAST_MUL_EN": "false"}, True),
+    "slow_shift": ({"CPU_FAST_SHIFT_EN": "false"}, True),
+    "no_c":       ({"RISCV_ISA_C": "false", "RISCV_ISA_Zcb": "false"}, False),
+}
+
+# coremark HPM setup (core_portme.c)
+COREMARK_METRICS = {
+    "cycles":        r"Active clock cycles\s*:\s*(\d+)",
+    "instret":       r"Retired instructions\s*:\s*(\d+)",
+    "hpm_compr":     r"Compressed instructions\s*:\s*(\d+)",
+    "hpm_wait_dis":  r"Instr\. dispatch wait cycles\s*:\s*(\d+)",
+    "hpm_wait_alu":  r"ALU wait cycles\s*:\s*(\d+)",
+    "hpm_branch":    r"Branch instructions\s*:\s*(\d+)",
+    "hpm_ctrlflow":  r"Control flow transfers\s*:\s*(\d+)",
+    "hpm_load":      r"Load instructions\s*:\s*(\d+)",
+    "hpm_store":     r"Store instructions\s*:\s*(\d+)",
+    "hpm_wait_lsu":  r"Load/store wait cycles\s*:\s*(\d+)",
+}
+
+# instruction timing tests: total plus one metric per tested instruction
+TIMING_METRICS = {
+    "cycles": r"^total (\d+) cycles$",
+    "inst:*": r"^(.+?) inst\.? (\d+) cyc$",
+}
+TIMING_FLAGS = ["-DRUN_CHECK", "-DUART0_SIM_MODE", "-DSILENT_MODE", "-Drv32_all"]
+
+# benchmarks: folder (relative to sw/example), MARCH ({c} = C extension), application
+# flags, simulation time, end-of-run marker and metrics (name: regex)
+BENCHMARKS = {
+    "coremark": {
+        "dir": "coremark",
+        "march": "rv32im{c}_zicsr_zifencei",
+        "flags": ["-DUART0_SIM_MODE", "-DITERATIONS=4"],
+        "stop": "30ms",
+        "done": r"Load/store wait cycles|no HPMs available",
+        "metrics": COREMARK_METRICS,
+    },
+    "dhrystone": {
+        "dir": "dhrystone",
+        "march": "rv32i{c}_zicsr_zifencei",
+        "flags": ["-DRUN_DHRYSTONE", "-DUART0_SIM_MODE", "-DDHRY_ITERS=2000"],
+        "stop": "20ms",
+        "done": r"NEORV32: VAX DMIPS/s/MHz",
+        "metrics": {
+            "cycles":  r"NEORV32: Total cycles:\s*(\d+)",
+            "instret": r"NEORV32: Total instructions:\s*(\d+)",
+        },
+    },
+    "timing_I": {
+        "dir": "performance_tests/I",
+        "march": "rv32i_zicsr_zifencei",
+        "flags": TIMING_FLAGS,
+        "stop": "4500us",
+        "done": r"avg\. inst\. execute cyles",
+        "metrics": TIMING_METRICS,
+    },
+    "timing_M": {
+        "dir": "performance_tests/M",
+        "march": "rv32im_zicsr_zifencei",
+        "flags": TIMING_FLAGS,
+        "stop": "1500us",
+        "done": r"avg\. inst\. execute cyles",
+        "metrics": TIMING_METRICS,
+    },
+    "timing_Zfinx": {
+        "dir": "performance_tests/Zfinx",
+        "march": "rv32i_zicsr_zifencei_zfinx",
+        "flags": TIMING_FLAGS,
+        "stop": "4500us",
+        "done": r"avg\. inst\. execute cyles",
+        "metrics": TIMING_METRICS,
+    },
+    "membench": {
+        "dir": "membench",
+        "march": "rv32i{c}_zicsr_zifencei",
+        "flags": ["-DUART0_SIM_MODE"],
+        "stop": "10ms",
+        "done": r"membench done",
+        "metrics": {
+            "mem:*": r"^(\w+)\s+(\d+) B:\s+(\d+) cycles",
+        },
+    },
+}
+
+
+def run(cmd, cwd, log):
+    """Run command; append output to log; return (exit code, output)."""
+    proc = subprocess.run(cmd, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                          universal_newlines=True)
+    log.write(f"$ {' '.join(cmd)}\n{proc.stdout}\n")
+    return proc.returncode, proc.stdout
+
+
+def extract(bench, output):
+    """Extract metrics from the simulation console output."""
+    lines = [line.strip() for line in output.splitlines()]
+    values = {}
+    for name, regex in bench["metrics"].items():
+        pattern = re.compile(regex)
+        for line in lines:
+            m = pattern.search(line)
+            if not m:
+                continue
+            if name.endswith("*"):  # one metric per match, name from all but the last group
+                values[name[:-1] + "_".join(m.groups()[:-1])] = int(m.groups()[-1])
+            else:
+                values[name] = int(m.group(1))
+                break
+    return values
+
+
+def run_benchmark(config, bench, args, log):
+    """Build and simulate one benchmark; return metrics or an error string."""
+    generics, isa_c = CONFIGS[config]
+    folder = os.path.join(EXAMPLES, bench["dir"])
+    march = bench["march"].format(c="c" if isa_c else "")
+    make = ["make", f"MARCH={march}"] + [f"USER_FLAGS+={f}" for f in bench["flags"]] + ["clean_all", "install"]
+    rc, _ = run(make, folder, log)
+    if rc != 0:
+        return "build failed"
+
+    ghdl = [GHDL_SCRIPT] + [f"-g{k}={v}" for k, v in {**TB_COMMON, **generics}.items()]
+    ghdl += [f"--stop-time={args.stop_time or bench['stop']}"] + args.ghdl_args
+    env = dict(os.environ, GHDL_NOLOG="1")
+    proc = subprocess.run(ghdl, cwd=os.path.dirname(GHDL_SCRIPT), env=env, stdout=subprocess.PIPE,
+                          stderr=subprocess.STDOUT, universal_newlines=True)
+    log.write(f"$ {' '.join(ghdl)}\n{proc.stdout}\n")
+    if not re.search(bench["done"], proc.stdout):
+        return "incomplete (simulation time too short?)"
+    values = extract(bench, proc.stdout)
+    return values if values else "no metrics found"
+
+
+def compare(baseline, current, threshold):
+    """Compare metrics; return list of (metric, base, value, delta %, status)."""
+    rows = []
+    for name in sorted(set(baseline) | set(current)):
+        base, value = baseline.get(name), current.get(name)
+        if value is None:
+            rows.append((name, base, None, None, "MISSING"))
+        elif base is None:
+            rows.append((name, None, value, None, "new"))
+        else:
+            delta = 100.0 * (value - base) / base if base else (0.0 if value == base else 100.0)
+            if delta > threshold:
+                status = "REGRESSION"
+            elif delta < -threshold:
+                status = "improved"
+            else:
+                status = "ok"
+            rows.append((name, base, value, delta, status))
+    return rows
+
+
+def main():
+    parser = argparse.ArgumentParser(description="NEORV32 performance regression suite (GHDL simulation).")
+    parser.add_argument("-c", "--config", action="append", choices=CONFIGS.keys(),
+                        help="processor configuration(s) to run; default: all")
+    parser.add_argument("-b", "--benchmark", action="append", choices=BENCHMARKS.keys(),
+                        help="benchmark(s) to run; default: all")
+    parser.add_argument("-t", "--threshold", type=float, default=2.0,
+                        help="allowed increase of any count in percent; default: 2.0")
+    parser.add_argument("--baseline", default=os.path.join(HOME, "perf_baseline.json"),
+                        help="baseline file; default: perf_baseline.json")
+    parser.add_argument("--update", action="store_true",
+                        help="write the measured values to the baseline file instead of comparing")
+    parser.add_argument("--results", help="write the measured values to this JSON file")
+    parser.add_argument("--log", default=os.path.join(HOME, "perf_regression.log"),
+                        help="build and simulation log; default: perf_regression.log")
+    parser.add_argument("--stop-time", help="override the per-benchmark GHDL stop time (e.g. 50ms)")
+    parser.add_argument("--ghdl-args", nargs=argparse.REMAINDER, default=[],
+                        help="additional GHDL run arguments (has to be the last option)")
+    parser.add_argument("-v", "--verbose", action="store_true", help="also show metrics within the threshold")
+    parser.add_argument("-l", "--list", action="store_true", help="list configurations and benchmarks")
+    args = parser.parse_args()
+
+    if args.list:
+        for name, (generics, isa_c) in CONFIGS.items():
+            opts = [f"{k}={v}" for k, v in generics.items()] + ([] if isa_c else ["MARCH without C"])
+            print(f"config    {name:12s} {', '.join(opts) or 'testbench defaults'}")
+        for name, bench in BENCHMARKS.items():
+            print(f"benchmark {name:12s} sw/example/{bench['dir']} ({bench['march']})")
+        return 0
+
+    configs = args.config or list(CONFIGS)
+    benches = args.benchmark or list(BENCHMARKS)
+
+    baseline = {}
+    if os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+    elif not args.update:
+        print(f"WARNING! No baseline file {args.baseline}; run with --update to create it.")
+
+    results = {}
+    failed = False
+    with open(args.log, "w") as log:
+        for config in configs:
+            for name in benches:
+                t_start = time.time()
+                print(f"[{config}] {name} ...", end="", flush=True)
+                values = run_benchmark(config, BENCHMARKS[name], args, log)
+                if isinstance(values, str):
+                    print(f" FAILED: {values} (see {args.log})")
+                    failed = True
+                    continue
+                print(f" {len(values)} metrics, {time.time() - t_start:.0f}s")
+                results.setdefault(config, {})[name] = values
+                if args.update:
+                    continue
+                for metric, base, value, delta, status in compare(baseline.get(config, {}).get(name, {}), values,
+                                                                   args.threshold):
+                    if (status == "ok") and not args.verbose:
+                        continue
+                    base_s = "-" if base is None else str(base)
+                    value_s = "-" if value is None else str(value)
+                    delta_s = "" if delta is None else f"{delta:+.2f}%"
+                    print(f"  {metric:40s} {base_s:>12s} -> {value_s:>12s} {delta_s:>9s}  {status}")
+                    failed |= status in ("REGRESSION", "MISSING")
+
+    if args.results:
+        with open(args.results, "w") as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+    if args.update:
+        for config, benches_ in results.items():
+            baseline.setdefault(config, {}).update(benches_)
+        with open(args.baseline, "w") as f:
+            json.dump(baseline, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print(f"Baseline updated: {args.baseline}")
+        return 1 if failed else 0
+
+    print("FAILED" if failed else f"PASSED (threshold {args.threshold}%)")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -70,6 +70,7 @@ int  core1_main(void);
 void goto_user_mode(void);
 void trace_test_1(void);
 void trace_test_2(void);
+void trace_test_3(int n);
 
 // trap value that will be NEVER set by the hardware
 const uint32_t trap_never_c = 0x80000000U;
@@ -84,6 +85,7 @@ volatile uint32_t num_hpm_cnts_global = 0; // global number of available hpms
 volatile int vectored_mei_handler_ack = 0; // vectored mei trap handler acknowledge
 volatile uint32_t gpio_trap_handler_ack = 0; // gpio trap handler acknowledge
 volatile uint32_t dma_src[2], dma_dst[2]; // dma source & destination data
+volatile uint32_t trace_buf[32]; // compressed trace stream
 volatile uint32_t store_access_addr[2]; // variable to test store accesses
 volatile uint32_t __attribute__((aligned(8*4))) pmp_access[8]; // variable to test pmp
 volatile uint32_t trap_cnt; // number of triggered traps
@@ -140,6 +142,7 @@ int main() {
   // setup UARTs at default baud rate, no interrupts
   neorv32_uart0_setup(BAUD_RATE, 0);
   NEORV32_UART1->CTRL = 0;
+  NEORV32_UART1->BAUD = NEORV32_UART0->BAUD;
   NEORV32_UART1->CTRL = NEORV32_UART0->CTRL;
 
 
@@ -1263,6 +1266,7 @@ int main() {
     NEORV32_UART0->CTRL &= ~(1 << UART_CTRL_SIM_MODE); // make sure sim mode is disabled
     neorv32_uart_rtscts_enable(NEORV32_UART0);
     NEORV32_UART1->CTRL = 0; // reset
+    NEORV32_UART1->BAUD = NEORV32_UART0->BAUD;
     NEORV32_UART1->CTRL = NEORV32_UART0->CTRL;
 
     // enable fast interrupt
@@ -1318,6 +1322,7 @@ int main() {
     NEORV32_UART1->CTRL &= ~(1 << UART_CTRL_SIM_MODE); // make sure sim mode is disabled
     neorv32_uart_rtscts_enable(NEORV32_UART1);
     NEORV32_UART0->CTRL = 0; // reset
+    NEORV32_UART0->BAUD = NEORV32_UART1->BAUD;
     NEORV32_UART0->CTRL = NEORV32_UART1->CTRL;
 
     // send a char to trigger interrupt
@@ -1353,10 +1358,48 @@ int main() {
 
 
   // ----------------------------------------------------------
-  // Fast interrupt channel 4 (reserved)
+  // Fast interrupt channel 4 (MBOX)
   // ----------------------------------------------------------
-  PRINT("[%i] FIRQ4 (reserved) ", cnt_test);
-  PRINT("[n.a.]\n");
+  PRINT("[%i] FIRQ4 (MBOX) ", cnt_test);
+
+  if (neorv32_mbox_available()) {
+    trap_cause = trap_never_c;
+    cnt_test++;
+
+    // enable own inbox and its interrupt
+    neorv32_mbox_setup(1);
+    neorv32_cpu_csr_write(CSR_MIE, 1 << MBOX_FIRQ_ENABLE);
+
+    // send message to ourself
+    neorv32_mbox_put(0, 0x1234abcd);
+
+    // wait for interrupt
+    asm volatile ("nop");
+    asm volatile ("nop");
+
+    // disable MBOX interrupt
+    neorv32_cpu_csr_write(CSR_MIE, 0);
+
+    uint32_t mbox_data = 0;
+    int mbox_src = -1;
+    if ((trap_cause == MBOX_TRAP_CODE) && // correct trap code
+        (neorv32_mbox_recv(&mbox_data, &mbox_src) == 0) && // message available
+        (mbox_data == 0x1234abcd) && // correct message
+        (mbox_src == 0) && // correct sender
+        (neorv32_mbox_avail() == 0) && // inbox empty
+        (neorv32_mbox_overflow() == 0)) { // no message lost
+      test_ok();
+    }
+    else {
+      test_fail();
+    }
+
+    // disable inbox
+    NEORV32_MBOX->INBOX[0].CTRL = 0;
+  }
+  else {
+    PRINT("[n.a.]\n");
+  }
 
 
   // ----------------------------------------------------------
@@ -1641,6 +1684,56 @@ int main() {
   }
 
 
+  // ----------------------------------------------------------
+  // Compressed trace stream via DMA (TRACER + DMA)
+  // ----------------------------------------------------------
+  PRINT("[%i] TRACER stream (DMA) ", cnt_test);
+
+  if ((neorv32_tracer_available()) && (neorv32_dma_available())) {
+    cnt_test++;
+
+    for (tmp_a=0; tmp_a<32; tmp_a++) {
+      trace_buf[tmp_a] = 0;
+    }
+    asm volatile ("fence");
+
+    // compressed trace of hart 0, stop when entering trace_test_1
+    neorv32_tracer_stream_enable(0, (uint32_t)&trace_test_1);
+
+    // drain the trace stream into memory; the DMA is paced by the tracer's DMA request only
+    neorv32_dma_enable();
+    tmp_a = (uint32_t)neorv32_tracer_stream_dma((uint32_t*)trace_buf, 32);
+
+    // trace branches, calls and returns
+    neorv32_tracer_start();
+    trace_test_3(5);
+    trace_test_1();
+
+    // wait until all trace data has been moved, then abort the (partially filled) transfer
+    while (neorv32_tracer_run());
+    while (neorv32_tracer_data_avail());
+    neorv32_dma_disable();
+    neorv32_tracer_irq_ack();
+    asm volatile ("fence");
+
+    if ((tmp_a == 0) && // no error during descriptor programming
+        (neorv32_tracer_stream_lost() == 0) && // no trace data lost
+        ((trace_buf[0] & 0x1f) == ((TRACER_ADDR_SYNC << 2) | TRACER_PKT_ADDR))) { // stream starts with sync packet
+      test_ok();
+    }
+    else {
+      test_fail();
+    }
+
+    // print trace for the host decoder (checked by the sim-check make target)
+    neorv32_tracer_stream_dump(NEORV32_UART0, (const uint32_t*)trace_buf, 32);
+    neorv32_tracer_disable();
+  }
+  else {
+    PRINT("[n.a.]\n");
+  }
+
+
   // ----------------------------------------------------------
   // Fast interrupt channel 11 (SDI)
   // ----------------------------------------------------------
@@ -2141,6 +2234,47 @@ int main() {
   }
 
 
+  // ----------------------------------------------------------
+  // Test XIP continuous reads (TB: flash word at address A reads A)
+  // ----------------------------------------------------------
+  PRINT("[%i] XIP continuous read ", cnt_test);
+
+  if (neorv32_xip_available()) {
+    trap_cause = trap_never_c;
+    cnt_test++;
+
+    const uint8_t xip_rdcmd[4] = {0x0B, 0x3B, 0x6B, 0xEB}; // 1-1-1, 1-1-2, 1-1-4, 1-4-4
+    const uint8_t xip_dummy[4] = {8, 8, 8, 6};
+
+    tmp_b = 0;
+    for (tmp_a = 0; tmp_a < 4*32; tmp_a++) { // 4 read modes, 32 sequential words (several cache blocks) each
+      if ((tmp_a % 32) == 0) { // new read mode; starts a new session
+        neorv32_xip_setup(CLK_PRSC_2, 0, 1, 3, tmp_a / 32, xip_dummy[tmp_a / 32], xip_rdcmd[tmp_a / 32]);
+        neorv32_xip_window_enable();
+        asm volatile ("fence"); // reload d-cache
+      }
+      if (neorv32_cpu_load_unsigned_word(NEORV32_XIP_MEM_BASE + 4*tmp_a) != 4*tmp_a) {
+        tmp_b++;
+      }
+    }
+
+    if ((trap_cause == trap_never_c) && // no bus errors
+        (tmp_b == 0) && // correct read data
+        (NEORV32_XIP->CTRL & (1 << XIP_CTRL_SESSION))) { // session is kept open
+      test_ok();
+    }
+    else {
+      test_fail();
+    }
+
+    neorv32_xip_disable();
+    asm volatile ("fence"); // reload d-cache
+  }
+  else {
+    PRINT("[n.a.]\n");
+  }
+
+
   // ----------------------------------------------------------
   // Test physical memory protection
   // ----------------------------------------------------------
@@ -2604,3 +2738,18 @@ void __attribute__((noinline)) trace_test_2(void) {
 
   asm volatile ("nop");
 }
+
+
+/**********************************************************************//**
+ * Test code for compressed tracer stream: conditional branches, calls and returns
+ *
+ * @param[in] n Number of loop iterations.
+ **************************************************************************/
+void __attribute__((noinline)) trace_test_3(int n) {
+
+  while (n--) {
+    if (n & 1) {
+      trace_test_2();
+    }
+  }
+}
@@ -15,10 +15,21 @@
 
 // executable signature ("magic word")
 const uint32_t signature = 0xB007C0DE;
+const uint32_t signature_lz4 = 0xB007C0DF; // compressed executable
+
+// LZ4 block compression parameters
+#define LZ4_MIN_MATCH    4     // minimal match length
+#define LZ4_MAX_OFFSET   65535 // maximal match distance
+#define LZ4_LAST_LITERAL 5     // the last 5 bytes are always literals
+#define LZ4_MF_LIMIT     12    // the last match has to start at least 12 bytes before the end
+#define LZ4_HASH_BITS    16    // hash table size (log2)
+#define LZ4_MAX_CHAIN    1024  // maximal number of match candidates to check
+#define LZ4_MAX_MATCH    64    // limit match length so the bootloader's copy loop does not miss UART data
 
 // output file types (operation select)
 enum operation_enum {
   OP_EXE,
+  OP_CEXE,
   OP_VHD,
   OP_HEX,
   OP_BIN,
@@ -42,6 +53,7 @@ void print_help(void){
     "\n"
     "Image type:\n"
     "  exe  Executable for bootloader upload (binary file with header) \n"
+    "  cexe Compressed executable for bootloader upload (LZ4, binary file with header)\n"
     "  vhd  VHDL memory image (raw executable)\n"
     "  hex  ASCII hex file (raw executable)\n"
     "  bin  Binary file (raw executable)\n"
@@ -51,6 +63,149 @@ void print_help(void){
   );
 }
 
+// write 32-bit little-endian word
+void put_word(FILE *output, uint32_t data) {
+  fputc((unsigned char)((data >>  0) & 0xFF), output);
+  fputc((unsigned char)((data >>  8) & 0xFF), output);
+  fputc((unsigned char)((data >> 16) & 0xFF), output);
+  fputc((unsigned char)((data >> 24) & 0xFF), output);
+}
+
+// LZ4: hash of the 4 bytes at p
+unsigned int lz4_hash(const unsigned char *p) {
+  uint32_t tmp = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+  return (unsigned int)((tmp * 2654435761U) >> (32 - LZ4_HASH_BITS));
+}
+
+// LZ4: emit length extension bytes
+unsigned char *lz4_put_len(unsigned char *op, unsigned int len) {
+  len -= 15;
+  while (len >= 255) {
+    *op++ = 255;
+    len -= 255;
+  }
+  *op++ = (unsigned char)len;
+  return op;
+}
+
+// LZ4: emit one sequence (literals plus optional match; match_len = 0 for the last sequence)
+unsigned char *lz4_put_seq(unsigned char *op, const unsigned char *lit, unsigned int lit_len, unsigned int offset, unsigned int match_len) {
+  unsigned char *token = op++;
+  *token = (unsigned char)(((lit_len < 15) ? lit_len : 15) << 4);
+  if (lit_len >= 15) {
+    op = lz4_put_len(op, lit_len);
+  }
+  memcpy(op, lit, lit_len);
+  op += lit_len;
+  if (match_len) {
+    *op++ = (unsigned char)(offset & 0xFF);
+    *op++ = (unsigned char)(offset >> 8);
+    match_len -= LZ4_MIN_MATCH;
+    *token |= (unsigned char)((match_len < 15) ? match_len : 15);
+    if (match_len >= 15) {
+      op = lz4_put_len(op, match_len);
+    }
+  }
+  return op;
+}
+
+// LZ4 match finder state
+typedef struct {
+  const unsigned char *src; // uncompressed data
+  unsigned int size;        // uncompressed size
+  unsigned int inserted;    // all positions below this are in the hash chains
+  int *head;                // most recent position per hash value
+  int *prev;                // previous position with the same hash value
+} lz4_ctx_t;
+
+// LZ4: find longest match for position pos; returns match length, sets offset
+unsigned int lz4_find(lz4_ctx_t *ctx, unsigned int pos, unsigned int *offset) {
+
+  const unsigned char *src = ctx->src;
+  unsigned int best_len = 0, chain = 0, len = 0;
+  unsigned int max_len = ctx->size - LZ4_LAST_LITERAL - pos;
+  unsigned int h;
+
+  // update hash chains
+  while (ctx->inserted < pos) {
+    h = lz4_hash(&src[ctx->inserted]);
+    ctx->prev[ctx->inserted] = ctx->head[h];
+    ctx->head[h] = (int)ctx->inserted;
+    ctx->inserted++;
+  }
+
+  if (max_len > LZ4_MAX_MATCH) {
+    max_len = LZ4_MAX_MATCH;
+  }
+
+  // check candidates
+  int cand = ctx->head[lz4_hash(&src[pos])];
+  while ((cand >= 0) && ((pos - (unsigned int)cand) <= LZ4_MAX_OFFSET) && (chain++ < LZ4_MAX_CHAIN)) {
+    len = 0;
+    while ((len < max_len) && (src[(unsigned int)cand + len] == src[pos + len])) {
+      len++;
+    }
+    if (len > best_len) {
+      best_len = len;
+      *offset = pos - (unsigned int)cand;
+    }
+    cand = ctx->prev[cand];
+  }
+  return best_len;
+}
+
+// LZ4 block compression (hash chains, greedy parsing with one step of lazy evaluation);
+// dst has to provide at least size + size/255 + 16 bytes; returns compressed size (0 if error)
+unsigned int lz4_compress(const unsigned char *src, unsigned int size, unsigned char *dst) {
+
+  lz4_ctx_t ctx;
+  unsigned char *op = dst;
+  unsigned int ip = 0, anchor = 0, i = 0;
+  unsigned int len = 0, off = 0, len2 = 0, off2 = 0;
+  unsigned int match_limit = (size > LZ4_MF_LIMIT) ? (size - LZ4_MF_LIMIT) : 0;
+
+  ctx.src = src;
+  ctx.size = size;
+  ctx.inserted = 0;
+  ctx.head = malloc(sizeof(int) << LZ4_HASH_BITS);
+  ctx.prev = malloc(sizeof(int) * (size + 1));
+  if ((ctx.head == NULL) || (ctx.prev == NULL)) {
+    free(ctx.head);
+    free(ctx.prev);
+    return 0;
+  }
+  for (i = 0; i < (1U << LZ4_HASH_BITS); i++) {
+    ctx.head[i] = -1;
+  }
+
+  while (ip < match_limit) {
+    len = lz4_find(&ctx, ip, &off);
+    if (len < LZ4_MIN_MATCH) {
+      ip++;
+      continue;
+    }
+    // lazy evaluation: prefer a longer match starting at the next byte
+    if ((ip + 1) < match_limit) {
+      len2 = lz4_find(&ctx, ip + 1, &off2);
+      if (len2 > (len + 1)) {
+        ip++;
+        len = len2;
+        off = off2;
+      }
+    }
+    op = lz4_put_seq(op, &src[anchor], ip - anchor, off, len);
+    ip += len;
+    anchor = ip;
+  }
+
+  // last sequence: literals only
+  op = lz4_put_seq(op, &src[anchor], size - anchor, 0, 0);
+
+  free(ctx.head);
+  free(ctx.prev);
+  return (unsigned int)(op - dst);
+}
+
 int main(int argc, char *argv[]) {
 
   FILE *input = NULL, *output = NULL;
@@ -84,6 +239,7 @@ int main(int argc, char *argv[]) {
     else if (strcmp(argv[i], "-t") == 0) {
       i++;
       if      (strcmp(argv[i], "exe") == 0) { operation = OP_EXE; }
+      else if (strcmp(argv[i], "cexe") == 0) { operation = OP_CEXE; }
       else if (strcmp(argv[i], "vhd") == 0) { operation = OP_VHD; }
       else if (strcmp(argv[i], "hex") == 0) { operation = OP_HEX; }
       else if (strcmp(argv[i], "bin") == 0) { operation = OP_BIN; }
@@ -176,6 +332,63 @@ int main(int argc, char *argv[]) {
     fputc((unsigned char)((checksum >> 24) & 0xFF), output);
   }
 
+  // --------------------------------------------------------------------------
+  // compressed executable for bootloader upload (including header)
+  // --------------------------------------------------------------------------
+  else if (operation == OP_CEXE) {
+
+    // read input image; pad to a multiple of 4 bytes
+    unsigned int raw_size = (raw_exe_size + 3) & ~3U;
+    if (raw_size == 0) { // padding wrapped around (empty input is rejected above)
+      printf("[ERROR] Input file too large (%s)!\n", input_file);
+      fclose(input);
+      fclose(output);
+      return -2;
+    }
+    unsigned char *raw = calloc(raw_size, 1);
+    unsigned char *comp = malloc(raw_size + (raw_size / 255) + 16);
+    if ((raw == NULL) || (comp == NULL) || (fread(raw, 1, raw_exe_size, input) != raw_exe_size)) {
+      printf("[ERROR] Input file error (%s)!\n", input_file);
+      free(raw);
+      free(comp);
+      fclose(input);
+      fclose(output);
+      return -2;
+    }
+
+    // checksum over the uncompressed image
+    checksum = 0;
+    for (i=0; i<raw_size; i+=4) {
+      checksum += (uint32_t)raw[i+0] | ((uint32_t)raw[i+1] << 8) | ((uint32_t)raw[i+2] << 16) | ((uint32_t)raw[i+3] << 24);
+    }
+
+    unsigned int comp_size = lz4_compress(raw, raw_size, comp);
+    if (comp_size == 0) {
+      printf("[ERROR] Compression failed!\n");
+      free(raw);
+      free(comp);
+      fclose(input);
+      fclose(output);
+      return -2;
+    }
+
+    // header: signature, uncompressed size, checksum (sum complement)
+    put_word(output, signature_lz4);
+    put_word(output, (uint32_t)raw_size);
+    put_word(output, ~checksum);
+
+    // compressed data, padded to a multiple of 4 bytes
+    fwrite(comp, 1, comp_size, output);
+    while (comp_size % 4) {
+      fputc(0, output);
+      comp_size++;
+    }
+    printf("Compressed %u bytes to %u bytes (%u%%)\n", raw_size, comp_size, (unsigned int)(((unsigned long long)comp_size * 100) / raw_size));
+
+    free(raw);
+    free(comp);
+  }
+
   // --------------------------------------------------------------------------
   // VHDL memory image (package name = output file name)
   // --------------------------------------------------------------------------
@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+
+# ================================================================================ #
+# The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              #
+# Copyright (c) NEORV32 contributors.                                              #
+# Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  #
+# Licensed under the BSD-3-Clause license, see LICENSE for details.                #
+# SPDX-License-Identifier: BSD-3-Clause                                            #
+# ================================================================================ #
+
+# Host decoder for the NEORV32 binary deferred logging (neorv32_log.h). Reads the
+# format strings from the application's ELF file (".neorv32_log" section) and
+# reconstructs the log messages from the binary record stream (file or serial port).
+#
+# Record (32-bit little-endian words): [header][mcycle(31:0)][argument 0]...[argument n-1]
+# header: [31:12] format string ID, [11:8] n, [7:6] level, [5:4] hart, [3:0] sync (0xA)
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC = 0xA
+ID_START = 0xFFFFE
+ID_DROPPED = 0xFFFFF
+LEVELS = ["ERROR", "WARN ", "INFO ", "DEBUG"]
+
+SPEC = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|z|j|t)?([diuxXobpcsfF%])")
+
+
+class Elf:
+    """Minimal ELF reader: section contents by name and by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF":
+            sys.exit(f"ERROR! {path} is not an ELF file.")
+        is64 = self.data[4] == 2
+        endian = "<" if self.data[5] == 1 else ">"
+        self.endian = endian
+        if is64:
+            shoff, = struct.unpack_from(endian + "Q", self.data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", self.data, 0x3A)
+            shfmt = endian + "IIQQQQ"
+        else:
+            shoff, = struct.unpack_from(endian + "I", self.data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", self.data, 0x2E)
+            shfmt = endian + "IIIIII"
+        hdrs = [struct.unpack_from(shfmt, self.data, shoff + i * shentsize) for i in range(shnum)]
+        strtab = hdrs[shstrndx]
+        self.sections = []  # (name, type, flags, addr, content)
+        for name, stype, flags, addr, offset, size in hdrs:
+            end = self.data.index(b"\0", strtab[4] + name)
+            sname = self.data[strtab[4] + name:end].decode()
+            content = self.data[offset:offset + size] if stype != 8 else b""  # SHT_NOBITS
+            self.sections.append((sname, stype, flags, addr, content))
+
+    def section(self, name):
+        for sname, _, _, addr, content in self.sections:
+            if sname == name:
+                return addr, content
+        return None, None
+
+    def symbols(self, code_only=False):
+        """Symbol table (32-bit ELF): list of (address, size, type, name); optionally code sections only."""
+        _, symtab = self.section(".symtab")
+        _, strtab = self.section(".strtab")
+        syms = []
+        if not symtab or not strtab:
+            return syms
+        for offs in range(0, len(symtab) - 15, 16):
+            name, value, size, info, _, shndx = struct.unpack_from(self.endian + "IIIBBH", symtab, offs)
+            if name == 0 or shndx == 0 or shndx >= len(self.sections):  # unnamed, undefined, absolute/common
+                continue
+            if code_only and not (self.sections[shndx][2] & 4):  # SHF_EXECINSTR
+                continue
+            end = strtab.index(b"\0", name)
+            syms.append((value, size, info & 0xF, strtab[name:end].decode(errors="replace")))
+        return syms
+
+    def string(self, addr):
+        """Zero-terminated string from an allocated section."""
+        for _, stype, flags, base, content in self.sections:
+            if (flags & 2) and stype == 1 and base <= addr < base + len(content):
+                end = content.find(b"\0", addr - base)
+                return content[addr - base:end if end >= 0 else None].decode(errors="replace")
+        return f"<0x{addr:08x}>"
+
+
+def pad(prefix, digits, zeros, flags, width):
+    """Assemble number with sign/prefix, precision zeros and field padding (like the HAL engine)."""
+    n = width - (len(prefix) + zeros + len(digits))
+    if "0" in flags and "-" not in flags:
+        zeros += max(n, 0)
+        n = 0
+    s = prefix + "0" * zeros + digits
+    return s + " " * n if "-" in flags else " " * n + s
+
+
+def format_message(fmt, args, elf):
+    """Render C format string with raw 32-bit argument words."""
+    out = []
+    pos = 0
+    args = list(args)
+
+    def word():
+        return args.pop(0) if args else 0
+
+    for m in SPEC.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, prec, lmod, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            continue
+        if width == "*":
+            width = struct.unpack("<i", struct.pack("<I", word()))[0]
+            if width < 0:
+                flags += "-"
+                width = -width
+        width = int(width) if width else 0
+        if prec == "*":
+            prec = struct.unpack("<i", struct.pack("<I", word()))[0]
+            prec = None if prec < 0 else prec
+        elif prec is not None:
+            prec = int(prec) if prec else 0
+        is64 = lmod in ("ll", "j")
+
+        if conv in "sc":
+            s = elf.string(word()) if conv == "s" else chr(word() & 0xFF)
+            if conv == "s" and prec is not None:
+                s = s[:prec]
+            out.append(pad("", s, 0, flags.replace("0", ""), width))
+            continue
+
+        if conv in "fF":
+            val = struct.unpack("<f", struct.pack("<I", word()))[0]
+            spec = "%" + flags + (str(width) if width else "") + "." + str(6 if prec is None else prec) + conv
+            out.append(spec % val)
+            continue
+
+        val = word()
+        if is64:
+            val |= word() << 32
+        bits = 64 if is64 else 32
+        if lmod == "h":
+            bits = 16
+        elif lmod == "hh":
+            bits = 8
+        val &= (1 << bits) - 1
+
+        prefix = ""
+        if conv in "di":
+            if val >> (bits - 1):
+                val -= 1 << bits
+            prefix = "-" if val < 0 else ("+" if "+" in flags else (" " if " " in flags else ""))
+            val = abs(val)
+        if conv in "xXp" and not (flags or width or prec is not None):
+            prec = 16 if is64 else 8  # legacy: all hex digits
+        digits = {"o": "%o", "b": "{:b}", "x": "%x", "p": "%x", "X": "%X"}.get(conv, "%d")
+        digits = digits.format(val) if conv == "b" else digits % val
+        if prec == 0 and val == 0:
+            digits = ""
+        if "#" in flags and val:
+            if conv in "xX":
+                prefix = "0" + conv
+            elif conv == "b":
+                prefix = "0b"
+            elif conv == "o" and (prec is None or prec <= len(digits)):
+                prec = len(digits) + 1
+        if prec is not None:
+            flags = flags.replace("0", "")
+        zeros = max(prec - len(digits), 0) if prec is not None else 0
+        out.append(pad(prefix, digits, zeros, flags, width))
+
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+class Decoder:
+    def __init__(self, elf, clock):
+        self.elf = elf
+        base, self.strings = elf.section(".neorv32_log")
+        if self.strings is None:
+            sys.exit("ERROR! No .neorv32_log section in ELF file (no log messages or old linker script?).")
+        self.clock = clock
+        self.time = {}  # per-hart 64-bit timestamp
+        self.buf = b""
+        self.sync = True
+
+    def valid(self, hdr):
+        ident = hdr >> 12
+        return (hdr & 0xF) == SYNC and (ident < len(self.strings) or ident in (ID_START, ID_DROPPED))
+
+    def record(self, hdr, cycle, args):
+        ident, nargs = hdr >> 12, (hdr >> 8) & 0xF
+        level, hart = (hdr >> 6) & 3, (hdr >> 4) & 3
+        if ident == ID_START:
+            self.clock = self.clock or args[0]
+            self.time = {}
+            msg = f"--- log start (clock {args[0]} Hz) ---"
+        elif ident == ID_DROPPED:
+            msg = f"--- {args[0]} record(s) dropped ---"
+        else:
+            end = self.strings.find(b"\0", ident)
+            msg = format_message(self.strings[ident:end].decode(errors="replace"), args, self.elf)
+        last = self.time.get(hart, cycle)
+        now = last + ((cycle - last) & 0xFFFFFFFF)
+        self.time[hart] = now
+        stamp = f"{now / self.clock:14.6f}" if self.clock else f"{now:14d}"
+        return f"[{stamp}] hart{hart} {LEVELS[level]} {msg}"
+
+    def feed(self, data):
+        """Decode new input data; returns list of decoded lines."""
+        self.buf += data
+        lines = []
+        while len(self.buf) >= 8:
+            hdr, cycle = struct.unpack_from("<II", self.buf)
+            if not self.valid(hdr):
+                if self.sync:
+                    lines.append("--- lost synchronization ---")
+                    self.sync = False
+                self.buf = self.buf[1:]
+                continue
+            nargs = (hdr >> 8) & 0xF
+            size = 8 + 4 * nargs
+            if len(self.buf) < size:
+                break
+            args = struct.unpack_from(f"<{nargs}I", self.buf, 8)
+            self.buf = self.buf[size:]
+            self.sync = True
+            lines.append(self.record(hdr, cycle, args))
+        return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode NEORV32 binary deferred log records.")
+    parser.add_argument("elf", help="application ELF file (main.elf)")
+    parser.add_argument("input", help="binary log file (e.g. neorv32_log.bin) or serial port")
+    parser.add_argument("-b", "--baud", type=int, default=0,
+                        help="read from serial port with this baud rate (requires pyserial)")
+    parser.add_argument("-c", "--clock", type=int, default=0,
+                        help="processor clock in Hz (default: from log start record)")
+    args = parser.parse_args()
+
+    dec = Decoder(Elf(args.elf), args.clock)
+
+    if args.baud:
+        try:
+            import serial
+        except ImportError:
+            sys.exit("ERROR! Serial input requires pyserial (pip install pyserial).")
+        port = serial.Serial(args.input, args.baud, timeout=0.1)
+        try:
+            while True:
+                for line in dec.feed(port.read(4096)):
+                    print(line, flush=True)
+        except KeyboardInterrupt:
+            pass
+        port.close()
+    else:
+        with open(args.input, "rb") as f:
+            for line in dec.feed(f.read()):
+                print(line)
+
+
+if __name__ == "__main__":
+    main()
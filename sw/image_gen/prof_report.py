@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+
+# ================================================================================ #
+# The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              #
+# Copyright (c) NEORV32 contributors.                                              #
+# Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  #
+# Licensed under the BSD-3-Clause license, see LICENSE for details.                #
+# SPDX-License-Identifier: BSD-3-Clause                                            #
+# ================================================================================ #
+
+# Host report generator for the NEORV32 sampling profiler (neorv32_prof.h). Reads the
+# PC histogram dump from a console log (file or serial port), maps the histogram
+# buckets to functions using the application's ELF symbol table and prints a flat
+# profile or folded stacks ("function count") for flame graph tools.
+#
+# Dump format (text lines, can be embedded in other console output):
+#   neorv32_prof begin <base> <bucket size> <rate> <samples> <outside> [<event> <period>]
+#   neorv32_prof <bucket address> <count>
+#   neorv32_prof end
+
+import argparse
+import bisect
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from log_decode import Elf  # noqa: E402
+
+BEGIN = re.compile(r"neorv32_prof begin (0x[0-9a-fA-F]+) (\d+) (\d+) (\d+) (\d+)(?: (\d+) (\d+))?")
+BUCKET = re.compile(r"neorv32_prof (0x[0-9a-fA-F]+) (\d+)")
+END = re.compile(r"neorv32_prof end")
+
+# HPM event names (NEORV32_HPMCNT_EVENT_enum)
+EVENTS = {0: "CY", 2: "IR", 3: "COMPR", 4: "WAIT_DIS", 5: "WAIT_ALU", 6: "BRANCH", 7: "CTRLFLOW", 8: "LOAD",
+          9: "STORE", 10: "WAIT_LSU", 11: "TRAP", 12: "IRQ", 13: "WAIT_RST", 14: "IC_HIT", 15: "IC_MISS",
+          16: "DC_HIT", 17: "DC_MISS", 18: "WAIT_BUS", 19: "DMA"}
+
+STT_NOTYPE = 0
+STT_FUNC = 2
+
+
+class Dump:
+    """Parser for the histogram dump; keeps the last complete dump."""
+
+    def __init__(self):
+        self.header = None
+        self.buckets = None
+        self.complete = None  # (header, buckets)
+
+    def feed(self, line):
+        m = BEGIN.search(line)
+        if m:
+            self.header = [int(m.group(1), 16)] + [int(x) if x else None for x in m.groups()[1:]]
+            self.buckets = {}
+            return False
+        if self.buckets is None:
+            return False
+        if END.search(line):
+            self.complete = (self.header, self.buckets)
+            self.buckets = None
+            return True
+        m = BUCKET.search(line)
+        if m:
+            self.buckets[int(m.group(1), 16)] = int(m.group(2))
+        return False
+
+
+class Symbols:
+    """Address to function mapping."""
+
+    def __init__(self, elf):
+        syms = [s for s in elf.symbols(code_only=True) if s[2] in (STT_NOTYPE, STT_FUNC)
+                and not s[3].startswith((".L", "$"))]
+        self.funcs = sorted((a, sz, n) for a, sz, t, n in syms if t == STT_FUNC and sz)
+        self.func_addr = [f[0] for f in self.funcs]
+        self.labels = sorted((a, n) for a, _, _, n in syms)
+        self.label_addr = [lbl[0] for lbl in self.labels]
+
+    def lookup(self, addr):
+        # function that contains the address
+        i = bisect.bisect_right(self.func_addr, addr) - 1
+        if i >= 0 and addr < self.funcs[i][0] + self.funcs[i][1]:
+            return self.funcs[i][2]
+        # closest preceding code label (assembly code without size information)
+        i = bisect.bisect_right(self.label_addr, addr) - 1
+        if i >= 0:
+            return self.labels[i][1]
+        return f"<0x{addr:08x}>"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Evaluate a NEORV32 sampling profiler (neorv32_prof) dump.")
+    parser.add_argument("elf", help="application ELF file (main.elf)")
+    parser.add_argument("input", help="console log file containing the dump or serial port")
+    parser.add_argument("-b", "--baud", type=int, default=0,
+                        help="read from serial port with this baud rate until the end of a dump (requires pyserial)")
+    parser.add_argument("-f", "--folded", action="store_true",
+                        help="print folded stacks (flamegraph.pl / speedscope input) instead of the flat profile")
+    parser.add_argument("-a", "--addr", action="store_true", help="also list the histogram buckets of each function")
+    parser.add_argument("-n", "--top", type=int, default=0, help="show only the N hottest functions")
+    args = parser.parse_args()
+
+    dump = Dump()
+    if args.baud:
+        try:
+            import serial
+        except ImportError:
+            sys.exit("ERROR! Serial input requires pyserial (pip install pyserial).")
+        with serial.Serial(args.input, args.baud, timeout=1) as port:
+            try:
+                while not dump.feed(port.readline().decode(errors="replace")):
+                    pass
+            except KeyboardInterrupt:
+                pass
+    else:
+        with open(args.input, errors="replace") as f:
+            for line in f:
+                dump.feed(line)
+    if dump.complete is None:
+        sys.exit("ERROR! No complete profiler dump found in input.")
+
+    (base, bsize, rate, samples, outside, event, period), buckets = dump.complete
+    syms = Symbols(Elf(args.elf))
+
+    funcs = {}  # name: [samples, {bucket: count}]
+    for addr, cnt in buckets.items():
+        entry = funcs.setdefault(syms.lookup(addr), [0, {}])
+        entry[0] += cnt
+        entry[1][addr] = cnt
+    ranking = sorted(funcs.items(), key=lambda f: (-f[1][0], f[0]))
+    if args.top:
+        ranking = ranking[:args.top]
+
+    if args.folded:
+        for name, (cnt, _) in ranking:
+            print(f"{name} {cnt}")
+        return 0
+
+    total = sum(buckets.values())
+    if not total:
+        sys.exit("ERROR! Dump does not contain any samples in the profiled range.")
+    if event is not None:
+        source = f"every {period} events (HPM event {EVENTS.get(event, event)})"
+    else:
+        source = f"at {rate} Hz" + (f", {samples / rate:.3f} s" if rate else "")
+    print(f"{samples} samples {source}; bucket size {bsize} bytes, base 0x{base:08x}; "
+          f"{outside} outside of profiled range, {samples - outside - total} lost (saturated)")
+    print()
+    print(f"{'%':>7s} {'cumul.%':>7s} {'samples':>9s}  function")
+    cumul = 0
+    for name, (cnt, addrs) in ranking:
+        cumul += cnt
+        print(f"{100.0 * cnt / total:7.2f} {100.0 * cumul / total:7.2f} {cnt:9d}  {name}")
+        if args.addr:
+            for addr in sorted(addrs):
+                print(f"{'':26s}0x{addr:08x} {addrs[addr]:9d}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
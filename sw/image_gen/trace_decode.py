@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+
+# ================================================================================ #
+# The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              #
+# Copyright (c) NEORV32 contributors.                                              #
+# Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  #
+# Licensed under the BSD-3-Clause license, see LICENSE for details.                #
+# SPDX-License-Identifier: BSD-3-Clause                                            #
+# ================================================================================ #
+
+# Host decoder for the NEORV32 tracer's compressed trace mode (neorv32_tracer.h).
+# Reconstructs the complete instruction flow from the compressed trace stream using
+# the application's ELF file and prints per-function instruction counts or the full
+# instruction listing.
+#
+# Input: console log (file or serial port) with the trace stream dump
+#   neorv32_trace begin
+#   neorv32_trace <low word> <high word>
+#   neorv32_trace end
+# or a raw little-endian memory dump of the trace buffer (-r), e.g. from GDB:
+#   (gdb) dump binary memory trace.bin buffer buffer+sizeof(buffer)
+#
+# The reconstructed instruction flow can be compared against the simulation's full
+# CPU trace log (-c sim/neorv32.tracer0.log) to verify the encoder end-to-end.
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from log_decode import Elf  # noqa: E402
+from prof_report import Symbols  # noqa: E402
+
+BEGIN = re.compile(r"neorv32_trace begin")
+PACKET = re.compile(r"neorv32_trace ([0-9a-fA-F]+) ([0-9a-fA-F]+)")
+END = re.compile(r"neorv32_trace end")
+
+# packet types (NEORV32_TRACER_PKT_enum) and address kinds (NEORV32_TRACER_ADDR_enum)
+PKT_BRANCH = 1
+PKT_ADDR = 2
+ADDR_JUMP = 0
+ADDR_TRAP = 1
+ADDR_SYNC = 2
+ADDR_STOP = 3
+
+SHF_EXECINSTR = 4
+
+
+class Dump:
+    """Parser for the console dump; keeps the last complete dump."""
+
+    def __init__(self):
+        self.packets = None
+        self.complete = None
+
+    def feed(self, line):
+        if BEGIN.search(line):
+            self.packets = []
+            return False
+        if self.packets is None:
+            return False
+        if END.search(line):
+            self.complete = self.packets
+            self.packets = None
+            return True
+        m = PACKET.search(line)
+        if m:
+            self.packets.append((int(m.group(1), 16), int(m.group(2), 16)))
+        return False
+
+
+class Code:
+    """Instruction memory image from the executable ELF sections."""
+
+    def __init__(self, elf):
+        self.sections = [(addr, content) for _, _, flags, addr, content in elf.sections
+                         if (flags & SHF_EXECINSTR) and content]
+
+    def half(self, addr):
+        for base, content in self.sections:
+            if base <= addr and addr + 2 <= base + len(content):
+                return struct.unpack_from("<H", content, addr - base)[0]
+        return None
+
+    def decode(self, pc):
+        """Decode instruction at pc: (length, conditional branch target or None, jal target or None)."""
+        lo = self.half(pc)
+        if lo is None:
+            return None
+        if (lo & 3) != 3:  # compressed
+            if (lo & 3) == 1 and (lo >> 13) in (1, 5):  # c.jal, c.j
+                imm = (((lo >> 12) & 1) << 11 | ((lo >> 11) & 1) << 4 | ((lo >> 9) & 3) << 8 | ((lo >> 8) & 1) << 10 |
+                       ((lo >> 7) & 1) << 6 | ((lo >> 6) & 1) << 7 | ((lo >> 3) & 7) << 1 | ((lo >> 2) & 1) << 5)
+                return 2, None, (pc + sext(imm, 12)) & 0xFFFFFFFF
+            if (lo & 3) == 1 and (lo >> 13) in (6, 7):  # c.beqz, c.bnez
+                imm = (((lo >> 12) & 1) << 8 | ((lo >> 10) & 3) << 3 | ((lo >> 5) & 3) << 6 |
+                       ((lo >> 3) & 3) << 1 | ((lo >> 2) & 1) << 5)
+                return 2, (pc + sext(imm, 9)) & 0xFFFFFFFF, None
+            return 2, None, None
+        hi = self.half(pc + 2)
+        if hi is None:
+            return None
+        insn = hi << 16 | lo
+        opcode = insn & 0x7F
+        if opcode == 0b1100011:  # branch
+            imm = ((insn >> 31) & 1) << 12 | ((insn >> 25) & 0x3F) << 5 | ((insn >> 8) & 0xF) << 1 | ((insn >> 7) & 1) << 11
+            return 4, (pc + sext(imm, 13)) & 0xFFFFFFFF, None
+        if opcode == 0b1101111:  # jal
+            imm = (((insn >> 31) & 1) << 20 | ((insn >> 21) & 0x3FF) << 1 | ((insn >> 20) & 1) << 11 |
+                   ((insn >> 12) & 0xFF) << 12)
+            return 4, None, (pc + sext(imm, 21)) & 0xFFFFFFFF
+        return 4, None, None
+
+
+def sext(value, bits):
+    return value - (1 << bits) if value & (1 << (bits - 1)) else value
+
+
+class Decoder:
+    """Reconstruct the instruction flow; calls emit(pc, marker) for each executed instruction."""
+
+    def __init__(self, code, emit):
+        self.code = code
+        self.emit = emit
+        self.executed = 0
+        self.gaps = 0
+
+    def run(self, packets):
+        # split into epochs at trace start and resynchronization points; within an epoch
+        # branch maps and address packets are two independent in-order streams
+        epochs = []
+        for w0, w1 in packets:
+            kind = (w0 >> 2) & 3
+            if (w0 & 3) == PKT_ADDR and ((w0 >> 4) & 1 or (kind == ADDR_SYNC and (w0 >> 5) == 0)):
+                epochs.append(([], [(ADDR_SYNC, 0, w1)]))
+            elif not epochs:
+                continue  # no start point yet
+            elif (w0 & 3) == PKT_BRANCH:
+                cnt = (w0 >> 2) & 0x3F
+                bits = (w1 << 24 | w0 >> 8) & ((1 << 56) - 1)
+                epochs[-1][0].extend((bits >> i) & 1 for i in range(cnt))
+            elif (w0 & 3) == PKT_ADDR:
+                epochs[-1][1].append((kind, w0 >> 5, w1))
+        self.gaps = max(len(epochs) - 1, 0)
+        for i, (bits, addrs) in enumerate(epochs):
+            if i:
+                self.emit(None, "<TRACE DATA LOST>")
+            if not self.epoch(bits, addrs) and i == len(epochs) - 1:
+                print("WARNING! Incomplete trace (no stop packet).", file=sys.stderr)
+
+    def epoch(self, bits, addrs):
+        """Decode one epoch; returns False if the epoch ends without stop packet."""
+        bit = iter(bits)
+        pc = addrs[0][2]
+        marker = "<TRACE START>"
+        for kind, icnt, addr in addrs[1:]:
+            last = pc
+            for _ in range(icnt):
+                insn = self.code.decode(pc)
+                if insn is None:
+                    sys.exit(f"ERROR! Trace leaves the ELF code sections at 0x{pc:08x}.")
+                self.emit(pc, marker)
+                marker = None
+                self.executed += 1
+                last = pc
+                size, btarget, jtarget = insn
+                if btarget is not None:
+                    taken = next(bit, None)
+                    if taken is None:  # branch map got lost before the next resync
+                        return False
+                    pc = btarget if taken else pc + size
+                elif jtarget is not None:
+                    pc = jtarget
+                else:
+                    pc += size
+            if kind == ADDR_STOP:
+                if icnt and last != addr:
+                    print(f"WARNING! Trace ends at 0x{last:08x}, expected 0x{addr:08x}.", file=sys.stderr)
+                self.emit(None, "<TRACE STOP>")
+                return True
+            pc = addr
+            marker = "<TRAP ENTRY>" if kind == ADDR_TRAP else None
+        return False
+
+
+def check(flow, log):
+    """Check that the reconstructed flow (None = gap) appears in order in a simulation trace log."""
+    with open(log) as f:
+        trace = [int(line.split()[2], 16) for line in f if line.strip()]
+    segments = [[]]
+    for pc in flow:
+        if pc is None:
+            segments.append([])
+        else:
+            segments[-1].append(pc)
+    pos = 0
+    for seg in (s for s in segments if s):
+        while pos < len(trace) and (trace[pos] != seg[0] or trace[pos:pos + len(seg)] != seg):
+            pos += 1
+        if pos >= len(trace):
+            return f"Reconstructed flow starting at 0x{seg[0]:08x} not found in {log}."
+        pos += len(seg)
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode a NEORV32 compressed execution trace (neorv32_tracer).")
+    parser.add_argument("elf", help="application ELF file (main.elf)")
+    parser.add_argument("input", help="console log file containing the trace dump, raw trace buffer (-r) or serial port")
+    parser.add_argument("-r", "--raw", action="store_true", help="input is a raw little-endian trace buffer dump")
+    parser.add_argument("-b", "--baud", type=int, default=0,
+                        help="read from serial port with this baud rate until the end of a dump (requires pyserial)")
+    parser.add_argument("-l", "--listing", action="store_true", help="print the complete instruction flow")
+    parser.add_argument("-n", "--top", type=int, default=0, help="show only the N most executed functions")
+    parser.add_argument("-c", "--check", metavar="SIMLOG",
+                        help="compare the reconstructed flow against a simulation trace log (neorv32.tracerN.log)")
+    args = parser.parse_args()
+
+    if args.raw:
+        with open(args.input, "rb") as f:
+            data = f.read()
+        words = struct.unpack(f"<{len(data) // 4}I", data[:len(data) & ~3])
+        packets = [(words[i], words[i + 1]) for i in range(0, len(words) - 1, 2) if words[i] or words[i + 1]]
+    else:
+        dump = Dump()
+        if args.baud:
+            try:
+                import serial
+            except ImportError:
+                sys.exit("ERROR! Serial input requires pyserial (pip install pyserial).")
+            with serial.Serial(args.input, args.baud, timeout=1) as port:
+                try:
+                    while not dump.feed(port.readline().decode(errors="replace")):
+                        pass
+                except KeyboardInterrupt:
+                    pass
+        else:
+            with open(args.input, errors="replace") as f:
+                for line in f:
+                    dump.feed(line)
+        if dump.complete is None:
+            sys.exit("ERROR! No complete trace dump found in input.")
+        packets = dump.complete
+
+    elf = Elf(args.elf)
+    syms = Symbols(elf)
+    funcs = {}
+    flow = []
+
+    def emit(pc, marker):
+        if args.check and (pc is not None or marker == "<TRACE DATA LOST>"):
+            flow.append(pc)
+        if pc is None:
+            if args.listing:
+                print(marker)
+            return
+        name = syms.lookup(pc)
+        funcs[name] = funcs.get(name, 0) + 1
+        if args.listing:
+            print(f"0x{pc:08x}  {name}" + (f"  {marker}" if marker else ""))
+
+    dec = Decoder(Code(elf), emit)
+    dec.run(packets)
+    if not dec.executed:
+        sys.exit("ERROR! Trace does not contain any instructions (missing start packet?).")
+    if args.check:
+        error = check(flow, args.check)
+        if error:
+            sys.exit(f"ERROR! {error}")
+        print(f"Reconstructed instruction flow matches {args.check}.", file=sys.stderr)
+    if args.listing:
+        return 0
+
+    print(f"{dec.executed} instructions reconstructed from {len(packets)} packets "
+          f"({8.0 * len(packets) / dec.executed:.3f} bytes/instruction); {dec.gaps} gap(s) due to lost trace data")
+    print()
+    print(f"{'%':>7s} {'instr.':>10s}  function")
+    ranking = sorted(funcs.items(), key=lambda f: (-f[1], f[0]))
+    if args.top:
+        ranking = ranking[:args.top]
+    for name, cnt in ranking:
+        print(f"{100.0 * cnt / dec.executed:7.2f} {cnt:10d}  {name}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+
+# ================================================================================ #
+# The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              #
+# Copyright (c) NEORV32 contributors.                                              #
+# Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  #
+# Licensed under the BSD-3-Clause license, see LICENSE for details.                #
+# SPDX-License-Identifier: BSD-3-Clause                                            #
+# ================================================================================ #
+
+# High-speed upload of an executable (plain or compressed) to the NEORV32 bootloader
+# using the block upload protocol (bootloader console command 'b'). Requires pyserial.
+#
+# Frame (host -> bootloader), all multi-byte fields are little-endian:
+# [SOH][type:8][length:16][argument:32][CRC32(type..argument):32][data:length][CRC32(data):32]
+# Each frame is answered by ACK or NAK; corrupted or lost frames are repeated.
+
+import argparse
+import struct
+import sys
+import time
+import zlib
+
+try:
+    import serial
+except ImportError:
+    sys.exit("ERROR! This script requires pyserial (pip install pyserial).")
+
+SOH, ACK, NAK = 0x01, 0x06, 0x15
+CMD_PING, CMD_BAUD, CMD_WRITE, CMD_DONE = b"P", b"B", b"W", b"D"
+BLOCK_SIZE = 1024
+RETRIES = 16
+
+SIGNATURE = 0xB007C0DE
+SIGNATURE_LZ4 = 0xB007C0DF
+
+# candidate baud rates (fastest first)
+BAUD_RATES = [4000000, 3000000, 2000000, 1500000, 1000000, 921600, 500000,
+              460800, 230400, 115200, 57600, 38400, 19200]
+
+
+def uart_baud_error(clk, baud):
+    """Relative error of the NEORV32 UART fractional baud rate generator as configured
+    by the bootloader (16x oversampling, divider with 4 fractional bits)."""
+    div = (clk + baud // 2) // baud  # clock cycles per sample * 16
+    if div < 16:
+        return 1.0
+    return abs(clk / div - baud) / baud
+
+
+def lz4_load_offset(image):
+    """Smallest memory offset for a compressed image so that in-place decompression
+    never overwrites input data that has not been read yet (the bootloader fetches
+    the input stream in 32-bit words)."""
+    data = image[12:]
+    size = struct.unpack("<I", image[4:8])[0]
+    ip, op, gap = 0, 0, 0
+
+    def check():  # before writing output byte 'op' the next unread input word must be above it
+        nonlocal gap
+        gap = max(gap, op - (12 + (ip & ~3)) + 1)
+
+    def get_len(n):
+        nonlocal ip
+        if n == 15:
+            while True:
+                b = data[ip]
+                ip += 1
+                n += b
+                if b != 255:
+                    break
+        return n
+
+    while op < size:
+        token = data[ip]
+        ip += 1
+        n = get_len(token >> 4)
+        for _ in range(n):  # literals
+            ip += 1
+            check()
+            op += 1
+        if op >= size:  # last sequence has no match
+            break
+        ip += 2  # match offset
+        n = get_len(token & 15) + 4
+        for _ in range(n):
+            check()
+            op += 1
+    return (gap + 3) & ~3
+
+
+def frame(cmd, arg, data=b""):
+    """Build protocol frame."""
+    hdr = cmd + struct.pack("<HI", len(data), arg)
+    frm = bytes([SOH]) + hdr + struct.pack("<I", zlib.crc32(hdr))
+    if data:
+        frm += data + struct.pack("<I", zlib.crc32(data))
+    return frm
+
+
+def send(port, frm, retries=RETRIES):
+    """Send frame and wait for ACK; repeat on NAK/timeout."""
+    port.timeout = 0.5 + 10 * len(frm) / port.baudrate  # bootloader responds after the line has been idle for a short time
+    for _ in range(retries):
+        port.reset_input_buffer()
+        port.write(frm)
+        rsp = port.read(1)
+        if rsp == bytes([ACK]):
+            return True
+    return False
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Upload an executable to the NEORV32 bootloader "
+                                     "via the UART block upload protocol. Reset processor before "
+                                     "starting the upload.")
+    parser.add_argument("port", help="serial port (e.g. /dev/ttyUSB0)")
+    parser.add_argument("image", help="NEORV32 executable (neorv32_exe.bin or neorv32_cexe.bin)")
+    parser.add_argument("-b", "--baud", type=int, default=BAUD_RATES[0],
+                        help="maximum baud rate for the transfer (default: %(default)s)")
+    parser.add_argument("--base-baud", type=int, default=19200,
+                        help="bootloader console baud rate (default: %(default)s)")
+    parser.add_argument("-n", "--no-run", action="store_true",
+                        help="do not start the executable after the upload")
+    args = parser.parse_args()
+
+    with open(args.image, "rb") as f:
+        image = f.read()
+    image += bytes(-len(image) % 4)
+    if len(image) < 12:
+        sys.exit("ERROR! Invalid executable.")
+    signature, size = struct.unpack("<II", image[:8])
+    if signature == SIGNATURE:
+        offset = 0  # bootloader reads ahead of its write pointer
+    elif signature == SIGNATURE_LZ4:
+        offset = lz4_load_offset(image)
+    else:
+        sys.exit("ERROR! Invalid executable signature.")
+
+    print(f"Opening serial port ({args.port})... ", end="", flush=True)
+    port = serial.Serial(args.port, args.base_baud, timeout=0.5)
+    print("OK")
+
+    # skip auto-boot (SPACE) and start block upload ('b')
+    port.reset_input_buffer()
+    port.write(b" b")
+    port.timeout = 2
+    rsp = port.read_until(b"NVB")
+    clk = port.read(4)
+    if not rsp.endswith(b"NVB") or len(clk) != 4:
+        sys.exit("ERROR! No bootloader response (block upload not supported?).")
+    clk = struct.unpack("<I", clk)[0]
+    print(f"Processor clock: {clk} Hz")
+
+    # switch to the fastest baud rate the clock (and the host) can handle
+    for baud in [b for b in BAUD_RATES if args.base_baud < b <= args.baud]:
+        if uart_baud_error(clk, baud) > 0.02:
+            continue
+        if not send(port, frame(CMD_BAUD, baud), 2):
+            continue
+        time.sleep(0.01)
+        try:
+            port.baudrate = baud
+        except (ValueError, serial.SerialException):
+            port.baudrate = args.base_baud
+            time.sleep(1)  # wait for bootloader fall back
+            continue
+        if send(port, frame(CMD_PING, 0), 1):
+            break
+        port.baudrate = args.base_baud  # bootloader falls back after a short timeout
+        time.sleep(1)
+    print(f"Baud rate: {port.baudrate}")
+
+    # transfer image
+    total = len(image)
+    start = time.time()
+    for i in range(0, total, BLOCK_SIZE):
+        if not send(port, frame(CMD_WRITE, offset + i, image[i:i+BLOCK_SIZE])):
+            sys.exit("\nERROR! Transfer failed.")
+        print(f"\rUploading executable ({total} bytes)... {min(i + BLOCK_SIZE, total) * 100 // total}%",
+              end="", flush=True)
+    elapsed = time.time() - start
+    print(f" ({total / elapsed / 1024:.1f} KiB/s)" if elapsed > 0 else "")
+
+    # done; bootloader falls back to the console baud rate and checks the executable
+    if not send(port, frame(CMD_DONE, offset)):
+        sys.exit("ERROR! Transfer failed.")
+    time.sleep(0.01)
+    port.baudrate = args.base_baud
+    port.timeout = 5 + size // 4096  # checking/unpacking from memory
+    rsp = port.read_until(b"\n").decode(errors="replace").strip()
+    if rsp != "OK":
+        sys.exit(f"ERROR! Bootloader response: {rsp}")
+    print("Upload OK")
+
+    if not args.no_run:
+        print("Booting executable...")
+        port.write(b"e")
+    port.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -50,8 +50,8 @@ extern "C" {
 #define NEORV32_CFS_BASE     (0xFFEB0000U) /**< Custom Functions Subsystem (CFS) */
 #define NEORV32_SLINK_BASE   (0xFFEC0000U) /**< Stream Link Interface (SLINK) */
 #define NEORV32_DMA_BASE     (0xFFED0000U) /**< Direct Memory Access Controller (DMA) */
-//#define NEORV32_???_BASE   (0xFFEE0000U) /**< reserved */
-//#define NEORV32_???_BASE   (0xFFEF0000U) /**< reserved */
+#define NEORV32_MBOX_BASE    (0xFFEE0000U) /**< Inter-Core Mailbox (MBOX) */
+#define NEORV32_XIP_BASE     (0xFFEF0000U) /**< Execute In-Place Module (XIP) */
 #define NEORV32_PWM_BASE     (0xFFF00000U) /**< Pulse Width Modulation Controller (PWM) */
 #define NEORV32_GPTMR_BASE   (0xFFF10000U) /**< General Purpose Timer (GPTMR) */
 #define NEORV32_ONEWIRE_BASE (0xFFF20000U) /**< 1-Wire Interface Controller (ONEWIRE) */
@@ -71,6 +71,15 @@ extern "C" {
 /**@}*/
 
 
+/**********************************************************************//**
+ * @name Memory-Mapped Flash Window
+ **************************************************************************/
+/**@{*/
+#define NEORV32_XIP_MEM_BASE (0xE0000000U) /**< Execute In-Place Module (XIP) memory window (read-only) */
+#define NEORV32_XIP_MEM_SIZE (0x10000000U) /**< Execute In-Place Module (XIP) memory window size in bytes */
+/**@}*/
+
+
 /**********************************************************************//**
  * @name Fast Interrupt Requests (FIRQ) Aliases
  **************************************************************************/
@@ -99,6 +108,12 @@ extern "C" {
 #define UART1_FIRQ_PENDING     CSR_MIP_FIRQ3P    /**< MIP CSR bit (#NEORV32_CSR_MIP_enum) */
 #define UART1_TRAP_CODE        TRAP_CODE_FIRQ_3  /**< MCAUSE CSR trap code (#NEORV32_EXCEPTION_CODES_enum) */
 /**@}*/
+/** @name Inter-Core Mailbox (MBOX) */
+/**@{*/
+#define MBOX_FIRQ_ENABLE       CSR_MIE_FIRQ4E    /**< MIE CSR bit (#NEORV32_CSR_MIE_enum) */
+#define MBOX_FIRQ_PENDING      CSR_MIP_FIRQ4P    /**< MIP CSR bit (#NEORV32_CSR_MIP_enum) */
+#define MBOX_TRAP_CODE         TRAP_CODE_FIRQ_4  /**< MCAUSE CSR trap code (#NEORV32_EXCEPTION_CODES_enum) */
+/**@}*/
 /** @name Execution Trace Buffer (TRACER) */
 /**@{*/
 #define TRACER_FIRQ_ENABLE     CSR_MIE_FIRQ5E    /**< MIE CSR bit (#NEORV32_CSR_MIE_enum) */
@@ -249,6 +264,7 @@ typedef union {
  * @name Include all processor header files
  **************************************************************************/
 /**@{*/
+#include "neorv32_alloc.h"
 #include "neorv32_aux.h"
 #include "neorv32_cfs.h"
 #include "neorv32_cfu.h"
@@ -260,10 +276,16 @@ typedef union {
 #include "neorv32_gptmr.h"
 #include "neorv32_intrinsics.h"
 #include "neorv32_legacy.h"
+#include "neorv32_log.h"
+#include "neorv32_mbox.h"
 #include "neorv32_neoled.h"
 #include "neorv32_onewire.h"
+#include "neorv32_perf.h"
+#include "neorv32_prof.h"
 #include "neorv32_pwm.h"
+#include "neorv32_queue.h"
 #include "neorv32_rte.h"
+#include "neorv32_sched.h"
 #include "neorv32_semihosting.h"
 #include "neorv32_sdi.h"
 #include "neorv32_slink.h"
@@ -276,6 +298,7 @@ typedef union {
 #include "neorv32_twi.h"
 #include "neorv32_uart.h"
 #include "neorv32_wdt.h"
+#include "neorv32_xip.h"
 /**@}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,92 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_alloc.h
+ * @brief Fast memory allocators (fixed-size pools, TLSF heaps, per-hart arenas) header file.
+ */
+
+#ifndef NEORV32_ALLOC_H
+#define NEORV32_ALLOC_H
+
+#include <neorv32.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/**********************************************************************//**
+ * @name Configuration
+ **************************************************************************/
+/**@{*/
+/** Maximum number of harts that get their own arena */
+#define NEORV32_ALLOC_HARTS 2
+/** log2 of the number of second-level size classes per first-level class (TLSF) */
+#define NEORV32_TLSF_SL_LOG2 4
+/** Largest supported block size is 2^NEORV32_TLSF_FL_MAX bytes (TLSF) */
+#define NEORV32_TLSF_FL_MAX 24
+/** Number of first-level size classes (TLSF) */
+#define NEORV32_TLSF_FL_COUNT (NEORV32_TLSF_FL_MAX - (NEORV32_TLSF_SL_LOG2 + 3) + 1)
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Allocator types
+ **************************************************************************/
+/**@{*/
+/** Allocator statistics */
+typedef struct {
+  uint32_t total;      /**< size of the managed memory in bytes */
+  uint32_t used;       /**< currently allocated bytes (including block overhead) */
+  uint32_t peak;       /**< maximum of "used" since initialization */
+  uint32_t largest;    /**< largest free block in bytes */
+  uint32_t fragment;   /**< free memory fragmentation in percent: 100 * (1 - largest / free) */
+  uint32_t num_alloc;  /**< number of successful allocations */
+  uint32_t num_fail;   /**< number of failed allocations */
+} neorv32_alloc_stats_t;
+
+/** Fixed-size block pool */
+typedef struct {
+  void    *free;       /**< free list head */
+  uint8_t *start;      /**< pool memory begin */
+  uint8_t *end;        /**< pool memory end */
+  uint32_t block_size; /**< size of a single block in bytes */
+  uint32_t num_blocks; /**< total number of blocks */
+  uint32_t num_used;   /**< number of allocated blocks */
+  uint32_t peak;       /**< maximum of "num_used" since initialization */
+  uint32_t num_alloc;  /**< number of successful allocations */
+  uint32_t num_fail;   /**< number of failed allocations */
+  uint32_t lock;       /**< spinlock (atomic accesses only) */
+} neorv32_pool_t;
+
+/** TLSF heap (opaque; the control structure is placed at the beginning of the heap memory) */
+typedef struct neorv32_tlsf_s neorv32_tlsf_t;
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Prototypes
+ **************************************************************************/
+/**@{*/
+int             neorv32_pool_init(neorv32_pool_t *pool, void *memory, uint32_t block_size, uint32_t num_blocks);
+void           *neorv32_pool_alloc(neorv32_pool_t *pool);
+void            neorv32_pool_free(neorv32_pool_t *pool, void *ptr);
+void            neorv32_pool_get_stats(neorv32_pool_t *pool, neorv32_alloc_stats_t *stats);
+neorv32_tlsf_t *neorv32_tlsf_init(void *memory, uint32_t size);
+void           *neorv32_tlsf_malloc(neorv32_tlsf_t *tlsf, size_t size);
+void            neorv32_tlsf_free(neorv32_tlsf_t *tlsf, void *ptr);
+void           *neorv32_tlsf_realloc(neorv32_tlsf_t *tlsf, void *ptr, size_t size);
+int             neorv32_tlsf_owns(neorv32_tlsf_t *tlsf, void *ptr);
+void            neorv32_tlsf_get_stats(neorv32_tlsf_t *tlsf, neorv32_alloc_stats_t *stats);
+int             neorv32_alloc_setup(uint32_t hart0_share);
+void           *neorv32_alloc_malloc(size_t size);
+void           *neorv32_alloc_calloc(size_t num, size_t size);
+void           *neorv32_alloc_realloc(void *ptr, size_t size);
+void            neorv32_alloc_free(void *ptr);
+int             neorv32_alloc_get_stats(int hart, neorv32_alloc_stats_t *stats);
+/**@}*/
+
+#endif // NEORV32_ALLOC_H
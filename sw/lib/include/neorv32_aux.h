@@ -16,6 +16,7 @@
 
 #include <neorv32.h>
 #include <stdint.h>
+#include <stdarg.h>
 
 /**********************************************************************//**
  * @name Date and time struct
@@ -31,6 +32,19 @@ typedef struct {
 } date_t;
 
 
+/**********************************************************************//**
+ * @name Formatted output sink (see neorv32_aux_vformat)
+ **************************************************************************/
+typedef struct neorv32_aux_sink_s {
+  char    *buf;   /**< output buffer */
+  uint32_t size;  /**< output buffer size in bytes */
+  uint32_t pos;   /**< number of chars currently in the buffer */
+  uint32_t total; /**< total number of generated chars */
+  void   (*flush)(struct neorv32_aux_sink_s *sink); /**< drain buffer and reset "pos" when full; NULL: truncate output */
+  void    *ctx;   /**< user context for "flush" */
+} neorv32_aux_sink_t;
+
+
 /**********************************************************************//**
  * @name AUX prototypes
  **************************************************************************/
@@ -41,6 +55,9 @@ void     neorv32_aux_unixtime2date(uint64_t unixtime, date_t* date);
 uint64_t neorv32_aux_hexstr2uint64(char *buffer, unsigned int length);
 uint32_t neorv32_aux_xorshift32(void);
 void     neorv32_aux_itoa(char *buffer, uint32_t num, uint32_t base);
+int      neorv32_aux_vformat(neorv32_aux_sink_t *sink, const char *format, va_list args);
+int      neorv32_aux_vsnprintf(char *buffer, uint32_t size, const char *format, va_list args);
+int      neorv32_aux_snprintf(char *buffer, uint32_t size, const char *format, ...);
 void     neorv32_aux_print_hw_config(void);
 void     neorv32_aux_print_hw_version(uint32_t impid);
 void     neorv32_aux_print_about(void);
@@ -259,7 +259,7 @@ inline uint32_t __attribute__ ((always_inline)) neorv32_cpu_amolr(uint32_t addr)
   uint32_t amo_addr = addr;
   uint32_t amo_rdata;
 
-  asm volatile ("lr.w %[dst], 0(%[addr])" : [dst] "=r" (amo_rdata) : [addr] "r" (amo_addr));
+  asm volatile ("lr.w %[dst], 0(%[addr])" : [dst] "=r" (amo_rdata) : [addr] "r" (amo_addr) : "memory");
 
   return amo_rdata;
 #else
@@ -287,7 +287,7 @@ inline uint32_t __attribute__ ((always_inline)) neorv32_cpu_amosc(uint32_t addr,
   uint32_t amo_wdata = wdata;
   uint32_t amo_status;
 
-  asm volatile ("sc.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_status) : [src] "r" (amo_wdata), [addr] "r" (amo_addr));
+  asm volatile ("sc.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_status) : [src] "r" (amo_wdata), [addr] "r" (amo_addr) : "memory");
 
   return amo_status;
 #else
@@ -316,7 +316,7 @@ inline uint32_t __attribute__ ((always_inline)) neorv32_cpu_amoswap(uint32_t add
   uint32_t amo_wdata = wdata;
   uint32_t amo_rdata;
 
-  asm volatile ("amoswap.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr));
+  asm volatile ("amoswap.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr) : "memory");
 
   return amo_rdata;
 #else
@@ -345,7 +345,7 @@ inline uint32_t __attribute__ ((always_inline)) neorv32_cpu_amoadd(uint32_t addr
   uint32_t amo_wdata = wdata;
   uint32_t amo_rdata;
 
-  asm volatile ("amoadd.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr));
+  asm volatile ("amoadd.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr) : "memory");
 
   return amo_rdata;
 #else
@@ -374,7 +374,7 @@ inline uint32_t __attribute__ ((always_inline)) neorv32_cpu_amoxor(uint32_t addr
   uint32_t amo_wdata = wdata;
   uint32_t amo_rdata;
 
-  asm volatile ("amoxor.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr));
+  asm volatile ("amoxor.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr) : "memory");
 
   return amo_rdata;
 #else
@@ -403,7 +403,7 @@ inline uint32_t __attribute__ ((always_inline)) neorv32_cpu_amoand(uint32_t addr
   uint32_t amo_wdata = wdata;
   uint32_t amo_rdata;
 
-  asm volatile ("amoand.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr));
+  asm volatile ("amoand.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr) : "memory");
 
   return amo_rdata;
 #else
@@ -432,7 +432,7 @@ inline uint32_t __attribute__ ((always_inline)) neorv32_cpu_amoor(uint32_t addr,
   uint32_t amo_wdata = wdata;
   uint32_t amo_rdata;
 
-  asm volatile ("amoor.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr));
+  asm volatile ("amoor.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr) : "memory");
 
   return amo_rdata;
 #else
@@ -461,7 +461,7 @@ inline uint32_t __attribute__ ((always_inline)) neorv32_cpu_amomin(uint32_t addr
   uint32_t amo_wdata = wdata;
   uint32_t amo_rdata;
 
-  asm volatile ("amomin.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr));
+  asm volatile ("amomin.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr) : "memory");
 
   return amo_rdata;
 #else
@@ -490,7 +490,7 @@ inline uint32_t __attribute__ ((always_inline)) neorv32_cpu_amomax(uint32_t addr
   uint32_t amo_wdata = wdata;
   uint32_t amo_rdata;
 
-  asm volatile ("amomax.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr));
+  asm volatile ("amomax.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr) : "memory");
 
   return amo_rdata;
 #else
@@ -519,7 +519,7 @@ inline uint32_t __attribute__ ((always_inline)) neorv32_cpu_amominu(uint32_t add
   uint32_t amo_wdata = wdata;
   uint32_t amo_rdata;
 
-  asm volatile ("amominu.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr));
+  asm volatile ("amominu.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr) : "memory");
 
   return amo_rdata;
 #else
@@ -548,7 +548,7 @@ inline uint32_t __attribute__ ((always_inline)) neorv32_cpu_amomaxu(uint32_t add
   uint32_t amo_wdata = wdata;
   uint32_t amo_rdata;
 
-  asm volatile ("amomaxu.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr));
+  asm volatile ("amomaxu.w %[dst], %[src], (%[addr])" : [dst] "=r" (amo_rdata) : [src] "r" (amo_wdata), [addr] "r" (amo_addr) : "memory");
 
   return amo_rdata;
 #else
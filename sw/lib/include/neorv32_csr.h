@@ -92,6 +92,19 @@ enum NEORV32_CSR_enum {
   /* machine counter control - continued */
   CSR_MCYCLECFGH     = 0x721, /**< 0x721 - mcyclecfgh:   Machine cycle counter privilege mode filtering - high word */
   CSR_MINSTRETCFGH   = 0x722, /**< 0x722 - minstretcfgh: Machine instret counter privilege mode filtering - high word */
+  CSR_MHPMEVENT3H    = 0x723, /**< 0x723 - mhpmevent3h:  Machine hardware performance monitor event selector 3 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT4H    = 0x724, /**< 0x724 - mhpmevent4h:  Machine hardware performance monitor event selector 4 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT5H    = 0x725, /**< 0x725 - mhpmevent5h:  Machine hardware performance monitor event selector 5 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT6H    = 0x726, /**< 0x726 - mhpmevent6h:  Machine hardware performance monitor event selector 6 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT7H    = 0x727, /**< 0x727 - mhpmevent7h:  Machine hardware performance monitor event selector 7 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT8H    = 0x728, /**< 0x728 - mhpmevent8h:  Machine hardware performance monitor event selector 8 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT9H    = 0x729, /**< 0x729 - mhpmevent9h:  Machine hardware performance monitor event selector 9 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT10H   = 0x72a, /**< 0x72a - mhpmevent10h: Machine hardware performance monitor event selector 10 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT11H   = 0x72b, /**< 0x72b - mhpmevent11h: Machine hardware performance monitor event selector 11 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT12H   = 0x72c, /**< 0x72c - mhpmevent12h: Machine hardware performance monitor event selector 12 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT13H   = 0x72d, /**< 0x72d - mhpmevent13h: Machine hardware performance monitor event selector 13 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT14H   = 0x72e, /**< 0x72e - mhpmevent14h: Machine hardware performance monitor event selector 14 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
+  CSR_MHPMEVENT15H   = 0x72f, /**< 0x72f - mhpmevent15h: Machine hardware performance monitor event selector 15 - high word (#NEORV32_CSR_MHPMEVENTH_enum) */
 
   /* on-chip debugger - hardware trigger module */
   CSR_TSELECT        = 0x7a0, /**< 0x7a0 - tselect:  Trigger select */
@@ -236,6 +249,7 @@ enum NEORV32_CSR_MIE_enum {
   CSR_MIE_MSIE    =  3, /**< mie CSR  (3): MSIE - Machine software interrupt enable (r/w) */
   CSR_MIE_MTIE    =  7, /**< mie CSR  (7): MTIE - Machine timer interrupt enable bit (r/w) */
   CSR_MIE_MEIE    = 11, /**< mie CSR (11): MEIE - Machine external interrupt enable bit (r/w) */
+  CSR_MIE_LCOFIE  = 13, /**< mie CSR (13): LCOFIE - Local counter overflow interrupt enable bit (r/w) */
 
   /* NEORV32-specific extension: Fast Interrupt Requests (FIRQ) */
   CSR_MIE_FIRQ0E  = 16, /**< mie CSR (16): FIRQ0E - Fast interrupt channel 0 enable bit (r/w) */
@@ -264,6 +278,7 @@ enum NEORV32_CSR_MIP_enum {
   CSR_MIP_MSIP    =  3, /**<  mip CSR  (3): MSIP - Machine software interrupt pending (r/-) */
   CSR_MIP_MTIP    =  7, /**<  mip CSR  (7): MTIP - Machine timer interrupt pending (r/-) */
   CSR_MIP_MEIP    = 11, /**<  mip CSR (11): MEIP - Machine external interrupt pending (r/-) */
+  CSR_MIP_LCOFIP  = 13, /**<  mip CSR (13): LCOFIP - Local counter overflow interrupt pending (r/-) */
   /* NEORV32-specific extension: Fast Interrupt Requests (FIRQ) */
   CSR_MIP_FIRQ0P  = 16, /**< mip CSR (16): FIRQ0P - Fast interrupt channel 0 pending (r/-) */
   CSR_MIP_FIRQ1P  = 17, /**< mip CSR (17): FIRQ1P - Fast interrupt channel 1 pending (r/-) */
@@ -358,6 +373,16 @@ enum NEORV32_CSR_MINSTRETCFGH_enum {
 };
 
 
+/**********************************************************************//**
+ * mhpmevent*h CSRs (r/w): Machine hardware performance monitor overflow and privilege-mode filtering
+ **************************************************************************/
+enum NEORV32_CSR_MHPMEVENTH_enum {
+  CSR_MHPMEVENTH_UINH = 28, /**< mhpmevent*h CSR (28): inhibit counter when in user-mode when set (r/w) */
+  CSR_MHPMEVENTH_MINH = 30, /**< mhpmevent*h CSR (30): inhibit counter when in machine-mode when set (r/w) */
+  CSR_MHPMEVENTH_OF   = 31  /**< mhpmevent*h CSR (31): counter overflow flag; triggers the local counter overflow interrupt when set (r/w) */
+};
+
+
 /**********************************************************************//**
  * mhpmevent hardware performance monitor events
  **************************************************************************/
@@ -372,7 +397,16 @@ enum NEORV32_HPMCNT_EVENT_enum {
   HPMCNT_EVENT_CTRLFLOW = 7, /**< mhpmevent CSR (7):  Control flow transfer */
   HPMCNT_EVENT_LOAD     = 8, /**< mhpmevent CSR (8):  Executed load operation */
   HPMCNT_EVENT_STORE    = 9, /**< mhpmevent CSR (9):  Executed store operation */
-  HPMCNT_EVENT_WAIT_LSU = 10 /**< mhpmevent CSR (10): Load-store unit memory wait cycle */
+  HPMCNT_EVENT_WAIT_LSU = 10, /**< mhpmevent CSR (10): Load-store unit memory wait cycle */
+  HPMCNT_EVENT_TRAP     = 11, /**< mhpmevent CSR (11): Trap entry (exception or interrupt) */
+  HPMCNT_EVENT_IRQ      = 12, /**< mhpmevent CSR (12): Interrupt entry */
+  HPMCNT_EVENT_WAIT_RST = 13, /**< mhpmevent CSR (13): Instruction dispatch wait cycle after fetch restart */
+  HPMCNT_EVENT_IC_HIT   = 14, /**< mhpmevent CSR (14): Instruction cache hit */
+  HPMCNT_EVENT_IC_MISS  = 15, /**< mhpmevent CSR (15): Instruction cache miss */
+  HPMCNT_EVENT_DC_HIT   = 16, /**< mhpmevent CSR (16): Data cache hit */
+  HPMCNT_EVENT_DC_MISS  = 17, /**< mhpmevent CSR (17): Data cache miss */
+  HPMCNT_EVENT_WAIT_BUS = 18, /**< mhpmevent CSR (18): Bus arbitration wait cycle (other core or DMA) */
+  HPMCNT_EVENT_DMA      = 19  /**< mhpmevent CSR (19): DMA bus access */
 };
 
 
@@ -416,6 +450,7 @@ enum NEORV32_EXCEPTION_CODES_enum {
   TRAP_CODE_MSI          = 0x80000003U, /**< 1.3:  Machine software interrupt */
   TRAP_CODE_MTI          = 0x80000007U, /**< 1.7:  Machine timer interrupt */
   TRAP_CODE_MEI          = 0x8000000bU, /**< 1.11: Machine external interrupt */
+  TRAP_CODE_LCOFI        = 0x8000000dU, /**< 1.13: Local counter overflow interrupt (HPM) */
   TRAP_CODE_FIRQ_0       = 0x80000010U, /**< 1.16: Fast interrupt channel 0 */
   TRAP_CODE_FIRQ_1       = 0x80000011U, /**< 1.17: Fast interrupt channel 1 */
   TRAP_CODE_FIRQ_2       = 0x80000012U, /**< 1.18: Fast interrupt channel 2 */
@@ -48,14 +48,16 @@ enum NEORV32_DMA_CTRL_enum {
 
 /** DMA transfer configuration */
 enum NEORV32_DMA_CONF_enum {
-  DMA_CONF_NUM_LSB =  0, /**< DMA transfer type register(0)  (r/w): Number of elements to transfer, LSB */
-  DMA_CONF_NUM_MSB = 23, /**< DMA transfer type register(23) (r/w): Number of elements to transfer, MSB */
-
-  DMA_CONF_BSWAP   = 27, /**< DMA transfer type register(27) (r/w): Swap byte order when set */
-  DMA_CONF_SRC_LSB = 28, /**< DMA transfer type register(28) (r/w): SRC transfer type select (#NEORV32_DMA_TYPE_enum), LSB */
-  DMA_CONF_SRC_MSB = 29, /**< DMA transfer type register(29) (r/w): SRC transfer type select (#NEORV32_DMA_TYPE_enum), MSB */
-  DMA_CONF_DST_LSB = 30, /**< DMA transfer type register(30) (r/w): DST transfer type select (#NEORV32_DMA_TYPE_enum), LSB */
-  DMA_CONF_DST_MSB = 31  /**< DMA transfer type register(31) (r/w): DST transfer type select (#NEORV32_DMA_TYPE_enum), MSB */
+  DMA_CONF_NUM_LSB  =  0, /**< DMA transfer type register(0)  (r/w): Number of elements to transfer, LSB */
+  DMA_CONF_NUM_MSB  = 23, /**< DMA transfer type register(23) (r/w): Number of elements to transfer, MSB */
+  DMA_CONF_DSEL_LSB = 24, /**< DMA transfer type register(24) (r/w): Peripheral DMA request select (#NEORV32_DMA_DSEL_enum), LSB */
+  DMA_CONF_DSEL_MSB = 25, /**< DMA transfer type register(25) (r/w): Peripheral DMA request select (#NEORV32_DMA_DSEL_enum), MSB */
+  DMA_CONF_DREQ     = 26, /**< DMA transfer type register(26) (r/w): Wait for peripheral DMA request before each element */
+  DMA_CONF_BSWAP    = 27, /**< DMA transfer type register(27) (r/w): Swap byte order when set */
+  DMA_CONF_SRC_LSB  = 28, /**< DMA transfer type register(28) (r/w): SRC transfer type select (#NEORV32_DMA_TYPE_enum), LSB */
+  DMA_CONF_SRC_MSB  = 29, /**< DMA transfer type register(29) (r/w): SRC transfer type select (#NEORV32_DMA_TYPE_enum), MSB */
+  DMA_CONF_DST_LSB  = 30, /**< DMA transfer type register(30) (r/w): DST transfer type select (#NEORV32_DMA_TYPE_enum), LSB */
+  DMA_CONF_DST_MSB  = 31  /**< DMA transfer type register(31) (r/w): DST transfer type select (#NEORV32_DMA_TYPE_enum), MSB */
 };
 /**@}*/
 
@@ -70,6 +72,11 @@ enum NEORV32_DMA_TYPE_enum {
   DMA_TYPE_INC_BYTE   = 0b10, /**< incrementing byte */
   DMA_TYPE_INC_WORD   = 0b11  /**< incrementing word */
 };
+/** peripheral DMA request sources */
+enum NEORV32_DMA_DSEL_enum {
+  DMA_DSEL_SPI    = 0b00, /**< SPI controller */
+  DMA_DSEL_TRACER = 0b01  /**< execution tracer (compressed trace stream) */
+};
 /** source aliases */
 #define DMA_SRC_CONST_BYTE (DMA_TYPE_CONST_BYTE << DMA_CONF_SRC_LSB)
 #define DMA_SRC_CONST_WORD (DMA_TYPE_CONST_WORD << DMA_CONF_SRC_LSB)
@@ -82,6 +89,10 @@ enum NEORV32_DMA_TYPE_enum {
 #define DMA_DST_INC_WORD   (DMA_TYPE_INC_WORD   << DMA_CONF_DST_LSB)
 /** Endianness conversion */
 #define DMA_BSWAP (1 << DMA_CONF_BSWAP)
+/** Peripheral flow control */
+#define DMA_DREQ (1 << DMA_CONF_DREQ)
+#define DMA_DREQ_SPI    (DMA_DREQ | (DMA_DSEL_SPI    << DMA_CONF_DSEL_LSB))
+#define DMA_DREQ_TRACER (DMA_DREQ | (DMA_DSEL_TRACER << DMA_CONF_DSEL_LSB))
 /**@}*/
 
 
@@ -0,0 +1,147 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_log.h
+ * @brief Binary deferred logging header file.
+ *
+ * @note Format strings are placed in the non-loaded ".neorv32_log" ELF section.
+ * The messages are reconstructed on the host by sw/image_gen/log_decode.py.
+ */
+
+#ifndef NEORV32_LOG_H
+#define NEORV32_LOG_H
+
+#include <neorv32.h>
+#include <stdint.h>
+
+/**********************************************************************//**
+ * @name Configuration
+ **************************************************************************/
+/**@{*/
+/** Compile-time log level filter: messages above this level are removed (#NEORV32_LOG_LEVEL_enum) */
+#ifndef NEORV32_LOG_LEVEL
+  #define NEORV32_LOG_LEVEL NEORV32_LOG_DEBUG
+#endif
+/** Host file name for the semihosting sink */
+#ifndef NEORV32_LOG_FILE
+  #define NEORV32_LOG_FILE "neorv32_log.bin"
+#endif
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Log levels
+ **************************************************************************/
+enum NEORV32_LOG_LEVEL_enum {
+  NEORV32_LOG_ERROR = 0, /**< error */
+  NEORV32_LOG_WARN  = 1, /**< warning */
+  NEORV32_LOG_INFO  = 2, /**< information */
+  NEORV32_LOG_DEBUG = 3  /**< debug */
+};
+
+
+/**********************************************************************//**
+ * @name Log sinks (drain targets)
+ **************************************************************************/
+enum NEORV32_LOG_SINK_enum {
+  NEORV32_LOG_SINK_NONE        = 0, /**< records are fetched by the application (#neorv32_log_read) */
+  NEORV32_LOG_SINK_UART0       = 1, /**< UART0 (raw binary) */
+  NEORV32_LOG_SINK_UART1       = 2, /**< UART1 (raw binary) */
+  NEORV32_LOG_SINK_SEMIHOSTING = 3  /**< host file #NEORV32_LOG_FILE via semihosting */
+};
+
+
+/**********************************************************************//**
+ * @name Record format (32-bit words, little-endian)
+ *
+ * word 0: header; word 1: mcycle[31:0] timestamp; word 2..: arguments
+ **************************************************************************/
+/**@{*/
+/** Record header bits */
+enum NEORV32_LOG_HDR_enum {
+  LOG_HDR_SYNC_LSB  =  0, /**< header(3:0):   sync pattern (#NEORV32_LOG_SYNC) */
+  LOG_HDR_SYNC_MSB  =  3, /**< header(3:0):   sync pattern (#NEORV32_LOG_SYNC) */
+  LOG_HDR_HART_LSB  =  4, /**< header(5:4):   hart ID */
+  LOG_HDR_HART_MSB  =  5, /**< header(5:4):   hart ID */
+  LOG_HDR_LEVEL_LSB =  6, /**< header(7:6):   log level (#NEORV32_LOG_LEVEL_enum) */
+  LOG_HDR_LEVEL_MSB =  7, /**< header(7:6):   log level (#NEORV32_LOG_LEVEL_enum) */
+  LOG_HDR_NARGS_LSB =  8, /**< header(11:8):  number of argument words */
+  LOG_HDR_NARGS_MSB = 11, /**< header(11:8):  number of argument words */
+  LOG_HDR_ID_LSB    = 12, /**< header(31:12): format string ID (offset in the ".neorv32_log" section) */
+  LOG_HDR_ID_MSB    = 31  /**< header(31:12): format string ID (offset in the ".neorv32_log" section) */
+};
+
+/** Header sync pattern */
+#define NEORV32_LOG_SYNC 0xA
+/** Reserved ID: start of log; argument: processor clock in Hz */
+#define NEORV32_LOG_ID_START 0xFFFFE
+/** Reserved ID: records were dropped; argument: number of dropped records */
+#define NEORV32_LOG_ID_DROPPED 0xFFFFF
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Logging statistics
+ **************************************************************************/
+typedef struct {
+  uint32_t records; /**< number of stored records */
+  uint32_t dropped; /**< number of records dropped because the ring buffer was full */
+  uint32_t peak;    /**< maximum ring buffer fill level in bytes */
+  uint32_t sent;    /**< number of bytes passed to the sink */
+} neorv32_log_stats_t;
+
+
+/**********************************************************************//**
+ * @name Logging macros
+ *
+ * All arguments are stored as raw 32-bit words; the message is formatted on the host.
+ * Use #NEORV32_LOG_U64 for "%ll*" and #NEORV32_LOG_FLOAT for "%f" arguments. "%s"
+ * arguments must point to constant strings (resolved from the ELF file on the host).
+ * Up to 15 argument words per message.
+ **************************************************************************/
+/**@{*/
+/** Emit log record with given level */
+#define NEORV32_LOG(level, fmt, ...) do { \
+  if ((level) <= NEORV32_LOG_LEVEL) { \
+    static const char __neorv32_log_fmt[] __attribute__((section(".neorv32_log"), used)) = fmt; \
+    const uint32_t __neorv32_log_args[] = {0, ##__VA_ARGS__}; \
+    _Static_assert((sizeof(__neorv32_log_args) / 4) <= 16, "NEORV32_LOG: too many arguments"); \
+    neorv32_log_write(((uint32_t)__neorv32_log_fmt << LOG_HDR_ID_LSB) | \
+                      (((sizeof(__neorv32_log_args) / 4) - 1) << LOG_HDR_NARGS_LSB) | \
+                      ((uint32_t)(level) << LOG_HDR_LEVEL_LSB), &__neorv32_log_args[1]); \
+  } \
+} while (0)
+/** Error message */
+#define NEORV32_LOG_ERROR(fmt, ...) NEORV32_LOG(NEORV32_LOG_ERROR, fmt, ##__VA_ARGS__)
+/** Warning message */
+#define NEORV32_LOG_WARN(fmt, ...)  NEORV32_LOG(NEORV32_LOG_WARN,  fmt, ##__VA_ARGS__)
+/** Information message */
+#define NEORV32_LOG_INFO(fmt, ...)  NEORV32_LOG(NEORV32_LOG_INFO,  fmt, ##__VA_ARGS__)
+/** Debug message */
+#define NEORV32_LOG_DEBUG(fmt, ...) NEORV32_LOG(NEORV32_LOG_DEBUG, fmt, ##__VA_ARGS__)
+/** 64-bit argument (two words) */
+#define NEORV32_LOG_U64(x) (uint32_t)((uint64_t)(x)), (uint32_t)((uint64_t)(x) >> 32)
+/** Single-precision floating-point argument (raw IEEE-754 bits) */
+#define NEORV32_LOG_FLOAT(x) ({ union { float f; uint32_t u; } __neorv32_log_f = {.f = (float)(x)}; __neorv32_log_f.u; })
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Prototypes
+ **************************************************************************/
+/**@{*/
+int  neorv32_log_setup(uint32_t *buffer, uint32_t size, int sink);
+void neorv32_log_write(uint32_t header, const uint32_t *args);
+int  neorv32_log_drain(void);
+void neorv32_log_flush(void);
+int  neorv32_log_read(void *buffer, int len);
+void neorv32_log_get_stats(neorv32_log_stats_t *stats);
+/**@}*/
+
+#endif // NEORV32_LOG_H
@@ -0,0 +1,74 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_mbox.h
+ * @brief Inter-Core Mailbox (MBOX) HW driver header file.
+ */
+
+#ifndef NEORV32_MBOX_H
+#define NEORV32_MBOX_H
+
+#include <neorv32.h>
+#include <stdint.h>
+
+/**********************************************************************//**
+ * @name IO Device: Inter-Core Mailbox (MBOX)
+ **************************************************************************/
+/**@{*/
+/** MBOX inbox prototype (one per hart) */
+typedef volatile struct __attribute__((packed,aligned(4))) {
+  uint32_t       CTRL;     /**< control register (#NEORV32_MBOX_CTRL_enum) */
+  const uint32_t SRC;      /**< sender hart ID of the last message read from DATA */
+  uint32_t       DATA;     /**< write: push message to inbox; read: pop message from inbox */
+  const uint32_t reserved; /**< reserved */
+} neorv32_mbox_inbox_t;
+
+/** MBOX module prototype */
+typedef volatile struct __attribute__((packed,aligned(4))) {
+  neorv32_mbox_inbox_t INBOX[4]; /**< per-hart inboxes */
+} neorv32_mbox_t;
+
+/** MBOX module hardware handle (#neorv32_mbox_t) */
+#define NEORV32_MBOX ((neorv32_mbox_t*) (NEORV32_MBOX_BASE))
+
+/** MBOX control register bits */
+enum NEORV32_MBOX_CTRL_enum {
+  MBOX_CTRL_EN        =  0, /**< MBOX control register(0)  (r/w): Inbox enable, inbox is cleared when disabled */
+  MBOX_CTRL_IRQ_EN    =  1, /**< MBOX control register(1)  (r/w): Interrupt if inbox not empty */
+
+  MBOX_CTRL_AVAIL     =  8, /**< MBOX control register(8)  (r/-): Inbox not empty */
+  MBOX_CTRL_FULL      =  9, /**< MBOX control register(9)  (r/-): Inbox full */
+  MBOX_CTRL_OVF       = 10, /**< MBOX control register(10) (r/c): Message lost (write to full inbox); cleared by writing CTRL */
+
+  MBOX_CTRL_FIFO_LSB  = 24, /**< MBOX control register(24) (r/-): log2(inbox FIFO size) LSB */
+  MBOX_CTRL_FIFO_MSB  = 27, /**< MBOX control register(27) (r/-): log2(inbox FIFO size) MSB */
+  MBOX_CTRL_HARTS_LSB = 28, /**< MBOX control register(28) (r/-): Number of harts - 1, LSB */
+  MBOX_CTRL_HARTS_MSB = 29  /**< MBOX control register(29) (r/-): Number of harts - 1, MSB */
+};
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Prototypes
+ **************************************************************************/
+/**@{*/
+int      neorv32_mbox_available(void);
+void     neorv32_mbox_setup(int irq_en);
+int      neorv32_mbox_get_fifo_depth(void);
+int      neorv32_mbox_get_num_harts(void);
+int      neorv32_mbox_send(int hart, uint32_t data);
+void     neorv32_mbox_put(int hart, uint32_t data);
+int      neorv32_mbox_avail(void);
+int      neorv32_mbox_recv(uint32_t *data, int *src);
+uint32_t neorv32_mbox_get(void);
+int      neorv32_mbox_overflow(void);
+/**@}*/
+
+
+#endif // NEORV32_MBOX_H
@@ -0,0 +1,70 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_perf.h
+ * @brief Region-scoped performance measurement header file.
+ */
+
+#ifndef NEORV32_PERF_H
+#define NEORV32_PERF_H
+
+#include <neorv32.h>
+#include "neorv32_uart.h"
+#include <stdint.h>
+
+
+/**********************************************************************//**
+ * @name Configuration
+ **************************************************************************/
+/**@{*/
+/** Number of HPM counters (mhpmcounter3 upwards) captured per region (0..13) */
+#ifndef NEORV32_PERF_HPM_NUM
+  #define NEORV32_PERF_HPM_NUM 4
+#endif
+/** Total number of metrics per region: cycle + instret + HPMs */
+#define NEORV32_PERF_NUM (2 + NEORV32_PERF_HPM_NUM)
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Metric index
+ **************************************************************************/
+enum NEORV32_PERF_METRIC_enum {
+  NEORV32_PERF_CYCLE   = 0, /**< [m]cycle */
+  NEORV32_PERF_INSTRET = 1, /**< [m]instret */
+  NEORV32_PERF_HPM3    = 2  /**< mhpmcounter3; mhpmcounter4 = NEORV32_PERF_HPM3 + 1, etc. */
+};
+
+
+/**********************************************************************//**
+ * @name Region statistics (one entry per region ID)
+ **************************************************************************/
+typedef struct {
+  const char *name;                   /**< region name (optional, for the report) */
+  uint32_t count;                     /**< number of completed measurements */
+  uint32_t start[NEORV32_PERF_NUM];   /**< counter snapshot of the pending measurement */
+  uint32_t min[NEORV32_PERF_NUM];     /**< minimum delta per metric */
+  uint32_t max[NEORV32_PERF_NUM];     /**< maximum delta per metric */
+  uint64_t sum[NEORV32_PERF_NUM];     /**< accumulated deltas per metric (mean = sum / count) */
+} neorv32_perf_region_t;
+
+
+/**********************************************************************//**
+ * @name Prototypes
+ **************************************************************************/
+/**@{*/
+int  neorv32_perf_setup(neorv32_perf_region_t *table, uint32_t num);
+void neorv32_perf_name(uint32_t id, const char *name);
+void neorv32_perf_begin(uint32_t id);
+void neorv32_perf_end(uint32_t id);
+void neorv32_perf_clear(void);
+void neorv32_perf_report(neorv32_uart_t *UARTx);
+/**@}*/
+
+#endif // NEORV32_PERF_H
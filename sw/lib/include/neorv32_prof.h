@@ -0,0 +1,56 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_prof.h
+ * @brief Sampling profiler header file.
+ *
+ * @note The histogram dump is mapped to functions on the host by sw/image_gen/prof_report.py.
+ */
+
+#ifndef NEORV32_PROF_H
+#define NEORV32_PROF_H
+
+#include <neorv32.h>
+#include "neorv32_uart.h"
+#include <stdint.h>
+
+
+/**********************************************************************//**
+ * HPM counter (3..15) used for event-based sampling (#neorv32_prof_event).
+ **************************************************************************/
+#ifndef NEORV32_PROF_HPM
+#define NEORV32_PROF_HPM 3
+#endif
+
+
+/**********************************************************************//**
+ * @name Profiling statistics
+ **************************************************************************/
+typedef struct {
+  uint32_t samples;   /**< total number of samples */
+  uint32_t outside;   /**< samples outside of the profiled address range */
+  uint32_t saturated; /**< samples lost because the histogram bucket was saturated */
+  uint32_t missed;    /**< sampling periods missed (interrupts disabled for too long) */
+} neorv32_prof_stats_t;
+
+
+/**********************************************************************//**
+ * @name Prototypes
+ **************************************************************************/
+/**@{*/
+int  neorv32_prof_setup(uint16_t *buffer, uint32_t size, uint32_t base, uint32_t limit, uint32_t rate);
+int  neorv32_prof_event(uint32_t event, uint32_t period);
+void neorv32_prof_start(void);
+void neorv32_prof_stop(void);
+void neorv32_prof_clear(void);
+void neorv32_prof_get_stats(neorv32_prof_stats_t *stats);
+void neorv32_prof_dump(neorv32_uart_t *UARTx);
+/**@}*/
+
+#endif // NEORV32_PROF_H
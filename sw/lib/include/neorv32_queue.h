@@ -0,0 +1,80 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_queue.h
+ * @brief Lock-free inter-core message queues header file.
+ */
+
+#ifndef NEORV32_QUEUE_H
+#define NEORV32_QUEUE_H
+
+#include <neorv32.h>
+#include <stdint.h>
+
+/**********************************************************************//**
+ * @name Configuration
+ **************************************************************************/
+/**@{*/
+/** Alignment of the producer/consumer indices (should be at least the cache block size) */
+#ifndef NEORV32_QUEUE_ALIGN
+#define NEORV32_QUEUE_ALIGN 64
+#endif
+/** No doorbell interrupt */
+#define NEORV32_QUEUE_NO_DOORBELL (-1)
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Queue types
+ **************************************************************************/
+/**@{*/
+/** Single-producer/single-consumer (SPSC) queue */
+typedef struct {
+  uint32_t  head __attribute__((aligned(NEORV32_QUEUE_ALIGN))); /**< read index; written by consumer only */
+  uint32_t  tail __attribute__((aligned(NEORV32_QUEUE_ALIGN))); /**< write index; written by producer only */
+  uint32_t *buf  __attribute__((aligned(NEORV32_QUEUE_ALIGN))); /**< message buffer */
+  uint32_t  mask;     /**< number of buffer entries - 1 */
+  int       doorbell; /**< consumer hart ID to notify via CLINT MSI; #NEORV32_QUEUE_NO_DOORBELL if disabled */
+} neorv32_queue_spsc_t;
+
+/** Multi-producer/multi-consumer (MPMC) queue cell */
+typedef struct {
+  uint32_t seq;  /**< cell sequence number */
+  uint32_t data; /**< message */
+} neorv32_queue_cell_t;
+
+/** Multi-producer/multi-consumer (MPMC) queue */
+typedef struct {
+  uint32_t              head  __attribute__((aligned(NEORV32_QUEUE_ALIGN))); /**< read ticket */
+  uint32_t              tail  __attribute__((aligned(NEORV32_QUEUE_ALIGN))); /**< write ticket */
+  neorv32_queue_cell_t *cells __attribute__((aligned(NEORV32_QUEUE_ALIGN))); /**< message cells */
+  uint32_t              mask;     /**< number of cells - 1 */
+  int                   doorbell; /**< consumer hart ID to notify via CLINT MSI; #NEORV32_QUEUE_NO_DOORBELL if disabled */
+} neorv32_queue_mpmc_t;
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Prototypes
+ **************************************************************************/
+/**@{*/
+int      neorv32_queue_spsc_init(neorv32_queue_spsc_t *q, uint32_t *buffer, uint32_t size, int doorbell);
+int      neorv32_queue_spsc_push(neorv32_queue_spsc_t *q, uint32_t data);
+int      neorv32_queue_spsc_pop(neorv32_queue_spsc_t *q, uint32_t *data);
+uint32_t neorv32_queue_spsc_count(neorv32_queue_spsc_t *q);
+void     neorv32_queue_spsc_push_wait(neorv32_queue_spsc_t *q, uint32_t data);
+uint32_t neorv32_queue_spsc_pop_wait(neorv32_queue_spsc_t *q);
+int      neorv32_queue_mpmc_init(neorv32_queue_mpmc_t *q, neorv32_queue_cell_t *cells, uint32_t size, int doorbell);
+int      neorv32_queue_mpmc_push(neorv32_queue_mpmc_t *q, uint32_t data);
+int      neorv32_queue_mpmc_pop(neorv32_queue_mpmc_t *q, uint32_t *data);
+void     neorv32_queue_mpmc_push_wait(neorv32_queue_mpmc_t *q, uint32_t data);
+uint32_t neorv32_queue_mpmc_pop_wait(neorv32_queue_mpmc_t *q);
+/**@}*/
+
+#endif // NEORV32_QUEUE_H
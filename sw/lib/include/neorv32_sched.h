@@ -0,0 +1,72 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_sched.h
+ * @brief Work-stealing task scheduler for the SMP dual-core configuration header file.
+ */
+
+#ifndef NEORV32_SCHED_H
+#define NEORV32_SCHED_H
+
+#include <neorv32.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/**********************************************************************//**
+ * @name Configuration
+ **************************************************************************/
+/**@{*/
+/** Number of task slots in each hart's deque (has to be a power of two) */
+#ifndef NEORV32_SCHED_DEQUE_SIZE
+#define NEORV32_SCHED_DEQUE_SIZE 32
+#endif
+/** Maximum number of harts supported by the scheduler */
+#define NEORV32_SCHED_HARTS 2
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Task types
+ **************************************************************************/
+/**@{*/
+/** Plain task function */
+typedef void (*neorv32_sched_func_t)(void *arg);
+
+/** Range task function (parallel-for body); processes indices [begin, end) */
+typedef void (*neorv32_sched_range_t)(uint32_t begin, uint32_t end, void *arg);
+
+/** Fork-join task group */
+typedef struct {
+  uint32_t pending; /**< number of spawned but not yet completed tasks (access atomically only) */
+} neorv32_sched_group_t;
+
+/** Static initializer for #neorv32_sched_group_t */
+#define NEORV32_SCHED_GROUP_INIT {0}
+
+/** Per-hart scheduler statistics */
+typedef struct {
+  uint32_t executed; /**< number of tasks executed by this hart */
+  uint32_t stolen;   /**< number of tasks this hart stole from another hart */
+} neorv32_sched_stats_t;
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Prototypes
+ **************************************************************************/
+/**@{*/
+int  neorv32_sched_start(uint8_t *stack_memory, size_t stack_size_bytes);
+void neorv32_sched_stop(void);
+void neorv32_sched_spawn(neorv32_sched_group_t *group, neorv32_sched_func_t func, void *arg);
+void neorv32_sched_sync(neorv32_sched_group_t *group);
+void neorv32_sched_parallel_for(uint32_t begin, uint32_t end, uint32_t grain, neorv32_sched_range_t func, void *arg);
+void neorv32_sched_get_stats(int hart, neorv32_sched_stats_t *stats);
+/**@}*/
+
+#endif // NEORV32_SCHED_H
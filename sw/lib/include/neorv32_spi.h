@@ -25,6 +25,7 @@
 typedef volatile struct __attribute__((packed,aligned(4))) {
   uint32_t CTRL;  /**< offset 0: control register (#NEORV32_SPI_CTRL_enum) */
   uint32_t DATA;  /**< offset 4: data register  (#NEORV32_SPI_DATA_enum) */
+  uint32_t XFER;  /**< offset 8: transfer register (#NEORV32_SPI_XFER_enum) */
 } neorv32_spi_t;
 
 /** SPI module hardware handle (#neorv32_spi_t) */
@@ -42,16 +43,19 @@ enum NEORV32_SPI_CTRL_enum {
   SPI_CTRL_CDIV1        =  7, /**< SPI control register(7)  (r/w): Clock divider bit 1 */
   SPI_CTRL_CDIV2        =  8, /**< SPI control register(8)  (r/w): Clock divider bit 2 */
   SPI_CTRL_CDIV3        =  9, /**< SPI control register(9)  (r/w): Clock divider bit 3 */
+  SPI_CTRL_DWIDTH_LSB   = 10, /**< SPI control register(10) (r/w): Frame data width (00=8, 01=16, 1-=32 bit), LSB */
+  SPI_CTRL_DWIDTH_MSB   = 11, /**< SPI control register(11) (r/w): Frame data width (00=8, 01=16, 1-=32 bit), MSB */
 
   SPI_CTRL_RX_AVAIL     = 16, /**< SPI control register(16) (r/-): RX FIFO data available (RX FIFO not empty) */
   SPI_CTRL_TX_EMPTY     = 17, /**< SPI control register(17) (r/-): TX FIFO empty */
   SPI_CTRL_TX_FULL      = 18, /**< SPI control register(18) (r/-): TX FIFO full */
+  SPI_CTRL_XFER         = 19, /**< SPI control register(19) (r/-): Hardware-managed transfers (XFER, DMA request) implemented */
 
   SPI_CTRL_FIFO_LSB     = 24, /**< SPI control register(24) (r/-): log2(FIFO size), LSB */
   SPI_CTRL_FIFO_MSB     = 27, /**< SPI control register(27) (r/-): log2(FIFO size), MSB */
 
   SPI_CS_ACTIVE         = 30, /**< SPI control register(30) (r/-): At least one CS line is active when set */
-  SPI_CTRL_BUSY         = 31  /**< SPI control register(31) (r/-): serial PHY busy or TX FIFO not empty yet */
+  SPI_CTRL_BUSY         = 31  /**< SPI control register(31) (r/-): serial PHY busy or TX FIFO not empty yet or transfer in progress */
 };
 
 /** SPI data register bits */
@@ -59,7 +63,19 @@ enum NEORV32_SPI_DATA_enum {
   SPI_DATA_LSB  =  0, /**< SPI data register(0)  (r/w): Data byte LSB */
   SPI_DATA_CSEN =  3, /**< SPI data register(3)  (-/w): Chip select enable (command-mode) */
   SPI_DATA_MSB  =  7, /**< SPI data register(7)  (r/w): Data byte MSB */
-  SPI_DATA_CMD  = 31  /**< SPI data register(31) (-/w): 1=command, 0=data */
+  SPI_DATA_CMD  = 31  /**< SPI data register(31) (-/w): 1=command, 0=data; ignored during hardware-managed transfers */
+};
+
+/** SPI transfer register bits */
+enum NEORV32_SPI_XFER_enum {
+  SPI_XFER_NUM_LSB =  0, /**< SPI transfer register(0)  (r/w): Number of frames to transfer, LSB */
+  SPI_XFER_NUM_MSB = 23, /**< SPI transfer register(23) (r/w): Number of frames to transfer, MSB */
+  SPI_XFER_CS_LSB  = 24, /**< SPI transfer register(24) (r/w): Chip select for automatic CS, LSB */
+  SPI_XFER_CS_MSB  = 26, /**< SPI transfer register(26) (r/w): Chip select for automatic CS, MSB */
+  SPI_XFER_CSEN    = 27, /**< SPI transfer register(27) (r/w): Automatic chip select enable */
+  SPI_XFER_RXO     = 28, /**< SPI transfer register(28) (r/w): Receive-only (no TX data, send all-ones) */
+  SPI_XFER_TXO     = 29, /**< SPI transfer register(29) (r/w): Transmit-only (discard RX data) */
+  SPI_XFER_BUSY    = 31  /**< SPI transfer register(31) (r/-): Transfer in progress */
 };
 /**@}*/
 
@@ -86,6 +102,11 @@ int      neorv32_spi_rx_avail(void);
 int      neorv32_spi_tx_empty(void);
 int      neorv32_spi_tx_full(void);
 int      neorv32_spi_busy(void);
+void     neorv32_spi_set_dwidth(int bits);
+int      neorv32_spi_get_dwidth(void);
+int      neorv32_spi_rw(const void *tx, void *rx, int len);
+int      neorv32_spi_rw_cs(int cs, const void *tx, void *rx, int len);
+int      neorv32_spi_rw_dma(int cs, const void *tx, void *rx, int len);
 /**@}*/
 
 #endif // NEORV32_SPI_H
@@ -15,6 +15,7 @@
 #define NEORV32_TRACER_H
 
 #include <neorv32.h>
+#include "neorv32_uart.h"
 #include <stdint.h>
 
 /**********************************************************************//**
@@ -25,7 +26,7 @@
 typedef volatile struct __attribute__((packed,aligned(4))) {
   uint32_t       CTRL;      /**< control register (#NEORV32_TRACER_CTRL_enum) */
   uint32_t       STOP_ADDR; /**< stop tracing at this address */
-  const uint32_t DELTA_SRC; /**< trace data: delta source + first-packet flag */
+  const uint32_t DELTA_SRC; /**< trace data: delta source + first-packet flag; compressed trace stream in compressed mode */
   const uint32_t DELTA_DST; /**< trace data: delta destination + trap-entry flag */
 } neorv32_tracer_t;
 
@@ -42,7 +43,28 @@ enum NEORV32_TRACER_CTRL_enum {
   TRACER_CTRL_AVAIL   =  5, /**< TRACER control register (5) (r/-): Trace data available when set */
   TRACER_CTRL_IRQ_CLR =  6, /**< TRACER control register (6) (r/w): Clear pending interrupt when writing 1 */
   TRACER_CTRL_TBM_LSB =  7, /**< TRACER control register (7) (r/-): log2(trace buffer depth), LSB */
-  TRACER_CTRL_TBM_MSB = 10  /**< TRACER control register(10) (r/-): log2(trace buffer depth), MSB */
+  TRACER_CTRL_TBM_MSB = 10, /**< TRACER control register(10) (r/-): log2(trace buffer depth), MSB */
+  TRACER_CTRL_CMODE   = 11, /**< TRACER control register(11) (r/w): Compressed trace mode (branch maps + addresses) */
+  TRACER_CTRL_LOST    = 12  /**< TRACER control register(12) (r/-): Compressed trace data lost (trace buffer overflow) */
+};
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Compressed trace packet format (two words per packet, low word first)
+ **************************************************************************/
+/**@{*/
+/** Packet type (low word, bits 1:0) */
+enum NEORV32_TRACER_PKT_enum {
+  TRACER_PKT_BRANCH = 0b01, /**< branch map: bits 7:2 = number of branches, bits 31:8 + high word = taken flags (LSB = oldest) */
+  TRACER_PKT_ADDR   = 0b10  /**< address: bits 3:2 = kind, bit 4 = resync, bits 31:5 = instruction count; high word = address */
+};
+/** Address packet kind (low word, bits 3:2) */
+enum NEORV32_TRACER_ADDR_enum {
+  TRACER_ADDR_JUMP  = 0b00, /**< uninferable jump/trap return; address = jump target */
+  TRACER_ADDR_TRAP  = 0b01, /**< trap entry; address = first instruction of trap handler */
+  TRACER_ADDR_SYNC  = 0b10, /**< trace start/synchronization; address = next instruction */
+  TRACER_ADDR_STOP  = 0b11  /**< trace stop; address = last traced instruction */
 };
 /**@}*/
 
@@ -60,6 +82,11 @@ void     neorv32_tracer_irq_ack(void);
 int      neorv32_tracer_data_avail(void);
 uint32_t neorv32_tracer_data_get_src(void);
 uint32_t neorv32_tracer_data_get_dst(void);
+void     neorv32_tracer_stream_enable(int hsel, uint32_t stop_addr);
+int      neorv32_tracer_stream_lost(void);
+uint32_t neorv32_tracer_stream_get(void);
+int      neorv32_tracer_stream_dma(uint32_t *buffer, uint32_t num);
+void     neorv32_tracer_stream_dump(neorv32_uart_t *UARTx, const uint32_t *buffer, uint32_t num);
 /**@}*/
 
 
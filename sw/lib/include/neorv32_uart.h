@@ -26,6 +26,7 @@
 typedef volatile struct __attribute__((packed,aligned(4))) {
   uint32_t CTRL;  /**< offset 0: control register (#NEORV32_UART_CTRL_enum) */
   uint32_t DATA;  /**< offset 4: data register  (#NEORV32_UART_DATA_enum) */
+  uint32_t BAUD;  /**< offset 8: fractional baud rate generator / RX timeout configuration (#NEORV32_UART_BAUD_enum) */
 } neorv32_uart_t;
 
 /** UART0 module hardware handle (#neorv32_uart_t) */
@@ -51,6 +52,8 @@ enum NEORV32_UART_CTRL_enum {
   UART_CTRL_IRQ_RX_FULL   = 21, /**< UART control register(21) (r/w): Fire IRQ if RX FIFO full */
   UART_CTRL_IRQ_TX_EMPTY  = 22, /**< UART control register(22) (r/w): Fire IRQ if TX FIFO empty */
   UART_CTRL_IRQ_TX_NFULL  = 23, /**< UART control register(23) (r/w): Fire IRQ if TX FIFO not full */
+  UART_CTRL_IRQ_RX_TOUT   = 24, /**< UART control register(24) (r/w): Fire IRQ on RX timeout */
+  UART_CTRL_RX_TOUT       = 25, /**< UART control register(25) (r/-): RX timeout (RX FIFO not empty and line idle) */
 
   UART_CTRL_RX_OVER       = 30, /**< UART control register(30) (r/-): RX FIFO overflow */
   UART_CTRL_TX_BUSY       = 31  /**< UART control register(31) (r/-): Transmitter busy or TX FIFO not empty */
@@ -67,6 +70,34 @@ enum NEORV32_UART_DATA_enum {
   UART_DATA_TX_FIFO_SIZE_LSB = 12, /**< UART data register(12) (r/-): log2(RX FIFO size), LSB */
   UART_DATA_TX_FIFO_SIZE_MSB = 15, /**< UART data register(15) (r/-): log2(RX FIFO size), MSB */
 };
+
+/** UART baud register bits */
+enum NEORV32_UART_BAUD_enum {
+  UART_BAUD_FRAC_LSB =  0, /**< UART baud register(0)  (r/w): fractional divider (1/16 clock cycles), LSB */
+  UART_BAUD_FRAC_MSB =  3, /**< UART baud register(3)  (r/w): fractional divider (1/16 clock cycles), MSB */
+  UART_BAUD_DIV_LSB  =  4, /**< UART baud register(4)  (r/w): integer divider (clock cycles per sample), LSB */
+  UART_BAUD_DIV_MSB  = 19, /**< UART baud register(19) (r/w): integer divider (clock cycles per sample), MSB */
+  UART_BAUD_OSR_LSB  = 20, /**< UART baud register(20) (r/w): oversampling ratio (samples per bit) - 1, LSB */
+  UART_BAUD_OSR_MSB  = 23, /**< UART baud register(23) (r/w): oversampling ratio (samples per bit) - 1, MSB */
+  UART_BAUD_RTO_LSB  = 24, /**< UART baud register(24) (r/w): RX timeout (character times) - 1, LSB */
+  UART_BAUD_RTO_MSB  = 27, /**< UART baud register(27) (r/w): RX timeout (character times) - 1, MSB */
+  UART_BAUD_FEN      = 31  /**< UART baud register(31) (r/w): Use fractional baud rate generator */
+};
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Interrupt-driven buffered mode
+ **************************************************************************/
+/**@{*/
+/** UART buffered-mode statistics */
+typedef struct {
+  uint32_t tx_bytes;   /**< number of bytes moved from the TX ring buffer to the TX FIFO */
+  uint32_t rx_bytes;   /**< number of bytes moved from the RX FIFO to the RX ring buffer */
+  uint32_t rx_dropped; /**< received bytes dropped because the RX ring buffer was full (software overrun) */
+  uint32_t tx_stalls;  /**< number of times a blocking TX call had to wait for free TX ring buffer space */
+  uint32_t rx_overrun; /**< non-zero if the RX FIFO has overflowed (hardware overrun, #UART_CTRL_RX_OVER) */
+} neorv32_uart_stats_t;
 /**@}*/
 
 
@@ -78,6 +109,7 @@ int  neorv32_uart_available(neorv32_uart_t *UARTx);
 int  neorv32_uart_get_rx_fifo_depth(neorv32_uart_t *UARTx);
 int  neorv32_uart_get_tx_fifo_depth(neorv32_uart_t *UARTx);
 void neorv32_uart_setup(neorv32_uart_t *UARTx, uint32_t baudrate, uint32_t irq_mask);
+void neorv32_uart_set_rx_timeout(neorv32_uart_t *UARTx, int chars);
 void neorv32_uart_enable(neorv32_uart_t *UARTx);
 void neorv32_uart_disable(neorv32_uart_t *UARTx);
 void neorv32_uart_rtscts_enable(neorv32_uart_t *UARTx);
@@ -93,6 +125,12 @@ void neorv32_uart_puts(neorv32_uart_t *UARTx, const char *s);
 void neorv32_uart_vprintf(neorv32_uart_t *UARTx, const char *format, va_list args);
 void neorv32_uart_printf(neorv32_uart_t *UARTx, const char *format, ...);
 int  neorv32_uart_scan(neorv32_uart_t *UARTx, char *buffer, int max_size, int echo);
+int  neorv32_uart_write(neorv32_uart_t *UARTx, const void *buf, int len);
+int  neorv32_uart_read(neorv32_uart_t *UARTx, void *buf, int len);
+int  neorv32_uart_buffered_setup(neorv32_uart_t *UARTx, uint8_t *tx_buf, uint32_t tx_size, uint8_t *rx_buf, uint32_t rx_size);
+void neorv32_uart_buffered_disable(neorv32_uart_t *UARTx);
+void neorv32_uart_flush(neorv32_uart_t *UARTx);
+int  neorv32_uart_get_stats(neorv32_uart_t *UARTx, neorv32_uart_stats_t *stats);
 /**@}*/
 
 
@@ -104,6 +142,7 @@ int  neorv32_uart_scan(neorv32_uart_t *UARTx, char *buffer, int max_size, int ec
 #define neorv32_uart0_get_rx_fifo_depth()          neorv32_uart_get_rx_fifo_depth(NEORV32_UART0)
 #define neorv32_uart0_get_tx_fifo_depth()          neorv32_uart_get_tx_fifo_depth(NEORV32_UART0)
 #define neorv32_uart0_setup(baudrate, irq_mask)    neorv32_uart_setup(NEORV32_UART0, baudrate, irq_mask)
+#define neorv32_uart0_set_rx_timeout(chars)        neorv32_uart_set_rx_timeout(NEORV32_UART0, chars)
 #define neorv32_uart0_disable()                    neorv32_uart_disable(NEORV32_UART0)
 #define neorv32_uart0_enable()                     neorv32_uart_enable(NEORV32_UART0)
 #define neorv32_uart0_rtscts_disable()             neorv32_uart_rtscts_disable(NEORV32_UART0)
@@ -118,11 +157,15 @@ int  neorv32_uart_scan(neorv32_uart_t *UARTx, char *buffer, int max_size, int ec
 #define neorv32_uart0_puts(s)                      neorv32_uart_puts(NEORV32_UART0, s)
 #define neorv32_uart0_printf(...)                  neorv32_uart_printf(NEORV32_UART0, __VA_ARGS__)
 #define neorv32_uart0_scan(buffer, max_size, echo) neorv32_uart_scan(NEORV32_UART0, buffer, max_size, echo)
+#define neorv32_uart0_write(buf, len)              neorv32_uart_write(NEORV32_UART0, buf, len)
+#define neorv32_uart0_read(buf, len)               neorv32_uart_read(NEORV32_UART0, buf, len)
+#define neorv32_uart0_flush()                      neorv32_uart_flush(NEORV32_UART0)
 
 #define neorv32_uart1_available()                  neorv32_uart_available(NEORV32_UART1)
 #define neorv32_uart1_get_rx_fifo_depth()          neorv32_uart_get_rx_fifo_depth(NEORV32_UART1)
 #define neorv32_uart1_get_tx_fifo_depth()          neorv32_uart_get_tx_fifo_depth(NEORV32_UART1)
 #define neorv32_uart1_setup(baudrate, irq_mask)    neorv32_uart_setup(NEORV32_UART1, baudrate, irq_mask)
+#define neorv32_uart1_set_rx_timeout(chars)        neorv32_uart_set_rx_timeout(NEORV32_UART1, chars)
 #define neorv32_uart1_disable()                    neorv32_uart_disable(NEORV32_UART1)
 #define neorv32_uart1_enable()                     neorv32_uart_enable(NEORV32_UART1)
 #define neorv32_uart1_rtscts_disable()             neorv32_uart_rtscts_disable(NEORV32_UART1)
@@ -137,6 +180,9 @@ int  neorv32_uart_scan(neorv32_uart_t *UARTx, char *buffer, int max_size, int ec
 #define neorv32_uart1_puts(s)                      neorv32_uart_puts(NEORV32_UART1, s)
 #define neorv32_uart1_printf(...)                  neorv32_uart_printf(NEORV32_UART1, __VA_ARGS__)
 #define neorv32_uart1_scan(buffer, max_size, echo) neorv32_uart_scan(NEORV32_UART1, buffer, max_size, echo)
+#define neorv32_uart1_write(buf, len)              neorv32_uart_write(NEORV32_UART1, buf, len)
+#define neorv32_uart1_read(buf, len)               neorv32_uart_read(NEORV32_UART1, buf, len)
+#define neorv32_uart1_flush()                      neorv32_uart_flush(NEORV32_UART1)
 /**@}*/
 
 
@@ -0,0 +1,86 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_xip.h
+ * @brief Execute In-Place Module (XIP) HW driver header file.
+ */
+
+#ifndef NEORV32_XIP_H
+#define NEORV32_XIP_H
+
+#include <neorv32.h>
+#include <stdint.h>
+
+/**********************************************************************//**
+ * @name IO Device: Execute In-Place Module (XIP)
+ **************************************************************************/
+/**@{*/
+/** XIP module prototype */
+typedef volatile struct __attribute__((packed,aligned(4))) {
+  uint32_t CTRL; /**< offset 0: control register (#NEORV32_XIP_CTRL_enum) */
+  uint32_t DATA; /**< offset 4: direct mode data register (byte-wide) */
+} neorv32_xip_t;
+
+/** XIP module hardware handle (#neorv32_xip_t) */
+#define NEORV32_XIP ((neorv32_xip_t*) (NEORV32_XIP_BASE))
+
+/** XIP control register bits */
+enum NEORV32_XIP_CTRL_enum {
+  XIP_CTRL_EN        =  0, /**< XIP control register(0)  (r/w): Module enable */
+  XIP_CTRL_XIP_EN    =  1, /**< XIP control register(1)  (r/w): Memory window enable (disables direct mode) */
+  XIP_CTRL_HSPEED    =  2, /**< XIP control register(2)  (r/w): High-speed mode: SCK = clk/2 (PRSC and CDIV are ignored) */
+  XIP_CTRL_PRSC0     =  3, /**< XIP control register(3)  (r/w): Clock prescaler select bit 0 */
+  XIP_CTRL_PRSC1     =  4, /**< XIP control register(4)  (r/w): Clock prescaler select bit 1 */
+  XIP_CTRL_PRSC2     =  5, /**< XIP control register(5)  (r/w): Clock prescaler select bit 2 */
+  XIP_CTRL_CDIV0     =  6, /**< XIP control register(6)  (r/w): Clock divider bit 0 */
+  XIP_CTRL_CDIV1     =  7, /**< XIP control register(7)  (r/w): Clock divider bit 1 */
+  XIP_CTRL_CDIV2     =  8, /**< XIP control register(8)  (r/w): Clock divider bit 2 */
+  XIP_CTRL_CDIV3     =  9, /**< XIP control register(9)  (r/w): Clock divider bit 3 */
+  XIP_CTRL_ABYTES0   = 10, /**< XIP control register(10) (r/w): Number of address bytes - 1, bit 0 */
+  XIP_CTRL_ABYTES1   = 11, /**< XIP control register(11) (r/w): Number of address bytes - 1, bit 1 */
+  XIP_CTRL_MODE0     = 12, /**< XIP control register(12) (r/w): Read mode bit 0 (#NEORV32_XIP_MODE_enum) */
+  XIP_CTRL_MODE1     = 13, /**< XIP control register(13) (r/w): Read mode bit 1 (#NEORV32_XIP_MODE_enum) */
+  XIP_CTRL_DUMMY0    = 14, /**< XIP control register(14) (r/w): Number of dummy clock cycles, bit 0 */
+  XIP_CTRL_DUMMY4    = 18, /**< XIP control register(18) (r/w): Number of dummy clock cycles, bit 4 */
+  XIP_CTRL_RDCMD0    = 19, /**< XIP control register(19) (r/w): Read command, bit 0 */
+  XIP_CTRL_RDCMD7    = 26, /**< XIP control register(26) (r/w): Read command, bit 7 */
+  XIP_CTRL_CS        = 27, /**< XIP control register(27) (r/w): Direct mode chip-select enable */
+
+  XIP_CTRL_SESSION   = 30, /**< XIP control register(30) (r/-): Continuous read session active */
+  XIP_CTRL_BUSY      = 31  /**< XIP control register(31) (r/-): PHY busy */
+};
+
+/** XIP read modes (command - address - data lanes) */
+enum NEORV32_XIP_MODE_enum {
+  XIP_MODE_111 = 0, /**< 0: standard SPI, e.g. READ (0x03) or FAST_READ (0x0B) */
+  XIP_MODE_112 = 1, /**< 1: dual output, e.g. 0x3B */
+  XIP_MODE_114 = 2, /**< 2: quad output, e.g. 0x6B */
+  XIP_MODE_144 = 3  /**< 3: quad input/output, e.g. 0xEB (first two dummy cycles send mode bits 0xFF) */
+};
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Prototypes
+ **************************************************************************/
+/**@{*/
+int      neorv32_xip_available(void);
+void     neorv32_xip_setup(int prsc, int cdiv, int hspeed, int abytes, int mode, int dummy, uint8_t rdcmd);
+uint32_t neorv32_xip_get_clock_speed(void);
+void     neorv32_xip_disable(void);
+void     neorv32_xip_window_enable(void);
+void     neorv32_xip_window_disable(void);
+void     neorv32_xip_cs_enable(void);
+void     neorv32_xip_cs_disable(void);
+uint8_t  neorv32_xip_spi_trans(uint8_t tx_data);
+int      neorv32_xip_busy(void);
+/**@}*/
+
+
+#endif // NEORV32_XIP_H
@@ -0,0 +1,939 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_alloc.c
+ * @brief Fast memory allocators (fixed-size pools, TLSF heaps, per-hart arenas) source file.
+ *
+ * @note The general-purpose allocator is a two-level segregated fit (TLSF) allocator:
+ * malloc and free run in constant time. Free blocks are kept in 2^SL_LOG2 size classes per
+ * power of two; two bitmaps locate a suitable non-empty class with two find-first-set operations.
+ *
+ * @note All allocators are protected by a spinlock (A ISA extension) and run with interrupts
+ * disabled, so they can be used by both harts and from interrupt handlers. Heap meta data
+ * lives in cacheable memory, so the lock acquire reloads the data cache ("fence").
+ *
+ * @note Define NEORV32_ALLOC_NEWLIB (e.g. USER_FLAGS+=-DNEORV32_ALLOC_NEWLIB) to replace
+ * newlib's malloc, free, calloc and realloc by the per-hart arena allocator.
+ */
+
+#include <neorv32.h>
+#include <string.h>
+
+
+/**********************************************************************//**
+ * @name TLSF constants
+ **************************************************************************/
+/**@{*/
+#define TLSF_ALIGN_LOG2 3                                  // 8-byte alignment (RISC-V ILP32 ABI)
+#define TLSF_ALIGN      (1 << TLSF_ALIGN_LOG2)
+#define TLSF_SL_COUNT   (1 << NEORV32_TLSF_SL_LOG2)
+#define TLSF_FL_SHIFT   (NEORV32_TLSF_SL_LOG2 + TLSF_ALIGN_LOG2)
+#define TLSF_SMALL      (1 << TLSF_FL_SHIFT)               // blocks below this size use first-level class 0
+#define TLSF_FREE_BIT   (1 << 0)                           // block is free
+#define TLSF_PFREE_BIT  (1 << 1)                           // previous physical block is free
+#define TLSF_OVERHEAD   (sizeof(size_t))                   // per-block overhead of an allocated block
+#define TLSF_START      (sizeof(void*) + sizeof(size_t))   // offset of user data from block header
+#define TLSF_SIZE_MIN   (sizeof(tlsf_block_t) - sizeof(void*))
+#define TLSF_SIZE_MAX   ((uint32_t)1 << NEORV32_TLSF_FL_MAX)
+/**@}*/
+
+
+/**********************************************************************//**
+ * TLSF block header. "prev_phys" is stored in the last word of the previous
+ * block and is only valid if that block is free; "next_free" and "prev_free"
+ * are only valid if this block is free (they overlay the user data).
+ **************************************************************************/
+typedef struct tlsf_block_s {
+  struct tlsf_block_s *prev_phys; // previous physical block
+  size_t               size;      // payload size in bytes | free flags
+  struct tlsf_block_s *next_free; // next free block in this size class
+  struct tlsf_block_s *prev_free; // previous free block in this size class
+} tlsf_block_t;
+
+
+/**********************************************************************//**
+ * TLSF control structure (placed at the beginning of the heap memory).
+ **************************************************************************/
+struct neorv32_tlsf_s {
+  tlsf_block_t  null;                                           // free list terminator
+  uint32_t      fl_bitmap;                                      // non-empty first-level classes
+  uint32_t      sl_bitmap[NEORV32_TLSF_FL_COUNT];               // non-empty second-level classes
+  tlsf_block_t *blocks[NEORV32_TLSF_FL_COUNT][TLSF_SL_COUNT];   // free list heads
+  uint8_t      *begin;                                          // managed memory begin
+  uint8_t      *end;                                            // managed memory end
+  uint32_t      lock;                                           // spinlock (atomic accesses only)
+  uint32_t      total;                                          // statistics
+  uint32_t      used;
+  uint32_t      peak;
+  uint32_t      num_alloc;
+  uint32_t      num_fail;
+};
+
+
+/**********************************************************************//**
+ * Per-hart arenas.
+ **************************************************************************/
+static neorv32_tlsf_t *__neorv32_alloc_arena[NEORV32_ALLOC_HARTS];
+static uint32_t __neorv32_alloc_setup_lock; // serializes arena setup (atomic accesses only)
+
+
+// #################################################################################################
+// Locking
+// #################################################################################################
+
+/**********************************************************************//**
+ * Disable interrupts and acquire spinlock.
+ *
+ * @param[in,out] lock Pointer to lock variable.
+ * @return Previous mstatus CSR value.
+ **************************************************************************/
+static inline uint32_t __neorv32_alloc_lock(uint32_t *lock) {
+
+  uint32_t mstatus = neorv32_cpu_csr_read(CSR_MSTATUS);
+  neorv32_cpu_csr_clr(CSR_MSTATUS, 1 << CSR_MSTATUS_MIE);
+
+#if defined __riscv_atomic
+  while (neorv32_cpu_amoswap((uint32_t)lock, 1)) {
+    while (neorv32_cpu_amolr((uint32_t)lock)); // read-only spin (bypasses the data cache)
+  }
+  asm volatile ("fence" : : : "memory"); // reload data cache: meta data might have been modified by another hart
+#else
+  (void)lock;
+#endif
+
+  return mstatus;
+}
+
+
+/**********************************************************************//**
+ * Release spinlock and restore interrupts.
+ *
+ * @param[in,out] lock Pointer to lock variable.
+ * @param[in] mstatus Previous mstatus CSR value (from #__neorv32_alloc_lock).
+ **************************************************************************/
+static inline void __neorv32_alloc_unlock(uint32_t *lock, uint32_t mstatus) {
+
+#if defined __riscv_atomic
+  asm volatile ("fence" : : : "memory");
+  neorv32_cpu_amoswap((uint32_t)lock, 0);
+#else
+  (void)lock;
+#endif
+
+  if (mstatus & (1 << CSR_MSTATUS_MIE)) {
+    neorv32_cpu_csr_set(CSR_MSTATUS, 1 << CSR_MSTATUS_MIE);
+  }
+}
+
+
+// #################################################################################################
+// Fixed-Size Block Pools
+// #################################################################################################
+
+/**********************************************************************//**
+ * Initialize fixed-size block pool.
+ *
+ * @param[in,out] pool Pool handle.
+ * @param[in] memory Pool memory (4-byte aligned, at least block_size * num_blocks bytes).
+ * @param[in] block_size Size of each block in bytes (rounded up to a multiple of 4).
+ * @param[in] num_blocks Number of blocks.
+ * @return 0 if success, -1 if invalid configuration.
+ **************************************************************************/
+int neorv32_pool_init(neorv32_pool_t *pool, void *memory, uint32_t block_size, uint32_t num_blocks) {
+
+  block_size = (block_size + 3) & ~3;
+  if ((memory == NULL) || ((uint32_t)memory & 3) || (block_size == 0) || (num_blocks == 0)) {
+    return -1;
+  }
+
+  pool->start      = (uint8_t*)memory;
+  pool->end        = (uint8_t*)memory + block_size * num_blocks;
+  pool->block_size = block_size;
+  pool->num_blocks = num_blocks;
+  pool->num_used   = 0;
+  pool->peak       = 0;
+  pool->num_alloc  = 0;
+  pool->num_fail   = 0;
+  pool->lock       = 0;
+
+  // build free list; each free block stores a pointer to the next free block
+  uint8_t *blk = pool->start;
+  while (--num_blocks) {
+    *(void**)blk = (void*)(blk + block_size);
+    blk += block_size;
+  }
+  *(void**)blk = NULL;
+  pool->free = (void*)pool->start;
+
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Allocate one block from a pool (constant time).
+ *
+ * @param[in,out] pool Pool handle.
+ * @return Pointer to block or NULL if pool is exhausted.
+ **************************************************************************/
+void *neorv32_pool_alloc(neorv32_pool_t *pool) {
+
+  uint32_t mstatus = __neorv32_alloc_lock(&pool->lock);
+
+  void *blk = pool->free;
+  if (blk != NULL) {
+    pool->free = *(void**)blk;
+    pool->num_used++;
+    pool->num_alloc++;
+    if (pool->num_used > pool->peak) {
+      pool->peak = pool->num_used;
+    }
+  }
+  else {
+    pool->num_fail++;
+  }
+
+  __neorv32_alloc_unlock(&pool->lock, mstatus);
+  return blk;
+}
+
+
+/**********************************************************************//**
+ * Return block to a pool (constant time).
+ *
+ * @param[in,out] pool Pool handle.
+ * @param[in] ptr Block pointer (from #neorv32_pool_alloc). Pointers that do
+ * not belong to the pool are ignored.
+ **************************************************************************/
+void neorv32_pool_free(neorv32_pool_t *pool, void *ptr) {
+
+  if (((uint8_t*)ptr < pool->start) || ((uint8_t*)ptr >= pool->end)) {
+    return;
+  }
+
+  uint32_t mstatus = __neorv32_alloc_lock(&pool->lock);
+
+  *(void**)ptr = pool->free;
+  pool->free = ptr;
+  pool->num_used--;
+
+  __neorv32_alloc_unlock(&pool->lock, mstatus);
+}
+
+
+/**********************************************************************//**
+ * Get pool statistics.
+ *
+ * @param[in] pool Pool handle.
+ * @param[in,out] stats Statistics (#neorv32_alloc_stats_t).
+ **************************************************************************/
+void neorv32_pool_get_stats(neorv32_pool_t *pool, neorv32_alloc_stats_t *stats) {
+
+  uint32_t mstatus = __neorv32_alloc_lock(&pool->lock);
+
+  stats->total     = pool->num_blocks * pool->block_size;
+  stats->used      = pool->num_used * pool->block_size;
+  stats->peak      = pool->peak * pool->block_size;
+  stats->largest   = (pool->num_used < pool->num_blocks) ? pool->block_size : 0;
+  stats->fragment  = 0; // all blocks have the same size
+  stats->num_alloc = pool->num_alloc;
+  stats->num_fail  = pool->num_fail;
+
+  __neorv32_alloc_unlock(&pool->lock, mstatus);
+}
+
+
+// #################################################################################################
+// TLSF Block Helpers
+// #################################################################################################
+
+static inline uint32_t tlsf_fls(uint32_t x) { return 31 - __builtin_clz(x); } // x must not be zero
+static inline uint32_t tlsf_ffs(uint32_t x) { return __builtin_ctz(x); }      // x must not be zero
+
+static inline uint32_t tlsf_size(const tlsf_block_t *b) { return b->size & ~(TLSF_FREE_BIT | TLSF_PFREE_BIT); }
+static inline void tlsf_set_size(tlsf_block_t *b, uint32_t size) { b->size = size | (b->size & (TLSF_FREE_BIT | TLSF_PFREE_BIT)); }
+static inline int  tlsf_is_free(const tlsf_block_t *b) { return (int)(b->size & TLSF_FREE_BIT); }
+static inline int  tlsf_is_pfree(const tlsf_block_t *b) { return (int)(b->size & TLSF_PFREE_BIT); }
+static inline void tlsf_set_free(tlsf_block_t *b) { b->size |= TLSF_FREE_BIT; }
+static inline void tlsf_set_used(tlsf_block_t *b) { b->size &= ~TLSF_FREE_BIT; }
+static inline void tlsf_set_pfree(tlsf_block_t *b) { b->size |= TLSF_PFREE_BIT; }
+static inline void tlsf_set_pused(tlsf_block_t *b) { b->size &= ~TLSF_PFREE_BIT; }
+
+static inline tlsf_block_t *tlsf_from_ptr(const void *ptr) { return (tlsf_block_t*)((uint8_t*)ptr - TLSF_START); }
+static inline void *tlsf_to_ptr(const tlsf_block_t *b) { return (void*)((uint8_t*)b + TLSF_START); }
+static inline tlsf_block_t *tlsf_offset(const void *ptr, int32_t offset) { return (tlsf_block_t*)((uint8_t*)ptr + offset); }
+static inline tlsf_block_t *tlsf_next(const tlsf_block_t *b) { return tlsf_offset(tlsf_to_ptr(b), tlsf_size(b) - TLSF_OVERHEAD); }
+
+
+/**********************************************************************//**
+ * Link next physical block to this one and return it.
+ **************************************************************************/
+static inline tlsf_block_t *tlsf_link_next(tlsf_block_t *b) {
+
+  tlsf_block_t *next = tlsf_next(b);
+  next->prev_phys = b;
+  return next;
+}
+
+
+/**********************************************************************//**
+ * Mark block as free / used (also updates the next block's flags).
+ **************************************************************************/
+static inline void tlsf_mark_free(tlsf_block_t *b) {
+
+  tlsf_block_t *next = tlsf_link_next(b);
+  tlsf_set_pfree(next);
+  tlsf_set_free(b);
+}
+
+static inline void tlsf_mark_used(tlsf_block_t *b) {
+
+  tlsf_block_t *next = tlsf_next(b);
+  tlsf_set_pused(next);
+  tlsf_set_used(b);
+}
+
+
+/**********************************************************************//**
+ * Compute first- and second-level class index of a block size.
+ **************************************************************************/
+static inline void tlsf_mapping_insert(uint32_t size, uint32_t *fl, uint32_t *sl) {
+
+  if (size < TLSF_SMALL) {
+    *fl = 0;
+    *sl = size / (TLSF_SMALL / TLSF_SL_COUNT);
+  }
+  else {
+    uint32_t f = tlsf_fls(size);
+    *sl = (size >> (f - NEORV32_TLSF_SL_LOG2)) ^ (1 << NEORV32_TLSF_SL_LOG2);
+    *fl = f - (TLSF_FL_SHIFT - 1);
+  }
+}
+
+
+/**********************************************************************//**
+ * Compute the class index to search: round up to the next class so that
+ * any block of that class is large enough (good fit).
+ **************************************************************************/
+static inline void tlsf_mapping_search(uint32_t size, uint32_t *fl, uint32_t *sl) {
+
+  if (size >= TLSF_SMALL) {
+    size += (1 << (tlsf_fls(size) - NEORV32_TLSF_SL_LOG2)) - 1;
+  }
+  tlsf_mapping_insert(size, fl, sl);
+}
+
+
+/**********************************************************************//**
+ * Find the first non-empty free list at or above the given class.
+ **************************************************************************/
+static tlsf_block_t *tlsf_search(neorv32_tlsf_t *t, uint32_t *fl, uint32_t *sl) {
+
+  uint32_t sl_map = t->sl_bitmap[*fl] & (~0U << *sl);
+  if (sl_map == 0) {
+    uint32_t fl_map = t->fl_bitmap & (~0U << (*fl + 1));
+    if (fl_map == 0) {
+      return NULL; // out of memory
+    }
+    *fl = tlsf_ffs(fl_map);
+    sl_map = t->sl_bitmap[*fl];
+  }
+  *sl = tlsf_ffs(sl_map);
+  return t->blocks[*fl][*sl];
+}
+
+
+/**********************************************************************//**
+ * Remove a free block from its free list.
+ **************************************************************************/
+static void tlsf_remove_free(neorv32_tlsf_t *t, tlsf_block_t *b, uint32_t fl, uint32_t sl) {
+
+  tlsf_block_t *prev = b->prev_free;
+  tlsf_block_t *next = b->next_free;
+  next->prev_free = prev;
+  prev->next_free = next;
+
+  if (t->blocks[fl][sl] == b) {
+    t->blocks[fl][sl] = next;
+    if (next == &t->null) { // list is empty now
+      t->sl_bitmap[fl] &= ~(1U << sl);
+      if (t->sl_bitmap[fl] == 0) {
+        t->fl_bitmap &= ~(1U << fl);
+      }
+    }
+  }
+}
+
+
+/**********************************************************************//**
+ * Insert a free block into its free list.
+ **************************************************************************/
+static void tlsf_insert_free(neorv32_tlsf_t *t, tlsf_block_t *b, uint32_t fl, uint32_t sl) {
+
+  tlsf_block_t *head = t->blocks[fl][sl];
+  b->next_free = head;
+  b->prev_free = &t->null;
+  head->prev_free = b;
+  t->blocks[fl][sl] = b;
+  t->fl_bitmap |= (1U << fl);
+  t->sl_bitmap[fl] |= (1U << sl);
+}
+
+static inline void tlsf_remove(neorv32_tlsf_t *t, tlsf_block_t *b) {
+  uint32_t fl, sl;
+  tlsf_mapping_insert(tlsf_size(b), &fl, &sl);
+  tlsf_remove_free(t, b, fl, sl);
+}
+
+static inline void tlsf_insert(neorv32_tlsf_t *t, tlsf_block_t *b) {
+  uint32_t fl, sl;
+  tlsf_mapping_insert(tlsf_size(b), &fl, &sl);
+  tlsf_insert_free(t, b, fl, sl);
+}
+
+
+/**********************************************************************//**
+ * Split block; returns the remaining (free) tail block.
+ **************************************************************************/
+static tlsf_block_t *tlsf_split(tlsf_block_t *b, uint32_t size) {
+
+  tlsf_block_t *rem = tlsf_offset(tlsf_to_ptr(b), size - TLSF_OVERHEAD);
+  uint32_t rem_size = tlsf_size(b) - (size + TLSF_OVERHEAD);
+  tlsf_set_size(rem, rem_size);
+  tlsf_set_size(b, size);
+  tlsf_mark_free(rem);
+  return rem;
+}
+
+static inline int tlsf_can_split(const tlsf_block_t *b, uint32_t size) {
+  return tlsf_size(b) >= (sizeof(tlsf_block_t) + size);
+}
+
+
+/**********************************************************************//**
+ * Coalesce block with its free neighbours.
+ **************************************************************************/
+static tlsf_block_t *tlsf_absorb(tlsf_block_t *prev, tlsf_block_t *b) {
+
+  prev->size += tlsf_size(b) + TLSF_OVERHEAD;
+  tlsf_link_next(prev);
+  return prev;
+}
+
+static tlsf_block_t *tlsf_merge_prev(neorv32_tlsf_t *t, tlsf_block_t *b) {
+
+  if (tlsf_is_pfree(b)) {
+    tlsf_block_t *prev = b->prev_phys;
+    tlsf_remove(t, prev);
+    b = tlsf_absorb(prev, b);
+  }
+  return b;
+}
+
+static tlsf_block_t *tlsf_merge_next(neorv32_tlsf_t *t, tlsf_block_t *b) {
+
+  tlsf_block_t *next = tlsf_next(b);
+  if (tlsf_is_free(next)) {
+    tlsf_remove(t, next);
+    b = tlsf_absorb(b, next);
+  }
+  return b;
+}
+
+
+/**********************************************************************//**
+ * Return unused tail of a block to the free lists.
+ **************************************************************************/
+static void tlsf_trim_free(neorv32_tlsf_t *t, tlsf_block_t *b, uint32_t size) {
+
+  if (tlsf_can_split(b, size)) {
+    tlsf_block_t *rem = tlsf_split(b, size);
+    tlsf_link_next(b);
+    tlsf_set_pfree(rem);
+    tlsf_insert(t, rem);
+  }
+}
+
+static void tlsf_trim_used(neorv32_tlsf_t *t, tlsf_block_t *b, uint32_t size) {
+
+  if (tlsf_can_split(b, size)) {
+    tlsf_block_t *rem = tlsf_split(b, size);
+    tlsf_set_pused(rem);
+    rem = tlsf_merge_next(t, rem);
+    tlsf_insert(t, rem);
+  }
+}
+
+
+/**********************************************************************//**
+ * Convert a request size into a block size; returns 0 if impossible.
+ * Block size plus overhead is always a multiple of TLSF_ALIGN, so the user
+ * data of the next physical block stays aligned.
+ **************************************************************************/
+static inline uint32_t tlsf_adjust(size_t size) {
+
+  if ((size == 0) || (size >= TLSF_SIZE_MAX)) {
+    return 0;
+  }
+  uint32_t aligned = (((uint32_t)size + TLSF_OVERHEAD + (TLSF_ALIGN - 1)) & ~(TLSF_ALIGN - 1)) - TLSF_OVERHEAD;
+  return (aligned < TLSF_SIZE_MIN) ? TLSF_SIZE_MIN : aligned;
+}
+
+
+/**********************************************************************//**
+ * Statistics bookkeeping.
+ **************************************************************************/
+static inline void tlsf_account(neorv32_tlsf_t *t, int32_t delta) {
+
+  t->used += delta;
+  if (t->used > t->peak) {
+    t->peak = t->used;
+  }
+}
+
+
+/**********************************************************************//**
+ * Allocate (lock must be held).
+ **************************************************************************/
+static void *tlsf_malloc_locked(neorv32_tlsf_t *t, size_t size) {
+
+  uint32_t adjust = tlsf_adjust(size);
+  tlsf_block_t *b = NULL;
+
+  if (adjust) {
+    uint32_t fl, sl;
+    tlsf_mapping_search(adjust, &fl, &sl);
+    if (fl < NEORV32_TLSF_FL_COUNT) {
+      b = tlsf_search(t, &fl, &sl);
+      if (b != NULL) {
+        tlsf_remove_free(t, b, fl, sl);
+      }
+    }
+  }
+
+  if (b == NULL) {
+    t->num_fail++;
+    return NULL;
+  }
+
+  tlsf_trim_free(t, b, adjust);
+  tlsf_mark_used(b);
+  t->num_alloc++;
+  tlsf_account(t, (int32_t)(tlsf_size(b) + TLSF_OVERHEAD));
+  return tlsf_to_ptr(b);
+}
+
+
+/**********************************************************************//**
+ * Free (lock must be held).
+ **************************************************************************/
+static void tlsf_free_locked(neorv32_tlsf_t *t, void *ptr) {
+
+  tlsf_block_t *b = tlsf_from_ptr(ptr);
+  tlsf_account(t, -(int32_t)(tlsf_size(b) + TLSF_OVERHEAD));
+  tlsf_mark_free(b);
+  b = tlsf_merge_prev(t, b);
+  b = tlsf_merge_next(t, b);
+  tlsf_insert(t, b);
+}
+
+
+// #################################################################################################
+// TLSF Heap
+// #################################################################################################
+
+/**********************************************************************//**
+ * Create TLSF heap in the given memory. The control structure (about 1.3kB)
+ * is placed at the beginning of the memory.
+ *
+ * @param[in] memory Heap memory (8-byte aligned).
+ * @param[in] size Size of heap memory in bytes.
+ * @return Heap handle or NULL if memory is too small.
+ **************************************************************************/
+neorv32_tlsf_t *neorv32_tlsf_init(void *memory, uint32_t size) {
+
+  // the first block's size word follows the control structure, its user data has to be aligned
+  uint32_t ctrl_size = ((sizeof(neorv32_tlsf_t) + TLSF_OVERHEAD + (TLSF_ALIGN - 1)) & ~(TLSF_ALIGN - 1)) - TLSF_OVERHEAD;
+
+  if ((memory == NULL) || ((uint32_t)memory & (TLSF_ALIGN - 1)) ||
+      (size < (ctrl_size + 2 * TLSF_OVERHEAD + TLSF_SIZE_MIN))) {
+    return NULL;
+  }
+
+  // initialize control structure
+  neorv32_tlsf_t *t = (neorv32_tlsf_t*)memory;
+  t->null.next_free = &t->null;
+  t->null.prev_free = &t->null;
+  t->fl_bitmap = 0;
+  uint32_t i, j;
+  for (i=0; i<NEORV32_TLSF_FL_COUNT; i++) {
+    t->sl_bitmap[i] = 0;
+    for (j=0; j<TLSF_SL_COUNT; j++) {
+      t->blocks[i][j] = &t->null;
+    }
+  }
+
+  // usable pool: one big free block followed by a zero-sized "last" sentinel block
+  uint8_t *pool = (uint8_t*)memory + ctrl_size;
+  uint32_t pool_size = ((size - ctrl_size - TLSF_OVERHEAD) & ~(TLSF_ALIGN - 1)) - TLSF_OVERHEAD;
+  if (pool_size > (TLSF_SIZE_MAX - TLSF_ALIGN - TLSF_OVERHEAD)) {
+    pool_size = TLSF_SIZE_MAX - TLSF_ALIGN - TLSF_OVERHEAD;
+  }
+
+  tlsf_block_t *b = tlsf_offset(pool, -(int32_t)TLSF_OVERHEAD); // "prev_phys" of the first block is never used
+  b->size = pool_size;
+  tlsf_set_free(b);
+  tlsf_set_pused(b);
+  tlsf_insert(t, b);
+
+  tlsf_block_t *last = tlsf_link_next(b);
+  last->size = 0;
+  tlsf_set_used(last);
+  tlsf_set_pfree(last);
+
+  t->begin     = pool;
+  t->end       = pool + pool_size;
+  t->lock      = 0;
+  t->total     = pool_size;
+  t->used      = 0;
+  t->peak      = 0;
+  t->num_alloc = 0;
+  t->num_fail  = 0;
+
+  return t;
+}
+
+
+/**********************************************************************//**
+ * Allocate memory from TLSF heap (constant time).
+ *
+ * @param[in,out] tlsf Heap handle.
+ * @param[in] size Number of bytes.
+ * @return Pointer to 8-byte aligned memory or NULL if out of memory.
+ **************************************************************************/
+void *neorv32_tlsf_malloc(neorv32_tlsf_t *tlsf, size_t size) {
+
+  uint32_t mstatus = __neorv32_alloc_lock(&tlsf->lock);
+  void *p = tlsf_malloc_locked(tlsf, size);
+  __neorv32_alloc_unlock(&tlsf->lock, mstatus);
+  return p;
+}
+
+
+/**********************************************************************//**
+ * Return memory to TLSF heap (constant time).
+ *
+ * @param[in,out] tlsf Heap handle.
+ * @param[in] ptr Pointer from #neorv32_tlsf_malloc or #neorv32_tlsf_realloc (can be NULL).
+ **************************************************************************/
+void neorv32_tlsf_free(neorv32_tlsf_t *tlsf, void *ptr) {
+
+  if (ptr == NULL) {
+    return;
+  }
+
+  uint32_t mstatus = __neorv32_alloc_lock(&tlsf->lock);
+  tlsf_free_locked(tlsf, ptr);
+  __neorv32_alloc_unlock(&tlsf->lock, mstatus);
+}
+
+
+/**********************************************************************//**
+ * Resize memory block. Grows in-place if the next physical block is free.
+ *
+ * @param[in,out] tlsf Heap handle.
+ * @param[in] ptr Pointer to current block (NULL: same as malloc).
+ * @param[in] size New size in bytes (0: same as free).
+ * @return Pointer to resized block or NULL if out of memory (old block is not modified then).
+ **************************************************************************/
+void *neorv32_tlsf_realloc(neorv32_tlsf_t *tlsf, void *ptr, size_t size) {
+
+  if (ptr == NULL) {
+    return neorv32_tlsf_malloc(tlsf, size);
+  }
+  if (size == 0) {
+    neorv32_tlsf_free(tlsf, ptr);
+    return NULL;
+  }
+
+  uint32_t mstatus = __neorv32_alloc_lock(&tlsf->lock);
+
+  void *p = NULL;
+  tlsf_block_t *b = tlsf_from_ptr(ptr);
+  tlsf_block_t *next = tlsf_next(b);
+  uint32_t cur = tlsf_size(b);
+  uint32_t combined = cur + tlsf_size(next) + TLSF_OVERHEAD;
+  uint32_t adjust = tlsf_adjust(size);
+
+  if (adjust == 0) {
+    tlsf->num_fail++;
+  }
+  else if ((adjust > cur) && ((!tlsf_is_free(next)) || (adjust > combined))) { // relocate
+    p = tlsf_malloc_locked(tlsf, size);
+    if (p != NULL) {
+      memcpy(p, ptr, cur);
+      tlsf_free_locked(tlsf, ptr);
+    }
+  }
+  else { // resize in-place
+    tlsf_account(tlsf, -(int32_t)cur);
+    if (adjust > cur) {
+      tlsf_merge_next(tlsf, b);
+      tlsf_mark_used(b);
+    }
+    tlsf_trim_used(tlsf, b, adjust);
+    tlsf_account(tlsf, (int32_t)tlsf_size(b));
+    p = ptr;
+  }
+
+  __neorv32_alloc_unlock(&tlsf->lock, mstatus);
+  return p;
+}
+
+
+/**********************************************************************//**
+ * Check if a pointer belongs to a TLSF heap.
+ *
+ * @param[in] tlsf Heap handle.
+ * @param[in] ptr Pointer to check.
+ * @return Non-zero if ptr is inside the heap's memory.
+ **************************************************************************/
+int neorv32_tlsf_owns(neorv32_tlsf_t *tlsf, void *ptr) {
+
+  return (int)((tlsf != NULL) && ((uint8_t*)ptr >= tlsf->begin) && ((uint8_t*)ptr < tlsf->end));
+}
+
+
+/**********************************************************************//**
+ * Get TLSF heap statistics. Walks all blocks of the heap (not constant time).
+ *
+ * @param[in] tlsf Heap handle.
+ * @param[in,out] stats Statistics (#neorv32_alloc_stats_t).
+ **************************************************************************/
+void neorv32_tlsf_get_stats(neorv32_tlsf_t *tlsf, neorv32_alloc_stats_t *stats) {
+
+  uint32_t mstatus = __neorv32_alloc_lock(&tlsf->lock);
+
+  uint32_t free = 0, largest = 0;
+  tlsf_block_t *b = tlsf_offset(tlsf->begin, -(int32_t)TLSF_OVERHEAD);
+  while (tlsf_size(b) != 0) {
+    if (tlsf_is_free(b)) {
+      free += tlsf_size(b);
+      if (tlsf_size(b) > largest) {
+        largest = tlsf_size(b);
+      }
+    }
+    b = tlsf_next(b);
+  }
+
+  stats->total     = tlsf->total;
+  stats->used      = tlsf->used;
+  stats->peak      = tlsf->peak;
+  stats->largest   = largest;
+  stats->fragment  = (free != 0) ? (100 - (uint32_t)(((uint64_t)largest * 100) / free)) : 0;
+  stats->num_alloc = tlsf->num_alloc;
+  stats->num_fail  = tlsf->num_fail;
+
+  __neorv32_alloc_unlock(&tlsf->lock, mstatus);
+}
+
+
+// #################################################################################################
+// Per-Hart Arenas
+// #################################################################################################
+
+/**********************************************************************//**
+ * Split the linker-defined heap (NEORV32_HEAP_BEGIN .. NEORV32_HEAP_END)
+ * into one TLSF arena per hart. Should be called once by hart 0 before any
+ * hart allocates memory (#neorv32_alloc_malloc calls this function with an
+ * equal split if it has not been called before). The arenas are set up only
+ * once: the setup is serialized by a spinlock and later calls (from any hart)
+ * do not touch the arenas that are already in use.
+ *
+ * @warning Do not mix with newlib's malloc (both use the same heap memory)
+ * unless NEORV32_ALLOC_NEWLIB is defined.
+ *
+ * @param[in] hart0_share Percentage of the heap assigned to hart 0 (1..100).
+ * Ignored (= 100) on single-core systems.
+ * @return 0 if success, -1 if there is no (or not enough) heap memory or if
+ * the arenas have already been set up.
+ **************************************************************************/
+int neorv32_alloc_setup(uint32_t hart0_share) {
+
+  uint32_t begin = (NEORV32_HEAP_BEGIN + (TLSF_ALIGN - 1)) & ~(TLSF_ALIGN - 1);
+  uint32_t size  = (NEORV32_HEAP_END - begin) & ~(TLSF_ALIGN - 1);
+  uint32_t harts = (NEORV32_SYSINFO->MISC >> SYSINFO_MISC_HART_LSB) & 0xf;
+
+  if ((NEORV32_HEAP_SIZE == 0) || (NEORV32_HEAP_END <= begin)) {
+    return -1;
+  }
+  if ((harts < 2) || (hart0_share >= 100) || (hart0_share == 0)) {
+    hart0_share = 100;
+  }
+
+  uint32_t size0 = (uint32_t)(((uint64_t)size * hart0_share) / 100) & ~(TLSF_ALIGN - 1);
+  int rc = -1;
+
+  uint32_t mstatus = __neorv32_alloc_lock(&__neorv32_alloc_setup_lock);
+  if (__neorv32_alloc_arena[0] == NULL) { // never re-initialize arenas that might be in use
+    neorv32_tlsf_t *arena0 = neorv32_tlsf_init((void*)begin, size0);
+    neorv32_tlsf_t *arena1 = (hart0_share < 100) ? neorv32_tlsf_init((void*)(begin + size0), size - size0) : NULL;
+    asm volatile ("fence" : : : "memory"); // heaps are initialized before they get published
+    __neorv32_alloc_arena[1] = arena1;
+    __neorv32_alloc_arena[0] = arena0;
+    rc = (arena0 == NULL) ? -1 : 0;
+  }
+  __neorv32_alloc_unlock(&__neorv32_alloc_setup_lock, mstatus); // make arena pointers visible to the other hart
+
+  return rc;
+}
+
+
+/**********************************************************************//**
+ * Find arena owning a pointer.
+ *
+ * @param[in] ptr Pointer to check.
+ * @return Arena handle or NULL if not found.
+ **************************************************************************/
+static neorv32_tlsf_t *__neorv32_alloc_owner(void *ptr) {
+
+  int i;
+  for (i=0; i<NEORV32_ALLOC_HARTS; i++) {
+    if (neorv32_tlsf_owns(__neorv32_alloc_arena[i], ptr)) {
+      return __neorv32_alloc_arena[i];
+    }
+  }
+  return NULL;
+}
+
+
+/**********************************************************************//**
+ * Allocate memory from the calling hart's arena. Falls back to the other
+ * arena if the own arena is exhausted.
+ *
+ * @param[in] size Number of bytes.
+ * @return Pointer to 8-byte aligned memory or NULL if out of memory.
+ **************************************************************************/
+void *neorv32_alloc_malloc(size_t size) {
+
+  if (__neorv32_alloc_arena[0] == NULL) {
+    neorv32_alloc_setup(50); // no-op if the other hart has set up the arenas in the meantime
+    if (__neorv32_alloc_arena[0] == NULL) {
+      return NULL;
+    }
+  }
+
+  uint32_t hart = neorv32_cpu_csr_read(CSR_MHARTID) & (NEORV32_ALLOC_HARTS - 1);
+  void *p = NULL;
+  uint32_t i;
+  for (i=0; i<NEORV32_ALLOC_HARTS; i++) {
+    neorv32_tlsf_t *arena = __neorv32_alloc_arena[(hart + i) & (NEORV32_ALLOC_HARTS - 1)];
+    if (arena != NULL) {
+      p = neorv32_tlsf_malloc(arena, size);
+      if (p != NULL) {
+        break;
+      }
+    }
+  }
+  return p;
+}
+
+
+/**********************************************************************//**
+ * Allocate zero-initialized memory for an array.
+ *
+ * @param[in] num Number of elements.
+ * @param[in] size Size of each element in bytes.
+ * @return Pointer to memory or NULL if out of memory.
+ **************************************************************************/
+void *neorv32_alloc_calloc(size_t num, size_t size) {
+
+  uint64_t bytes = (uint64_t)num * (uint64_t)size;
+  if (bytes >> 32) {
+    return NULL; // overflow
+  }
+
+  void *p = neorv32_alloc_malloc((size_t)bytes);
+  if (p != NULL) {
+    memset(p, 0, (size_t)bytes);
+  }
+  return p;
+}
+
+
+/**********************************************************************//**
+ * Resize memory block (in the arena that owns it).
+ *
+ * @param[in] ptr Pointer to current block (NULL: same as malloc).
+ * @param[in] size New size in bytes (0: same as free).
+ * @return Pointer to resized block or NULL if out of memory.
+ **************************************************************************/
+void *neorv32_alloc_realloc(void *ptr, size_t size) {
+
+  if (ptr == NULL) {
+    return neorv32_alloc_malloc(size);
+  }
+
+  neorv32_tlsf_t *owner = __neorv32_alloc_owner(ptr);
+  if (owner == NULL) {
+    return NULL;
+  }
+  return neorv32_tlsf_realloc(owner, ptr, size);
+}
+
+
+/**********************************************************************//**
+ * Free memory. Memory can be freed by any hart; it is returned to the
+ * arena it was allocated from.
+ *
+ * @param[in] ptr Pointer to memory (can be NULL).
+ **************************************************************************/
+void neorv32_alloc_free(void *ptr) {
+
+  neorv32_tlsf_t *owner = __neorv32_alloc_owner(ptr);
+  if (owner != NULL) {
+    neorv32_tlsf_free(owner, ptr);
+  }
+}
+
+
+/**********************************************************************//**
+ * Get per-hart arena statistics.
+ *
+ * @param[in] hart Hart ID.
+ * @param[in,out] stats Statistics (#neorv32_alloc_stats_t).
+ * @return 0 if success, -1 if there is no arena for this hart.
+ **************************************************************************/
+int neorv32_alloc_get_stats(int hart, neorv32_alloc_stats_t *stats) {
+
+  if ((hart < 0) || (hart >= NEORV32_ALLOC_HARTS) || (__neorv32_alloc_arena[hart] == NULL)) {
+    return -1;
+  }
+  neorv32_tlsf_get_stats(__neorv32_alloc_arena[hart], stats);
+  return 0;
+}
+
+
+// #################################################################################################
+// Newlib Integration
+// #################################################################################################
+#ifdef NEORV32_ALLOC_NEWLIB
+
+#include <reent.h>
+
+void *malloc(size_t size) { return neorv32_alloc_malloc(size); }
+void  free(void *ptr) { neorv32_alloc_free(ptr); }
+void *calloc(size_t num, size_t size) { return neorv32_alloc_calloc(num, size); }
+void *realloc(void *ptr, size_t size) { return neorv32_alloc_realloc(ptr, size); }
+
+void *_malloc_r(struct _reent *r, size_t size) { (void)r; return neorv32_alloc_malloc(size); }
+void  _free_r(struct _reent *r, void *ptr) { (void)r; neorv32_alloc_free(ptr); }
+void *_calloc_r(struct _reent *r, size_t num, size_t size) { (void)r; return neorv32_alloc_calloc(num, size); }
+void *_realloc_r(struct _reent *r, void *ptr, size_t size) { (void)r; return neorv32_alloc_realloc(ptr, size); }
+
+#endif // NEORV32_ALLOC_NEWLIB
@@ -281,6 +281,611 @@ void neorv32_aux_itoa(char *buffer, uint32_t num, uint32_t base) {
 }
 
 
+// #################################################################################################
+// Formatted output
+// #################################################################################################
+
+/**********************************************************************//**
+ * Format specifier flags.
+ **************************************************************************/
+enum {
+  FMT_LEFT  = 1 << 0, // '-': left-justify
+  FMT_ZERO  = 1 << 1, // '0': pad with zeros
+  FMT_PLUS  = 1 << 2, // '+': always print sign
+  FMT_SPACE = 1 << 3, // ' ': space instead of '+'
+  FMT_ALT   = 1 << 4, // '#': alternate form
+  FMT_UPPER = 1 << 5, // upper-case digits/prefix
+  FMT_PREC  = 1 << 6, // precision given
+  FMT_WIDTH = 1 << 7  // width given
+};
+
+
+/**********************************************************************//**
+ * Put a single char into the output sink.
+ *
+ * @param[in,out] sink Output sink.
+ * @param[in] c Char to output.
+ **************************************************************************/
+static inline __attribute__((always_inline)) void __neorv32_aux_out(neorv32_aux_sink_t *sink, char c) {
+
+  if ((sink->pos >= sink->size) && (sink->flush != NULL)) {
+    sink->flush(sink);
+  }
+  if (sink->pos < sink->size) {
+    sink->buf[sink->pos++] = c;
+  }
+  sink->total++;
+}
+
+
+/**********************************************************************//**
+ * Put a char n times into the output sink.
+ *
+ * @param[in,out] sink Output sink.
+ * @param[in] c Char to output.
+ * @param[in] n Number of repetitions (no output if <= 0).
+ **************************************************************************/
+static void __neorv32_aux_pad(neorv32_aux_sink_t *sink, char c, int n) {
+
+  while (n-- > 0) {
+    __neorv32_aux_out(sink, c);
+  }
+}
+
+
+/**********************************************************************//**
+ * Put a string of given length into the output sink.
+ *
+ * @param[in,out] sink Output sink.
+ * @param[in] s Pointer to string.
+ * @param[in] n Number of chars.
+ **************************************************************************/
+static void __neorv32_aux_write(neorv32_aux_sink_t *sink, const char *s, int n) {
+
+  while (n-- > 0) {
+    __neorv32_aux_out(sink, *s++);
+  }
+}
+
+
+/**********************************************************************//**
+ * Unsigned division by 10 without a hardware divider: multiply with the
+ * reciprocal (0.1 = 0.000110011001100...b) using shifts and additions only
+ * and correct the (at most off-by-one) estimate via the remainder.
+ *
+ * @param[in] n Dividend.
+ * @param[in,out] rem Remainder (n % 10).
+ * @return Quotient (n / 10).
+ **************************************************************************/
+static inline uint32_t __neorv32_aux_divu10(uint32_t n, uint32_t *rem) {
+
+  uint32_t q = (n >> 1) + (n >> 2);
+  q += q >> 4;
+  q += q >> 8;
+  q += q >> 16;
+  q >>= 3;
+  uint32_t r = n - ((q << 3) + (q << 1));
+  if (r > 9) {
+    q++;
+    r -= 10;
+  }
+  *rem = r;
+  return q;
+}
+
+
+/**********************************************************************//**
+ * 64-bit version of #__neorv32_aux_divu10.
+ *
+ * @param[in] n Dividend.
+ * @param[in,out] rem Remainder (n % 10).
+ * @return Quotient (n / 10).
+ **************************************************************************/
+static uint64_t __neorv32_aux_divu10_64(uint64_t n, uint32_t *rem) {
+
+  uint64_t q = (n >> 1) + (n >> 2);
+  q += q >> 4;
+  q += q >> 8;
+  q += q >> 16;
+  q += q >> 32;
+  q >>= 3;
+  uint32_t r = (uint32_t)(n - ((q << 3) + (q << 1)));
+  if (r > 9) {
+    q++;
+    r -= 10;
+  }
+  *rem = r;
+  return q;
+}
+
+
+/**********************************************************************//**
+ * Convert unsigned number to string (right-aligned, no termination).
+ *
+ * @param[in,out] end Pointer to the end of the output buffer (digits are stored in front of it).
+ * @param[in] num Number to convert.
+ * @param[in] shift log2 of the base for base 2, 8 and 16; 0 for decimal.
+ * @param[in] upper Use upper-case hex digits when non-zero.
+ * @return Pointer to the first (most significant) digit.
+ **************************************************************************/
+static char *__neorv32_aux_utoa(char *end, uint64_t num, int shift, int upper) {
+
+  const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+  uint32_t r = 0;
+
+  if (shift) { // power of two base
+    uint32_t mask = (1 << shift) - 1;
+    do {
+      *--end = digits[(uint32_t)num & mask];
+      num >>= shift;
+    } while (num);
+    return end;
+  }
+
+  while (num >> 32) { // 64-bit decimal
+    num = __neorv32_aux_divu10_64(num, &r);
+    *--end = (char)('0' + r);
+  }
+  uint32_t n = (uint32_t)num; // 32-bit decimal
+  do {
+    n = __neorv32_aux_divu10(n, &r);
+    *--end = (char)('0' + r);
+  } while (n);
+  return end;
+}
+
+
+/**********************************************************************//**
+ * Output a converted number with sign/prefix, precision and padding.
+ *
+ * @param[in,out] sink Output sink.
+ * @param[in] prefix Sign and/or base prefix (zero-terminated, may be empty).
+ * @param[in] digits Pointer to the digits.
+ * @param[in] ndigits Number of digits.
+ * @param[in] zeros Number of additional leading zeros (precision).
+ * @param[in] width Minimum field width.
+ * @param[in] flags Format flags.
+ **************************************************************************/
+static void __neorv32_aux_field(neorv32_aux_sink_t *sink, const char *prefix, const char *digits,
+                                int ndigits, int zeros, int width, int flags) {
+
+  int nprefix = 0;
+  while (prefix[nprefix]) {
+    nprefix++;
+  }
+
+  int pad = width - (nprefix + zeros + ndigits);
+  if ((flags & (FMT_LEFT | FMT_ZERO)) == FMT_ZERO) { // zero padding after prefix
+    zeros += (pad > 0) ? pad : 0;
+    pad = 0;
+  }
+
+  if ((flags & FMT_LEFT) == 0) {
+    __neorv32_aux_pad(sink, ' ', pad);
+  }
+  __neorv32_aux_write(sink, prefix, nprefix);
+  __neorv32_aux_pad(sink, '0', zeros);
+  __neorv32_aux_write(sink, digits, ndigits);
+  if (flags & FMT_LEFT) {
+    __neorv32_aux_pad(sink, ' ', pad);
+  }
+}
+
+
+/**********************************************************************//**
+ * Format IEEE-754 double-precision value in fixed-point notation ("%f").
+ * Uses integer arithmetic only, so no floating-point (emulation) library is required.
+ *
+ * @note Values with a magnitude of 2^64 or above are printed as "ovf".
+ * @note Fractions of more than 60 bits are exact to at least 17 significant digits.
+ *
+ * @param[in,out] sink Output sink.
+ * @param[in] bits Raw value.
+ * @param[in] prec Number of fractional digits.
+ * @param[in] width Minimum field width.
+ * @param[in] flags Format flags.
+ **************************************************************************/
+static void __neorv32_aux_ftoa(neorv32_aux_sink_t *sink, uint64_t bits, int prec, int width, int flags) {
+
+  char tmp[24+32+2];
+  char prefix[2] = {0, 0};
+  uint64_t man = bits & ((1ULL << 52) - 1);
+  int exp = (int)((bits >> 52) & 0x7ff);
+  int i = 0;
+
+  if (bits >> 63) {
+    prefix[0] = '-';
+  }
+  else if (flags & FMT_PLUS) {
+    prefix[0] = '+';
+  }
+  else if (flags & FMT_SPACE) {
+    prefix[0] = ' ';
+  }
+
+  // special values
+  const char *special = NULL;
+  if (exp == 0x7ff) {
+    special = man ? "nan" : "inf";
+  }
+  else if (exp > (1023 + 63)) {
+    special = "ovf";
+  }
+  if (special) {
+    for (i=0; i<3; i++) {
+      tmp[i] = (flags & FMT_UPPER) ? (char)(special[i] - 'a' + 'A') : special[i];
+    }
+    __neorv32_aux_field(sink, prefix, tmp, 3, 0, width, flags & ~FMT_ZERO);
+    return;
+  }
+
+  // value = man * 2^(-shift)
+  int shift = 1075 - exp;
+  if (exp) {
+    man |= 1ULL << 52;
+  }
+  else {
+    shift = 1074; // sub-normal
+  }
+
+  uint64_t ipart = 0, frac = 0;
+  if (shift <= 0) { // integer (value < 2^64)
+    ipart = man << -shift;
+    shift = 0;
+  }
+  else if (shift <= 60) {
+    ipart = man >> shift;
+    frac = man & ((1ULL << shift) - 1);
+  }
+  else { // more than 60 fractional bits: normalized while generating the digits
+    frac = man;
+  }
+
+  // fractional digits
+  if (prec > 32) {
+    prec = 32;
+  }
+  char *fdig = &tmp[24+1];
+  for (i=0; i<prec; i++) {
+    while (frac >> 60) { // drop the lowest fraction bit so "frac * 10" cannot overflow
+      frac >>= 1;
+      shift--;
+    }
+    frac = (frac << 3) + (frac << 1);
+    if (shift < 64) {
+      fdig[i] = (char)('0' + (uint32_t)(frac >> shift));
+      frac &= (1ULL << shift) - 1;
+    }
+    else { // frac < 2^64 <= 2^shift
+      fdig[i] = '0';
+    }
+  }
+
+  // round half to even (frac < 2^64 is always below one half if shift > 64)
+  if ((shift) && (shift <= 64)) {
+    uint64_t half = 1ULL << (shift - 1);
+    int odd = (prec) ? (fdig[prec-1] & 1) : (int)(ipart & 1);
+    if ((frac > half) || ((frac == half) && odd)) {
+      for (i=prec-1; i>=0; i--) {
+        if (fdig[i] != '9') {
+          fdig[i]++;
+          break;
+        }
+        fdig[i] = '0';
+      }
+      if (i < 0) {
+        ipart++;
+      }
+    }
+  }
+
+  // integer digits directly in front of the fractional part
+  int nfrac = prec;
+  if (prec || (flags & FMT_ALT)) {
+    fdig[-1] = '.';
+    nfrac++;
+  }
+  char *start = __neorv32_aux_utoa(&fdig[(nfrac > prec) ? -1 : 0], ipart, 0, 0);
+  int len = (int)(&fdig[prec] - start);
+  __neorv32_aux_field(sink, prefix, start, len, 0, width, flags);
+}
+
+
+/**********************************************************************//**
+ * Formatted output engine: render format string in a single pass into an output sink.
+ *
+ * Supported: flags "-0+ #", field width and precision (both also as "*"),
+ * length modifiers "hh", "h", "l", "ll", "z", "j", "t" and the conversions
+ * "%d %i %u %x %X %o %b %p %c %s %f %F %%".
+ *
+ * @note Decimal conversion avoids divisions (suitable for cores without M extension).
+ * @note "%f" uses integer arithmetic only (no floating-point library); default precision is 6.
+ * @note For backwards compatibility "%x", "%X" and "%p" print all 8 (16 for "ll")
+ * hex digits with leading zeros if neither flags nor width nor precision are specified.
+ * @note "\n" is NOT converted to "\r\n" (this is up to the sink).
+ *
+ * @param[in,out] sink Output sink (#neorv32_aux_sink_t).
+ * @param[in] format Pointer to format string.
+ * @param[in] args A value identifying a variable arguments list.
+ * @return Total number of generated chars (including chars that did not fit into the sink).
+ **************************************************************************/
+int neorv32_aux_vformat(neorv32_aux_sink_t *sink, const char *format, va_list args) {
+
+  char tmp[68]; // 64 binary digits + prefix
+  char c = 0;
+
+  while ((c = *format++)) {
+
+    if (c != '%') {
+      __neorv32_aux_out(sink, c);
+      continue;
+    }
+
+    // flags
+    int flags = 0;
+    while (1) {
+      c = *format++;
+      if      (c == '-') { flags |= FMT_LEFT;  }
+      else if (c == '0') { flags |= FMT_ZERO;  }
+      else if (c == '+') { flags |= FMT_PLUS;  }
+      else if (c == ' ') { flags |= FMT_SPACE; }
+      else if (c == '#') { flags |= FMT_ALT;   }
+      else { break; }
+    }
+
+    // field width
+    int width = 0;
+    if (c == '*') {
+      width = va_arg(args, int);
+      if (width < 0) {
+        flags |= FMT_LEFT;
+        width = -width;
+      }
+      flags |= FMT_WIDTH;
+      c = *format++;
+    }
+    else {
+      while ((c >= '0') && (c <= '9')) {
+        width = (width << 3) + (width << 1) + (c - '0');
+        flags |= FMT_WIDTH;
+        c = *format++;
+      }
+    }
+
+    // precision
+    int prec = 0;
+    if (c == '.') {
+      flags |= FMT_PREC;
+      c = *format++;
+      if (c == '*') {
+        prec = va_arg(args, int);
+        if (prec < 0) {
+          flags &= ~FMT_PREC;
+          prec = 0;
+        }
+        c = *format++;
+      }
+      else {
+        while ((c >= '0') && (c <= '9')) {
+          prec = (prec << 3) + (prec << 1) + (c - '0');
+          c = *format++;
+        }
+      }
+    }
+
+    // length modifier
+    int is64 = 0, lmod = 0;
+    if (c == 'h') {
+      lmod = 'h';
+      c = *format++;
+      if (c == 'h') {
+        lmod = 'H';
+        c = *format++;
+      }
+    }
+    else if (c == 'l') {
+      is64 = (sizeof(long) == 8);
+      c = *format++;
+      if (c == 'l') {
+        is64 = 1;
+        c = *format++;
+      }
+    }
+    else if ((c == 'z') || (c == 'j') || (c == 't')) {
+      is64 = (c == 'j') ? 1 : (sizeof(size_t) == 8);
+      c = *format++;
+    }
+
+    // conversion
+    char prefix[3] = {0, 0, 0};
+    uint64_t num = 0;
+    int shift = 0;
+    switch (c) {
+
+      case 's': { // string
+        const char *s = va_arg(args, const char*);
+        if (s == NULL) {
+          s = "(null)";
+        }
+        int len = 0;
+        while (s[len] && (((flags & FMT_PREC) == 0) || (len < prec))) {
+          len++;
+        }
+        __neorv32_aux_field(sink, "", s, len, 0, width, flags & ~FMT_ZERO);
+        continue;
+      }
+
+      case 'c': // char
+        tmp[0] = (char)va_arg(args, int);
+        __neorv32_aux_field(sink, "", tmp, 1, 0, width, flags & ~FMT_ZERO);
+        continue;
+
+      case 'f': // fixed-point floating-point
+      case 'F': {
+        union { double f; uint64_t u; } val;
+        val.f = va_arg(args, double);
+        if (c == 'F') {
+          flags |= FMT_UPPER;
+        }
+        __neorv32_aux_ftoa(sink, val.u, (flags & FMT_PREC) ? prec : 6, width, flags);
+        continue;
+      }
+
+      case 'd': // signed decimal
+      case 'i': {
+        int64_t n = is64 ? va_arg(args, int64_t) : (int64_t)va_arg(args, int);
+        if (lmod == 'h') {
+          n = (short)n;
+        }
+        else if (lmod == 'H') {
+          n = (signed char)n;
+        }
+        if (n < 0) {
+          prefix[0] = '-';
+          num = -(uint64_t)n;
+        }
+        else {
+          prefix[0] = (flags & FMT_PLUS) ? '+' : ((flags & FMT_SPACE) ? ' ' : 0);
+          num = (uint64_t)n;
+        }
+        break;
+      }
+
+      case 'p': // pointer
+        is64 = (sizeof(void*) == 8);
+        __attribute__((fallthrough));
+      case 'X': // unsigned hexadecimal
+      case 'x':
+      case 'o': // unsigned octal
+      case 'b': // unsigned binary
+      case 'u': // unsigned decimal
+        if (c == 'p') {
+          num = (uint64_t)(uintptr_t)va_arg(args, void*);
+        }
+        else {
+          num = is64 ? va_arg(args, uint64_t) : (uint64_t)va_arg(args, unsigned int);
+        }
+        if (lmod == 'h') {
+          num = (unsigned short)num;
+        }
+        else if (lmod == 'H') {
+          num = (unsigned char)num;
+        }
+        if (c == 'u') {
+          break;
+        }
+        if (c == 'o') {
+          shift = 3;
+          break;
+        }
+        if (c == 'b') {
+          shift = 1;
+          if ((flags & FMT_ALT) && num) {
+            prefix[0] = '0';
+            prefix[1] = 'b';
+          }
+          break;
+        }
+        shift = 4;
+        if (c == 'X') {
+          flags |= FMT_UPPER;
+        }
+        if ((flags & (FMT_LEFT | FMT_ZERO | FMT_PLUS | FMT_SPACE | FMT_ALT | FMT_PREC | FMT_WIDTH)) == 0) {
+          flags |= FMT_PREC; // legacy: print all hex digits
+          prec = is64 ? 16 : 8;
+        }
+        if ((flags & FMT_ALT) && num) {
+          prefix[0] = '0';
+          prefix[1] = (flags & FMT_UPPER) ? 'X' : 'x';
+        }
+        break;
+
+      case '%': // escaped percent sign
+        __neorv32_aux_out(sink, '%');
+        continue;
+
+      case '\0': // premature end of format string
+        format--;
+        __neorv32_aux_out(sink, '%');
+        continue;
+
+      default: // unsupported conversion: print as is
+        __neorv32_aux_out(sink, '%');
+        __neorv32_aux_out(sink, c);
+        continue;
+    }
+
+    // integer output
+    char *end = &tmp[sizeof(tmp)];
+    char *digits = end;
+    if ((num != 0) || ((flags & FMT_PREC) == 0) || (prec != 0)) {
+      digits = __neorv32_aux_utoa(end, num, shift, flags & FMT_UPPER);
+    }
+    int ndigits = (int)(end - digits);
+    if ((shift == 3) && (flags & FMT_ALT) && (digits[0] != '0') && (prec <= ndigits)) {
+      prec = ndigits + 1; // octal alternate form: leading zero
+      flags |= FMT_PREC;
+    }
+    if (flags & FMT_PREC) {
+      flags &= ~FMT_ZERO;
+    }
+    int zeros = ((flags & FMT_PREC) && (prec > ndigits)) ? (prec - ndigits) : 0;
+    __neorv32_aux_field(sink, prefix, digits, ndigits, zeros, width, flags);
+  }
+
+  return (int)sink->total;
+}
+
+
+/**********************************************************************//**
+ * Custom version of 'vsnprintf': render formatted string into a buffer.
+ * See neorv32_aux_vformat for the supported formatting features.
+ *
+ * @param[in,out] buffer Pointer to output buffer (result is always zero-terminated if size > 0).
+ * @param[in] size Size of the output buffer in bytes (including zero-termination).
+ * @param[in] format Pointer to format string.
+ * @param[in] args A value identifying a variable arguments list.
+ * @return Length of the complete formatted string (excluding zero-termination); the output
+ * was truncated if this is >= size.
+ **************************************************************************/
+int neorv32_aux_vsnprintf(char *buffer, uint32_t size, const char *format, va_list args) {
+
+  neorv32_aux_sink_t sink = {
+    .buf   = buffer,
+    .size  = (size) ? (size - 1) : 0,
+    .pos   = 0,
+    .total = 0,
+    .flush = NULL,
+    .ctx   = NULL
+  };
+
+  int res = neorv32_aux_vformat(&sink, format, args);
+  if (size) {
+    buffer[sink.pos] = '\0';
+  }
+  return res;
+}
+
+
+/**********************************************************************//**
+ * Custom version of 'snprintf': render formatted string into a buffer.
+ * See neorv32_aux_vformat for the supported formatting features.
+ *
+ * @param[in,out] buffer Pointer to output buffer (result is always zero-terminated if size > 0).
+ * @param[in] size Size of the output buffer in bytes (including zero-termination).
+ * @param[in] format Pointer to format string.
+ * @return Length of the complete formatted string (excluding zero-termination).
+ **************************************************************************/
+int neorv32_aux_snprintf(char *buffer, uint32_t size, const char *format, ...) {
+
+  va_list args;
+  va_start(args, format);
+  int res = neorv32_aux_vsnprintf(buffer, size, format, args);
+  va_end(args);
+  return res;
+}
+
+
 /**********************************************************************//**
  * Print hardware configuration information via UART0.
  *
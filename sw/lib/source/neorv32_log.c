@@ -0,0 +1,379 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_log.c
+ * @brief Binary deferred logging source file.
+ *
+ * Log messages are not formatted on the target: each message is stored as a compact
+ * binary record (format string ID, mcycle timestamp, raw arguments) in a RAM ring buffer
+ * that is drained to UART0/UART1 or a host file (semihosting) in the background.
+ *
+ * @note Records can be written by any hart and from interrupt handlers (the ring buffer
+ * is protected by a spinlock with interrupts disabled). Drain/read functions must only
+ * be called by a single context.
+ */
+
+#include <neorv32.h>
+#include <string.h>
+
+
+/**********************************************************************//**
+ * Logging state.
+ **************************************************************************/
+typedef struct {
+  uint32_t *buf;                  // ring buffer; NULL if logging is not initialized
+  uint32_t mask;                  // ring buffer size in words - 1
+  volatile uint32_t head;         // read index in words (drain)
+  volatile uint32_t tail;         // write index in words (writers)
+  uint32_t hoff;                  // read byte offset within the head word
+  uint32_t lost;                  // records dropped since the last drop marker
+  int sink;                       // drain target (#NEORV32_LOG_SINK_enum)
+  int file;                       // semihosting file handle
+  int cycle;                      // mcycle CSR available
+  uint32_t lock;                  // spinlock (atomic accesses only)
+  neorv32_log_stats_t stats;      // statistics
+} __neorv32_log_t;
+
+static __neorv32_log_t __neorv32_log;
+
+
+/**********************************************************************//**
+ * Disable interrupts and acquire spinlock.
+ *
+ * @return Previous mstatus CSR value.
+ **************************************************************************/
+static inline uint32_t __neorv32_log_lock(void) {
+
+  uint32_t mstatus = neorv32_cpu_csr_read(CSR_MSTATUS);
+  neorv32_cpu_csr_clr(CSR_MSTATUS, 1 << CSR_MSTATUS_MIE);
+
+#if defined __riscv_atomic
+  while (neorv32_cpu_amoswap((uint32_t)&__neorv32_log.lock, 1)) {
+    while (neorv32_cpu_amolr((uint32_t)&__neorv32_log.lock)); // read-only spin (bypasses the data cache)
+  }
+  asm volatile ("fence" : : : "memory"); // reload data cache: ring buffer might have been modified by another hart
+#endif
+
+  return mstatus;
+}
+
+
+/**********************************************************************//**
+ * Release spinlock and restore interrupts.
+ *
+ * @param[in] mstatus Previous mstatus CSR value (from #__neorv32_log_lock).
+ **************************************************************************/
+static inline void __neorv32_log_unlock(uint32_t mstatus) {
+
+#if defined __riscv_atomic
+  asm volatile ("fence" : : : "memory");
+  neorv32_cpu_amoswap((uint32_t)&__neorv32_log.lock, 0);
+#endif
+
+  if (mstatus & (1 << CSR_MSTATUS_MIE)) {
+    neorv32_cpu_csr_set(CSR_MSTATUS, 1 << CSR_MSTATUS_MIE);
+  }
+}
+
+
+/**********************************************************************//**
+ * Store a record in the ring buffer. Caller has to hold the lock.
+ *
+ * @param[in] header Record header.
+ * @param[in] args Pointer to argument words.
+ * @return 0 if success, non-zero if the ring buffer is full.
+ **************************************************************************/
+static int __neorv32_log_put(uint32_t header, const uint32_t *args) {
+
+  __neorv32_log_t *l = &__neorv32_log;
+  uint32_t nargs = (header >> LOG_HDR_NARGS_LSB) & 0xf;
+  uint32_t tail = l->tail;
+  uint32_t fill = tail - l->head;
+
+  if ((l->mask + 1 - fill) < (2 + nargs)) {
+    return 1;
+  }
+
+  l->buf[tail++ & l->mask] = header | (NEORV32_LOG_SYNC << LOG_HDR_SYNC_LSB) |
+                             ((neorv32_cpu_csr_read(CSR_MHARTID) & 3) << LOG_HDR_HART_LSB);
+  l->buf[tail++ & l->mask] = (l->cycle) ? neorv32_cpu_csr_read(CSR_MCYCLE) : 0;
+  while (nargs--) {
+    l->buf[tail++ & l->mask] = *args++;
+  }
+  l->tail = tail;
+
+  fill = (tail - l->head) << 2;
+  if (fill > l->stats.peak) {
+    l->stats.peak = fill;
+  }
+  l->stats.records++;
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Store a marker record for dropped records (if any). Caller has to hold the lock.
+ **************************************************************************/
+static void __neorv32_log_put_lost(void) {
+
+  __neorv32_log_t *l = &__neorv32_log;
+
+  if (l->lost) {
+    if (__neorv32_log_put(((uint32_t)NEORV32_LOG_ID_DROPPED << LOG_HDR_ID_LSB) | (1 << LOG_HDR_NARGS_LSB) |
+                          (NEORV32_LOG_WARN << LOG_HDR_LEVEL_LSB), &l->lost) == 0) {
+      l->stats.records--; // marker is not a record
+      l->lost = 0;
+    }
+  }
+}
+
+
+/**********************************************************************//**
+ * Get contiguous block of pending log data. Caller has to hold the lock.
+ *
+ * @param[in,out] data Pointer to the first pending byte.
+ * @return Number of contiguous pending bytes.
+ **************************************************************************/
+static uint32_t __neorv32_log_peek(uint8_t **data) {
+
+  __neorv32_log_t *l = &__neorv32_log;
+  uint32_t head = l->head & l->mask;
+  uint32_t words = l->tail - l->head;
+
+  if (words > (l->mask + 1 - head)) { // wrap-around
+    words = l->mask + 1 - head;
+  }
+  *data = (uint8_t*)&l->buf[head] + l->hoff;
+  return (words << 2) - ((words) ? l->hoff : 0);
+}
+
+
+/**********************************************************************//**
+ * Remove pending log data. Caller has to hold the lock.
+ *
+ * @param[in] len Number of bytes to remove.
+ **************************************************************************/
+static void __neorv32_log_consume(uint32_t len) {
+
+  __neorv32_log_t *l = &__neorv32_log;
+  uint32_t offs = l->hoff + len;
+
+  l->head += offs >> 2;
+  l->hoff = offs & 3;
+  l->stats.sent += len;
+}
+
+
+/**********************************************************************//**
+ * Initialize logging.
+ *
+ * @param[in,out] buffer Ring buffer memory (32-bit aligned).
+ * @param[in] size Ring buffer size in bytes (power of two, at least 64).
+ * @param[in] sink Drain target (#NEORV32_LOG_SINK_enum); UARTs have to be configured by the application.
+ * @return 0 if success, -1 if invalid configuration, -2 if sink not available.
+ **************************************************************************/
+int neorv32_log_setup(uint32_t *buffer, uint32_t size, int sink) {
+
+  __neorv32_log_t *l = &__neorv32_log;
+
+  if ((buffer == NULL) || (size < 64) || (size & (size - 1)) || ((uint32_t)buffer & 3)) {
+    return -1;
+  }
+  if (((sink == NEORV32_LOG_SINK_UART0) && (neorv32_uart_available(NEORV32_UART0) == 0)) ||
+      ((sink == NEORV32_LOG_SINK_UART1) && (neorv32_uart_available(NEORV32_UART1) == 0))) {
+    return -2;
+  }
+
+  l->buf  = NULL;
+  l->mask = (size >> 2) - 1;
+  l->head = 0;
+  l->tail = 0;
+  l->hoff = 0;
+  l->lost = 0;
+  l->sink = sink;
+  l->file = -1;
+  l->cycle = (int)(neorv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_ZICNTR));
+  l->lock = 0;
+  l->stats.records = 0;
+  l->stats.dropped = 0;
+  l->stats.peak    = 0;
+  l->stats.sent    = 0;
+
+  if (sink == NEORV32_LOG_SINK_SEMIHOSTING) {
+    l->file = neorv32_semihosting_open(NEORV32_LOG_FILE, SEMIHOSTING_OPEN_WB);
+    if (l->file < 0) {
+      return -2;
+    }
+  }
+
+  // start marker: tells the host decoder the clock speed
+  uint32_t clk = NEORV32_SYSINFO->CLK;
+  l->buf = buffer;
+  __neorv32_log_put(((uint32_t)NEORV32_LOG_ID_START << LOG_HDR_ID_LSB) | (1 << LOG_HDR_NARGS_LSB) |
+                    (NEORV32_LOG_INFO << LOG_HDR_LEVEL_LSB), &clk);
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Store a log record (used by the NEORV32_LOG* macros).
+ *
+ * @note This function is non-blocking. The record is dropped if the ring buffer is full.
+ *
+ * @param[in] header Record header (ID, number of arguments and level).
+ * @param[in] args Pointer to argument words.
+ **************************************************************************/
+void neorv32_log_write(uint32_t header, const uint32_t *args) {
+
+  __neorv32_log_t *l = &__neorv32_log;
+
+  if (l->buf == NULL) {
+    return;
+  }
+
+  uint32_t mstatus = __neorv32_log_lock();
+
+  __neorv32_log_put_lost(); // report previously dropped records first
+  if ((l->lost) || (__neorv32_log_put(header, args))) {
+    l->lost++;
+    l->stats.dropped++;
+  }
+
+  __neorv32_log_unlock(mstatus);
+}
+
+
+/**********************************************************************//**
+ * Send pending log data to the configured sink.
+ *
+ * @note This function is non-blocking for the UART sinks (sends as much as
+ * fits into the UART TX FIFO / TX ring buffer). Call it periodically, e.g. from
+ * the main loop or an idle task.
+ *
+ * @return Number of bytes sent.
+ **************************************************************************/
+int neorv32_log_drain(void) {
+
+  __neorv32_log_t *l = &__neorv32_log;
+  uint8_t *data = NULL;
+  int cnt = 0;
+
+  if ((l->buf == NULL) || (l->sink == NEORV32_LOG_SINK_NONE)) {
+    return 0;
+  }
+
+  while (1) {
+    uint32_t mstatus = __neorv32_log_lock();
+    int len = (int)__neorv32_log_peek(&data);
+    __neorv32_log_unlock(mstatus);
+    if (len == 0) {
+      break;
+    }
+
+    int n = 0;
+    if (l->sink == NEORV32_LOG_SINK_SEMIHOSTING) {
+      n = neorv32_semihosting_write(l->file, (char*)data, len);
+    }
+    else {
+      n = neorv32_uart_write((l->sink == NEORV32_LOG_SINK_UART1) ? NEORV32_UART1 : NEORV32_UART0, data, len);
+    }
+
+    mstatus = __neorv32_log_lock();
+    __neorv32_log_consume((uint32_t)n);
+    __neorv32_log_unlock(mstatus);
+
+    cnt += n;
+    if (n < len) {
+      break; // sink is busy
+    }
+  }
+
+  return cnt;
+}
+
+
+/**********************************************************************//**
+ * Send all pending log data to the configured sink.
+ *
+ * @note This function is blocking.
+ **************************************************************************/
+void neorv32_log_flush(void) {
+
+  __neorv32_log_t *l = &__neorv32_log;
+
+  if ((l->buf == NULL) || (l->sink == NEORV32_LOG_SINK_NONE)) {
+    return;
+  }
+
+  do {
+    uint32_t mstatus = __neorv32_log_lock();
+    __neorv32_log_put_lost();
+    __neorv32_log_unlock(mstatus);
+    while (l->tail != l->head) {
+      neorv32_log_drain();
+    }
+  } while (l->lost);
+  if (l->sink == NEORV32_LOG_SINK_UART0) {
+    neorv32_uart_flush(NEORV32_UART0);
+  }
+  else if (l->sink == NEORV32_LOG_SINK_UART1) {
+    neorv32_uart_flush(NEORV32_UART1);
+  }
+}
+
+
+/**********************************************************************//**
+ * Fetch pending log data (raw byte stream) for a custom transport.
+ *
+ * @param[in,out] buffer Pointer to destination buffer.
+ * @param[in] len Maximum number of bytes to read.
+ * @return Number of bytes actually read (0..len).
+ **************************************************************************/
+int neorv32_log_read(void *buffer, int len) {
+
+  __neorv32_log_t *l = &__neorv32_log;
+  uint8_t *dst = (uint8_t*)buffer;
+  uint8_t *data = NULL;
+  int cnt = 0;
+
+  if (l->buf == NULL) {
+    return 0;
+  }
+
+  uint32_t mstatus = __neorv32_log_lock();
+  while (cnt < len) {
+    int n = (int)__neorv32_log_peek(&data);
+    if (n == 0) {
+      break;
+    }
+    if (n > (len - cnt)) {
+      n = len - cnt;
+    }
+    memcpy(dst, data, n);
+    __neorv32_log_consume((uint32_t)n);
+    dst += n;
+    cnt += n;
+  }
+  __neorv32_log_unlock(mstatus);
+
+  return cnt;
+}
+
+
+/**********************************************************************//**
+ * Get logging statistics.
+ *
+ * @param[in,out] stats Pointer to statistics structure (#neorv32_log_stats_t).
+ **************************************************************************/
+void neorv32_log_get_stats(neorv32_log_stats_t *stats) {
+
+  uint32_t mstatus = __neorv32_log_lock();
+  *stats = __neorv32_log.stats;
+  __neorv32_log_unlock(mstatus);
+}
@@ -0,0 +1,186 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_mbox.c
+ * @brief Inter-Core Mailbox (MBOX) HW driver source file.
+ *
+ * @note All "receive" functions operate on the inbox of the calling hart.
+ */
+
+#include <neorv32.h>
+
+
+/**********************************************************************//**
+ * Get the inbox of the calling hart.
+ *
+ * @return Pointer to own inbox.
+ **************************************************************************/
+static inline neorv32_mbox_inbox_t* __attribute__((always_inline)) __neorv32_mbox_own(void) {
+
+  return &NEORV32_MBOX->INBOX[neorv32_cpu_csr_read(CSR_MHARTID) & 3];
+}
+
+
+/**********************************************************************//**
+ * Check if inter-core mailbox was synthesized.
+ *
+ * @return Zero if MBOX was not synthesized, non-zero if MBOX is available.
+ **************************************************************************/
+int neorv32_mbox_available(void) {
+
+  return (int)(NEORV32_SYSINFO->SOC & (1 << SYSINFO_SOC_IO_MBOX));
+}
+
+
+/**********************************************************************//**
+ * Reset, clear and enable the calling hart's inbox.
+ *
+ * @note Each hart has to call this function once to be able to receive messages.
+ * Messages sent to a disabled inbox are discarded.
+ *
+ * @param[in] irq_en Fire FIRQ 4 (#MBOX_FIRQ_ENABLE) of this hart while its inbox is not empty when non-zero.
+ **************************************************************************/
+void neorv32_mbox_setup(int irq_en) {
+
+  neorv32_mbox_inbox_t *inbox = __neorv32_mbox_own();
+
+  inbox->CTRL = 0; // reset, disable and clear inbox
+
+  uint32_t tmp = (uint32_t)(1 << MBOX_CTRL_EN);
+  if (irq_en) {
+    tmp |= (uint32_t)(1 << MBOX_CTRL_IRQ_EN);
+  }
+  inbox->CTRL = tmp;
+}
+
+
+/**********************************************************************//**
+ * Get inbox FIFO depth.
+ *
+ * @return Number of messages each inbox can buffer.
+ **************************************************************************/
+int neorv32_mbox_get_fifo_depth(void) {
+
+  uint32_t tmp = (NEORV32_MBOX->INBOX[0].CTRL >> MBOX_CTRL_FIFO_LSB) & 0x0f;
+  return (int)(1 << tmp);
+}
+
+
+/**********************************************************************//**
+ * Get number of implemented inboxes.
+ *
+ * @return Number of harts / inboxes.
+ **************************************************************************/
+int neorv32_mbox_get_num_harts(void) {
+
+  uint32_t tmp = (NEORV32_MBOX->INBOX[0].CTRL >> MBOX_CTRL_HARTS_LSB) & 0x03;
+  return (int)(tmp + 1);
+}
+
+
+/**********************************************************************//**
+ * Send message to a hart's inbox (non-blocking).
+ *
+ * @note If several harts send to the same inbox concurrently the full-check
+ * can race; use #neorv32_mbox_overflow(void) on the receiver side to detect lost messages.
+ *
+ * @param[in] hart Destination hart ID.
+ * @param[in] data Message to send.
+ * @return 0 if message was sent, -1 if the destination inbox is full or disabled.
+ **************************************************************************/
+int neorv32_mbox_send(int hart, uint32_t data) {
+
+  neorv32_mbox_inbox_t *inbox = &NEORV32_MBOX->INBOX[hart & 3];
+
+  uint32_t ctrl = inbox->CTRL;
+  if ((ctrl & (1 << MBOX_CTRL_FULL)) || ((ctrl & (1 << MBOX_CTRL_EN)) == 0)) {
+    return -1;
+  }
+  inbox->DATA = data;
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Send message to a hart's inbox (blocking). Waits until there is
+ * space left in the destination inbox.
+ *
+ * @param[in] hart Destination hart ID.
+ * @param[in] data Message to send.
+ **************************************************************************/
+void neorv32_mbox_put(int hart, uint32_t data) {
+
+  while (neorv32_mbox_send(hart, data));
+}
+
+
+/**********************************************************************//**
+ * Check if there are messages in the calling hart's inbox.
+ *
+ * @return Zero if inbox is empty, non-zero if there is at least one message.
+ **************************************************************************/
+int neorv32_mbox_avail(void) {
+
+  return (int)(__neorv32_mbox_own()->CTRL & (1 << MBOX_CTRL_AVAIL));
+}
+
+
+/**********************************************************************//**
+ * Receive message from the calling hart's inbox (non-blocking).
+ *
+ * @param[in,out] data Pointer to store the message to.
+ * @param[in,out] src Pointer to store the sender's hart ID to (can be NULL).
+ * @return 0 if a message was received, -1 if the inbox is empty.
+ **************************************************************************/
+int neorv32_mbox_recv(uint32_t *data, int *src) {
+
+  neorv32_mbox_inbox_t *inbox = __neorv32_mbox_own();
+
+  if ((inbox->CTRL & (1 << MBOX_CTRL_AVAIL)) == 0) {
+    return -1;
+  }
+  *data = inbox->DATA;
+  if (src != NULL) {
+    *src = (int)inbox->SRC;
+  }
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Receive message from the calling hart's inbox (blocking). Waits until
+ * a message is available.
+ *
+ * @return Received message.
+ **************************************************************************/
+uint32_t neorv32_mbox_get(void) {
+
+  uint32_t data;
+  while (neorv32_mbox_recv(&data, NULL));
+  return data;
+}
+
+
+/**********************************************************************//**
+ * Check if messages were lost because the calling hart's inbox was full.
+ * The overflow flag is cleared by this function.
+ *
+ * @return Zero if no message was lost, non-zero otherwise.
+ **************************************************************************/
+int neorv32_mbox_overflow(void) {
+
+  neorv32_mbox_inbox_t *inbox = __neorv32_mbox_own();
+
+  uint32_t ctrl = inbox->CTRL;
+  if (ctrl & (1 << MBOX_CTRL_OVF)) {
+    inbox->CTRL = ctrl & ((1 << MBOX_CTRL_EN) | (1 << MBOX_CTRL_IRQ_EN)); // clear flag
+    return 1;
+  }
+  return 0;
+}
@@ -9,6 +9,13 @@
 /**
  * @file neorv32_newlib.c
  * @brief NEORV32-specific Newlib system calls
+ *
+ * @note The system calls are SMP-safe: malloc/environment/stdio locks are implemented
+ * as recursive spinlocks using the A ISA extension, every hart gets its own reentrancy
+ * structure (if newlib was build with __DYNAMIC_REENT__) and STDOUT/STDERR writes of
+ * different harts do not get mixed up. STDOUT/STDERR output does not block if UART0's
+ * interrupt-driven buffered mode is enabled (#neorv32_uart_buffered_setup).
+ *
  * @note Sources:
  * https://www.sourceware.org/newlib/libc.html#Syscalls
  * https://interrupt.memfault.com/blog/boostrapping-libc-with-newlib
@@ -19,6 +26,8 @@
 #include <newlib.h>
 #include <time.h>
 #include <unistd.h>
+#include <sys/lock.h>
+#include <sys/reent.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 
@@ -31,6 +40,31 @@ extern int errno;
 char *__env[1] = { 0 };
 char **environ = __env;
 
+/**********************************************************************//**
+ * @name Configuration
+ **************************************************************************/
+/**@{*/
+/** Maximum number of harts */
+#define NEWLIB_HARTS 2
+/**@}*/
+
+/**********************************************************************//**
+ * Recursive spinlock.
+ **************************************************************************/
+typedef struct {
+  uint32_t lock;  // spinlock (atomic accesses only)
+  uint32_t owner; // owning hart ID + 1; zero if not locked
+  uint32_t count; // recursion depth
+} newlib_lock_t;
+
+// locks
+static newlib_lock_t __neorv32_newlib_malloc_lock = {0, 0, 0};
+static newlib_lock_t __neorv32_newlib_env_lock = {0, 0, 0};
+
+#ifndef STDIO_SEMIHOSTING
+static newlib_lock_t __neorv32_newlib_tx_lock = {0, 0, 0}; // STDOUT/STDERR
+#endif
+
 
 /**********************************************************************//**
  * Issue a warning when semihosting is enabled.
@@ -45,11 +79,304 @@ char **environ = __env;
 /**@}*/
 
 
+// #################################################################################################
+// Locking
+// #################################################################################################
+
+/**********************************************************************//**
+ * Try to acquire a simple spinlock once.
+ *
+ * @param[in,out] lock Pointer to lock variable.
+ * @return 1 if the lock was acquired, 0 if it is owned by someone else.
+ **************************************************************************/
+static int __neorv32_newlib_trylock(uint32_t *lock) {
+
+#if defined __riscv_atomic
+  if (neorv32_cpu_amoswap((uint32_t)lock, 1)) {
+    return 0;
+  }
+  asm volatile ("fence" : : : "memory"); // reload data cache: data might have been modified by another hart
+  return 1;
+#else
+  uint32_t mstatus = neorv32_cpu_csr_read(CSR_MSTATUS);
+  neorv32_cpu_csr_clr(CSR_MSTATUS, 1 << CSR_MSTATUS_MIE);
+  int acquired = (*lock == 0);
+  *lock = 1;
+  neorv32_cpu_csr_write(CSR_MSTATUS, mstatus);
+  return acquired;
+#endif
+}
+
+
+/**********************************************************************//**
+ * Release a simple spinlock.
+ *
+ * @param[in,out] lock Pointer to lock variable.
+ **************************************************************************/
+static void __neorv32_newlib_unlock(uint32_t *lock) {
+
+#if defined __riscv_atomic
+  asm volatile ("fence" : : : "memory");
+  neorv32_cpu_amoswap((uint32_t)lock, 0);
+#else
+  *(volatile uint32_t*)lock = 0;
+#endif
+}
+
+
+/**********************************************************************//**
+ * Try to acquire a recursive spinlock once.
+ *
+ * @param[in,out] lock Pointer to lock.
+ * @return 1 if the lock was acquired, 0 if it is owned by another hart.
+ **************************************************************************/
+static int __neorv32_newlib_lock_try_acquire(newlib_lock_t *lock) {
+
+  uint32_t self = neorv32_cpu_csr_read(CSR_MHARTID) + 1;
+  int acquired = 1;
+
+  // an interrupt handler of this hart must not see a half-updated lock
+  uint32_t mstatus = neorv32_cpu_csr_read(CSR_MSTATUS);
+  neorv32_cpu_csr_clr(CSR_MSTATUS, 1 << CSR_MSTATUS_MIE);
+
+  // only this hart can write its own ID to "owner", so there is no race here
+  if (lock->owner == self) {
+    lock->count++;
+  }
+  else if (__neorv32_newlib_trylock(&lock->lock)) {
+    lock->owner = self;
+    lock->count = 1;
+  }
+  else {
+    acquired = 0;
+  }
+
+  neorv32_cpu_csr_write(CSR_MSTATUS, mstatus);
+  return acquired;
+}
+
+
+/**********************************************************************//**
+ * Acquire a recursive spinlock (blocking).
+ *
+ * @param[in,out] lock Pointer to lock.
+ **************************************************************************/
+static void __neorv32_newlib_lock_acquire(newlib_lock_t *lock) {
+
+  while (__neorv32_newlib_lock_try_acquire(lock) == 0) {
+#if defined __riscv_atomic
+    while (neorv32_cpu_amolr((uint32_t)&lock->lock)); // read-only spin (bypasses the data cache)
+#endif
+  }
+}
+
+
+/**********************************************************************//**
+ * Release a recursive spinlock.
+ *
+ * @param[in,out] lock Pointer to lock.
+ **************************************************************************/
+static void __neorv32_newlib_lock_release(newlib_lock_t *lock) {
+
+  uint32_t mstatus = neorv32_cpu_csr_read(CSR_MSTATUS);
+  neorv32_cpu_csr_clr(CSR_MSTATUS, 1 << CSR_MSTATUS_MIE);
+
+  if (--lock->count == 0) {
+    lock->owner = 0;
+    __neorv32_newlib_unlock(&lock->lock);
+  }
+
+  neorv32_cpu_csr_write(CSR_MSTATUS, mstatus);
+}
+
+
+ /**********************************************************************//**
+ * Lock/unlock the memory allocator (malloc & co.).
+ **************************************************************************/
+/**@{*/
+void __malloc_lock(struct _reent *r) {
+  (void)r;
+  __neorv32_newlib_lock_acquire(&__neorv32_newlib_malloc_lock);
+}
+
+void __malloc_unlock(struct _reent *r) {
+  (void)r;
+  __neorv32_newlib_lock_release(&__neorv32_newlib_malloc_lock);
+}
+/**@}*/
+
+
+ /**********************************************************************//**
+ * Lock/unlock the global environment (getenv & co.).
+ **************************************************************************/
+/**@{*/
+void __env_lock(struct _reent *r) {
+  (void)r;
+  __neorv32_newlib_lock_acquire(&__neorv32_newlib_env_lock);
+}
+
+void __env_unlock(struct _reent *r) {
+  (void)r;
+  __neorv32_newlib_lock_release(&__neorv32_newlib_env_lock);
+}
+/**@}*/
+
+
+#ifdef _RETARGETABLE_LOCKING
+ /**********************************************************************//**
+ * Newlib retargetable locking interface (stdio, atexit, ...). Only used
+ * if newlib was build with "--enable-newlib-retargetable-locking".
+ * All dynamically-initialized locks (e.g. one per FILE) share a single
+ * recursive lock.
+ **************************************************************************/
+/**@{*/
+struct __lock {
+  newlib_lock_t lock;
+};
+
+struct __lock __lock___sinit_recursive_mutex;
+struct __lock __lock___sfp_recursive_mutex;
+struct __lock __lock___atexit_recursive_mutex;
+struct __lock __lock___at_quick_exit_mutex;
+struct __lock __lock___malloc_recursive_mutex;
+struct __lock __lock___env_recursive_mutex;
+struct __lock __lock___tz_mutex;
+struct __lock __lock___dd_hash_mutex;
+struct __lock __lock___arc4random_mutex;
+
+static struct __lock __neorv32_newlib_lock_dynamic;
+
+void __retarget_lock_init(_LOCK_T *lock) {
+  *lock = &__neorv32_newlib_lock_dynamic;
+}
+
+void __retarget_lock_init_recursive(_LOCK_T *lock) {
+  *lock = &__neorv32_newlib_lock_dynamic;
+}
+
+void __retarget_lock_close(_LOCK_T lock) {
+  (void)lock;
+}
+
+void __retarget_lock_close_recursive(_LOCK_T lock) {
+  (void)lock;
+}
+
+void __retarget_lock_acquire(_LOCK_T lock) {
+  __neorv32_newlib_lock_acquire(&lock->lock);
+}
+
+void __retarget_lock_acquire_recursive(_LOCK_T lock) {
+  __neorv32_newlib_lock_acquire(&lock->lock);
+}
+
+int __retarget_lock_try_acquire(_LOCK_T lock) {
+  return __neorv32_newlib_lock_try_acquire(&lock->lock);
+}
+
+int __retarget_lock_try_acquire_recursive(_LOCK_T lock) {
+  return __neorv32_newlib_lock_try_acquire(&lock->lock);
+}
+
+void __retarget_lock_release(_LOCK_T lock) {
+  __neorv32_newlib_lock_release(&lock->lock);
+}
+
+void __retarget_lock_release_recursive(_LOCK_T lock) {
+  __neorv32_newlib_lock_release(&lock->lock);
+}
+/**@}*/
+#endif
+
+
+#ifdef __DYNAMIC_REENT__
+ /**********************************************************************//**
+ * Get the calling hart's reentrancy structure (errno, stdio streams, ...).
+ * Only available if newlib was build with __DYNAMIC_REENT__ (newlib's _REENT
+ * calls this function then); otherwise all harts share "_impure_ptr".
+ *
+ * @return Pointer to the calling hart's reentrancy structure.
+ **************************************************************************/
+struct _reent *__getreent(void) {
+
+  static struct _reent reent[NEWLIB_HARTS-1];
+  static uint32_t reent_init[NEWLIB_HARTS-1];
+
+  uint32_t hart = neorv32_cpu_csr_read(CSR_MHARTID) & (NEWLIB_HARTS-1);
+
+  if (hart == 0) { // primary hart uses the default structure
+    return _impure_ptr;
+  }
+
+  hart--;
+  if (reent_init[hart] == 0) { // only accessed by the according hart
+    _REENT_INIT_PTR(&reent[hart]);
+    reent_init[hart] = 1;
+  }
+  return &reent[hart];
+}
+#endif
+
+
+#ifndef STDIO_SEMIHOSTING
+// #################################################################################################
+// STDOUT/STDERR
+// #################################################################################################
+
+/**********************************************************************//**
+ * Write data to UART0. Writes of different harts are serialized so their
+ * output does not get mixed up. Data is copied to the TX ring buffer if UART0's
+ * buffered mode is enabled (non-blocking unless the ring buffer is full);
+ * otherwise it is written to the TX FIFO directly.
+ *
+ * @note Interrupts are only disabled while a chunk of data is copied to the ring
+ * buffer / FIFO (the ring buffer's index update), so a nested write from an
+ * interrupt handler on the same hart cannot corrupt the ring buffer.
+ *
+ * @param[in] ptr Pointer to data.
+ * @param[in] len Number of bytes.
+ **************************************************************************/
+static void __neorv32_newlib_tx_write(const char *ptr, int len) {
+
+  uint32_t mstatus;
+  int n;
+
+  __neorv32_newlib_lock_acquire(&__neorv32_newlib_tx_lock);
+  while (len > 0) {
+    mstatus = neorv32_cpu_csr_read(CSR_MSTATUS);
+    neorv32_cpu_csr_clr(CSR_MSTATUS, 1 << CSR_MSTATUS_MIE);
+    n = neorv32_uart_write(NEORV32_UART0, ptr, len);
+    if ((n == 0) && ((mstatus & (1 << CSR_MSTATUS_MIE)) == 0)) {
+      neorv32_uart_putc(NEORV32_UART0, *ptr); // interrupts were disabled anyway: wait for space by polling
+      n = 1;
+    }
+    neorv32_cpu_csr_write(CSR_MSTATUS, mstatus);
+    ptr += n;
+    len -= n;
+    if (len) {
+      asm volatile ("fence" : : : "memory"); // reload data cache: ring buffer might be drained by another hart
+    }
+  }
+  __neorv32_newlib_lock_release(&__neorv32_newlib_tx_lock);
+}
+#endif
+
+
+// #################################################################################################
+// System calls
+// #################################################################################################
+
  /**********************************************************************//**
  * Exit a program without cleaning up anything.
  **************************************************************************/
 void _exit(int status) {
 
+#ifndef STDIO_SEMIHOSTING
+  if (neorv32_uart_available(NEORV32_UART0)) {
+    neorv32_uart_flush(NEORV32_UART0); // send remaining STDOUT/STDERR data
+  }
+#endif
+
   // put status into register 'a0' and jump to crt0's exit code
   asm volatile (
     ".extern __crt0_main_exit \n"
@@ -245,8 +572,8 @@ int _read(int file, char *ptr, int len) {
 
 
  /**********************************************************************//**
- * Write to a file. STDOUT and STDERR will write to UART0, all other
- * output streams will write to UART1.
+ * Write to a file. STDOUT and STDERR will write to UART0 (buffered), all
+ * other output streams will write to UART1.
  **************************************************************************/
 int _write(int file, char *ptr, int len) {
 
@@ -258,11 +585,8 @@ int _write(int file, char *ptr, int len) {
   // write STDOUT and STDERR streams to NEORV32.UART0 (if available)
   if ((file == STDOUT_FILENO) || (file == STDERR_FILENO)) {
     if (neorv32_uart_available(NEORV32_UART0)) {
-      while (len--) {
-        neorv32_uart_putc(NEORV32_UART0, *ptr++);
-        write_cnt++;
-      }
-      return write_cnt;
+      __neorv32_newlib_tx_write(ptr, len);
+      return len;
     }
     else {
       errno = ENOSYS;
@@ -294,6 +618,9 @@ void *_sbrk(int incr) {
   static unsigned char *curr_heap = NULL; // current heap pointer
   unsigned char *prev_heap; // previous heap pointer
 
+  // the heap pointer is shared by all harts
+  __neorv32_newlib_lock_acquire(&__neorv32_newlib_malloc_lock);
+
   // initialize
   if (curr_heap == NULL) {
     curr_heap = (unsigned char *)NEORV32_HEAP_BEGIN;
@@ -304,6 +631,7 @@ void *_sbrk(int incr) {
 #ifdef NEWLIB_DEBUG
     write(STDERR_FILENO, "[neorv32-newlib] no heap available\r\n", 36);
 #endif
+    __neorv32_newlib_lock_release(&__neorv32_newlib_malloc_lock);
     errno = ENOMEM;
     return (void*)-1; // error - no more memory
   }
@@ -313,6 +641,7 @@ void *_sbrk(int incr) {
 #ifdef NEWLIB_DEBUG
     write(STDERR_FILENO, "[neorv32-newlib] heap exhausted\r\n", 33);
 #endif
+    __neorv32_newlib_lock_release(&__neorv32_newlib_malloc_lock);
     errno = ENOMEM;
     return (void*)-1; // error - no more memory
   }
@@ -320,6 +649,7 @@ void *_sbrk(int incr) {
   prev_heap = curr_heap;
   curr_heap += incr;
 
+  __neorv32_newlib_lock_release(&__neorv32_newlib_malloc_lock);
   return (void*)prev_heap;
 }
 
@@ -0,0 +1,324 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_perf.c
+ * @brief Region-scoped performance measurement source file.
+ *
+ * #neorv32_perf_begin and #neorv32_perf_end take a snapshot of the low words of
+ * [m]cycle, [m]instret and the first #NEORV32_PERF_HPM_NUM HPM counters. The deltas
+ * are accumulated per region (count, min, max, sum). The constant cost of the
+ * measurement itself is determined once by #neorv32_perf_setup and subtracted from
+ * every delta.
+ *
+ * @note Each hart uses its own region table (passed to #neorv32_perf_setup on that
+ * hart), so no locking is required. A region ID must not be measured concurrently
+ * by an interrupt handler and the interrupted code of the same hart. Machine-mode only.
+ */
+
+#include <neorv32.h>
+#include <string.h>
+
+
+/**********************************************************************//**
+ * Per-hart measurement state.
+ **************************************************************************/
+typedef struct {
+  neorv32_perf_region_t *tab;         // region table; NULL if not initialized
+  uint32_t num;                       // number of regions
+  uint32_t hpm;                       // HPM counters available
+  uint32_t ovh[NEORV32_PERF_NUM];     // measurement overhead per metric
+} __neorv32_perf_t;
+
+static __neorv32_perf_t __neorv32_perf[2];
+
+// HPM event names (#NEORV32_HPMCNT_EVENT_enum)
+static const char *const __neorv32_perf_events[20] = {
+  "CY", "TM", "IR", "COMPR", "WAIT_DIS", "WAIT_ALU", "BRANCH", "CTRLFLOW", "LOAD", "STORE",
+  "WAIT_LSU", "TRAP", "IRQ", "WAIT_RST", "IC_HIT", "IC_MISS", "DC_HIT", "DC_MISS", "WAIT_BUS", "DMA"
+};
+
+
+/**********************************************************************//**
+ * Get the state of the calling hart.
+ **************************************************************************/
+static inline __neorv32_perf_t *__neorv32_perf_get(void) {
+
+  return &__neorv32_perf[neorv32_cpu_csr_read(CSR_MHARTID) & 1];
+}
+
+
+/**********************************************************************//**
+ * Take a counter snapshot.
+ *
+ * @param[in,out] s Snapshot (#NEORV32_PERF_NUM words).
+ * @param[in] hpm Read HPM counters when non-zero.
+ **************************************************************************/
+static inline __attribute__((always_inline)) void __neorv32_perf_snapshot(uint32_t *s, uint32_t hpm) {
+
+  s[NEORV32_PERF_CYCLE]   = neorv32_cpu_csr_read(CSR_MCYCLE);
+  s[NEORV32_PERF_INSTRET] = neorv32_cpu_csr_read(CSR_MINSTRET);
+#if (NEORV32_PERF_HPM_NUM > 0)
+  if (hpm) {
+    s[NEORV32_PERF_HPM3 + 0] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER3);
+#if (NEORV32_PERF_HPM_NUM > 1)
+    s[NEORV32_PERF_HPM3 + 1] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER4);
+#endif
+#if (NEORV32_PERF_HPM_NUM > 2)
+    s[NEORV32_PERF_HPM3 + 2] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER5);
+#endif
+#if (NEORV32_PERF_HPM_NUM > 3)
+    s[NEORV32_PERF_HPM3 + 3] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER6);
+#endif
+#if (NEORV32_PERF_HPM_NUM > 4)
+    s[NEORV32_PERF_HPM3 + 4] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER7);
+#endif
+#if (NEORV32_PERF_HPM_NUM > 5)
+    s[NEORV32_PERF_HPM3 + 5] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER8);
+#endif
+#if (NEORV32_PERF_HPM_NUM > 6)
+    s[NEORV32_PERF_HPM3 + 6] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER9);
+#endif
+#if (NEORV32_PERF_HPM_NUM > 7)
+    s[NEORV32_PERF_HPM3 + 7] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER10);
+#endif
+#if (NEORV32_PERF_HPM_NUM > 8)
+    s[NEORV32_PERF_HPM3 + 8] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER11);
+#endif
+#if (NEORV32_PERF_HPM_NUM > 9)
+    s[NEORV32_PERF_HPM3 + 9] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER12);
+#endif
+#if (NEORV32_PERF_HPM_NUM > 10)
+    s[NEORV32_PERF_HPM3 + 10] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER13);
+#endif
+#if (NEORV32_PERF_HPM_NUM > 11)
+    s[NEORV32_PERF_HPM3 + 11] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER14);
+#endif
+#if (NEORV32_PERF_HPM_NUM > 12)
+    s[NEORV32_PERF_HPM3 + 12] = neorv32_cpu_csr_read(CSR_MHPMCOUNTER15);
+#endif
+  }
+#else
+  (void)hpm;
+#endif
+}
+
+
+/**********************************************************************//**
+ * Read HPM event configuration.
+ *
+ * @param[in] i HPM index (0 = mhpmevent3).
+ * @return mhpmevent CSR value.
+ **************************************************************************/
+static uint32_t __neorv32_perf_hpm_event(uint32_t i) {
+
+  switch (i) {
+    case 0:  return neorv32_cpu_csr_read(CSR_MHPMEVENT3);
+    case 1:  return neorv32_cpu_csr_read(CSR_MHPMEVENT4);
+    case 2:  return neorv32_cpu_csr_read(CSR_MHPMEVENT5);
+    case 3:  return neorv32_cpu_csr_read(CSR_MHPMEVENT6);
+    case 4:  return neorv32_cpu_csr_read(CSR_MHPMEVENT7);
+    case 5:  return neorv32_cpu_csr_read(CSR_MHPMEVENT8);
+    case 6:  return neorv32_cpu_csr_read(CSR_MHPMEVENT9);
+    case 7:  return neorv32_cpu_csr_read(CSR_MHPMEVENT10);
+    case 8:  return neorv32_cpu_csr_read(CSR_MHPMEVENT11);
+    case 9:  return neorv32_cpu_csr_read(CSR_MHPMEVENT12);
+    case 10: return neorv32_cpu_csr_read(CSR_MHPMEVENT13);
+    case 11: return neorv32_cpu_csr_read(CSR_MHPMEVENT14);
+    case 12: return neorv32_cpu_csr_read(CSR_MHPMEVENT15);
+    default: return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Initialize region-scoped measurements for the calling hart.
+ *
+ * @note Configure the HPM events (mhpmevent*) before calling this function;
+ * the measurement overhead is calibrated with the current event configuration.
+ *
+ * @param[in,out] table Region table (one entry per region ID).
+ * @param[in] num Number of entries in the region table (region IDs 0..num-1).
+ * @return 0 if success, -1 if invalid configuration, -2 if base counters (Zicntr) not available.
+ **************************************************************************/
+int neorv32_perf_setup(neorv32_perf_region_t *table, uint32_t num) {
+
+  __neorv32_perf_t *p = __neorv32_perf_get();
+  uint32_t i, mxisa = neorv32_cpu_csr_read(CSR_MXISA);
+
+  if ((table == NULL) || (num == 0)) {
+    return -1;
+  }
+  if ((mxisa & (1 << CSR_MXISA_ZICNTR)) == 0) {
+    return -2;
+  }
+
+  p->tab = table;
+  p->num = num;
+  p->hpm = mxisa & (1 << CSR_MXISA_ZIHPM);
+  for (i = 0; i < NEORV32_PERF_NUM; i++) {
+    p->ovh[i] = 0;
+  }
+  for (i = 0; i < num; i++) {
+    table[i].name = NULL;
+  }
+
+  // calibrate: overhead = minimum of empty measurements
+  neorv32_perf_clear();
+  for (i = 0; i < 8; i++) {
+    neorv32_perf_begin(0);
+    neorv32_perf_end(0);
+  }
+  for (i = 0; i < NEORV32_PERF_NUM; i++) {
+    p->ovh[i] = table[0].min[i];
+  }
+  neorv32_perf_clear();
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Assign a name to a region (shown in the report).
+ *
+ * @param[in] id Region ID.
+ * @param[in] name Region name (constant string).
+ **************************************************************************/
+void neorv32_perf_name(uint32_t id, const char *name) {
+
+  __neorv32_perf_t *p = __neorv32_perf_get();
+
+  if (id < p->num) {
+    p->tab[id].name = name;
+  }
+}
+
+
+/**********************************************************************//**
+ * Start a measurement.
+ *
+ * @param[in] id Region ID; out-of-range IDs are ignored.
+ **************************************************************************/
+void neorv32_perf_begin(uint32_t id) {
+
+  __neorv32_perf_t *p = __neorv32_perf_get();
+
+  if (id < p->num) {
+    __neorv32_perf_snapshot(p->tab[id].start, p->hpm);
+  }
+}
+
+
+/**********************************************************************//**
+ * End a measurement and update the region statistics.
+ *
+ * @param[in] id Region ID; out-of-range IDs are ignored.
+ **************************************************************************/
+void neorv32_perf_end(uint32_t id) {
+
+  uint32_t now[NEORV32_PERF_NUM];
+  __neorv32_perf_t *p = __neorv32_perf_get();
+
+  __neorv32_perf_snapshot(now, p->hpm);
+
+  if (id >= p->num) {
+    return;
+  }
+
+  neorv32_perf_region_t *r = &p->tab[id];
+  uint32_t i, delta;
+  for (i = 0; i < NEORV32_PERF_NUM; i++) {
+    delta = now[i] - r->start[i];
+    delta = (delta > p->ovh[i]) ? (delta - p->ovh[i]) : 0;
+    if ((r->count == 0) || (delta < r->min[i])) {
+      r->min[i] = delta;
+    }
+    if (delta > r->max[i]) {
+      r->max[i] = delta;
+    }
+    r->sum[i] += delta;
+  }
+  r->count++;
+}
+
+
+/**********************************************************************//**
+ * Clear the statistics of all regions of the calling hart (names are kept).
+ **************************************************************************/
+void neorv32_perf_clear(void) {
+
+  __neorv32_perf_t *p = __neorv32_perf_get();
+  uint32_t i, j;
+
+  for (i = 0; i < p->num; i++) {
+    p->tab[i].count = 0;
+    for (j = 0; j < NEORV32_PERF_NUM; j++) {
+      p->tab[i].start[j] = 0;
+      p->tab[i].min[j]   = 0;
+      p->tab[i].max[j]   = 0;
+      p->tab[i].sum[j]   = 0;
+    }
+  }
+}
+
+
+/**********************************************************************//**
+ * Print the statistics of all regions of the calling hart that have been
+ * measured at least once (min / mean / max / total per metric).
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ **************************************************************************/
+void neorv32_perf_report(neorv32_uart_t *UARTx) {
+
+  __neorv32_perf_t *p = __neorv32_perf_get();
+  uint32_t evt[NEORV32_PERF_NUM];
+  char name[NEORV32_PERF_NUM][12];
+  uint32_t i, j;
+
+  if (p->tab == NULL) {
+    return;
+  }
+
+  // metric names
+  for (j = 0; j < NEORV32_PERF_NUM; j++) {
+    evt[j] = 1; // counting
+    if (j == NEORV32_PERF_CYCLE) {
+      strcpy(name[j], "cycles");
+    }
+    else if (j == NEORV32_PERF_INSTRET) {
+      strcpy(name[j], "instret");
+    }
+    else {
+      evt[j] = (p->hpm) ? __neorv32_perf_hpm_event(j - NEORV32_PERF_HPM3) : 0;
+      i = __builtin_ctz(evt[j] | (1U << 31));
+      if ((evt[j] == (1U << i)) && (i < 20)) { // single event: event name
+        strcpy(name[j], __neorv32_perf_events[i]);
+      }
+      else { // several events: counter name
+        neorv32_aux_snprintf(name[j], sizeof(name[j]), "hpm%u", j - NEORV32_PERF_HPM3 + 3);
+      }
+    }
+  }
+
+  neorv32_uart_printf(UARTx, "\nneorv32_perf report (hart %u), overhead compensated: %u cycles, %u instret\n",
+                      neorv32_cpu_csr_read(CSR_MHARTID), p->ovh[NEORV32_PERF_CYCLE], p->ovh[NEORV32_PERF_INSTRET]);
+  for (i = 0; i < p->num; i++) {
+    neorv32_perf_region_t *r = &p->tab[i];
+    if (r->count == 0) {
+      continue;
+    }
+    neorv32_uart_printf(UARTx, "\nregion %u %s: %u calls\n", i, (r->name) ? r->name : "", r->count);
+    neorv32_uart_printf(UARTx, "  %-10s %10s %10s %10s %20s\n", "metric", "min", "mean", "max", "total");
+    for (j = 0; j < NEORV32_PERF_NUM; j++) {
+      if (evt[j] == 0) { // HPM not configured
+        continue;
+      }
+      neorv32_uart_printf(UARTx, "  %-10s %10u %10u %10u %20llu\n", name[j],
+                          r->min[j], (uint32_t)(r->sum[j] / r->count), r->max[j], r->sum[j]);
+    }
+  }
+}
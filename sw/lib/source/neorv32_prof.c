@@ -0,0 +1,355 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_prof.c
+ * @brief Sampling profiler source file.
+ *
+ * The CLINT machine timer interrupt samples the interrupted program counter (mepc)
+ * at a fixed rate. Each sample increments a 16-bit bucket of a PC histogram in RAM.
+ * The histogram is dumped as text via UART and mapped to functions on the host.
+ *
+ * In event mode (#neorv32_prof_event) the HPM counter #NEORV32_PROF_HPM is preloaded so that
+ * it overflows after a given number of events; the local counter overflow interrupt then
+ * takes the sample and reloads the counter.
+ *
+ * @note The profiler uses the machine timer interrupt (and its RTE handler slot) of the
+ * hart that calls #neorv32_prof_start; it cannot be used together with other MTI users.
+ * In event mode the local counter overflow interrupt and HPM counter #NEORV32_PROF_HPM
+ * are used instead. Code that runs with interrupts disabled (including other trap
+ * handlers) is not sampled.
+ */
+
+#include <neorv32.h>
+
+
+/**********************************************************************//**
+ * HPM counter CSRs used in event mode
+ **************************************************************************/
+#define PROF_HPM_CNT  (CSR_MHPMCOUNTER3  + NEORV32_PROF_HPM - 3)
+#define PROF_HPM_CNTH (CSR_MHPMCOUNTER3H + NEORV32_PROF_HPM - 3)
+#define PROF_HPM_EVT  (CSR_MHPMEVENT3    + NEORV32_PROF_HPM - 3)
+#define PROF_HPM_EVTH (CSR_MHPMEVENT3H   + NEORV32_PROF_HPM - 3)
+
+/**********************************************************************//**
+ * Profiler interrupt sources (mie CSR)
+ **************************************************************************/
+#define PROF_IRQ_MASK ((1 << CSR_MIE_MTIE) | (1 << CSR_MIE_LCOFIE))
+
+
+/**********************************************************************//**
+ * Profiler state.
+ **************************************************************************/
+typedef struct {
+  uint16_t *buf;                  // histogram; NULL if profiler is not initialized
+  uint32_t num;                   // number of buckets
+  uint32_t base;                  // start address of profiled range
+  uint32_t span;                  // size of profiled range in bytes
+  uint32_t shift;                 // log2(bucket size in bytes)
+  uint32_t rate;                  // sampling rate in Hz
+  uint32_t period;                // sampling period in timer ticks (clock cycles) or events
+  uint32_t event;                 // HPM event (#NEORV32_HPMCNT_EVENT_enum); -1 = timer mode
+  uint32_t reload_lo;             // HPM counter preload value (event mode)
+  uint32_t reload_hi;
+  uint32_t width;                 // HPM counter width in bits (event mode)
+  neorv32_prof_stats_t stats;     // statistics
+} __neorv32_prof_t;
+
+static __neorv32_prof_t __neorv32_prof;
+
+// start/end of .text section (linker script)
+extern char __text_start[];
+extern char __text_end[];
+
+
+/**********************************************************************//**
+ * Add the interrupted program counter to the histogram.
+ **************************************************************************/
+static void __neorv32_prof_sample(void) {
+
+  __neorv32_prof_t *p = &__neorv32_prof;
+  uint32_t offs = neorv32_cpu_csr_read(CSR_MEPC) - p->base;
+
+  p->stats.samples++;
+  if (offs >= p->span) {
+    p->stats.outside++;
+  }
+  else {
+    uint16_t *bucket = &p->buf[offs >> p->shift];
+    if (*bucket == 0xffff) {
+      p->stats.saturated++;
+    }
+    else {
+      *bucket += 1;
+    }
+  }
+}
+
+
+/**********************************************************************//**
+ * Machine timer interrupt handler: take a sample and schedule the next one.
+ **************************************************************************/
+static void __neorv32_prof_irq_handler(void) {
+
+  __neorv32_prof_t *p = &__neorv32_prof;
+
+  // next sampling point; do not accumulate a backlog if we are late
+  uint64_t next = neorv32_clint_mtimecmp_get() + p->period;
+  uint64_t now = neorv32_clint_time_get();
+  if (next <= now) {
+    next = now + p->period;
+    p->stats.missed++;
+  }
+  neorv32_clint_mtimecmp_set(next);
+
+  __neorv32_prof_sample();
+}
+
+
+/**********************************************************************//**
+ * Preload the HPM counter so that it overflows after "period" events.
+ **************************************************************************/
+static void __neorv32_prof_hpm_reload(void) {
+
+  __neorv32_prof_t *p = &__neorv32_prof;
+
+  neorv32_cpu_csr_set(CSR_MCOUNTINHIBIT, 1 << NEORV32_PROF_HPM);
+  neorv32_cpu_csr_write(PROF_HPM_CNT, p->reload_lo);
+  if (p->width > 32) {
+    neorv32_cpu_csr_write(PROF_HPM_CNTH, p->reload_hi);
+  }
+  neorv32_cpu_csr_write(PROF_HPM_EVTH, 0); // clear overflow flag
+  neorv32_cpu_csr_clr(CSR_MCOUNTINHIBIT, 1 << NEORV32_PROF_HPM);
+}
+
+
+/**********************************************************************//**
+ * Local counter overflow interrupt handler: take a sample and re-arm the counter.
+ *
+ * @note The sampled PC trails the instruction that caused the overflow by the
+ * interrupt latency ("skid").
+ **************************************************************************/
+static void __neorv32_prof_lcof_handler(void) {
+
+  __neorv32_prof_hpm_reload();
+  __neorv32_prof_sample();
+}
+
+
+/**********************************************************************//**
+ * Initialize the profiler. Sampling is not started yet.
+ *
+ * @note The bucket size is the smallest power of two (at least 2 bytes) that maps
+ * the entire address range into the histogram buffer.
+ *
+ * @param[in,out] buffer Histogram memory (16-bit aligned).
+ * @param[in] size Histogram memory size in bytes (at least 2).
+ * @param[in] base Start address of the profiled range.
+ * @param[in] limit End address of the profiled range (exclusive). Set base = limit = 0 to
+ * profile the entire .text section.
+ * @param[in] rate Sampling rate in Hz.
+ * @return 0 if success, -1 if invalid configuration, -2 if CLINT not available.
+ **************************************************************************/
+int neorv32_prof_setup(uint16_t *buffer, uint32_t size, uint32_t base, uint32_t limit, uint32_t rate) {
+
+  __neorv32_prof_t *p = &__neorv32_prof;
+
+  if ((base == 0) && (limit == 0)) {
+    base  = (uint32_t)&__text_start[0];
+    limit = (uint32_t)&__text_end[0];
+  }
+  if ((buffer == NULL) || (size < 2) || ((uint32_t)buffer & 1) || (limit <= base) || (rate == 0)) {
+    return -1;
+  }
+  if (neorv32_clint_available() == 0) {
+    return -2;
+  }
+
+  p->buf    = buffer;
+  p->num    = size >> 1;
+  p->base   = base & ~1;
+  p->span   = limit - p->base;
+  p->shift  = 1;
+  while (((p->span - 1) >> p->shift) >= p->num) {
+    p->shift++;
+  }
+  p->rate   = rate;
+  p->event  = (uint32_t)-1;
+  p->period = neorv32_sysinfo_get_clk() / rate;
+  if (p->period == 0) {
+    p->period = 1;
+  }
+
+  neorv32_prof_clear();
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Switch an initialized profiler to event mode: take a sample every "period"
+ * occurrences of an HPM event instead of sampling at a fixed rate.
+ *
+ * @note This uses HPM counter #NEORV32_PROF_HPM and the local counter overflow
+ * interrupt. The counter width is probed via #neorv32_cpu_hpm_get_size, which
+ * overrides mhpmcounter3[h].
+ *
+ * @param[in] event HPM event to count (#NEORV32_HPMCNT_EVENT_enum), e.g. HPMCNT_EVENT_DC_MISS.
+ * @param[in] period Number of events between two samples (1 .. 2^32-1).
+ * @return 0 if success, -1 if invalid configuration / profiler not initialized,
+ * -2 if the HPM counter is not available.
+ **************************************************************************/
+int neorv32_prof_event(uint32_t event, uint32_t period) {
+
+  __neorv32_prof_t *p = &__neorv32_prof;
+
+  if ((p->buf == NULL) || (period == 0) || (event > 31)) {
+    return -1;
+  }
+  if ((NEORV32_PROF_HPM < 3) || (NEORV32_PROF_HPM > 15) ||
+      (neorv32_cpu_hpm_get_num_counters() < (NEORV32_PROF_HPM - 2))) {
+    return -2;
+  }
+
+  uint32_t width = neorv32_cpu_hpm_get_size();
+  if ((width < 32) && (period >= (1U << width))) {
+    return -1;
+  }
+
+  // preload value = 2^width - period
+  if (width < 32) {
+    p->reload_lo = (1U << width) - period;
+    p->reload_hi = 0;
+  }
+  else {
+    p->reload_lo = 0 - period;
+    p->reload_hi = (width >= 64) ? 0xffffffffU : ((1U << (width - 32)) - 1);
+  }
+  p->width  = width;
+  p->event  = event;
+  p->period = period;
+  p->rate   = 0;
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Start sampling. Installs the machine timer interrupt handler (or the local
+ * counter overflow interrupt handler in event mode) and enables the according
+ * interrupt and global machine-mode interrupts.
+ **************************************************************************/
+void neorv32_prof_start(void) {
+
+  __neorv32_prof_t *p = &__neorv32_prof;
+
+  if (p->buf == NULL) {
+    return;
+  }
+
+  if (p->event == (uint32_t)-1) {
+    neorv32_rte_handler_install(TRAP_CODE_MTI, __neorv32_prof_irq_handler);
+    neorv32_clint_mtimecmp_set(neorv32_clint_time_get() + p->period);
+    neorv32_cpu_csr_set(CSR_MIE, 1 << CSR_MIE_MTIE);
+  }
+  else {
+    neorv32_rte_handler_install(TRAP_CODE_LCOFI, __neorv32_prof_lcof_handler);
+    neorv32_cpu_csr_write(PROF_HPM_EVT, 1 << p->event);
+    __neorv32_prof_hpm_reload();
+    neorv32_cpu_csr_set(CSR_MIE, 1 << CSR_MIE_LCOFIE);
+  }
+  neorv32_cpu_csr_set(CSR_MSTATUS, 1 << CSR_MSTATUS_MIE);
+}
+
+
+/**********************************************************************//**
+ * Stop sampling. Disables the profiler's interrupt source.
+ **************************************************************************/
+void neorv32_prof_stop(void) {
+
+  neorv32_cpu_csr_clr(CSR_MIE, PROF_IRQ_MASK);
+  if (__neorv32_prof.event == (uint32_t)-1) {
+    neorv32_clint_mtimecmp_set(-1);
+  }
+  else {
+    neorv32_cpu_csr_set(CSR_MCOUNTINHIBIT, 1 << NEORV32_PROF_HPM);
+    neorv32_cpu_csr_write(PROF_HPM_EVTH, 0);
+  }
+}
+
+
+/**********************************************************************//**
+ * Clear histogram and statistics.
+ **************************************************************************/
+void neorv32_prof_clear(void) {
+
+  __neorv32_prof_t *p = &__neorv32_prof;
+  uint32_t i;
+
+  uint32_t mie = neorv32_cpu_csr_read(CSR_MIE);
+  neorv32_cpu_csr_clr(CSR_MIE, PROF_IRQ_MASK);
+
+  for (i = 0; i < p->num; i++) {
+    p->buf[i] = 0;
+  }
+  p->stats.samples   = 0;
+  p->stats.outside   = 0;
+  p->stats.saturated = 0;
+  p->stats.missed    = 0;
+
+  neorv32_cpu_csr_write(CSR_MIE, mie);
+}
+
+
+/**********************************************************************//**
+ * Get profiling statistics.
+ *
+ * @param[in,out] stats Pointer to statistics structure (#neorv32_prof_stats_t).
+ **************************************************************************/
+void neorv32_prof_get_stats(neorv32_prof_stats_t *stats) {
+
+  uint32_t mie = neorv32_cpu_csr_read(CSR_MIE);
+  neorv32_cpu_csr_clr(CSR_MIE, PROF_IRQ_MASK);
+  *stats = __neorv32_prof.stats;
+  neorv32_cpu_csr_write(CSR_MIE, mie);
+}
+
+
+/**********************************************************************//**
+ * Send the histogram (non-zero buckets only) as text via UART.
+ *
+ * Format (one record per line, can be embedded in other console output):
+ * - "neorv32_prof begin <base> <bucket size> <rate> <samples> <outside>"; event mode:
+ *   rate is 0 and the header is followed by " <event> <period>"
+ * - "neorv32_prof <bucket address> <count>" for each non-zero bucket
+ * - "neorv32_prof end"
+ *
+ * @note Stop sampling (#neorv32_prof_stop) before dumping, otherwise the dump itself is profiled.
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ **************************************************************************/
+void neorv32_prof_dump(neorv32_uart_t *UARTx) {
+
+  __neorv32_prof_t *p = &__neorv32_prof;
+  uint32_t i;
+
+  if (p->buf == NULL) {
+    return;
+  }
+
+  neorv32_uart_printf(UARTx, "\nneorv32_prof begin 0x%x %u %u %u %u",
+                      p->base, 1 << p->shift, p->rate, p->stats.samples, p->stats.outside);
+  if (p->event != (uint32_t)-1) {
+    neorv32_uart_printf(UARTx, " %u %u", p->event, p->period);
+  }
+  neorv32_uart_printf(UARTx, "\n");
+  for (i = 0; i < p->num; i++) {
+    if (p->buf[i]) {
+      neorv32_uart_printf(UARTx, "neorv32_prof 0x%x %u\n", p->base + (i << p->shift), (uint32_t)p->buf[i]);
+    }
+  }
+  neorv32_uart_printf(UARTx, "neorv32_prof end\n");
+}
@@ -0,0 +1,363 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_queue.c
+ * @brief Lock-free inter-core message queues source file.
+ *
+ * @note All shared queue data (indices, sequence numbers and messages) is accessed using
+ * atomic memory operations only. These bypass the data cache so no cache synchronization
+ * is required. Messages are 32-bit words (e.g. values or pointers).
+ *
+ * @warning These functions require the A ISA extension (Zaamo + Zalrsc).
+ */
+
+#include <neorv32.h>
+
+
+/**********************************************************************//**
+ * Atomic compare-and-swap.
+ *
+ * @param[in] addr Address of word-aligned variable.
+ * @param[in] expected Expected current value.
+ * @param[in] desired New value if current value matches.
+ * @return 1 if swap succeeded, 0 otherwise.
+ **************************************************************************/
+static int __neorv32_queue_cas(uint32_t addr, uint32_t expected, uint32_t desired) {
+
+  while (neorv32_cpu_amolr(addr) == expected) {
+    if (neorv32_cpu_amosc(addr, desired) == 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Notify consumer hart via its CLINT machine software interrupt.
+ *
+ * @param[in] hart Consumer hart ID or #NEORV32_QUEUE_NO_DOORBELL.
+ **************************************************************************/
+static inline void __neorv32_queue_ring(int hart) {
+
+  if (hart != NEORV32_QUEUE_NO_DOORBELL) {
+    neorv32_clint_msi_set(hart);
+  }
+}
+
+
+/**********************************************************************//**
+ * Sleep until the own doorbell (CLINT machine software interrupt) rings.
+ *
+ * @note Interrupts are globally disabled while waiting so no MSI trap handler is required.
+ **************************************************************************/
+static void __neorv32_queue_doorbell_wait(void) {
+
+  int hart = (int)neorv32_smp_whoami();
+  uint32_t mstatus = neorv32_cpu_csr_read(CSR_MSTATUS);
+  uint32_t mie = neorv32_cpu_csr_read(CSR_MIE);
+
+  neorv32_cpu_csr_clr(CSR_MSTATUS, 1 << CSR_MSTATUS_MIE);
+  neorv32_cpu_csr_set(CSR_MIE, 1 << CSR_MIE_MSIE);
+  neorv32_cpu_sleep(); // returns immediately if the doorbell is already pending
+  neorv32_clint_msi_clr(hart);
+  neorv32_cpu_csr_write(CSR_MIE, mie);
+  neorv32_cpu_csr_write(CSR_MSTATUS, mstatus);
+}
+
+
+// ################################################################################################
+// Single-Producer / Single-Consumer Queue
+// ################################################################################################
+
+
+/**********************************************************************//**
+ * Initialize SPSC queue.
+ *
+ * @note The queue has to be initialized before any other hart uses it.
+ *
+ * @param[in,out] q Pointer to queue struct (#neorv32_queue_spsc_t).
+ * @param[in] buffer Pointer to message buffer (size * 4 bytes).
+ * @param[in] size Number of buffer entries; has to be a power of two.
+ * @param[in] doorbell Consumer hart ID to notify on each message; #NEORV32_QUEUE_NO_DOORBELL to disable.
+ * @return 0 if success, -1 if invalid size or if compiled without A ISA extension.
+ **************************************************************************/
+int neorv32_queue_spsc_init(neorv32_queue_spsc_t *q, uint32_t *buffer, uint32_t size, int doorbell) {
+
+#if defined __riscv_atomic
+  if ((size == 0) || (size & (size - 1))) {
+    return -1;
+  }
+
+  q->buf      = buffer;
+  q->mask     = size - 1;
+  q->doorbell = doorbell;
+  neorv32_cpu_amoswap((uint32_t)&q->head, 0);
+  neorv32_cpu_amoswap((uint32_t)&q->tail, 0);
+  asm volatile ("fence"); // make configuration visible to other harts
+  return 0;
+#else
+  (void)q;
+  (void)buffer;
+  (void)size;
+  (void)doorbell;
+  return -1;
+#endif
+}
+
+
+/**********************************************************************//**
+ * Put message into SPSC queue (producer only).
+ *
+ * @note This function is non-blocking.
+ *
+ * @param[in,out] q Pointer to queue struct (#neorv32_queue_spsc_t).
+ * @param[in] data Message.
+ * @return 0 if success, -1 if queue is full.
+ **************************************************************************/
+int neorv32_queue_spsc_push(neorv32_queue_spsc_t *q, uint32_t data) {
+
+  uint32_t tail = neorv32_cpu_amolr((uint32_t)&q->tail);
+  uint32_t head = neorv32_cpu_amolr((uint32_t)&q->head);
+
+  if ((tail - head) > q->mask) {
+    return -1;
+  }
+
+  neorv32_cpu_amoswap((uint32_t)&q->buf[tail & q->mask], data);
+  neorv32_cpu_amoswap((uint32_t)&q->tail, tail + 1); // publish message
+  __neorv32_queue_ring(q->doorbell);
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Get message from SPSC queue (consumer only).
+ *
+ * @note This function is non-blocking.
+ *
+ * @param[in,out] q Pointer to queue struct (#neorv32_queue_spsc_t).
+ * @param[in,out] data Pointer for the received message.
+ * @return 0 if success, -1 if queue is empty.
+ **************************************************************************/
+int neorv32_queue_spsc_pop(neorv32_queue_spsc_t *q, uint32_t *data) {
+
+  uint32_t head = neorv32_cpu_amolr((uint32_t)&q->head);
+  uint32_t tail = neorv32_cpu_amolr((uint32_t)&q->tail);
+
+  if (head == tail) {
+    return -1;
+  }
+
+  *data = neorv32_cpu_amolr((uint32_t)&q->buf[head & q->mask]);
+  neorv32_cpu_amoswap((uint32_t)&q->head, head + 1); // release entry
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Get number of messages in SPSC queue.
+ *
+ * @param[in,out] q Pointer to queue struct (#neorv32_queue_spsc_t).
+ * @return Number of pending messages.
+ **************************************************************************/
+uint32_t neorv32_queue_spsc_count(neorv32_queue_spsc_t *q) {
+
+  uint32_t head = neorv32_cpu_amolr((uint32_t)&q->head);
+  uint32_t tail = neorv32_cpu_amolr((uint32_t)&q->tail);
+  return tail - head;
+}
+
+
+/**********************************************************************//**
+ * Put message into SPSC queue (producer only).
+ *
+ * @note This function is blocking until there is free space in the queue.
+ *
+ * @param[in,out] q Pointer to queue struct (#neorv32_queue_spsc_t).
+ * @param[in] data Message.
+ **************************************************************************/
+void neorv32_queue_spsc_push_wait(neorv32_queue_spsc_t *q, uint32_t data) {
+
+  while (neorv32_queue_spsc_push(q, data));
+}
+
+
+/**********************************************************************//**
+ * Get message from SPSC queue (consumer only).
+ *
+ * @note This function is blocking until a message is available. If the queue's doorbell
+ * is assigned to the calling hart it sleeps until the producer rings the doorbell.
+ *
+ * @param[in,out] q Pointer to queue struct (#neorv32_queue_spsc_t).
+ * @return Received message.
+ **************************************************************************/
+uint32_t neorv32_queue_spsc_pop_wait(neorv32_queue_spsc_t *q) {
+
+  uint32_t data = 0;
+  int sleep = (q->doorbell == (int)neorv32_smp_whoami());
+
+  while (neorv32_queue_spsc_pop(q, &data)) {
+    if (sleep) {
+      __neorv32_queue_doorbell_wait();
+    }
+  }
+  return data;
+}
+
+
+// ################################################################################################
+// Multi-Producer / Multi-Consumer Queue
+// ################################################################################################
+
+
+/**********************************************************************//**
+ * Initialize MPMC queue.
+ *
+ * @note The queue has to be initialized before any other hart uses it.
+ *
+ * @param[in,out] q Pointer to queue struct (#neorv32_queue_mpmc_t).
+ * @param[in] cells Pointer to cell array (#neorv32_queue_cell_t).
+ * @param[in] size Number of cells; has to be a power of two.
+ * @param[in] doorbell Consumer hart ID to notify on each message; #NEORV32_QUEUE_NO_DOORBELL to disable.
+ * @return 0 if success, -1 if invalid size or if compiled without A ISA extension.
+ **************************************************************************/
+int neorv32_queue_mpmc_init(neorv32_queue_mpmc_t *q, neorv32_queue_cell_t *cells, uint32_t size, int doorbell) {
+
+#if defined __riscv_atomic
+  if ((size == 0) || (size & (size - 1))) {
+    return -1;
+  }
+
+  uint32_t i;
+  for (i=0; i<size; i++) {
+    neorv32_cpu_amoswap((uint32_t)&cells[i].seq, i);
+  }
+
+  q->cells    = cells;
+  q->mask     = size - 1;
+  q->doorbell = doorbell;
+  neorv32_cpu_amoswap((uint32_t)&q->head, 0);
+  neorv32_cpu_amoswap((uint32_t)&q->tail, 0);
+  asm volatile ("fence"); // make configuration visible to other harts
+  return 0;
+#else
+  (void)q;
+  (void)cells;
+  (void)size;
+  (void)doorbell;
+  return -1;
+#endif
+}
+
+
+/**********************************************************************//**
+ * Put message into MPMC queue.
+ *
+ * @note This function is non-blocking.
+ *
+ * @param[in,out] q Pointer to queue struct (#neorv32_queue_mpmc_t).
+ * @param[in] data Message.
+ * @return 0 if success, -1 if queue is full.
+ **************************************************************************/
+int neorv32_queue_mpmc_push(neorv32_queue_mpmc_t *q, uint32_t data) {
+
+  neorv32_queue_cell_t *cell;
+  uint32_t pos = neorv32_cpu_amolr((uint32_t)&q->tail);
+
+  while (1) {
+    cell = &q->cells[pos & q->mask];
+    int32_t dif = (int32_t)(neorv32_cpu_amolr((uint32_t)&cell->seq) - pos);
+    if (dif == 0) { // cell is free: try to claim write ticket
+      if (__neorv32_queue_cas((uint32_t)&q->tail, pos, pos + 1)) {
+        break;
+      }
+    }
+    else if (dif < 0) { // cell still occupied by previous lap
+      return -1;
+    }
+    pos = neorv32_cpu_amolr((uint32_t)&q->tail); // another producer was faster
+  }
+
+  neorv32_cpu_amoswap((uint32_t)&cell->data, data);
+  neorv32_cpu_amoswap((uint32_t)&cell->seq, pos + 1); // publish message
+  __neorv32_queue_ring(q->doorbell);
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Get message from MPMC queue.
+ *
+ * @note This function is non-blocking.
+ *
+ * @param[in,out] q Pointer to queue struct (#neorv32_queue_mpmc_t).
+ * @param[in,out] data Pointer for the received message.
+ * @return 0 if success, -1 if queue is empty.
+ **************************************************************************/
+int neorv32_queue_mpmc_pop(neorv32_queue_mpmc_t *q, uint32_t *data) {
+
+  neorv32_queue_cell_t *cell;
+  uint32_t pos = neorv32_cpu_amolr((uint32_t)&q->head);
+
+  while (1) {
+    cell = &q->cells[pos & q->mask];
+    int32_t dif = (int32_t)(neorv32_cpu_amolr((uint32_t)&cell->seq) - (pos + 1));
+    if (dif == 0) { // cell is filled: try to claim read ticket
+      if (__neorv32_queue_cas((uint32_t)&q->head, pos, pos + 1)) {
+        break;
+      }
+    }
+    else if (dif < 0) { // cell not written yet
+      return -1;
+    }
+    pos = neorv32_cpu_amolr((uint32_t)&q->head); // another consumer was faster
+  }
+
+  *data = neorv32_cpu_amolr((uint32_t)&cell->data);
+  neorv32_cpu_amoswap((uint32_t)&cell->seq, pos + q->mask + 1); // release cell for next lap
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Put message into MPMC queue.
+ *
+ * @note This function is blocking until there is free space in the queue.
+ *
+ * @param[in,out] q Pointer to queue struct (#neorv32_queue_mpmc_t).
+ * @param[in] data Message.
+ **************************************************************************/
+void neorv32_queue_mpmc_push_wait(neorv32_queue_mpmc_t *q, uint32_t data) {
+
+  while (neorv32_queue_mpmc_push(q, data));
+}
+
+
+/**********************************************************************//**
+ * Get message from MPMC queue.
+ *
+ * @note This function is blocking until a message is available. If the queue's doorbell
+ * is assigned to the calling hart it sleeps until a producer rings the doorbell.
+ *
+ * @param[in,out] q Pointer to queue struct (#neorv32_queue_mpmc_t).
+ * @return Received message.
+ **************************************************************************/
+uint32_t neorv32_queue_mpmc_pop_wait(neorv32_queue_mpmc_t *q) {
+
+  uint32_t data = 0;
+  int sleep = (q->doorbell == (int)neorv32_smp_whoami());
+
+  while (neorv32_queue_mpmc_pop(q, &data)) {
+    if (sleep) {
+      __neorv32_queue_doorbell_wait();
+    }
+  }
+  return data;
+}
@@ -103,6 +103,7 @@ static void __neorv32_rte_panic(void) {
     case TRAP_CODE_MSI:          __neorv32_rte_puts("Machine software IRQ"); break;
     case TRAP_CODE_MTI:          __neorv32_rte_puts("Machine timer IRQ"); break;
     case TRAP_CODE_MEI:          __neorv32_rte_puts("Machine external IRQ"); break;
+    case TRAP_CODE_LCOFI:        __neorv32_rte_puts("Local counter overflow IRQ"); break;
     case TRAP_CODE_FIRQ_0:
     case TRAP_CODE_FIRQ_1:
     case TRAP_CODE_FIRQ_2:
@@ -0,0 +1,389 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_sched.c
+ * @brief Work-stealing task scheduler for the SMP dual-core configuration source file.
+ *
+ * @note Each hart owns a Chase-Lev deque. The owner pushes and pops tasks at the bottom
+ * end while other harts steal from the top end. All index accesses use atomic memory
+ * operations (neorv32_cpu_amo*, which bypass the data cache); task descriptors are published via "fence".
+ *
+ * @warning Parallel execution requires the A ISA extension (Zaamo + Zalrsc). Without
+ * atomics the scheduler falls back to sequential execution: tasks are executed right
+ * away by the spawning hart.
+ */
+
+#include <neorv32.h>
+
+
+/**********************************************************************//**
+ * Task descriptor (stored by value in the deque slots).
+ **************************************************************************/
+typedef struct {
+  void                  *func;  // neorv32_sched_func_t or neorv32_sched_range_t
+  void                  *arg;   // user argument
+  uint32_t               begin; // range tasks only: first index
+  uint32_t               end;   // range tasks only: last index + 1
+  uint32_t               grain; // 0 = plain task, otherwise range task split size
+  neorv32_sched_group_t *group; // task group this task belongs to
+} neorv32_sched_task_t;
+
+
+/**********************************************************************//**
+ * Per-hart work-stealing deque.
+ **************************************************************************/
+typedef struct {
+  uint32_t top;    // steal end; atomic accesses only
+  uint32_t bottom; // owner end; atomic accesses only
+  neorv32_sched_task_t slot[NEORV32_SCHED_DEQUE_SIZE];
+} neorv32_sched_deque_t;
+
+
+/**********************************************************************//**
+ * Private scheduler state.
+ **************************************************************************/
+static neorv32_sched_deque_t __neorv32_sched_deque[NEORV32_SCHED_HARTS];
+static neorv32_sched_stats_t __neorv32_sched_stats[NEORV32_SCHED_HARTS];
+static uint32_t __neorv32_sched_run = 0; // worker run flag
+
+
+/**********************************************************************//**
+ * Atomic compare-and-swap.
+ *
+ * @param[in] addr Address of word-aligned variable.
+ * @param[in] expected Expected current value.
+ * @param[in] desired New value if current value matches.
+ * @return 1 if swap succeeded, 0 otherwise.
+ **************************************************************************/
+static int __neorv32_sched_cas(uint32_t addr, uint32_t expected, uint32_t desired) {
+
+  while (neorv32_cpu_amolr(addr) == expected) {
+    if (neorv32_cpu_amosc(addr, desired) == 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Get deque index of the calling hart.
+ *
+ * @return Hart index.
+ **************************************************************************/
+static inline int __neorv32_sched_hart(void) {
+
+  return (int)(neorv32_smp_whoami() & (NEORV32_SCHED_HARTS-1));
+}
+
+
+/**********************************************************************//**
+ * Push task to the bottom of the own deque (owner only).
+ *
+ * @param[in] hart Own hart index.
+ * @param[in] task Pointer to task descriptor (will be copied).
+ * @return 0 if success, -1 if deque is full.
+ **************************************************************************/
+static int __neorv32_sched_push(int hart, const neorv32_sched_task_t *task) {
+
+#if defined __riscv_atomic
+  neorv32_sched_deque_t *dq = &__neorv32_sched_deque[hart];
+
+  uint32_t b = neorv32_cpu_amolr((uint32_t)&dq->bottom);
+  uint32_t t = neorv32_cpu_amolr((uint32_t)&dq->top);
+  if ((b - t) >= NEORV32_SCHED_DEQUE_SIZE) {
+    return -1;
+  }
+
+  dq->slot[b & (NEORV32_SCHED_DEQUE_SIZE-1)] = *task;
+  asm volatile ("fence" : : : "memory"); // make task visible before publishing it
+  neorv32_cpu_amoswap((uint32_t)&dq->bottom, b + 1);
+  return 0;
+#else
+  (void)hart;
+  (void)task;
+  return -1; // no deques without atomics: the caller executes the task right away
+#endif
+}
+
+
+/**********************************************************************//**
+ * Pop task from the bottom of the own deque (owner only).
+ *
+ * @param[in] hart Own hart index.
+ * @param[in,out] task Pointer to task descriptor.
+ * @return 0 if success, -1 if deque is empty.
+ **************************************************************************/
+static int __neorv32_sched_pop(int hart, neorv32_sched_task_t *task) {
+
+  neorv32_sched_deque_t *dq = &__neorv32_sched_deque[hart];
+
+  uint32_t b = neorv32_cpu_amolr((uint32_t)&dq->bottom) - 1;
+  neorv32_cpu_amoswap((uint32_t)&dq->bottom, b); // reserve bottom-most entry
+  uint32_t t = neorv32_cpu_amolr((uint32_t)&dq->top);
+
+  if ((int32_t)(b - t) < 0) { // deque is empty
+    neorv32_cpu_amoswap((uint32_t)&dq->bottom, t);
+    return -1;
+  }
+
+  *task = dq->slot[b & (NEORV32_SCHED_DEQUE_SIZE-1)];
+  if (b != t) { // more than one entry left - no race with thieves
+    return 0;
+  }
+
+  // last entry: race against thieves
+  int rc = __neorv32_sched_cas((uint32_t)&dq->top, t, t + 1) ? 0 : -1;
+  neorv32_cpu_amoswap((uint32_t)&dq->bottom, t + 1);
+  return rc;
+}
+
+
+/**********************************************************************//**
+ * Steal task from the top of another hart's deque.
+ *
+ * @param[in] victim Victim's hart index.
+ * @param[in,out] task Pointer to task descriptor.
+ * @return 0 if success, -1 if deque is empty or if we lost the race.
+ **************************************************************************/
+static int __neorv32_sched_steal(int victim, neorv32_sched_task_t *task) {
+
+  neorv32_sched_deque_t *dq = &__neorv32_sched_deque[victim];
+
+  uint32_t t = neorv32_cpu_amolr((uint32_t)&dq->top);
+  uint32_t b = neorv32_cpu_amolr((uint32_t)&dq->bottom);
+  if ((int32_t)(b - t) <= 0) {
+    return -1;
+  }
+
+  asm volatile ("fence" : : : "memory"); // reload data cache to see the published task
+  *task = dq->slot[t & (NEORV32_SCHED_DEQUE_SIZE-1)];
+  if (__neorv32_sched_cas((uint32_t)&dq->top, t, t + 1) == 0) {
+    return -1;
+  }
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Execute a task and signal its completion to the task's group.
+ *
+ * @param[in] hart Own hart index.
+ * @param[in] task Pointer to task descriptor.
+ **************************************************************************/
+static void __neorv32_sched_execute(int hart, neorv32_sched_task_t *task) {
+
+  if (task->grain == 0) { // plain task
+    ((neorv32_sched_func_t)task->func)(task->arg);
+  }
+  else { // range task: split off upper halves until the grain size is reached
+    uint32_t begin = task->begin;
+    uint32_t end = task->end;
+    while ((end - begin) > task->grain) {
+      neorv32_sched_task_t split = *task;
+      split.begin = begin + ((end - begin) >> 1);
+      split.end = end;
+      neorv32_cpu_amoadd((uint32_t)&task->group->pending, 1);
+      if (__neorv32_sched_push(hart, &split)) { // deque full; process remaining range right here
+        neorv32_cpu_amoadd((uint32_t)&task->group->pending, (uint32_t)-1);
+        break;
+      }
+      end = split.begin;
+    }
+    ((neorv32_sched_range_t)task->func)(begin, end, task->arg);
+  }
+
+  __neorv32_sched_stats[hart].executed++;
+  neorv32_cpu_amoadd((uint32_t)&task->group->pending, (uint32_t)-1);
+}
+
+
+/**********************************************************************//**
+ * Try to find and execute a single task (own deque first, then steal).
+ *
+ * @param[in] hart Own hart index.
+ * @return 1 if a task was executed, 0 if no work was found.
+ **************************************************************************/
+static int __neorv32_sched_try_run(int hart) {
+
+  neorv32_sched_task_t task;
+
+  if (__neorv32_sched_pop(hart, &task) == 0) {
+    __neorv32_sched_execute(hart, &task);
+    return 1;
+  }
+
+  int victim;
+  for (victim=0; victim<NEORV32_SCHED_HARTS; victim++) {
+    if ((victim != hart) && (__neorv32_sched_steal(victim, &task) == 0)) {
+      __neorv32_sched_stats[hart].stolen++;
+      __neorv32_sched_execute(hart, &task);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Worker main loop for the secondary core(s).
+ *
+ * @return Irrelevant.
+ **************************************************************************/
+static int __neorv32_sched_worker(void) {
+
+  neorv32_rte_setup();
+
+  int hart = __neorv32_sched_hart();
+  while (neorv32_cpu_amolr((uint32_t)&__neorv32_sched_run)) {
+    if (__neorv32_sched_try_run(hart) == 0) {
+      int i;
+      for (i=0; i<16; i++) { // idle back-off to reduce bus pressure
+        asm volatile ("nop");
+      }
+    }
+  }
+  return 0; // return to crt0 and halt
+}
+
+
+/**********************************************************************//**
+ * Launch the scheduler's worker loop on core 1.
+ *
+ * @note This function can be executed on core 0 only. Without calling this function
+ * all tasks are executed by the calling hart only (during neorv32_sched_sync).
+ *
+ * @param[in] stack_memory Pointer to beginning of core 1's stack memory array.
+ * @param[in] stack_size_bytes Core 1's stack size in bytes.
+ * @return 0 if success, -1 if A ISA extension is not available, -2 if core 1 could
+ * not be launched.
+ **************************************************************************/
+int neorv32_sched_start(uint8_t *stack_memory, size_t stack_size_bytes) {
+
+#if defined __riscv_atomic
+  uint32_t isa = neorv32_cpu_csr_read(CSR_MXISA);
+  if (((isa & (1 << CSR_MXISA_ZAAMO)) == 0) || ((isa & (1 << CSR_MXISA_ZALRSC)) == 0)) {
+    return -1;
+  }
+
+  neorv32_cpu_amoswap((uint32_t)&__neorv32_sched_run, 1);
+  if (neorv32_smp_launch(__neorv32_sched_worker, stack_memory, stack_size_bytes)) {
+    neorv32_cpu_amoswap((uint32_t)&__neorv32_sched_run, 0);
+    return -2;
+  }
+  return 0;
+#else
+  (void)stack_memory;
+  (void)stack_size_bytes;
+  return -1;
+#endif
+}
+
+
+/**********************************************************************//**
+ * Stop the worker loop of core 1 after it has finished its current task.
+ * Core 1 returns to crt0 and halts.
+ **************************************************************************/
+void neorv32_sched_stop(void) {
+
+  neorv32_cpu_amoswap((uint32_t)&__neorv32_sched_run, 0);
+}
+
+
+/**********************************************************************//**
+ * Spawn a new task. The task can be executed by any hart.
+ *
+ * @note If the calling hart's deque is full the task is executed right away.
+ *
+ * @param[in,out] group Task group; use neorv32_sched_sync() to wait for completion.
+ * @param[in] func Task function.
+ * @param[in] arg Task function argument.
+ **************************************************************************/
+void neorv32_sched_spawn(neorv32_sched_group_t *group, neorv32_sched_func_t func, void *arg) {
+
+  int hart = __neorv32_sched_hart();
+  neorv32_sched_task_t task;
+
+  task.func  = (void*)func;
+  task.arg   = arg;
+  task.begin = 0;
+  task.end   = 0;
+  task.grain = 0;
+  task.group = group;
+
+  neorv32_cpu_amoadd((uint32_t)&group->pending, 1);
+  if (__neorv32_sched_push(hart, &task)) {
+    __neorv32_sched_execute(hart, &task);
+  }
+}
+
+
+/**********************************************************************//**
+ * Wait until all tasks of a group have completed (join). The calling hart
+ * keeps executing (own or stolen) tasks while waiting.
+ *
+ * @param[in,out] group Task group.
+ **************************************************************************/
+void neorv32_sched_sync(neorv32_sched_group_t *group) {
+
+  int hart = __neorv32_sched_hart();
+
+  while (neorv32_cpu_amolr((uint32_t)&group->pending)) {
+    __neorv32_sched_try_run(hart);
+  }
+  asm volatile ("fence" : : : "memory"); // reload data cache to see all task results
+}
+
+
+/**********************************************************************//**
+ * Parallel for-loop. The index range is recursively split into halves that can be
+ * stolen by other harts until the chunk size is not larger than the grain size.
+ * This function returns when the whole range has been processed.
+ *
+ * @param[in] begin First index.
+ * @param[in] end Last index + 1.
+ * @param[in] grain Maximum number of indices processed by a single call of func
+ * (has to be non-zero).
+ * @param[in] func Range function; called as func(chunk_begin, chunk_end, arg).
+ * @param[in] arg Range function argument.
+ **************************************************************************/
+void neorv32_sched_parallel_for(uint32_t begin, uint32_t end, uint32_t grain, neorv32_sched_range_t func, void *arg) {
+
+  if (end <= begin) {
+    return;
+  }
+
+  int hart = __neorv32_sched_hart();
+  neorv32_sched_group_t group = NEORV32_SCHED_GROUP_INIT;
+  neorv32_sched_task_t task;
+
+  task.func  = (void*)func;
+  task.arg   = arg;
+  task.begin = begin;
+  task.end   = end;
+  task.grain = (grain == 0) ? 1 : grain;
+  task.group = &group;
+
+  neorv32_cpu_amoadd((uint32_t)&group.pending, 1);
+  __neorv32_sched_execute(hart, &task);
+  neorv32_sched_sync(&group);
+}
+
+
+/**********************************************************************//**
+ * Get scheduler statistics of a specific hart.
+ *
+ * @param[in] hart Hart ID.
+ * @param[in,out] stats Pointer to statistics struct (#neorv32_sched_stats_t).
+ **************************************************************************/
+void neorv32_sched_get_stats(int hart, neorv32_sched_stats_t *stats) {
+
+  asm volatile ("fence" : : : "memory"); // reload data cache to see other hart's counters
+  *stats = __neorv32_sched_stats[hart & (NEORV32_SCHED_HARTS-1)];
+}
@@ -1,7 +1,7 @@
 // ================================================================================ //
 // The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
 // Copyright (c) NEORV32 contributors.                                              //
-// Copyright (c) 2020 - 2025 Stephan Nolting. All rights reserved.                  //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
 // Licensed under the BSD-3-Clause license, see LICENSE for details.                //
 // SPDX-License-Identifier: BSD-3-Clause                                            //
 // ================================================================================ //
@@ -239,3 +239,279 @@ int neorv32_spi_busy(void) {
 
   return (int)(NEORV32_SPI->CTRL & (1 << SPI_CTRL_BUSY));
 }
+
+
+// #################################################################################################
+// Hardware-Managed Bulk Transfers
+// #################################################################################################
+
+
+/**********************************************************************//**
+ * Set frame data width.
+ *
+ * @note 32-bit frames can only be transferred via hardware-managed transfers
+ * (#neorv32_spi_rw) as bit 31 of the DATA register selects command mode otherwise.
+ *
+ * @param[in] bits Frame data width in bits (8, 16 or 32).
+ **************************************************************************/
+void neorv32_spi_set_dwidth(int bits) {
+
+  uint32_t sel = 0; // 8-bit
+  if (bits > 16) {
+    sel = 2; // 32-bit
+  }
+  else if (bits > 8) {
+    sel = 1; // 16-bit
+  }
+
+  uint32_t tmp = NEORV32_SPI->CTRL & ~(3U << SPI_CTRL_DWIDTH_LSB);
+  NEORV32_SPI->CTRL = tmp | (sel << SPI_CTRL_DWIDTH_LSB);
+}
+
+
+/**********************************************************************//**
+ * Get frame data width.
+ *
+ * @return Frame data width in bits (8, 16 or 32).
+ **************************************************************************/
+int neorv32_spi_get_dwidth(void) {
+
+  uint32_t sel = (NEORV32_SPI->CTRL >> SPI_CTRL_DWIDTH_LSB) & 3;
+  if (sel > 1) {
+    sel = 2;
+  }
+  return (int)(8 << sel);
+}
+
+
+/**********************************************************************//**
+ * Start hardware-managed transfer.
+ *
+ * @param[in] cs Chip select line for automatic chip select (0..7); no automatic chip select if negative.
+ * @param[in] tx Pointer to TX data; receive-only if NULL.
+ * @param[in] rx Pointer to RX buffer; transmit-only if NULL.
+ * @param[in] len Number of bytes to transfer (multiple of the frame size).
+ * @param[in] size Frame size in bytes.
+ * @return Number of frames, -1 if invalid length.
+ **************************************************************************/
+static int __neorv32_spi_xfer_start(int cs, const void *tx, void *rx, int len, uint32_t size) {
+
+  if ((len < 0) || ((uint32_t)len & (size - 1))) {
+    return -1;
+  }
+
+  uint32_t num = (uint32_t)len / size;
+  if (num > ((1U << (SPI_XFER_NUM_MSB + 1)) - 1)) {
+    return -1;
+  }
+  if (num == 0) {
+    return 0;
+  }
+
+  uint32_t tmp = num << SPI_XFER_NUM_LSB;
+  if (cs >= 0) {
+    tmp |= ((uint32_t)(cs & 7) << SPI_XFER_CS_LSB) | (1U << SPI_XFER_CSEN);
+  }
+  if (tx == NULL) {
+    tmp |= 1U << SPI_XFER_RXO;
+  }
+  if (rx == NULL) {
+    tmp |= 1U << SPI_XFER_TXO;
+  }
+
+  while (neorv32_spi_busy()); // wait for pending operations to complete
+  NEORV32_SPI->XFER = tmp;
+  return (int)num;
+}
+
+
+/**********************************************************************//**
+ * Get frame size in bytes.
+ *
+ * @return Frame size in bytes (1, 2 or 4).
+ **************************************************************************/
+static uint32_t __neorv32_spi_frame_size(void) {
+
+  return (uint32_t)neorv32_spi_get_dwidth() >> 3;
+}
+
+
+/**********************************************************************//**
+ * Software bulk data transfer (byte-wise) for SPI modules without hardware-managed transfers.
+ *
+ * @param[in] cs Chip select line that is activated before the first and deactivated
+ * after the last byte; no automatic chip select if negative.
+ * @param[in] tx Pointer to TX data; all-ones are sent if NULL.
+ * @param[in,out] rx Pointer to RX buffer; RX data is discarded if NULL.
+ * @param[in] len Number of bytes to transfer.
+ * @return Number of transferred bytes, -1 if invalid length.
+ **************************************************************************/
+static int __neorv32_spi_rw_sw(int cs, const void *tx, void *rx, int len) {
+
+  if (len < 0) {
+    return -1;
+  }
+
+  const uint8_t *txd = (const uint8_t*)tx;
+  uint8_t *rxd = (uint8_t*)rx;
+  uint8_t tmp;
+  int i;
+
+  if (cs >= 0) {
+    neorv32_spi_cs_en(cs & 7);
+  }
+  for (i = 0; i < len; i++) {
+    tmp = neorv32_spi_transfer((txd == NULL) ? 0xff : txd[i]);
+    if (rxd != NULL) {
+      rxd[i] = tmp;
+    }
+  }
+  if (cs >= 0) {
+    neorv32_spi_cs_dis();
+    while (neorv32_spi_busy()); // wait for chip select release
+  }
+  return len;
+}
+
+
+/**********************************************************************//**
+ * Bulk data transfer using the current chip select configuration.
+ *
+ * @note This function is blocking. See #neorv32_spi_rw_cs.
+ *
+ * @param[in] tx Pointer to TX data; all-ones are sent if NULL.
+ * @param[in,out] rx Pointer to RX buffer; RX data is discarded if NULL.
+ * @param[in] len Number of bytes to transfer (multiple of the frame size).
+ * @return Number of transferred bytes, -1 if invalid length.
+ **************************************************************************/
+int neorv32_spi_rw(const void *tx, void *rx, int len) {
+
+  return neorv32_spi_rw_cs(-1, tx, rx, len);
+}
+
+
+/**********************************************************************//**
+ * Bulk data transfer with optional automatic chip select. The transfer is counted
+ * by the hardware; the CPU only keeps the TX FIFO filled and the RX FIFO empty.
+ * Frames are only started if their RX data can be stored, so data cannot get lost.
+ *
+ * @note This function is blocking. Frames of 16 or 32 bit (#neorv32_spi_set_dwidth)
+ * are read from/written to naturally-aligned 16-bit or 32-bit buffer elements.
+ * @note Falls back to byte-wise software transfers if hardware-managed transfers
+ * are not implemented (IO_SPI_XFER_EN = false).
+ *
+ * @param[in] cs Chip select line (0..7) that is activated before the first and deactivated
+ * after the last frame; no automatic chip select if negative.
+ * @param[in] tx Pointer to TX data; all-ones are sent if NULL.
+ * @param[in,out] rx Pointer to RX buffer; RX data is discarded if NULL.
+ * @param[in] len Number of bytes to transfer (multiple of the frame size).
+ * @return Number of transferred bytes, -1 if invalid length.
+ **************************************************************************/
+int neorv32_spi_rw_cs(int cs, const void *tx, void *rx, int len) {
+
+  if ((NEORV32_SPI->CTRL & (1 << SPI_CTRL_XFER)) == 0) {
+    return __neorv32_spi_rw_sw(cs, tx, rx, len);
+  }
+
+  uint32_t size = __neorv32_spi_frame_size();
+  int num = __neorv32_spi_xfer_start(cs, tx, rx, len, size);
+  if (num <= 0) {
+    return num;
+  }
+
+  const uint8_t *txd = (const uint8_t*)tx;
+  uint8_t *rxd = (uint8_t*)rx;
+  int tx_cnt = (tx == NULL) ? num : 0; // receive-only: frames are generated by the hardware
+  int rx_cnt = (rx == NULL) ? num : 0; // transmit-only: RX data is discarded by the hardware
+  uint32_t tmp;
+
+  while ((tx_cnt < num) || (rx_cnt < num)) {
+    // fill TX FIFO
+    while ((tx_cnt < num) && ((NEORV32_SPI->CTRL & (1 << SPI_CTRL_TX_FULL)) == 0)) {
+      if (size == 1) {
+        tmp = (uint32_t)(*txd);
+      }
+      else if (size == 2) {
+        tmp = (uint32_t)(*(const uint16_t*)txd);
+      }
+      else {
+        tmp = *(const uint32_t*)txd;
+      }
+      NEORV32_SPI->DATA = tmp;
+      txd += size;
+      tx_cnt++;
+    }
+    // drain RX FIFO
+    while ((rx_cnt < num) && (NEORV32_SPI->CTRL & (1 << SPI_CTRL_RX_AVAIL))) {
+      tmp = NEORV32_SPI->DATA;
+      if (size == 1) {
+        *rxd = (uint8_t)tmp;
+      }
+      else if (size == 2) {
+        *(uint16_t*)rxd = (uint16_t)tmp;
+      }
+      else {
+        *(uint32_t*)rxd = tmp;
+      }
+      rxd += size;
+      rx_cnt++;
+    }
+  }
+
+  while (NEORV32_SPI->XFER & (1 << SPI_XFER_BUSY)); // wait for last frame and chip select release
+  return len;
+}
+
+
+/**********************************************************************//**
+ * Start bulk data transfer using the DMA controller. The DMA is paced by the SPI's
+ * DMA request (TX FIFO not full for transmit-only, RX FIFO data available otherwise).
+ *
+ * @note This function is non-blocking; use #neorv32_spi_busy to check for completion
+ * (or wait for the SPI interrupt). Only one direction can be handled by the DMA (either
+ * tx or rx has to be NULL) and only 8-bit and 32-bit frames are supported.
+ *
+ * @param[in] cs Chip select line (0..7) that is activated before the first and deactivated
+ * after the last frame; no automatic chip select if negative.
+ * @param[in] tx Pointer to TX data; all-ones are sent if NULL.
+ * @param[in,out] rx Pointer to RX buffer; RX data is discarded if NULL.
+ * @param[in] len Number of bytes to transfer (multiple of the frame size).
+ * @return 0 if transfer was started, -1 if invalid configuration, -2 if DMA or hardware-managed
+ * transfers not available or DMA busy.
+ **************************************************************************/
+int neorv32_spi_rw_dma(int cs, const void *tx, void *rx, int len) {
+
+  if ((NEORV32_SPI->CTRL & (1 << SPI_CTRL_XFER)) == 0) {
+    return -2;
+  }
+
+  uint32_t size = __neorv32_spi_frame_size();
+  if ((size == 2) || ((tx != NULL) && (rx != NULL))) {
+    return -1;
+  }
+
+  if ((neorv32_dma_available() == 0) || (neorv32_dma_status() == DMA_STATUS_BUSY) ||
+      (neorv32_dma_descriptor_fifo_empty() == 0)) {
+    return -2;
+  }
+
+  int num = __neorv32_spi_xfer_start(cs, tx, rx, len, size);
+  if (num <= 0) {
+    return num;
+  }
+
+  uint32_t conf = ((uint32_t)num << DMA_CONF_NUM_LSB) | DMA_DREQ_SPI;
+  if (tx != NULL) { // memory -> SPI
+    conf |= (size == 4) ? (DMA_SRC_INC_WORD | DMA_DST_CONST_WORD) : (DMA_SRC_INC_BYTE | DMA_DST_CONST_BYTE);
+    neorv32_dma_enable();
+    neorv32_dma_program((uint32_t)tx, (uint32_t)(&NEORV32_SPI->DATA), conf);
+    neorv32_dma_start();
+  }
+  else if (rx != NULL) { // SPI -> memory
+    conf |= (size == 4) ? (DMA_SRC_CONST_WORD | DMA_DST_INC_WORD) : (DMA_SRC_CONST_BYTE | DMA_DST_INC_BYTE);
+    neorv32_dma_enable();
+    neorv32_dma_program((uint32_t)(&NEORV32_SPI->DATA), (uint32_t)rx, conf);
+    neorv32_dma_start();
+  }
+  return 0;
+}
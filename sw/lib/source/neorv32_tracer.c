@@ -1,7 +1,7 @@
 // ================================================================================ //
 // The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
 // Copyright (c) NEORV32 contributors.                                              //
-// Copyright (c) 2020 - 2025 Stephan Nolting. All rights reserved.                  //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
 // Licensed under the BSD-3-Clause license, see LICENSE for details.                //
 // SPDX-License-Identifier: BSD-3-Clause                                            //
 // ================================================================================ //
@@ -118,3 +118,106 @@ uint32_t neorv32_tracer_data_get_dst(void) {
 
   return NEORV32_TRACER->DELTA_DST;
 }
+
+
+/**********************************************************************//**
+ * Reset, enable and configure trace module for compressed tracing.
+ *
+ * @note In compressed mode the trace is encoded as branch maps and addresses of
+ * uninferable control flow changes only. Trace data is read as a continuous word
+ * stream (#neorv32_tracer_stream_get or DMA) and decoded on the host using the
+ * program's ELF file (sw/image_gen/trace_decode.py).
+ *
+ * @param[in] hsel Hart ID of the CPU that is traced (0/1).
+ * @param[in] stop_addr Stop tracing at this address. Use -1 to disable auto-stopping.
+ **************************************************************************/
+void neorv32_tracer_stream_enable(int hsel, uint32_t stop_addr) {
+
+  NEORV32_TRACER->CTRL = 0; // reset
+
+  NEORV32_TRACER->STOP_ADDR = stop_addr;
+
+  uint32_t tmp = 0;
+  tmp |= (uint32_t)(1           << TRACER_CTRL_EN);
+  tmp |= (uint32_t)((hsel & 1)) << TRACER_CTRL_HSEL;
+  tmp |= (uint32_t)(1           << TRACER_CTRL_CMODE);
+  NEORV32_TRACER->CTRL = tmp;
+}
+
+
+/**********************************************************************//**
+ * Check if compressed trace data was lost due to a trace buffer overflow.
+ *
+ * @return Non-zero if data was lost, zero if the stream is complete.
+ **************************************************************************/
+int neorv32_tracer_stream_lost(void) {
+
+  return (int)(NEORV32_TRACER->CTRL & (1 << TRACER_CTRL_LOST));
+}
+
+
+/**********************************************************************//**
+ * Get next word of the compressed trace stream.
+ * @important Check if data is available before with #neorv32_tracer_data_avail().
+ * Each packet consists of two words, so always read words in pairs.
+ *
+ * @return Next trace stream word (zero if no data available).
+ **************************************************************************/
+uint32_t neorv32_tracer_stream_get(void) {
+
+  return NEORV32_TRACER->DELTA_SRC;
+}
+
+
+/**********************************************************************//**
+ * Stream compressed trace data into a memory buffer using the DMA.
+ *
+ * @note The DMA waits for the tracer's DMA request before each word so the trace
+ * buffer is drained as soon as data becomes available. The DMA has to be enabled before.
+ *
+ * @warning This is a single transfer: it completes when the buffer is full (at most
+ * 2^24-1 words) and further trace packets stay in the tracer's buffer. For continuous
+ * streaming call this function again (e.g. for a second buffer) from the DMA interrupt.
+ *
+ * @param[in] buffer Pointer to word-aligned destination buffer.
+ * @param[in] num Buffer size in words (should be even, 1..2^24-1).
+ * @return 0 if the transfer was started, -4 if num is out of range, other non-zero
+ * values if the DMA descriptor FIFO is full.
+ **************************************************************************/
+int neorv32_tracer_stream_dma(uint32_t *buffer, uint32_t num) {
+
+  if ((num == 0) || (num > 0xffffffU)) {
+    return -4;
+  }
+
+  int rc = neorv32_dma_program((uint32_t)(&NEORV32_TRACER->DELTA_SRC), (uint32_t)buffer,
+                               DMA_SRC_CONST_WORD | DMA_DST_INC_WORD | DMA_DREQ_TRACER | num);
+  if (rc == 0) {
+    neorv32_dma_start();
+  }
+  return rc;
+}
+
+
+/**********************************************************************//**
+ * Print compressed trace data for the host decoder (sw/image_gen/trace_decode.py).
+ *
+ * @note Trailing empty (zero) packets of the buffer are skipped.
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ * @param[in] buffer Pointer to trace stream data.
+ * @param[in] num Number of words in buffer.
+ **************************************************************************/
+void neorv32_tracer_stream_dump(neorv32_uart_t *UARTx, const uint32_t *buffer, uint32_t num) {
+
+  uint32_t i;
+
+  neorv32_uart_printf(UARTx, "neorv32_trace begin\n");
+  for (i=0; (i+1)<num; i+=2) {
+    if ((buffer[i] == 0) && (buffer[i+1] == 0)) {
+      continue;
+    }
+    neorv32_uart_printf(UARTx, "neorv32_trace %x %x\n", buffer[i], buffer[i+1]);
+  }
+  neorv32_uart_printf(UARTx, "neorv32_trace end\n");
+}
@@ -14,7 +14,6 @@
 #include <neorv32.h>
 #include <string.h>
 #include <stdarg.h>
-#include <ctype.h>
 
 
 /**********************************************************************//**
@@ -27,6 +26,29 @@
 /**@}*/
 
 
+/**********************************************************************//**
+ * Buffered-mode state (one per UART).
+ **************************************************************************/
+typedef struct {
+  uint8_t *tx_buf;              // TX ring buffer; NULL if buffered mode is disabled
+  uint8_t *rx_buf;              // RX ring buffer
+  uint32_t tx_mask;             // TX ring buffer size - 1
+  uint32_t rx_mask;             // RX ring buffer size - 1
+  volatile uint32_t tx_head;    // TX read index (ISR)
+  volatile uint32_t tx_tail;    // TX write index (application)
+  volatile uint32_t rx_head;    // RX read index (application)
+  volatile uint32_t rx_tail;    // RX write index (ISR)
+  uint32_t fifo_depth;          // hardware TX FIFO depth
+  neorv32_uart_stats_t stats;   // statistics
+} __neorv32_uart_buf_t;
+
+static __neorv32_uart_buf_t __neorv32_uart_buf[2];
+
+static __neorv32_uart_buf_t *__neorv32_uart_get_buf(neorv32_uart_t *UARTx);
+static void __neorv32_uart_buf_tx(neorv32_uart_t *UARTx, __neorv32_uart_buf_t *b);
+static void __neorv32_uart_buf_kick(neorv32_uart_t *UARTx, __neorv32_uart_buf_t *b);
+
+
 /**********************************************************************//**
  * Check if UART unit was synthesized.
  *
@@ -50,43 +72,56 @@ int neorv32_uart_available(neorv32_uart_t *UARTx) {
 /**********************************************************************//**
  * Reset, configure and enable UART.
  *
+ * @note The baud rate is generated by the fractional baud rate generator using the
+ * highest possible oversampling ratio (up to 16 samples per bit). The RX timeout is
+ * set to 4 character times.
+ * @note If buffered mode is enabled (#neorv32_uart_buffered_setup) it stays enabled;
+ * the interrupts it requires are enabled in addition to irq_mask.
+ *
  * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
  * @param[in] baudrate Targeted BAUD rate (e.g. 19200).
  * @param[in] irq_mask Interrupt configuration bit mask (CTRL's irq_* bits).
  **************************************************************************/
 void neorv32_uart_setup(neorv32_uart_t *UARTx, uint32_t baudrate, uint32_t irq_mask) {
 
-  uint32_t prsc_sel = 0;
-  uint32_t baud_div = 0;
+  uint32_t osr = 16; // samples per bit
+  uint32_t div = 0;  // clock cycles per sample (fixed point, 4 fractional bits)
 
   // reset
   UARTx->CTRL = 0;
 
-  // raw clock prescaler
   uint32_t clock = neorv32_sysinfo_get_clk(); // system clock in Hz
 #ifndef MAKE_BOOTLOADER // use div instructions / library functions
-  baud_div = clock / (2*baudrate);
-#else // division via repeated subtraction (minimal size, only for bootloader)
-  while (clock >= 2*baudrate) {
-    clock -= 2*baudrate;
-    baud_div++;
+  // reduce oversampling ratio for very high baud rates (at least one clock cycle per sample)
+  while ((osr > 2) && ((clock / osr) < baudrate)) {
+    osr--;
+  }
+  uint32_t sps = baudrate * osr; // samples per second
+  div = ((clock / sps) << 4) + ((((clock % sps) << 4) + (sps >> 1)) / sps);
+#else // division via repeated subtraction (minimal size, only for bootloader); div = clock / baudrate for osr = 16
+  clock += baudrate >> 1; // round to nearest
+  while (clock >= baudrate) {
+    clock -= baudrate;
+    div++;
   }
 #endif
 
-  // find baud prescaler (10-bit wide))
-  while (baud_div >= 0x3ffU) {
-    if ((prsc_sel == 2) || (prsc_sel == 4))
-      baud_div >>= 3;
-    else
-      baud_div >>= 1;
-    prsc_sel++;
+  // saturate divider (16.4 bits)
+  if (div < (1 << 4)) {
+    div = 1 << 4;
+  }
+  if (div > 0xfffffU) {
+    div = 0xfffffU;
   }
 
+  UARTx->BAUD = (div << UART_BAUD_FRAC_LSB) |
+                ((osr - 1) << UART_BAUD_OSR_LSB) |
+                (3U << UART_BAUD_RTO_LSB) |
+                (1U << UART_BAUD_FEN);
+
   uint32_t tmp = 0;
-  tmp |= (uint32_t)(1              & 1U)     << UART_CTRL_EN;
-  tmp |= (uint32_t)(prsc_sel       & 3U)     << UART_CTRL_PRSC_LSB;
-  tmp |= (uint32_t)((baud_div - 1) & 0x3ffU) << UART_CTRL_BAUD_LSB;
-  tmp |= (uint32_t)(irq_mask       & (0xfu   << UART_CTRL_IRQ_RX_NEMPTY));
+  tmp |= (uint32_t)(1        & 1U) << UART_CTRL_EN;
+  tmp |= (uint32_t)(irq_mask & ((0xfu << UART_CTRL_IRQ_RX_NEMPTY) | (1U << UART_CTRL_IRQ_RX_TOUT)));
 
 #ifdef UART0_SIM_MODE
 #warning UART0_SIM_MODE (primary UART) enabled! \
@@ -106,10 +141,43 @@ Use this for simulation only!
   }
 #endif
 
+  // keep buffered mode operational: it relies on the RX interrupt and on the TX
+  // interrupt as long as there is data left in the TX ring buffer
+  __neorv32_uart_buf_t *b = __neorv32_uart_get_buf(UARTx);
+  if (b) {
+    tmp |= 1U << UART_CTRL_IRQ_RX_NEMPTY;
+    if (b->tx_tail != b->tx_head) {
+      tmp |= 1U << UART_CTRL_IRQ_TX_EMPTY;
+    }
+  }
+
   UARTx->CTRL = tmp;
 }
 
 
+/**********************************************************************//**
+ * Configure RX timeout. The timeout (#UART_CTRL_RX_TOUT flag / interrupt) is
+ * raised if the RX FIFO is not empty and there was no reception and no FIFO read
+ * for the configured time.
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ * @param[in] chars Timeout in character times (1..16).
+ **************************************************************************/
+void neorv32_uart_set_rx_timeout(neorv32_uart_t *UARTx, int chars) {
+
+  if (chars < 1) {
+    chars = 1;
+  }
+  if (chars > 16) {
+    chars = 16;
+  }
+
+  uint32_t tmp = UARTx->BAUD & ~(0xfU << UART_BAUD_RTO_LSB);
+  tmp |= ((uint32_t)(chars - 1) & 0xfU) << UART_BAUD_RTO_LSB;
+  UARTx->BAUD = tmp;
+}
+
+
 /**********************************************************************//**
  * Get UART RX FIFO depth.
  *
@@ -192,6 +260,24 @@ void neorv32_uart_rtscts_disable(neorv32_uart_t *UARTx) {
  **************************************************************************/
 void neorv32_uart_putc(neorv32_uart_t *UARTx, char c) {
 
+  __neorv32_uart_buf_t *b = __neorv32_uart_get_buf(UARTx);
+
+  // buffered mode: wait for free space in TX ring buffer
+  if (b) {
+    if ((b->tx_tail - b->tx_head) > b->tx_mask) {
+      b->stats.tx_stalls++;
+      while ((b->tx_tail - b->tx_head) > b->tx_mask) {
+        if ((neorv32_cpu_csr_read(CSR_MSTATUS) & (1 << CSR_MSTATUS_MIE)) == 0) {
+          __neorv32_uart_buf_tx(UARTx, b); // interrupts disabled: drain ring buffer by polling
+        }
+      }
+    }
+    b->tx_buf[b->tx_tail & b->tx_mask] = (uint8_t)c;
+    b->tx_tail++;
+    __neorv32_uart_buf_kick(UARTx, b);
+    return;
+  }
+
   while ((UARTx->CTRL & (1<<UART_CTRL_TX_NFULL)) == 0); // wait for free space in TX FIFO
   neorv32_uart_tx_put(UARTx, c);
 }
@@ -200,11 +286,17 @@ void neorv32_uart_putc(neorv32_uart_t *UARTx, char c) {
 /**********************************************************************//**
  * Check if UART TX is busy (transmitter busy or data left in TX buffer).
  *
+ * @note In buffered mode this also includes data left in the TX ring buffer.
+ *
  * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
  * @return 0 if idle, non-zero if busy
  **************************************************************************/
 int neorv32_uart_tx_busy(neorv32_uart_t *UARTx) {
 
+  __neorv32_uart_buf_t *b = __neorv32_uart_get_buf(UARTx);
+  if ((b) && (b->tx_tail != b->tx_head)) {
+    return 1;
+  }
   return (int)(UARTx->CTRL & (1 << UART_CTRL_TX_BUSY));
 }
 
@@ -266,6 +358,10 @@ int neorv32_uart_char_received(neorv32_uart_t *UARTx) {
 #ifdef UART_SEMIHOSTING
   return 1;
 #else
+  __neorv32_uart_buf_t *b = __neorv32_uart_get_buf(UARTx);
+  if (b) {
+    return (int)(b->rx_tail != b->rx_head);
+  }
   return (int)(UARTx->CTRL & (1<<UART_CTRL_RX_NEMPTY));
 #endif
 }
@@ -285,6 +381,15 @@ char neorv32_uart_char_received_get(neorv32_uart_t *UARTx) {
 #ifdef UART_SEMIHOSTING
   return neorv32_semihosting_getc();
 #else
+  __neorv32_uart_buf_t *b = __neorv32_uart_get_buf(UARTx);
+  if (b) {
+    char c = 0;
+    if (b->rx_tail != b->rx_head) {
+      c = (char)b->rx_buf[b->rx_head & b->rx_mask];
+      b->rx_head++;
+    }
+    return c;
+  }
   return (char)(UARTx->DATA >> UART_DATA_RTX_LSB);
 #endif
 }
@@ -315,10 +420,66 @@ void neorv32_uart_puts(neorv32_uart_t *UARTx, const char *s) {
 }
 
 
+/**********************************************************************//**
+ * Send data block via UART (blocking).
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ * @param[in] s Pointer to data.
+ * @param[in] len Number of bytes to send.
+ **************************************************************************/
+static void __neorv32_uart_send(neorv32_uart_t *UARTx, const char *s, int len) {
+
+  while (len > 0) {
+    int n = neorv32_uart_write(UARTx, s, len);
+    if (n == 0) { // no space left: wait for a single free entry
+      neorv32_uart_putc(UARTx, *s);
+      n = 1;
+    }
+    s += n;
+    len -= n;
+  }
+}
+
+
+/**********************************************************************//**
+ * Output sink flush function for neorv32_uart_vprintf: send buffered chunk
+ * and convert "\n" line breaks to "\r\n".
+ *
+ * @param[in,out] sink Output sink; context is the UART handle.
+ **************************************************************************/
+static void __neorv32_uart_vprintf_flush(neorv32_aux_sink_t *sink) {
+
+  neorv32_uart_t *UARTx = (neorv32_uart_t*)sink->ctx;
+  char *run = sink->buf;
+  char *end = sink->buf + sink->pos;
+
+#ifdef UART_SEMIHOSTING
+  (void)UARTx;
+  (void)run;
+  *end = '\0'; // buffer provides space for the termination
+  neorv32_semihosting_puts(sink->buf);
+#else
+  char *p = NULL;
+  for (p=run; p<end; p++) {
+    if (*p == '\n') {
+      __neorv32_uart_send(UARTx, run, (int)(p - run));
+      __neorv32_uart_send(UARTx, "\r\n", 2);
+      run = p + 1;
+    }
+  }
+  __neorv32_uart_send(UARTx, run, (int)(end - run));
+#endif
+  sink->pos = 0;
+}
+
+
 /**********************************************************************//**
  * Custom version of 'vprintf' printing to UART.
  *
- * @warning: This functions only provides a minimal subset of the 'vprintf' formating features!
+ * The output is rendered in a single pass into a small stack buffer which is
+ * sent as a block whenever it is full (see neorv32_aux_vformat for the
+ * supported formatting features).
+ *
  * @warning "/n" line breaks are automatically converted to "/r/n".
  * @note This function is blocking.
  *
@@ -328,79 +489,24 @@ void neorv32_uart_puts(neorv32_uart_t *UARTx, const char *s) {
  **************************************************************************/
 void neorv32_uart_vprintf(neorv32_uart_t *UARTx, const char *format, va_list args) {
 
-  char c = 0;
-  char string_buf[36];
-  int32_t n = 0;
-  unsigned int i = 0;
-
-  // prevent uninitialized stack bytes
-  for (i=0; i<sizeof(string_buf); i++) {
-    string_buf[i] = 0;
-  }
-
-  while ((c = *format++)) {
-    if (c == '%') {
-      c = tolower(*format++);
-      switch (c) {
-
-        case 's': // string
-          neorv32_uart_puts(UARTx, va_arg(args, char*));
-          break;
-
-        case 'c': // char
-          neorv32_uart_putc(UARTx, (char)va_arg(args, int));
-          break;
-
-        case 'i': // 32-bit signed
-        case 'd':
-          n = (int32_t)va_arg(args, int32_t);
-          if (n < 0) {
-            n = -n;
-            neorv32_uart_putc(UARTx, '-');
-          }
-          neorv32_aux_itoa(string_buf, (uint32_t)n, 10);
-          neorv32_uart_puts(UARTx, string_buf);
-          break;
-
-        case 'u': // 32-bit unsigned
-          neorv32_aux_itoa(string_buf, va_arg(args, uint32_t), 10);
-          neorv32_uart_puts(UARTx, string_buf);
-          break;
-
-        case 'x': // 32-bit hexadecimal with leading zeros
-        case 'p':
-          neorv32_aux_itoa(string_buf, va_arg(args, uint32_t), 16);
-          i = 8 - strlen(string_buf);
-          while (i--) { // add leading zeros
-            neorv32_uart_putc(UARTx, '0');
-          }
-          neorv32_uart_puts(UARTx, string_buf);
-          break;
-
-        case '%': // escaped percent sign
-          neorv32_uart_putc(UARTx, c);
-          break;
-
-        default: // unsupported formatting character
-          neorv32_uart_putc(UARTx, '%');
-          neorv32_uart_putc(UARTx, c);
-          break;
-      }
-    }
-    else {
-      if (c == '\n') {
-        neorv32_uart_putc(UARTx, '\r');
-      }
-      neorv32_uart_putc(UARTx, c);
-    }
-  }
+  char buf[64+1];
+  neorv32_aux_sink_t sink = {
+    .buf   = buf,
+    .size  = sizeof(buf) - 1,
+    .pos   = 0,
+    .total = 0,
+    .flush = __neorv32_uart_vprintf_flush,
+    .ctx   = (void*)UARTx
+  };
+
+  neorv32_aux_vformat(&sink, format, args);
+  __neorv32_uart_vprintf_flush(&sink);
 }
 
 
 /**********************************************************************//**
  * Custom version of 'printf' printing to UART.
  *
- * @warning: This functions only provides a minimal subset of the 'printf' formatting features!
  * @note This function is blocking.
  *
  * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
@@ -457,3 +563,334 @@ int neorv32_uart_scan(neorv32_uart_t *UARTx, char *buffer, int max_size, int ech
 
   return length;
 }
+
+
+// #################################################################################################
+// Bulk transfers and interrupt-driven buffered mode
+// #################################################################################################
+
+
+/**********************************************************************//**
+ * Send data block (non-blocking).
+ *
+ * @note In buffered mode the data is copied to the TX ring buffer. Otherwise the data is
+ * written directly to the TX FIFO; if the FIFO is empty a complete FIFO's worth of data is
+ * written without checking the FIFO status for each byte.
+ * @note No "\n" to "\r\n" conversion is performed.
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ * @param[in] buf Pointer to data.
+ * @param[in] len Number of bytes to send.
+ * @return Number of bytes actually accepted (0..len).
+ **************************************************************************/
+int neorv32_uart_write(neorv32_uart_t *UARTx, const void *buf, int len) {
+
+  const uint8_t *src = (const uint8_t*)buf;
+  int cnt = 0;
+  __neorv32_uart_buf_t *b = __neorv32_uart_get_buf(UARTx);
+
+  if (b) { // buffered mode
+    uint32_t tail = b->tx_tail;
+    uint32_t free = b->tx_mask + 1 - (tail - b->tx_head);
+    while ((cnt < len) && (free != 0)) {
+      b->tx_buf[tail & b->tx_mask] = src[cnt++];
+      tail++;
+      free--;
+    }
+    b->tx_tail = tail;
+    __neorv32_uart_buf_kick(UARTx, b);
+    return cnt;
+  }
+
+  // direct mode
+  int depth = neorv32_uart_get_tx_fifo_depth(UARTx);
+  while (cnt < len) {
+    uint32_t ctrl = UARTx->CTRL;
+    int n = 0;
+    if (ctrl & (1 << UART_CTRL_TX_EMPTY)) {
+      n = depth; // whole FIFO is free
+    }
+    else if (ctrl & (1 << UART_CTRL_TX_NFULL)) {
+      n = 1;
+    }
+    else {
+      break; // FIFO full
+    }
+    while ((n--) && (cnt < len)) {
+      neorv32_uart_tx_put(UARTx, (char)src[cnt++]);
+    }
+  }
+  return cnt;
+}
+
+
+/**********************************************************************//**
+ * Receive data block (non-blocking).
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ * @param[in,out] buf Pointer to data buffer.
+ * @param[in] len Maximum number of bytes to read.
+ * @return Number of bytes actually read (0..len).
+ **************************************************************************/
+int neorv32_uart_read(neorv32_uart_t *UARTx, void *buf, int len) {
+
+  uint8_t *dst = (uint8_t*)buf;
+  int cnt = 0;
+  __neorv32_uart_buf_t *b = __neorv32_uart_get_buf(UARTx);
+
+  if (b) { // buffered mode
+    uint32_t head = b->rx_head;
+    uint32_t tail = b->rx_tail;
+    while ((cnt < len) && (head != tail)) {
+      dst[cnt++] = b->rx_buf[head & b->rx_mask];
+      head++;
+    }
+    b->rx_head = head;
+    return cnt;
+  }
+
+  // direct mode
+  while ((cnt < len) && (UARTx->CTRL & (1 << UART_CTRL_RX_NEMPTY))) {
+    dst[cnt++] = (uint8_t)(UARTx->DATA >> UART_DATA_RTX_LSB);
+  }
+  return cnt;
+}
+
+
+/**********************************************************************//**
+ * Wait until all data has been sent (TX ring buffer, TX FIFO and transmitter are empty).
+ *
+ * @note This function is blocking.
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ **************************************************************************/
+void neorv32_uart_flush(neorv32_uart_t *UARTx) {
+
+  __neorv32_uart_buf_t *b = __neorv32_uart_get_buf(UARTx);
+  if (b) {
+    while (b->tx_tail != b->tx_head) {
+      if ((neorv32_cpu_csr_read(CSR_MSTATUS) & (1 << CSR_MSTATUS_MIE)) == 0) {
+        __neorv32_uart_buf_tx(UARTx, b); // interrupts disabled: drain ring buffer by polling
+      }
+    }
+  }
+  while (UARTx->CTRL & (1 << UART_CTRL_TX_BUSY));
+}
+
+
+/**********************************************************************//**
+ * Get buffered-mode state of a UART.
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ * @return Pointer to state; NULL if buffered mode is not enabled.
+ **************************************************************************/
+static __neorv32_uart_buf_t *__neorv32_uart_get_buf(neorv32_uart_t *UARTx) {
+
+#ifndef MAKE_BOOTLOADER
+  __neorv32_uart_buf_t *b = &__neorv32_uart_buf[(UARTx == NEORV32_UART1) ? 1 : 0];
+  return (b->tx_buf) ? b : NULL;
+#else // no buffered mode in the bootloader: keep the state out of its tiny RAM
+  (void)UARTx;
+  return NULL;
+#endif
+}
+
+
+/**********************************************************************//**
+ * Move data from the TX ring buffer to the TX FIFO. Disables the TX interrupt
+ * when the ring buffer is empty.
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ * @param[in,out] b Buffered-mode state.
+ **************************************************************************/
+static void __neorv32_uart_buf_tx(neorv32_uart_t *UARTx, __neorv32_uart_buf_t *b) {
+
+  uint32_t head = b->tx_head;
+  uint32_t tail = b->tx_tail;
+  uint32_t ctrl = UARTx->CTRL;
+
+  // fill the complete FIFO if it is empty; otherwise just a single byte if there is space left
+  uint32_t n = 0;
+  if (ctrl & (1 << UART_CTRL_TX_EMPTY)) {
+    n = b->fifo_depth;
+  }
+  else if (ctrl & (1 << UART_CTRL_TX_NFULL)) {
+    n = 1;
+  }
+  while ((n--) && (head != tail)) {
+    neorv32_uart_tx_put(UARTx, (char)b->tx_buf[head & b->tx_mask]);
+    head++;
+    b->stats.tx_bytes++;
+  }
+  b->tx_head = head;
+
+  if (head == tail) { // nothing left to send
+    UARTx->CTRL &= ~(1 << UART_CTRL_IRQ_TX_EMPTY);
+  }
+}
+
+
+/**********************************************************************//**
+ * Start interrupt-driven transmission of the TX ring buffer.
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ * @param[in,out] b Buffered-mode state.
+ **************************************************************************/
+static void __neorv32_uart_buf_kick(neorv32_uart_t *UARTx, __neorv32_uart_buf_t *b) {
+
+  (void)b;
+  UARTx->CTRL |= 1 << UART_CTRL_IRQ_TX_EMPTY; // IRQ fires as soon as the TX FIFO is empty
+}
+
+
+/**********************************************************************//**
+ * UART buffered-mode interrupt service routine (common part).
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ * @param[in,out] b Buffered-mode state.
+ **************************************************************************/
+static void __neorv32_uart_buf_isr(neorv32_uart_t *UARTx, __neorv32_uart_buf_t *b) {
+
+  asm volatile ("fence" : : : "memory"); // reload data cache: TX data might have been written by another hart
+
+  // RX: move all received data to the RX ring buffer
+  uint32_t tail = b->rx_tail;
+  while (UARTx->CTRL & (1 << UART_CTRL_RX_NEMPTY)) {
+    uint8_t d = (uint8_t)(UARTx->DATA >> UART_DATA_RTX_LSB);
+    if ((tail - b->rx_head) <= b->rx_mask) {
+      b->rx_buf[tail & b->rx_mask] = d;
+      tail++;
+      b->stats.rx_bytes++;
+    }
+    else {
+      b->stats.rx_dropped++;
+    }
+  }
+  b->rx_tail = tail;
+  b->stats.rx_overrun = (UARTx->CTRL >> UART_CTRL_RX_OVER) & 1;
+
+  // TX: refill FIFO
+  if (UARTx->CTRL & (1 << UART_CTRL_IRQ_TX_EMPTY)) {
+    __neorv32_uart_buf_tx(UARTx, b);
+  }
+}
+
+
+/**********************************************************************//**
+ * UART0 buffered-mode interrupt handler.
+ **************************************************************************/
+static void __neorv32_uart0_buf_irq_handler(void) {
+
+  __neorv32_uart_buf_isr(NEORV32_UART0, &__neorv32_uart_buf[0]);
+}
+
+
+/**********************************************************************//**
+ * UART1 buffered-mode interrupt handler.
+ **************************************************************************/
+static void __neorv32_uart1_buf_irq_handler(void) {
+
+  __neorv32_uart_buf_isr(NEORV32_UART1, &__neorv32_uart_buf[1]);
+}
+
+
+/**********************************************************************//**
+ * Enable interrupt-driven buffered mode. All TX data (including putc, puts and printf)
+ * is copied to a software TX ring buffer that is emptied by the UART interrupt; all RX
+ * data is moved to a software RX ring buffer by the UART interrupt.
+ *
+ * @note The UART has to be configured via #neorv32_uart_setup before. The NEORV32 runtime
+ * environment (RTE) has to be initialized before (#neorv32_rte_setup) and machine-mode
+ * interrupts have to be enabled globally by the application (mstatus.MIE). If interrupts
+ * are disabled, blocking TX functions drain the TX ring buffer by polling.
+ * @note The buffered mode is intended for single-core operation (or for UARTs that are
+ * used by a single hart only). Other harts may only write to the TX ring buffer if their
+ * writes are serialized (like newlib's STDOUT/STDERR writes); the interrupt is handled
+ * by the hart that called this function.
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ * @param[in,out] tx_buf TX ring buffer memory.
+ * @param[in] tx_size Size of the TX ring buffer in bytes; has to be a power of two.
+ * @param[in,out] rx_buf RX ring buffer memory.
+ * @param[in] rx_size Size of the RX ring buffer in bytes; has to be a power of two.
+ * @return 0 if success, -1 if invalid arguments.
+ **************************************************************************/
+int neorv32_uart_buffered_setup(neorv32_uart_t *UARTx, uint8_t *tx_buf, uint32_t tx_size, uint8_t *rx_buf, uint32_t rx_size) {
+
+  if ((tx_buf == NULL) || (rx_buf == NULL) ||
+      (tx_size < 2) || (tx_size & (tx_size - 1)) ||
+      (rx_size < 2) || (rx_size & (rx_size - 1))) {
+    return -1;
+  }
+
+  int idx = (UARTx == NEORV32_UART1) ? 1 : 0;
+  __neorv32_uart_buf_t *b = &__neorv32_uart_buf[idx];
+
+  neorv32_uart_buffered_disable(UARTx);
+
+  memset((void*)b, 0, sizeof(__neorv32_uart_buf_t));
+  b->rx_buf     = rx_buf;
+  b->tx_mask    = tx_size - 1;
+  b->rx_mask    = rx_size - 1;
+  b->fifo_depth = (uint32_t)neorv32_uart_get_tx_fifo_depth(UARTx);
+  b->tx_buf     = tx_buf; // buffered mode is active from now on
+
+  // install interrupt handler and enable RX interrupt
+  if (idx == 0) {
+    neorv32_rte_handler_install(UART0_TRAP_CODE, __neorv32_uart0_buf_irq_handler);
+    neorv32_cpu_csr_set(CSR_MIE, 1 << UART0_FIRQ_ENABLE);
+  }
+  else {
+    neorv32_rte_handler_install(UART1_TRAP_CODE, __neorv32_uart1_buf_irq_handler);
+    neorv32_cpu_csr_set(CSR_MIE, 1 << UART1_FIRQ_ENABLE);
+  }
+  UARTx->CTRL |= 1 << UART_CTRL_IRQ_RX_NEMPTY;
+
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Disable interrupt-driven buffered mode. Pending TX data is sent before,
+ * pending RX data is discarded.
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ **************************************************************************/
+void neorv32_uart_buffered_disable(neorv32_uart_t *UARTx) {
+
+  __neorv32_uart_buf_t *b = __neorv32_uart_get_buf(UARTx);
+  if (b == NULL) {
+    return;
+  }
+
+  neorv32_uart_flush(UARTx);
+
+  if (UARTx == NEORV32_UART1) {
+    neorv32_cpu_csr_clr(CSR_MIE, 1 << UART1_FIRQ_ENABLE);
+  }
+  else {
+    neorv32_cpu_csr_clr(CSR_MIE, 1 << UART0_FIRQ_ENABLE);
+  }
+  UARTx->CTRL &= ~((1 << UART_CTRL_IRQ_RX_NEMPTY) | (1 << UART_CTRL_IRQ_TX_EMPTY));
+  b->tx_buf = NULL;
+}
+
+
+/**********************************************************************//**
+ * Get buffered-mode statistics.
+ *
+ * @param[in,out] UARTx Hardware handle to UART register struct, #neorv32_uart_t.
+ * @param[in,out] stats Pointer to statistics structure (#neorv32_uart_stats_t).
+ * @return 0 if success, -1 if buffered mode is not enabled.
+ **************************************************************************/
+int neorv32_uart_get_stats(neorv32_uart_t *UARTx, neorv32_uart_stats_t *stats) {
+
+  __neorv32_uart_buf_t *b = __neorv32_uart_get_buf(UARTx);
+  if (b == NULL) {
+    return -1;
+  }
+
+  *stats = b->stats;
+  stats->rx_overrun |= (UARTx->CTRL >> UART_CTRL_RX_OVER) & 1;
+  return 0;
+}
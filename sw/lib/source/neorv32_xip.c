@@ -0,0 +1,165 @@
+// ================================================================================ //
+// The NEORV32 RISC-V Processor - https://github.com/stnolting/neorv32              //
+// Copyright (c) NEORV32 contributors.                                              //
+// Copyright (c) 2020 - 2026 Stephan Nolting. All rights reserved.                  //
+// Licensed under the BSD-3-Clause license, see LICENSE for details.                //
+// SPDX-License-Identifier: BSD-3-Clause                                            //
+// ================================================================================ //
+
+/**
+ * @file neorv32_xip.c
+ * @brief Execute In-Place Module (XIP) HW driver source file.
+ *
+ * @note The flash contents are accessible via the memory window starting at #NEORV32_XIP_MEM_BASE.
+ */
+
+#include <neorv32.h>
+
+
+/**********************************************************************//**
+ * Check if XIP module was synthesized.
+ *
+ * @return Zero if XIP was not synthesized, non-zero if XIP is available.
+ **************************************************************************/
+int neorv32_xip_available(void) {
+
+  return (int)(NEORV32_SYSINFO->SOC & (1 << SYSINFO_SOC_XIP));
+}
+
+
+/**********************************************************************//**
+ * Enable and configure XIP module. The memory window is disabled (direct mode).
+ *
+ * @param[in] prsc Clock prescaler select (0..7). See #NEORV32_CLOCK_PRSC_enum.
+ * @param[in] cdiv Clock divider (0..15).
+ * @param[in] hspeed Use maximum SPI clock (clk/2) when non-zero (ignores prsc and cdiv).
+ * @param[in] abytes Number of address bytes (1..4).
+ * @param[in] mode Read mode (#NEORV32_XIP_MODE_enum).
+ * @param[in] dummy Number of dummy clock cycles after the address phase (0..31).
+ * @param[in] rdcmd Read command, has to match the selected read mode.
+ **************************************************************************/
+void neorv32_xip_setup(int prsc, int cdiv, int hspeed, int abytes, int mode, int dummy, uint8_t rdcmd) {
+
+  NEORV32_XIP->CTRL = 0; // reset
+
+  uint32_t tmp = 0;
+  tmp |= (uint32_t)(1            & 0x01) << XIP_CTRL_EN;
+  tmp |= (uint32_t)(hspeed       & 0x01) << XIP_CTRL_HSPEED;
+  tmp |= (uint32_t)(prsc         & 0x07) << XIP_CTRL_PRSC0;
+  tmp |= (uint32_t)(cdiv         & 0x0f) << XIP_CTRL_CDIV0;
+  tmp |= (uint32_t)((abytes - 1) & 0x03) << XIP_CTRL_ABYTES0;
+  tmp |= (uint32_t)(mode         & 0x03) << XIP_CTRL_MODE0;
+  tmp |= (uint32_t)(dummy        & 0x1f) << XIP_CTRL_DUMMY0;
+  tmp |= (uint32_t)(rdcmd        & 0xff) << XIP_CTRL_RDCMD0;
+
+  NEORV32_XIP->CTRL = tmp;
+}
+
+
+/**********************************************************************//**
+ * Get configured clock speed in Hz.
+ *
+ * @return Actual configured SPI clock speed in Hz.
+ **************************************************************************/
+uint32_t neorv32_xip_get_clock_speed(void) {
+
+  const uint16_t PRSC_LUT[8] = {2, 4, 8, 64, 128, 1024, 2048, 4096};
+
+  uint32_t ctrl = NEORV32_XIP->CTRL;
+  if (ctrl & (1 << XIP_CTRL_HSPEED)) {
+    return neorv32_sysinfo_get_clk() / 2;
+  }
+
+  uint32_t prsc_sel  = (ctrl >> XIP_CTRL_PRSC0) & 0x7;
+  uint32_t clock_div = (ctrl >> XIP_CTRL_CDIV0) & 0xf;
+
+  uint32_t tmp = 2 * PRSC_LUT[prsc_sel] * (1 + clock_div);
+  return neorv32_sysinfo_get_clk() / tmp;
+}
+
+
+/**********************************************************************//**
+ * Disable XIP module (also disables the memory window).
+ **************************************************************************/
+void neorv32_xip_disable(void) {
+
+  NEORV32_XIP->CTRL &= ~((uint32_t)(1 << XIP_CTRL_EN));
+}
+
+
+/**********************************************************************//**
+ * Enable memory window. The direct mode is no longer available.
+ *
+ * @note The flash has to be configured for the selected read mode (e.g. quad-enable bit) before.
+ * Execute "fence.i" before executing code from a flash that has been modified.
+ **************************************************************************/
+void neorv32_xip_window_enable(void) {
+
+  while (neorv32_xip_busy()); // wait for pending direct mode transfer
+
+  uint32_t tmp = NEORV32_XIP->CTRL;
+  tmp &= ~((uint32_t)(1 << XIP_CTRL_CS));
+  tmp |= (uint32_t)(1 << XIP_CTRL_XIP_EN);
+  NEORV32_XIP->CTRL = tmp;
+}
+
+
+/**********************************************************************//**
+ * Disable memory window and switch to direct mode.
+ *
+ * @warning Code must not be executed from the XIP window when calling this function.
+ **************************************************************************/
+void neorv32_xip_window_disable(void) {
+
+  NEORV32_XIP->CTRL &= ~((uint32_t)(1 << XIP_CTRL_XIP_EN));
+  while (neorv32_xip_busy()); // wait for current read session to terminate
+}
+
+
+/**********************************************************************//**
+ * Assert chip-select (direct mode only).
+ **************************************************************************/
+void neorv32_xip_cs_enable(void) {
+
+  NEORV32_XIP->CTRL |= (uint32_t)(1 << XIP_CTRL_CS);
+}
+
+
+/**********************************************************************//**
+ * Deassert chip-select (direct mode only).
+ **************************************************************************/
+void neorv32_xip_cs_disable(void) {
+
+  while (neorv32_xip_busy()); // wait for pending transfer
+  NEORV32_XIP->CTRL &= ~((uint32_t)(1 << XIP_CTRL_CS));
+}
+
+
+/**********************************************************************//**
+ * Transfer a single byte using the direct mode (single lane; blocking).
+ *
+ * @param[in] tx_data Byte to send.
+ * @return Received byte.
+ **************************************************************************/
+uint8_t neorv32_xip_spi_trans(uint8_t tx_data) {
+
+  NEORV32_XIP->DATA = (uint32_t)tx_data;
+  while (neorv32_xip_busy());
+  return (uint8_t)NEORV32_XIP->DATA;
+}
+
+
+/**********************************************************************//**
+ * Check if XIP PHY is busy.
+ *
+ * @return 0 if idle, 1 if busy.
+ **************************************************************************/
+int neorv32_xip_busy(void) {
+
+  if (NEORV32_XIP->CTRL & (1 << XIP_CTRL_BUSY)) {
+    return 1;
+  }
+  else {
+    return 0;
+  }
+}